@@ -0,0 +1,421 @@
+"""
+코드 생성 파이프라인 벤치마크 / 성능 회귀 게이트 (GUI 없이 실행)
+
+database/*.db(및 행을 N배로 늘린 합성 시트)로 단계별 소요 시간을 측정합니다.
+    db_load       DB 열기 + $ 시트 분류 + 시트 데이터 로드
+    chk_sht_info  MakeCode.ChkShtInfo
+    read_cal_list MakeCode.ReadXlstoCode (CalList.ReadCalList)
+    conv_code     MakeCode.ConvXlstoCode
+    file_write    .c/.h 파일 저장
+    excel_import  excel/*.xlsx 스트리밍 가져오기 (--excel-dir가 있을 때)
+
+결과는 JSON으로 저장되며(--output), 저장된 기준(--baseline)과 단계별로 비교합니다.
+1배 결과는 generated_output/의 파일과 바이트 단위로 비교합니다 ('파일 생성일' 라인과 CR 제외).
+
+사용 예:
+    python benchmark_cli.py                                   # 1배/10배, 기준 비교 (기준 파일이 있으면)
+    python benchmark_cli.py --scales 1,10,100 --repeat 5
+    python benchmark_cli.py --save-baseline                   # 현재 결과를 기준으로 저장
+    python benchmark_cli.py --compare-kernels                 # Cython 커널 vs Python 폴백 비교
+    python benchmark_cli.py --kernel-parity                   # 데이터 처리 커널 결과 일치/속도 확인만 실행
+    python benchmark_cli.py --unit-tests                      # 단위 테스트(<패키지>/tests) 통과 후 벤치마크 실행
+
+단위 테스트만 실행: python -m unittest discover -t . -s <패키지>/tests (패키지: UNIT_TEST_DIRS)
+
+종료 코드: 0 = 통과, 1 = 성능 회귀, 출력 불일치(기준 파일 누락 포함) 또는 단위 테스트 실패, 2 = 입력 없음
+"""
+
+import os
+import sys
+import json
+import glob
+import time
+import shutil
+import logging
+import argparse
+import platform
+import tempfile
+from datetime import datetime
+from typing import Dict, List, Optional
+
+from core.info import Info
+from core.data_parser import DataParser
+from core.sparse_sheet import SparseSheet
+
+STAGES = ("db_load", "chk_sht_info", "read_cal_list", "conv_code", "file_write", "excel_import")
+
+# 기준 대비 이 값(초)보다 작은 차이는 측정 잡음으로 보고 회귀로 판단하지 않음
+MIN_REGRESSION_SECONDS = 0.05
+
+# --unit-tests로 실행하는 단위 테스트 디렉토리 (저장소 루트 기준)
+UNIT_TEST_DIRS = ("core/tests", "code_generator/tests", "data_manager/tests", "ui/tests")
+
+
+def scale_sheet(data, factor: int):
+    """
+    CalList 시트의 항목 행(OpCode 헤더 다음 행부터)을 factor배로 늘린 합성 시트
+    (복제본의 타이틀 이름에는 _<번호>를 붙여 'Title명 중복' 오류를 피함)
+    """
+    if factor <= 1:
+        return data
+    dense = data.to_dense() if isinstance(data, SparseSheet) else [list(row) for row in data]
+
+    header_row = next((r for r, row in enumerate(dense) if any(str(cell).strip() == "OpCode" for cell in row)), None)
+    if header_row is None:
+        return data
+    header = [str(cell).strip() for cell in dense[header_row]]
+    op_col = header.index("OpCode")
+    key_col = header.index("Keyword") if "Keyword" in header else -1
+    title_ops = {op for op, mode in Info.dOpCode.items() if mode.name.startswith("TITLE")}
+
+    body = dense[header_row + 1:]
+    scaled = dense
+    for copy_index in range(1, factor):
+        for row in body:
+            new_row = list(row)
+            if (0 <= key_col < len(new_row) and op_col < len(new_row) and
+                    str(new_row[op_col]).strip() in title_ops and str(new_row[key_col]).strip()):
+                new_row[key_col] = f"{str(new_row[key_col]).strip()}_{copy_index}"
+            scaled.append(new_row)
+    return SparseSheet.from_dense(scaled) if isinstance(data, SparseSheet) else scaled
+
+
+def _normalize(text: str) -> List[str]:
+    """출력 비교용 정규화 (CR 제거, 생성 시각 라인 제외)"""
+    return [line for line in text.replace('\r', '').split('\n') if '파일 생성일' not in line]
+
+
+class StageTimer:
+    """단계별 누적 소요 시간"""
+
+    def __init__(self):
+        self.seconds = {stage: 0.0 for stage in STAGES}
+
+    def measure(self, stage: str, func, *args):
+        start = time.perf_counter()
+        try:
+            return func(*args)
+        finally:
+            self.seconds[stage] += time.perf_counter() - start
+
+
+def run_database(db_file: str, scale: int, output_dir: str, timer: StageTimer) -> Dict:
+    """DB 하나를 단계별로 측정하며 생성 (headless_generator.generate_group과 같은 순서)"""
+    from data_manager.db_handler_v2 import DBHandlerV2
+    from code_generator.make_code import MakeCode
+    from code_generator.headless_generator import (LineBuffer, GeneratedGroup, _GroupSurrogate, classify_dollar_sheets,
+                                                   reset_info_state, resolve_base_name, write_group_files)
+
+    stats = {'groups': 0, 'failed_groups': 0, 'lines': 0, 'errors': 0, 'files': []}
+    db_name = os.path.basename(db_file)
+
+    def load():
+        handler = DBHandlerV2(db_file, read_only=True)
+        try:
+            dollar_sheets = [s for s in handler.get_sheets() if s.get('is_dollar_sheet', False)]
+            groups = []
+            for group_name, group_data in classify_dollar_sheets(dollar_sheets).items():
+                if not group_data["FileInfoSht"] or not group_data["CalListSht"]:
+                    continue
+                file_info = group_data["FileInfoSht"]
+                file_info_sht = DataParser.prepare_sheet_for_existing_code(
+                    file_info['name'], handler.get_sheet_data_for_code_gen(file_info['id']))
+                cal_list_shts = [DataParser.prepare_sheet_for_existing_code(
+                    s['name'], scale_sheet(handler.get_sheet_data_for_code_gen(s['id']), scale))
+                    for s in group_data["CalListSht"]]
+                groups.append((group_name, file_info_sht, cal_list_shts))
+            return groups
+        finally:
+            handler.disconnect()
+
+    for group_name, file_info_sht, cal_list_shts in timer.measure("db_load", load):
+        stats['groups'] += 1
+        reset_info_state()
+        try:
+            lb_src, lb_hdr = LineBuffer(), LineBuffer()
+            make_code = MakeCode(_GroupSurrogate(file_info_sht, cal_list_shts), lb_src, lb_hdr)
+            if timer.measure("chk_sht_info", make_code.ChkShtInfo):
+                stats['failed_groups'] += 1
+                stats['errors'] += len(Info.ErrList)
+                continue
+
+            target_file_name = f"{resolve_base_name(group_name, file_info_sht)}.c"
+            timer.measure("read_cal_list", make_code.ReadXlstoCode)
+            timer.measure("conv_code", make_code.ConvXlstoCode, db_name, target_file_name)
+            if Info.ErrList:
+                stats['failed_groups'] += 1
+                stats['errors'] += len(Info.ErrList)
+                continue
+
+            group = GeneratedGroup(group_name)
+            group.src_file_name = target_file_name
+            group.hdr_file_name = target_file_name[:-2] + ".h"
+            group.src_lines = lb_src.lines()
+            group.hdr_lines = lb_hdr.lines()
+            stats['lines'] += len(group.src_lines) + len(group.hdr_lines)
+            written = timer.measure("file_write", write_group_files, group, output_dir)
+            stats['files'].extend(item['path'] for item in written)
+        except Exception as e:
+            logging.error(f"그룹 '{group_name}' 벤치마크 중 예외: {e}")
+            stats['failed_groups'] += 1
+        finally:
+            reset_info_state()
+
+    return stats
+
+
+def run_excel_import(excel_files: List[str], work_dir: str, timer: StageTimer):
+    """Excel 스트리밍 가져오기 측정 (임시 DB에 기록)"""
+    from data_manager.db_handler_v2 import DBHandlerV2
+    from excel_processor.excel_importer import ExcelImporter
+
+    for index, excel_path in enumerate(excel_files):
+        db_path = os.path.join(work_dir, f"import_{index}.db")
+
+        def import_one():
+            handler = DBHandlerV2(db_path)
+            try:
+                ExcelImporter(handler).import_excel(excel_path, db_path, engine="stream")
+            finally:
+                handler.disconnect()
+
+        try:
+            timer.measure("excel_import", import_one)
+        except Exception as e:
+            logging.error(f"Excel 가져오기 벤치마크 실패 ({os.path.basename(excel_path)}): {e}")
+
+
+def check_outputs(output_root: str, reference_root: str) -> Dict:
+    """1배 생성 결과와 reference_root(generated_output)의 같은 경로 파일 비교"""
+    checked, mismatched, missing = 0, [], []
+    for ref_path in sorted(glob.glob(os.path.join(reference_root, "*", "*.[ch]"))):
+        rel_path = os.path.relpath(ref_path, reference_root)
+        out_path = os.path.join(output_root, rel_path)
+        if not os.path.exists(out_path):
+            missing.append(rel_path)
+            continue
+        checked += 1
+        with open(ref_path, 'r', encoding='utf-8') as ref_file, open(out_path, 'r', encoding='utf-8') as out_file:
+            if _normalize(ref_file.read()) != _normalize(out_file.read()):
+                mismatched.append(rel_path)
+    return {'checked': checked, 'mismatched': mismatched, 'missing': missing}
+
+
+def run_suite(db_files: List[str], excel_files: List[str], scales: List[int], repeat: int, work_dir: str) -> Dict:
+    """스케일별 단계 시간 측정 (반복 중 최솟값 사용)"""
+    results = {}
+    for scale in scales:
+        best: Optional[Dict[str, float]] = None
+        stats_total = {}
+        for _ in range(repeat):
+            timer = StageTimer()
+            stats_total = {'groups': 0, 'failed_groups': 0, 'lines': 0, 'errors': 0}
+            run_root = os.path.join(work_dir, f"out_{scale}x")
+            shutil.rmtree(run_root, ignore_errors=True)
+
+            for db_file in db_files:
+                output_dir = os.path.join(run_root, os.path.splitext(os.path.basename(db_file))[0])
+                os.makedirs(output_dir, exist_ok=True)
+                stats = run_database(db_file, scale, output_dir, timer)
+                for key in stats_total:
+                    stats_total[key] += stats[key]
+
+            if scale == 1 and excel_files:
+                run_excel_import(excel_files, work_dir, timer)
+
+            if best is None:
+                best = dict(timer.seconds)
+            else:
+                best = {stage: min(best[stage], timer.seconds[stage]) for stage in STAGES}
+
+        best = {stage: round(value, 4) for stage, value in best.items()}
+        results[f"{scale}x"] = dict(stats_total, stages=best, total=round(sum(best.values()), 4))
+        print(f"  {scale:>4}x  total {results[f'{scale}x']['total']:8.3f}s  " +
+              "  ".join(f"{stage}={best[stage]:.3f}" for stage in STAGES if best[stage]), flush=True)
+    return results
+
+
+def compare_with_baseline(current: Dict, baseline: Dict, tolerance: float) -> List[str]:
+    """단계별로 기준 대비 (1 + tolerance)배를 넘게 느려진 항목 목록"""
+    regressions = []
+    for scale_key, result in current.get('results', {}).items():
+        base_result = baseline.get('results', {}).get(scale_key)
+        if not base_result:
+            continue
+        for stage, seconds in result['stages'].items():
+            base_seconds = base_result['stages'].get(stage, 0.0)
+            if seconds - base_seconds > max(base_seconds * tolerance, MIN_REGRESSION_SECONDS):
+                regressions.append(f"{scale_key} {stage}: {base_seconds:.3f}s → {seconds:.3f}s")
+    return regressions
+
+
+def run_kernel_parity(repeat: int) -> int:
+    """데이터 처리 커널 일치/속도 확인 (불일치 또는 Cython이 폴백보다 느리면 실패)"""
+    from core.data_kernels import check_kernel_parity
+
+    failed = False
+    compared = 0
+    print("🚀 데이터 처리 커널 Cython/폴백 비교")
+    for entry in check_kernel_parity(repeat=repeat):
+        if not entry['native']:
+            print(f"  - {entry['kernel']}: Cython 없음 (폴백 {entry['fallback_ms']:.2f}ms)")
+            continue
+        if not entry['match']:
+            failed = True
+            print(f"  ❌ {entry['kernel']}: 결과 불일치")
+            continue
+        compared += 1
+        # 측정 오차 10% 허용
+        slower = entry['speedup'] is not None and entry['speedup'] < 0.9
+        failed = failed or slower
+        mark = "⚠" if slower else "✓"
+        print(f"  {mark} {entry['kernel']}: Cython {entry['native_ms']:.2f}ms / 폴백 {entry['fallback_ms']:.2f}ms "
+              f"(x{entry['speedup']:.2f})")
+    if failed:
+        print("❌ 커널 확인 실패")
+    elif compared:
+        print(f"✓ 커널 결과 일치: {compared}건")
+    else:
+        print("✓ Cython 커널 없음 - 폴백만 실행 (비교 생략)")
+    return 1 if failed else 0
+
+
+def run_unit_tests() -> bool:
+    """UNIT_TEST_DIRS의 단위 테스트 실행 - 모두 통과하면 True"""
+    import unittest
+
+    root_dir = os.path.dirname(os.path.abspath(__file__))
+    suite = unittest.TestSuite()
+    for test_dir in UNIT_TEST_DIRS:
+        start_dir = os.path.join(root_dir, *test_dir.split("/"))
+        if os.path.isdir(start_dir):
+            suite.addTests(unittest.defaultTestLoader.discover(start_dir, top_level_dir=root_dir))
+
+    print(f"🚀 단위 테스트: {suite.countTestCases()}개")
+    result = unittest.TextTestRunner(verbosity=1).run(suite)
+    if not result.wasSuccessful():
+        print(f"❌ 단위 테스트 실패: 실패 {len(result.failures)}개, 오류 {len(result.errors)}개")
+        return False
+    print(f"✓ 단위 테스트 통과 (건너뜀 {len(result.skipped)}개)")
+    return True
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description="코드 생성 파이프라인 단계별 벤치마크 / 성능 회귀 게이트")
+    parser.add_argument("db_files", nargs="*", help="DB 파일 경로 또는 glob 패턴 (기본: <db-dir>/*.db)")
+    parser.add_argument("--db-dir", default="database", help="DB 파일 디렉토리 (기본: database)")
+    parser.add_argument("--excel-dir", default="excel", help="Excel 가져오기 측정용 xlsx 디렉토리 (빈 값이면 생략)")
+    parser.add_argument("--reference", default="generated_output", help="1배 출력 비교 기준 디렉토리 (빈 값이면 생략)")
+    parser.add_argument("--scales", default="1,10", help="행 배율 목록 (쉼표 구분, 기본: 1,10)")
+    parser.add_argument("--repeat", type=int, default=3, help="스케일별 반복 횟수 (최솟값 사용)")
+    parser.add_argument("-o", "--output", default="", help="결과 JSON 저장 경로")
+    parser.add_argument("--baseline", default="benchmark_baseline.json", help="비교할 기준 JSON 경로")
+    parser.add_argument("--save-baseline", action="store_true", help="현재 결과를 --baseline 경로에 저장")
+    parser.add_argument("--tolerance", type=float, default=0.2, help="허용 성능 저하 비율 (기본: 0.2 = 20%%)")
+    parser.add_argument("--compare-kernels", action="store_true", help="Python 폴백만으로 한 번 더 측정하여 비교")
+    parser.add_argument("--kernel-parity", action="store_true",
+                        help="데이터 처리 커널(core/data_kernels)의 Cython/폴백 결과 일치와 속도만 확인")
+    parser.add_argument("--unit-tests", action="store_true", help="벤치마크 전에 단위 테스트(UNIT_TEST_DIRS) 실행, 실패 시 중단")
+    parser.add_argument("-v", "--verbose", action="store_true", help="상세 로그 출력")
+    args = parser.parse_args(argv)
+
+    logging.basicConfig(level=logging.INFO if args.verbose else logging.CRITICAL,
+                        format="%(asctime)s - %(levelname)s - %(message)s", force=True)
+
+    if args.unit_tests and not run_unit_tests():
+        return 1
+
+    if args.kernel_parity:
+        return run_kernel_parity(max(1, args.repeat))
+
+    from generate_code_cli import collect_db_files
+    from core.performance_settings import get_cython_status
+    from core.kernels import kernel_stats, reset_kernel_stats, python_fallbacks_only
+    import code_generator.cal_list as cal_list_module
+    from code_generator.cal_list_engine import CalListRowEnginePython
+
+    db_files = collect_db_files(args.db_files, args.db_dir)
+    if not db_files:
+        print(f"❌ 벤치마크할 DB 파일이 없습니다: {args.db_files or args.db_dir}")
+        return 2
+    excel_files = sorted(glob.glob(os.path.join(args.excel_dir, "*.xlsx"))) if args.excel_dir else []
+    scales = sorted({max(1, int(value)) for value in args.scales.split(",") if value.strip()})
+
+    work_dir = tempfile.mkdtemp(prefix="autocal_bench_")
+    try:
+        # 원본 DB를 건드리지 않도록 복사본 사용
+        bench_dbs = []
+        for db_file in db_files:
+            copy_path = os.path.join(work_dir, os.path.basename(db_file))
+            shutil.copy2(db_file, copy_path)
+            bench_dbs.append(copy_path)
+
+        print(f"🚀 벤치마크: DB {len(bench_dbs)}개, Excel {len(excel_files)}개, 배율 {scales}, 반복 {args.repeat}회")
+        reset_kernel_stats()
+        report = {
+            'version': 1,
+            'timestamp': datetime.now().isoformat(timespec='seconds'),
+            'python': platform.python_version(),
+            'platform': platform.platform(),
+            'cython': get_cython_status(),
+            'db_files': [os.path.basename(path) for path in db_files],
+            'results': run_suite(bench_dbs, excel_files, scales, max(1, args.repeat), work_dir),
+            'kernels': kernel_stats(),
+        }
+
+        if args.compare_kernels:
+            print("🐍 Python 폴백만 사용하여 재측정")
+            saved_engine = cal_list_module.CalListRowEngine
+            cal_list_module.CalListRowEngine = CalListRowEnginePython
+            try:
+                with python_fallbacks_only():
+                    fallback_results = run_suite(bench_dbs, excel_files, scales, max(1, args.repeat), work_dir)
+            finally:
+                cal_list_module.CalListRowEngine = saved_engine
+            report['python_fallback'] = fallback_results
+            for scale_key, result in report['results'].items():
+                fallback_total = fallback_results[scale_key]['total']
+                speedup = fallback_total / result['total'] if result['total'] else 0.0
+                print(f"  {scale_key}: 커널 {result['total']:.3f}s / 폴백 {fallback_total:.3f}s (x{speedup:.2f})")
+
+        failed = False
+        if args.reference and 1 in scales and os.path.isdir(args.reference):
+            output_check = check_outputs(os.path.join(work_dir, "out_1x"), args.reference)
+            report['output_check'] = output_check
+            if output_check['mismatched']:
+                failed = True
+                print(f"❌ 출력 불일치 {len(output_check['mismatched'])}개: " + ", ".join(output_check['mismatched']))
+            if output_check['missing']:
+                failed = True
+                print(f"❌ 생성되지 않은 기준 파일 {len(output_check['missing'])}개: " + ", ".join(output_check['missing']))
+            if not failed:
+                print(f"✓ 출력 일치: {output_check['checked']}개 파일")
+
+        if args.save_baseline:
+            with open(args.baseline, 'w', encoding='utf-8') as f:
+                json.dump(report, f, ensure_ascii=False, indent=2)
+            print(f"✓ 기준 저장: {args.baseline}")
+        elif os.path.exists(args.baseline):
+            with open(args.baseline, 'r', encoding='utf-8') as f:
+                regressions = compare_with_baseline(report, json.load(f), args.tolerance)
+            report['regressions'] = regressions
+            if regressions:
+                failed = True
+                print(f"❌ 성능 회귀 {len(regressions)}건 (허용 {args.tolerance:.0%}):")
+                for item in regressions:
+                    print(f"    {item}")
+            else:
+                print(f"✓ 기준 대비 성능 회귀 없음 ({args.baseline})")
+
+        if args.output:
+            with open(args.output, 'w', encoding='utf-8') as f:
+                json.dump(report, f, ensure_ascii=False, indent=2)
+            print(f"✓ 결과 저장: {args.output}")
+
+        return 1 if failed else 0
+    finally:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
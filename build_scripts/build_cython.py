@@ -17,6 +17,17 @@ logging.basicConfig(
     format='%(asctime)s - %(levelname)s - %(message)s'
 )
 
+# 빌드 대상 Cython 모듈 (setup.py의 extensions 목록과 일치해야 함)
+CYTHON_MODULES = [
+    "excel_processor_v2",
+    "code_generator_v2",
+    "data_processor",
+    "regex_optimizer",
+    "sparse_sheet",
+    "float_suffix",
+    "cal_list_engine"
+]
+
 def check_dependencies():
     """필수 의존성 확인 및 설치"""
     dependencies = ['setuptools', 'wheel', 'cython', 'numpy']
@@ -101,18 +112,13 @@ def verify_build():
     project_root = Path(__file__).parent.parent
     cython_dir = project_root / "cython_extensions"
 
-    expected_files = [
-        "excel_processor_v2.c",
-        "code_generator_v2.c",
-        "data_processor.c",
-        "regex_optimizer.c"
-    ]
+    expected_files = [f"{module_name}.c" for module_name in CYTHON_MODULES]
 
     # 플랫폼별 확장자 확인 (실제 생성되는 파일명 패턴)
     if sys.platform == "win32":
         # Windows에서는 .cp311-win_amd64.pyd 형태로 생성됨
         import glob
-        for module_name in ["excel_processor_v2", "code_generator_v2", "data_processor", "regex_optimizer"]:
+        for module_name in CYTHON_MODULES:
             pyd_files = list(cython_dir.glob(f"{module_name}.cp*.pyd"))
             if pyd_files:
                 expected_files.extend([f.name for f in pyd_files])
@@ -120,12 +126,7 @@ def verify_build():
                 expected_files.append(f"{module_name}.pyd")  # 기본 형태도 확인
     else:
         # Linux/Mac에서는 .so 형태
-        expected_files.extend([
-            "excel_processor_v2.so",
-            "code_generator_v2.so",
-            "data_processor.so",
-            "regex_optimizer.so"
-        ])
+        expected_files.extend([f"{module_name}.so" for module_name in CYTHON_MODULES])
 
     missing_files = []
     for file_name in expected_files:
@@ -149,12 +150,7 @@ def test_imports():
     if str(project_root) not in sys.path:
         sys.path.insert(0, str(project_root))
 
-    modules_to_test = [
-        "cython_extensions.excel_processor_v2",
-        "cython_extensions.code_generator_v2",
-        "cython_extensions.data_processor",
-        "cython_extensions.regex_optimizer"
-    ]
+    modules_to_test = [f"cython_extensions.{module_name}" for module_name in CYTHON_MODULES]
 
     for module in modules_to_test:
         try:
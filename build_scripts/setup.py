@@ -48,6 +48,21 @@ extensions = [
         "cython_extensions.regex_optimizer",
         ["cython_extensions/regex_optimizer.pyx"],
         include_dirs=[numpy.get_include()]
+    ),
+    Extension(
+        "cython_extensions.sparse_sheet",
+        ["cython_extensions/sparse_sheet.pyx"],
+        include_dirs=[numpy.get_include()]
+    ),
+    Extension(
+        "cython_extensions.float_suffix",
+        ["cython_extensions/float_suffix.pyx"],
+        include_dirs=[numpy.get_include()]
+    ),
+    Extension(
+        "cython_extensions.cal_list_engine",
+        ["cython_extensions/cal_list_engine.pyx"],
+        include_dirs=[numpy.get_include()]
     )
 ]
 
@@ -1,4 +1,3 @@
-import re
 from typing import Dict, List
 from core.info import Info, EMkFile, EMkMode, EArrType, EErrType, CellInfos, ArrInfos, SCellPos, SPrjtInfo
 import logging
@@ -9,13 +8,30 @@ try:
     from core.performance_settings import (
         ENABLE_FLOAT_SUFFIX,
         USE_CYTHON_CAL_LIST,
-        USE_CYTHON_CODE_GEN
+        USE_CYTHON_CODE_GEN,
+        USE_CAL_LIST_ROW_ENGINE
     )
 except ImportError as e:
     logging.warning(f"성능 설정 import 실패, 기본값 사용: {e}")
     ENABLE_FLOAT_SUFFIX = True
     USE_CYTHON_CAL_LIST = True
     USE_CYTHON_CODE_GEN = True
+    USE_CAL_LIST_ROW_ENGINE = True
+
+# Float Suffix 단일 패스 커널 (Cython 커널이 없으면 모듈 내부에서 Python 구현 사용)
+from code_generator.float_suffix import apply_float_suffix
+
+# 행 해석 엔진 (Cython 엔진이 없으면 모듈 내부에서 Python 구현 사용)
+from code_generator.cal_list_engine import CalListRowEngine
+
+# 계측 (비활성화 시 no-op)
+from core.tracing import tracer
+
+# 정규화된 읽기 전용 시트 뷰 (셀 조회)
+from core.sheet_view import SheetView
+
+# 정렬 패딩 메모이제이션 / 배열 열 레이아웃
+from code_generator.layout import ArrayLayout, pad_count, spaces, tabs
 
 # Cython 모듈 안전 import
 CYTHON_CODE_GEN_AVAILABLE = False
@@ -26,20 +42,22 @@ try:
 except ImportError as e:
     logging.warning(f"⚠ Cython 코드 생성 모듈 로드 실패, Python 폴백 사용: {e}")
 
-# Cython 최적화 함수들을 필요할 때 동적으로 import (안전한 방식)
-def safe_import_cython_function(module_name, function_name):
-    """Cython 함수를 안전하게 import하는 헬퍼 함수"""
-    try:
-        # cython_extensions 경로 추가
-        if not module_name.startswith('cython_extensions.'):
-            module_name = f'cython_extensions.{module_name}'
-        module = __import__(module_name, fromlist=[function_name])
-        return getattr(module, function_name)
-    except (ImportError, AttributeError):
-        return None
-
-# 실제 사용되는 Cython 함수들만 캐시
-_cython_function_cache = {}
+# Cython 커널 디스패치 (모듈 로드 시 한 번만 조회, 없거나 실패하면 Python 폴백)
+from core.kernels import register_kernel
+
+
+def _chk_cal_list_python(name_str, val_str, type_str, key_str, desc_str):
+    return []
+
+
+def _variable_code_python(key_str, type_str, name_str, val_str, desc_str, *_align):
+    return (f"const {type_str} {name_str} = {val_str};", f"extern const {type_str} {name_str};")
+
+
+_chk_cal_list_kernel = register_kernel('fast_chk_cal_list_processing', 'code_generator_v2',
+                                       fallback=_chk_cal_list_python)
+_variable_code_kernel = register_kernel('fast_variable_code_generation', 'code_generator_v2',
+                                        fallback=_variable_code_python)
 
 class CalList:
     def __init__(self, fi, title_list, sht_info):
@@ -49,23 +67,9 @@ class CalList:
         self.ShtName = sht_info.Name
         self.shtData = sht_info.Data
 
-        # 데이터 캐싱을 위한 변수 추가
-        self.cell_cache = {}
-
-        # 자주 사용하는 정규식 패턴 미리 컴파일 - 성능 최적화
-        self.decimal_pattern = re.compile(r'(\d+\.\d*|\.\d+)(?![fF"\w])')
-        self.decimal_point_only_pattern = re.compile(r'(\d+\.)(?![fF"\w\d])')
-        self.integer_pattern = re.compile(r'(?<![.\w])([1-9]\d*)(?![.\w\[\]])')
-        self.zero_pattern = re.compile(r'(?<![.\w])0(?![.\w\[\]])')
-        self.block_comment_pattern = re.compile(r'/\*.*?\*/', re.DOTALL)
-        self.line_comment_pattern = re.compile(r'//.*?(?=\n|$)')
-        self.string_pattern = re.compile(r'"(?:\\.|[^"\\])*"')
-        self.array_index_pattern = re.compile(r'\[\s*\d+\s*\](?:\[\s*\d+\s*\])*')
-        self.cast_pattern = re.compile(r'\(\s*FLOAT32\s*\*\s*\)\s*&\w+\s*\[\s*\d+\s*\]\s*(?:\[\s*\d+\s*\])*', re.IGNORECASE)
-
-        # 배열 값 처리용 추가 정규식 패턴들 - add_float_suffix 최적화용
-        self.array_value_pattern = re.compile(r'(,\s*)(-?\d+)(\s*,|\s*\})')
-        self.array_last_value_pattern = re.compile(r'(,\s*)(-?\d+)(\s*\})')
+        # 셀 조회: 로드 시 한 번 정규화한 불변 뷰 (read_cell은 뷰의 바운드 메서드)
+        self.sheetView = SheetView.of(self.shtData)
+        self.read_cell = self.sheetView.read
 
         # 기존 코드 유지
         self.dTempCode = {}
@@ -73,6 +77,10 @@ class CalList:
         self.dHdrCode = {}
         self.dArr = {}
 
+        # 이 시트에서 titleList에 등록할 (타이틀, 생성 파일) 순서
+        # ReadCalList/캐시 복원 중에는 공유 titleList를 건드리지 않고, MakeCode가 시트 순서대로 register_titles() 호출
+        self.titleOrder = []
+
         self.dItem = {}
         self.dItem["OpCode"] = CellInfos(0, 0, "")
         self.dItem["Keyword"] = CellInfos(0, 0, "")
@@ -106,7 +114,7 @@ class CalList:
         self.PrjtDefMain = ""
         self.PrjtNameMain = ""
         self.PrjtDescMain = ""
-        self.frontTab = ""
+        self.frontDepth = 0  # 프로젝트 정의(#if) 블록 들여쓰기 깊이 (탭 개수)
         self.currentArr = ""
         self.currentTitle = ""
         self.currentPRGM = ""
@@ -120,48 +128,8 @@ class CalList:
         # Float Suffix 패턴 초기화 (04_Python_Migration 방식)
         self.float_suffix_patterns = True  # 간단한 플래그로 사용
 
-    def cached_read_cell(self, row, col):
-        """셀 데이터 캐싱하여 읽기 - 성능 최적화"""
-        cache_key = (row, col)
-
-        # 캐시 히트
-        if cache_key in self.cell_cache:
-            return self.cell_cache[cache_key]
-
-        # 캐시 미스 - 데이터 로드
-        value = Info.ReadCell(self.shtData, row, col)
-
-        # 캐시 크기 제한 (메모리 사용량 제어) - 안전한 Cython 최적화 적용
-        if USE_CYTHON_CAL_LIST:
-            # Cython 최적화 버전 사용 (안전한 동적 import)
-            fast_cell_cache_management = safe_import_cython_function('data_processor', 'fast_cell_cache_management')
-            if fast_cell_cache_management:
-                try:
-                    cache_size = fast_cell_cache_management(self.cell_cache, 100000)
-                    self.cell_cache[cache_key] = value
-                except Exception:
-                    # 실패 시 Python 폴백
-                    if len(self.cell_cache) < 100000:
-                        self.cell_cache[cache_key] = value
-            else:
-                # Cython 함수 없으면 Python 폴백
-                if len(self.cell_cache) < 100000:
-                    self.cell_cache[cache_key] = value
-        else:
-            # 기존 Python 버전 (폴백)
-            if len(self.cell_cache) < 100000:  # 10만개 제한
-                self.cell_cache[cache_key] = value
-            elif len(self.cell_cache) >= 150000:  # 15만개 초과 시 정리
-                # 오래된 캐시 항목 제거 (간단한 LRU 구현)
-                keys_to_remove = list(self.cell_cache.keys())[:50000]  # 5만개 제거
-                for key in keys_to_remove:
-                    del self.cell_cache[key]
-                self.cell_cache[cache_key] = value
-
-        return value
-
     def ChkCalListPos(self):
-        """아이템 항목 위치 찾기 - 캐싱 적용"""
+        """아이템 항목 위치 찾기"""
         err_flag = False
         item_chk_cnt = 0
         cell_str = ""
@@ -170,18 +138,15 @@ class CalList:
         prjt_name = ""
         prjt_desc = ""
 
-        # 셀 데이터 캐싱
-        for row in range(self.itemStartPos.Row, min(len(self.shtData), self.itemStartPos.Row + 20)):
-            for col in range(self.itemStartPos.Col, min(len(self.shtData[0]) if len(self.shtData) > 0 else 0, self.itemStartPos.Col + 10)):
-                self.cached_read_cell(row, col)
-
-        for row in range(self.itemStartPos.Row, len(self.shtData)):
+        read_cell = self.read_cell
+        col_count = self.sheetView.col_count
+        for row in range(self.itemStartPos.Row, self.sheetView.row_count):
             if item_chk_cnt == len(self.dItem):
                 break
 
             item_chk_cnt = 0
-            for col in range(self.itemStartPos.Col, len(self.shtData[0]) if len(self.shtData) > 0 else 0):
-                cell_str = self.cached_read_cell(row, col)
+            for col in range(self.itemStartPos.Col, col_count):
+                cell_str = read_cell(row, col)
 
                 if cell_str in self.dItem:
                     self.dItem[cell_str].Col = col
@@ -210,18 +175,11 @@ class CalList:
             self.prjtDefCol = self.PrjtStartPos.Col + Info.PrjtDefCol
             self.prjtNameCol = self.PrjtStartPos.Col + Info.PrjtNameCol
 
-            # 테이블 앞부분 데이터 캐싱
-            for row in range(1, min(self.itemStartPos.Row, 30)):
-                self.cached_read_cell(row, self.PrjtStartPos.Col)
-                self.cached_read_cell(row, self.prjtDefCol)
-                self.cached_read_cell(row, self.prjtNameCol)
-                self.cached_read_cell(row, self.prjtNameCol + 2)
-
             for row in range(1, self.itemStartPos.Row - 1):
-                prjt_title = self.cached_read_cell(row, self.PrjtStartPos.Col)
-                prjt_def = self.cached_read_cell(row, self.prjtDefCol)
-                prjt_name = self.cached_read_cell(row, self.prjtNameCol)
-                prjt_desc = self.cached_read_cell(row, self.prjtNameCol + 2)
+                prjt_title = self.read_cell(row, self.PrjtStartPos.Col)
+                prjt_def = self.read_cell(row, self.prjtDefCol)
+                prjt_name = self.read_cell(row, self.prjtNameCol)
+                prjt_desc = self.read_cell(row, self.prjtNameCol + 2)
 
                 if prjt_title and prjt_def and prjt_name:
                     self.PrjtStartPos.Row = row
@@ -251,7 +209,6 @@ class CalList:
     def ReadCalList(self, progress_callback=None):
         """아이템리스트 read 후 임시 코드 생성 - 응답성 개선"""
         import time
-        from PySide6.QtWidgets import QApplication
 
         logging.info(f"시트 {self.ShtName} ReadCalList 시작")
         start_time = time.time()
@@ -276,79 +233,45 @@ class CalList:
 
             logging.info(f"시트 {self.ShtName}: 배치 크기 {batch_size}로 {total_rows}행 처리 시작")
 
-            # 성능 최적화: 딕셔너리 순회를 한 번만 수행하고 리스트로 저장 (결과 동일, 속도 향상)
-            item_list = list(self.dItem.values())
+            # 행 해석 엔진 (없으면 행마다 _process_row)
+            row_engine = CalListRowEngine(self) if USE_CAL_LIST_ROW_ENGINE else None
 
             # 배치 단위로 처리
-            for batch_start in range(self.itemStartPos.Row, len(self.shtData), batch_size):
-                batch_end = min(batch_start + batch_size, len(self.shtData))
-
-                # 배치 시작 시 UI 응답성 및 진행률 업데이트
-                QApplication.processEvents()
-
-                if progress_callback:
-                    progress = int((processed_rows / total_rows) * 100)
-                    try:
-                        # 더 상세한 정보 제공
-                        elapsed = time.time() - start_time
-                        progress_callback(progress, f"시트 {self.ShtName}: {processed_rows}/{total_rows} 행 처리 중 ({elapsed:.1f}초 경과)")
-                    except InterruptedError as e:
-                        # 사용자가 취소한 경우
-                        logging.info(f"시트 {self.ShtName} 처리 중 사용자가 취소함: {str(e)}")
-                        raise  # 예외를 상위로 전파
-
-                # 타임아웃 체크 (10분 제한)
-                elapsed_time = time.time() - start_time
-                if elapsed_time > 600:  # 10분
-                    logging.warning(f"시트 {self.ShtName} 처리 타임아웃: {elapsed_time:.1f}초 경과")
-                    raise TimeoutError(f"시트 {self.ShtName} 처리가 10분을 초과했습니다. {processed_rows}/{total_rows} 행 처리 완료")
-
-                # 배치 내 행들 처리 - Cython 최적화 활성화
-                # Cython 최적화 버전 사용 (안전한 동적 import)
-                fast_read_cal_list_processing = safe_import_cython_function('code_generator_v2', 'fast_read_cal_list_processing')
-                if fast_read_cal_list_processing:
-                    try:
-                        processed_rows_batch = fast_read_cal_list_processing(
-                            self.shtData, batch_start, batch_end, item_list
-                        )
-                        # ReadCalList Cython 최적화 사용 (로그 제거)
-                    except Exception:
-                        # Python 폴백
-                        processed_rows_batch = []
-                else:
-                    # Python 폴백
-                    processed_rows_batch = []
-
-                # 개별 행 처리 (Cython 결과 또는 Python 폴백)
-                for row in range(batch_start, batch_end):
-                    try:
-                        # 아이템 행 설정 (성능 최적화: 사전 변환된 리스트 사용)
-                        for item in item_list:
-                            item.Row = row
+            with tracer.span("cal_list.read_rows", "code_gen", sheet=self.ShtName, rows=total_rows):
+                for batch_start in range(self.itemStartPos.Row, len(self.shtData), batch_size):
+                    batch_end = min(batch_start + batch_size, len(self.shtData))
 
-                        self.chk_op_code()
-
-                        if self.mkMode != EMkMode.NONE:
-                            if self.mkMode == EMkMode.ARR_MEM:
-                                self.readArrMem(row)
-                            else:
-                                self.readRow(row)
-
-                            self.chkCalList(row)
-                            self.saveTempList(row)
-
-                    except IndexError as e:
-                        logging.error(f"행 {row} 처리 중 인덱스 오류: {e}")
-                        logging.error(traceback.format_exc())
-                        # 다음 행 계속 처리
-
-                    processed_rows += 1
+                    # 배치 시작 시 진행률 업데이트 (UI 응답성은 콜백 측에서 처리)
+                    if progress_callback:
+                        progress = int((processed_rows / total_rows) * 100)
+                        try:
+                            # 더 상세한 정보 제공
+                            elapsed = time.time() - start_time
+                            progress_callback(progress, f"시트 {self.ShtName}: {processed_rows}/{total_rows} 행 처리 중 ({elapsed:.1f}초 경과)")
+                        except InterruptedError as e:
+                            # 사용자가 취소한 경우
+                            logging.info(f"시트 {self.ShtName} 처리 중 사용자가 취소함: {str(e)}")
+                            raise  # 예외를 상위로 전파
+
+                    # 타임아웃 체크 (10분 제한)
+                    elapsed_time = time.time() - start_time
+                    if elapsed_time > 600:  # 10분
+                        logging.warning(f"시트 {self.ShtName} 처리 타임아웃: {elapsed_time:.1f}초 경과")
+                        raise TimeoutError(f"시트 {self.ShtName} 처리가 10분을 초과했습니다. {processed_rows}/{total_rows} 행 처리 완료")
+
+                    # 배치 내 행별 처리 (행 엔진: 단순 OpCode는 엔진에서, 나머지는 _process_row)
+                    if row_engine is not None:
+                        row_engine.run(batch_start, batch_end)
+                    else:
+                        for row in range(batch_start, batch_end):
+                            self._process_row(row)
+                    processed_rows += batch_end - batch_start
 
-                # 배치 완료 후 메모리 정리 (대용량 데이터 처리 시)
-                if batch_size >= 500 and processed_rows % (batch_size * 10) == 0:
-                    import gc
-                    gc.collect()
-                    logging.debug(f"시트 {self.ShtName}: {processed_rows}행 처리 완료, 메모리 정리 실행")
+                    # 배치 완료 후 메모리 정리 (대용량 데이터 처리 시)
+                    if batch_size >= 500 and processed_rows % (batch_size * 10) == 0:
+                        import gc
+                        gc.collect()
+                        logging.debug(f"시트 {self.ShtName}: {processed_rows}행 처리 완료, 메모리 정리 실행")
 
             self.arrNameCnt = 0
 
@@ -356,48 +279,74 @@ class CalList:
             total_items = sum(len(item) for item in self.dTempCode.values())
             processed_items = 0
 
-            for key, item in self.dTempCode.items():
-                logging.debug(f"아이템 {key} 코드 생성 중, 항목 수: {len(item)}")
-
-                for i in range(len(item)):
-                    # 배치 단위로 UI 응답성 유지
-                    if processed_items % batch_size == 0:
-                        QApplication.processEvents()
-
-                        if progress_callback:
-                            progress = int((processed_items / total_items) * 100)
-                            try:
-                                # 더 상세한 정보 제공
-                                elapsed = time.time() - start_time
-                                progress_callback(progress, f"시트 {self.ShtName}: 코드 생성 중 {processed_items}/{total_items} ({elapsed:.1f}초 경과)")
-                            except InterruptedError as e:
-                                # 사용자가 취소한 경우
-                                logging.info(f"시트 {self.ShtName} 코드 생성 중 사용자가 취소함: {str(e)}")
-                                raise  # 예외를 상위로 전파
-
-                    try:
-                        self.writeCalList(item[i])
-                    except IndexError as e:
-                        logging.error(f"코드 작성 중 인덱스 오류: 키={key}, 인덱스={i}")
-                        logging.error(traceback.format_exc())
-                        # 다음 항목 계속 처리
-
-                    processed_items += 1
+            with tracer.span("cal_list.write_code", "code_gen", sheet=self.ShtName, rows=total_items):
+                for key, item in self.dTempCode.items():
+                    logging.debug(f"아이템 {key} 코드 생성 중, 항목 수: {len(item)}")
+
+                    for i in range(len(item)):
+                        # 배치 단위로 진행률 업데이트
+                        if processed_items % batch_size == 0:
+                            if progress_callback:
+                                progress = int((processed_items / total_items) * 100)
+                                try:
+                                    # 더 상세한 정보 제공
+                                    elapsed = time.time() - start_time
+                                    progress_callback(progress, f"시트 {self.ShtName}: 코드 생성 중 {processed_items}/{total_items} ({elapsed:.1f}초 경과)")
+                                except InterruptedError as e:
+                                    # 사용자가 취소한 경우
+                                    logging.info(f"시트 {self.ShtName} 코드 생성 중 사용자가 취소함: {str(e)}")
+                                    raise  # 예외를 상위로 전파
+
+                        try:
+                            self.writeCalList(item[i])
+                        except IndexError as e:
+                            logging.error(f"코드 작성 중 인덱스 오류: 키={key}, 인덱스={i}")
+                            logging.error(traceback.format_exc())
+                            # 다음 항목 계속 처리
+
+                        processed_items += 1
 
         except Exception as e:
             logging.error(f"ReadCalList 전체 오류: {e}")
             logging.error(traceback.format_exc())
             raise
 
+        if tracer.enabled:
+            tracer.count("cal_list.rows", len(self.shtData) - self.itemStartPos.Row)
+            tracer.count("sheet_view.cells", self.sheetView.cell_count)
+
         logging.info(f"시트 {self.ShtName} ReadCalList 완료 (소요시간: {time.time() - start_time:.1f}초)")
 
+    def _process_row(self, row):
+        """한 행 처리: OpCode 판별 → 아이템 읽기 → 오류 체크 → 임시 저장"""
+        try:
+            # 아이템 행 설정
+            for item in self.dItem.values():
+                item.Row = row
+
+            self.chk_op_code()
+
+            if self.mkMode != EMkMode.NONE:
+                if self.mkMode == EMkMode.ARR_MEM:
+                    self.readArrMem(row)
+                else:
+                    self.readRow(row)
+
+                self.chkCalList(row)
+                self.saveTempList(row)
+
+        except IndexError as e:
+            logging.error(f"행 {row} 처리 중 인덱스 오류: {e}")
+            logging.error(traceback.format_exc())
+            # 다음 행 계속 처리
+
     def chk_op_code(self):
         """OpCode 오류 체크 - 성능 최적화"""
         op_code_row = self.dItem["OpCode"].Row
         op_code_col = self.dItem["OpCode"].Col
 
         # 셀에서 OpCode 문자열 읽기 (캐싱 적용)
-        op_code_str = self.cached_read_cell(op_code_row, op_code_col)
+        op_code_str = self.read_cell(op_code_row, op_code_col)
         self.dItem["OpCode"].Str = op_code_str
 
         # 유효한 OpCode인지 딕셔너리로 한번에 확인
@@ -412,6 +361,51 @@ class CalList:
         # 이전 모드 갱신
         self.mkModeOld = self.mkMode
 
+    def export_fragment(self) -> Dict:
+        """ReadCalList 결과(소스/헤더 코드 조각, 타이틀 등록 순서) 추출 - 증분 생성 캐시용 (JSON 저장 가능한 값만 사용)"""
+        return {
+            "dSrcCode": self.dSrcCode,
+            "dHdrCode": self.dHdrCode,
+            "titleOrder": [[title, mk_file.value] for title, mk_file in self.titleOrder]
+        }
+
+    def apply_fragment(self, fragment: Dict):
+        """캐시된 ReadCalList 결과 적용 (ReadCalList 호출과 동일한 상태 재현)"""
+        self.dTempCode = {}
+        self.dSrcCode = fragment["dSrcCode"]
+        self.dHdrCode = fragment["dHdrCode"]
+        self.titleOrder = [(title, EMkFile(mk_file)) for title, mk_file in fragment["titleOrder"]]
+
+    # ChkCalListPos가 확정하는 위치/프로젝트 정보 (시트 IR 캐시 대상)
+    _IR_POS_FIELDS = ("prjtDefCol", "prjtNameCol", "nameDfltCol", "descDfltCol", "memDfltCol", "valDfltCol",
+                      "PrjtDefMain", "PrjtNameMain", "PrjtDescMain")
+
+    def export_ir(self) -> Dict:
+        """ChkCalListPos + ReadCalList 결과 추출 - 시트 IR 캐시용 (오류 없이 처리된 시트만 저장)"""
+        ir = {name: getattr(self, name) for name in self._IR_POS_FIELDS}
+        ir["itemStartPos"] = (self.itemStartPos.Row, self.itemStartPos.Col)
+        ir["PrjtStartPos"] = (self.PrjtStartPos.Row, self.PrjtStartPos.Col)
+        ir["items"] = {key: (item.Row, item.Col) for key, item in self.dItem.items()}
+        ir["fragment"] = self.export_fragment()
+        return ir
+
+    def apply_ir(self, ir: Dict):
+        """캐시된 시트 IR 적용 (ChkCalListPos와 ReadCalList 호출 후와 같은 상태)"""
+        for name in self._IR_POS_FIELDS:
+            setattr(self, name, ir[name])
+        self.itemStartPos = SCellPos(*ir["itemStartPos"])
+        self.PrjtStartPos = SCellPos(*ir["PrjtStartPos"])
+        for key, (row, col) in ir["items"].items():
+            self.dItem[key].Row = row
+            self.dItem[key].Col = col
+        self.apply_fragment(ir["fragment"])
+
+    def register_titles(self):
+        """이 시트의 타이틀을 공유 titleList에 등록 (먼저 등록된 시트의 생성 파일 설정 유지)"""
+        for title, mk_file in self.titleOrder:
+            if title not in self.titleList:
+                self.titleList[title] = mk_file
+
     def readRow(self, row):
         """OpCode에 따른 라인별 아이템 읽기 - 성능 최적화"""
         # 열 위치 계산 최적화
@@ -430,10 +424,10 @@ class CalList:
         self.dItem["Description"].Col = self.descDfltCol
 
         # 한번에 필요한 데이터 읽기 (캐싱 활용)
-        self.dItem["Keyword"].Str = self.cached_read_cell(row, self.dItem["Keyword"].Col)
-        self.dItem["Type"].Str = self.cached_read_cell(row, self.dItem["Type"].Col)
-        self.dItem["Name"].Str = self.cached_read_cell(row, self.dItem["Name"].Col)
-        self.dItem["Value"].Str = self.cached_read_cell(row, self.dItem["Value"].Col)
+        self.dItem["Keyword"].Str = self.read_cell(row, self.dItem["Keyword"].Col)
+        self.dItem["Type"].Str = self.read_cell(row, self.dItem["Type"].Col)
+        self.dItem["Name"].Str = self.read_cell(row, self.dItem["Name"].Col)
+        self.dItem["Value"].Str = self.read_cell(row, self.dItem["Value"].Col)
 
         if self.mkMode == EMkMode.ARRAY:
             self.currentArr = f"{self.ShtName}_{self.dItem['Name'].Str}_{self.arrNameCnt}"
@@ -455,15 +449,15 @@ class CalList:
                 self.dItem["Name"].Col = self.prjtDefCol + 1
                 self.dItem["Value"].Col = self.prjtNameCol + 1
 
-                prjt_def = self.cached_read_cell(row, self.prjtDefCol + 1)
-                prjt_name = self.cached_read_cell(row, self.prjtNameCol + 1)
+                prjt_def = self.read_cell(row, self.prjtDefCol + 1)
+                prjt_name = self.read_cell(row, self.prjtNameCol + 1)
 
             self.dItem["Name"].Str = prjt_def
             self.dItem["Value"].Str = prjt_name
             self.dItem["Description"].Col = self.dItem["Value"].Col + 2
 
         # 설명 읽기는 다른 컬럼 처리 후에 한 번만 수행
-        self.dItem["Description"].Str = self.cached_read_cell(row, self.dItem["Description"].Col)
+        self.dItem["Description"].Str = self.read_cell(row, self.dItem["Description"].Col)
 
     def chkArrInfo(self, row):
         """배열 타입 체크"""
@@ -474,8 +468,8 @@ class CalList:
         type2 = False
 
         arr_size_str = ""
-        arr_size_str1 = Info.ReadCell(self.shtData, row + 1, self.memDfltCol)
-        arr_size_str2 = Info.ReadCell(self.shtData, row, self.dItem["Value"].Col)
+        arr_size_str1 = self.read_cell(row + 1, self.memDfltCol)
+        arr_size_str2 = self.read_cell(row, self.dItem["Value"].Col)
 
         if arr_size_str1.startswith("[") and arr_size_str1.endswith("]"):
             type1 = True
@@ -591,19 +585,19 @@ class CalList:
         rt = False
 
         for col in range(self.memDfltCol + 1, self.memDfltCol + arr_size.Col):
-            cell_str = Info.ReadCell(self.shtData, row, col)
+            cell_str = self.read_cell(row, col)
             if cell_str:
                 rt = True
                 break
 
-            cell_str = Info.ReadCell(self.shtData, row + 1, col)
+            cell_str = self.read_cell(row + 1, col)
             if cell_str:
                 rt = True
                 break
 
         if not rt:
             for r in range(row + 2, row + 2 + arr_size.Row):
-                cell_str = Info.ReadCell(self.shtData, r, self.memDfltCol)
+                cell_str = self.read_cell(r, self.memDfltCol)
                 if cell_str:
                     rt = True
                     break
@@ -634,7 +628,7 @@ class CalList:
         is_first_row = (row == self.dArr[self.currentArr].StartPos.Row)
 
         # 첫 번째 행의 첫 번째 셀 확인 (타이틀 셀 여부 확인용)
-        first_cell_content = Info.ReadCell(self.shtData, row, self.dArr[self.currentArr].StartPos.Col)
+        first_cell_content = self.read_cell(row, self.dArr[self.currentArr].StartPos.Col)
         is_label_row = is_first_row or "Idx" in first_cell_content
 
         # 2차원 배열 확인
@@ -672,7 +666,7 @@ class CalList:
         # 기존 Python 버전 (폴백)
         while col < self.dArr[self.currentArr].EndPos.Col + 1:
             # 셀 데이터 읽기
-            cell_str = Info.ReadCell(self.shtData, row, col)
+            cell_str = self.read_cell(row, col)
 
             # 주석 위치인지 확인
             is_annotation = (cell_str == Info.ReadingXlsRule)
@@ -774,346 +768,169 @@ class CalList:
                         self.dArr[self.currentArr].AlignmentSize[col] += len("Idx")
 
     def writeArrMem(self):
-        """배열 만들기 - 04_Python_Migration 방식 (성능 최적화)"""
-        # 성능 최적화: 자주 사용되는 객체 참조 미리 저장
-        current_arr_data = self.dArr[self.currentArr]
-        row = current_arr_data.RowCnt
-        max_col = 0
-        src_data_str = None
-        antt_cnt = 0
-        empty_or_comma = ""
-
-        # 성능 최적화: 자주 사용되는 값들 미리 계산
-        arr_type = current_arr_data.ArrType
-        original_size_row = current_arr_data.OrignalSize.Row
-        temp_arr = current_arr_data.TempArr
-        alignment_size = current_arr_data.AlignmentSize
-        read_size_col = current_arr_data.ReadSize.Col
-
-        # 성능 최적화: 리스트를 set으로 변환 (O(n) → O(1) 검색)
-        annotate_row_set = set(current_arr_data.AnnotateRow)
-        annotate_col_set = set(current_arr_data.AnnotateCol)
+        """배열 만들기 - 04_Python_Migration 방식 (열별 정렬 정보는 ArrayLayout으로 배열당 한 번만 계산)"""
+        arr = self.dArr[self.currentArr]
+        row = arr.RowCnt
+        arr_type = arr.ArrType
+        is_type3 = arr_type == EArrType.Type3.value
+        is_type4 = arr_type == EArrType.Type4.value
 
         # 조건 검사
         if (arr_type == EArrType.SizeErr.value or
-            (arr_type != EArrType.Type3.value and
-            (row == 0 and not current_arr_data.IdxOn)) or
-            (arr_type == EArrType.Type3.value and row > 0)):
+            (not is_type3 and (row == 0 and not arr.IdxOn)) or
+            (is_type3 and row > 0)):
             return None
 
-        # 성능 최적화: set 사용으로 O(1) 검색
-        is_annotate_row = row in annotate_row_set
-        if is_annotate_row:
-            src_data_str = "/*\t"
-        else:
-            src_data_str = "\t"
-
-        # 다차원 배열 처리
-        if original_size_row > 1 and arr_type != EArrType.Type4.value:
-            if is_annotate_row:
-                src_data_str += "\t"
-            else:
-                src_data_str += "{\t"
+        temp_arr = arr.TempArr
+        read_size_col = arr.ReadSize.Col
+        multi_row = arr.OrignalSize.Row > 1
 
         # 열 수 계산
         max_col = read_size_col
-        if arr_type != EArrType.Type3.value:
+        if not is_type3:
             max_col -= 1
 
-        # 성능 최적화: 배열 값 처리 (범위 체크 최소화)
-        temp_arr_len = len(temp_arr)
-        for col in range(max_col):
-            # 성능 최적화: 범위 체크 최소화
-            if row >= temp_arr_len:
-                return None
+        if max_col > 0 and (row >= len(temp_arr) or len(temp_arr[row]) < max_col):
+            return None
+
+        # 배열당 한 번 정렬 레이아웃 계산 (AlignmentSize/AnnotateRow/AnnotateCol은 readyArrMemMake 이후 고정)
+        layout = arr.Layout
+        if layout is None:
+            layout = arr.Layout = ArrayLayout(arr, max(max_col, 0))
 
-            temp_arr_row = temp_arr[row]
-            if col >= len(temp_arr_row):
-                return None
+        align = layout.align
+        align_count = layout.align_count
+        annotate_col = layout.annotate_col
+        annotate_first = layout.annotate_first
+        annotate_next = layout.annotate_next
+        comma_base = layout.comma_base
+        is_annotate_row = row in layout.annotate_rows
+        float_suffix_on = bool(ENABLE_FLOAT_SUFFIX and getattr(self, 'float_suffix_patterns', None))
+        last_pad_on = (arr_type == EArrType.Type1.value and multi_row) or is_annotate_row
 
+        parts = ["/*\t" if is_annotate_row else "\t"]
+
+        # 다차원 배열 처리
+        if multi_row and not is_type4:
+            parts.append("\t" if is_annotate_row else "{\t")
+
+        antt_cnt = 0
+        temp_arr_row = temp_arr[row] if max_col > 0 else ()
+        for col in range(max_col):
             cell_str = temp_arr_row[col]
 
-            # Float suffix 기능 (04_Python_Migration 방식)
-            # 주석 행/열에서는 Float Suffix 적용 제외
-            is_comment_context = (row in annotate_row_set or col in annotate_col_set or
-                                '/*' in cell_str or '//' in cell_str)
-            if (ENABLE_FLOAT_SUFFIX and hasattr(self, 'float_suffix_patterns') and self.float_suffix_patterns and
-                not is_comment_context):
+            # Float suffix 기능 (주석 행/열에서는 제외)
+            if (float_suffix_on and not is_annotate_row and not annotate_col[col] and
+                    '/*' not in cell_str and '//' not in cell_str):
                 cell_str = self._apply_float_suffix(cell_str)
 
             # 주석 열 처리
-            if col in self.dArr[self.currentArr].AnnotateCol:
-                # 배열 크기 안전 검사
-                if col < len(self.dArr[self.currentArr].AlignmentSize):
-                    if not cell_str.strip():
-                        empty_or_comma = " "
-                    else:
-                        empty_or_comma = ","
-
-                    # 주석 형식 처리
-                    if row in self.dArr[self.currentArr].AnnotateRow:
-                        # 첫 레이블 행의 레이블은 특별 처리
-                        if col == 0 or (col-1) not in self.dArr[self.currentArr].AnnotateCol:
-                            antt_cnt = 0
-                            cell_str = "   " + cell_str
-                    else:
-                        # 첫 번째 주석 열이거나 이전 열이 주석이 아닌 경우
-                        if col == 0 or (col-1) not in self.dArr[self.currentArr].AnnotateCol:
-                            antt_cnt = 0
-                            cell_str = "/* " + cell_str
+            if annotate_col[col]:
+                if col >= align_count:
+                    # AlignmentSize 범위를 벗어나는 경우 기본 처리
+                    parts.append(cell_str + ", ")
+                    continue
 
-                    src_data_str += cell_str
+                empty_or_comma = "," if cell_str.strip() else " "
+                if annotate_first[col]:
+                    antt_cnt = 0
+                    cell_str = ("   " if is_annotate_row else "/* ") + cell_str
+                parts.append(cell_str)
 
+                col_align = align[col]
+                cell_len = len(cell_str.encode('utf-8'))
+                if annotate_next[col]:
                     # 다음 주석 열이 있는 경우 패딩 추가
-                    if (col+1) in self.dArr[self.currentArr].AnnotateCol:
-                        padding = self.dArr[self.currentArr].AlignmentSize[col] - len(cell_str.encode('utf-8')) + 2
-                        src_data_str += empty_or_comma.ljust(padding)
-                        antt_cnt += self.dArr[self.currentArr].AlignmentSize[col] + 2
+                    parts.append(empty_or_comma + spaces(col_align - cell_len + 1))
+                    antt_cnt += col_align + 2
+                else:
+                    # 주석 종료 처리
+                    if is_annotate_row:
+                        parts.append(empty_or_comma + spaces(col_align - cell_len + 2))
                     else:
-                        # 주석 종료 처리
-                        if row in self.dArr[self.currentArr].AnnotateRow:
-                            padding = self.dArr[self.currentArr].AlignmentSize[col] - len(cell_str.encode('utf-8')) + 3
-                            src_data_str += empty_or_comma.ljust(padding)
-                        else:
-                            padding = self.dArr[self.currentArr].AlignmentSize[col] - len(cell_str.encode('utf-8')) + 1
-                            src_data_str += " ".ljust(padding) + "*/"
+                        parts.append(" " + spaces(col_align - cell_len) + "*/")
 
-                            # 빈 주석 처리
-                            temp = src_data_str.replace("/*", "").replace("*/", "").replace("{", "").replace("\t", "")
-                            if not temp.strip():
-                                src_data_str = src_data_str.replace("/*", "  ").replace("*/", "  ")
+                        # 빈 주석 처리
+                        src_data_str = "".join(parts)
+                        temp = src_data_str.replace("/*", "").replace("*/", "").replace("{", "").replace("\t", "")
+                        if not temp.strip():
+                            src_data_str = src_data_str.replace("/*", "  ").replace("*/", "  ")
+                        parts = [src_data_str]
 
-                        antt_cnt += self.dArr[self.currentArr].AlignmentSize[col] + 3
+                    antt_cnt += col_align + 3
 
-                        # 주석 열 뒤에 탭 추가 (정렬을 위해)
-                        src_data_str += "\t"
-                        if antt_cnt % Info.TabSize > 2:
-                            src_data_str += "\t"
-                else:
-                    # AlignmentSize 범위를 벗어나는 경우 기본 처리
-                    src_data_str += cell_str + ", "
+                    # 주석 열 뒤에 탭 추가 (정렬을 위해)
+                    parts.append("\t\t" if antt_cnt % Info.TabSize > 2 else "\t")
 
             # 마지막 열 처리
             elif col == max_col - 1:
-                src_data_str += cell_str
+                parts.append(cell_str)
 
                 # 마지막 셀 처리 (다차원 배열 및 주석 행 고려)
-                if ((self.dArr[self.currentArr].ArrType == EArrType.Type1.value and
-                    self.dArr[self.currentArr].OrignalSize.Row > 1) or
-                    row in self.dArr[self.currentArr].AnnotateRow):
-
-                    # 안전 검사 추가
-                    if col < len(self.dArr[self.currentArr].AlignmentSize):
-                        pad_tab_cnt = self.calculatePad(
-                            self.dArr[self.currentArr].AlignmentSize[col] - 1,
-                            len(cell_str.encode('utf-8')) - 1,
-                            True, 1
-                        )
-                        src_data_str += "\t".ljust(pad_tab_cnt - 1, '\t')
+                if last_pad_on and col < align_count:
+                    pad_tab_cnt = layout.last_base[col] - len(cell_str.encode('utf-8')) // Info.TabSize
+                    parts.append(tabs(pad_tab_cnt - 1) or "\t")
 
             # Type3 또는 Type4가 아닌 경우 처리
-            elif (self.dArr[self.currentArr].ArrType == EArrType.Type3.value or
-                (self.dArr[self.currentArr].ArrType != EArrType.Type4.value and col != 0)):
-
-                temp_col = col
-                if self.dArr[self.currentArr].ArrType == EArrType.Type3.value:
-                    temp_col %= 10
-
-                src_data_str += cell_str
+            elif is_type3 or (not is_type4 and col != 0):
+                temp_col = col % 10 if is_type3 else col
+                parts.append(cell_str)
 
                 # Type3 배열의 특수 처리
-                if (self.dArr[self.currentArr].ArrType == EArrType.Type3.value) and (temp_col == 9):
-                    src_data_str += ","
+                if is_type3 and temp_col == 9:
+                    parts.append(",")
                 else:
-                    # 처리 중인 셀이 빈 문자열인지 확인
-                    if not cell_str.strip():
-                        empty_or_comma = " "
-                    else:
-                        empty_or_comma = ","
-
-                    # 안전 검사 추가
-                    if temp_col < len(self.dArr[self.currentArr].AlignmentSize):
+                    empty_or_comma = "," if cell_str.strip() else " "
+                    if temp_col < align_count:
                         # 콤마 뒤의 간격 조정
-                        pad_tab_cnt = self.calculatePad(
-                            self.dArr[self.currentArr].AlignmentSize[temp_col],
-                            len(cell_str.encode('utf-8')),
-                            True, 1
-                        )
-                        src_data_str += empty_or_comma.ljust(pad_tab_cnt, '\t')
+                        pad_tab_cnt = comma_base[temp_col] - (len(cell_str.encode('utf-8')) + 1) // Info.TabSize
+                        parts.append(empty_or_comma + tabs(pad_tab_cnt - 1))
                     else:
                         # 기본 간격 사용
-                        src_data_str += empty_or_comma + "\t"
+                        parts.append(empty_or_comma + "\t")
 
                 # Type3 배열의 줄바꿈 처리
-                if self.dArr[self.currentArr].ArrType == EArrType.Type3.value and (col % 10 == 9):
-                    src_data_str += "\r\n\t"
+                if is_type3 and temp_col == 9:
+                    parts.append("\r\n\t")
 
         # 주석 행 닫기
-        if row in self.dArr[self.currentArr].AnnotateRow:
-            src_data_str += "*/"
+        if is_annotate_row:
+            parts.append("*/")
         # 다차원 배열 행 닫기
-        elif self.dArr[self.currentArr].OrignalSize.Row > 1:
-            if self.dArr[self.currentArr].ArrType != EArrType.Type4.value:
-                src_data_str += "}"
+        elif multi_row:
+            if not is_type4:
+                parts.append("}")
 
-            if row < self.dArr[self.currentArr].ReadSize.Row - 1:
-                src_data_str += ","
+            if row < arr.ReadSize.Row - 1:
+                parts.append(",")
 
         # 배열 요소 뒤에 주석 처리
-        if row < len(self.dArr[self.currentArr].TempArr) and len(self.dArr[self.currentArr].TempArr[row]) > self.dArr[self.currentArr].ReadSize.Col - 1:
-            # 주석 있는지 확인
-            comment = self.dArr[self.currentArr].TempArr[row][self.dArr[self.currentArr].ReadSize.Col - 1].strip()
+        if row < len(temp_arr) and len(temp_arr[row]) > read_size_col - 1:
+            comment = temp_arr[row][read_size_col - 1].strip()
             if comment:
-                if self.dArr[self.currentArr].ArrType == EArrType.Type4.value:
-                    if self.dArr[self.currentArr].ReadSize.Col - 2 < len(self.dArr[self.currentArr].AlignmentSize):
-                        pad_tab_cnt = ((self.dArr[self.currentArr].AlignmentSize[self.dArr[self.currentArr].ReadSize.Col - 2] + 1) // Info.TabSize) + 1
-                        tab_padding = pad_tab_cnt - ((len(self.dArr[self.currentArr].TempArr[row][self.dArr[self.currentArr].ReadSize.Col - 2]) + 1) // Info.TabSize)
-                        src_data_str += "\t".ljust(tab_padding, '\t')
+                if is_type4 and read_size_col - 2 < align_count:
+                    pad_tab_cnt = ((align[read_size_col - 2] + 1) // Info.TabSize) + 1
+                    tab_padding = pad_tab_cnt - ((len(temp_arr[row][read_size_col - 2]) + 1) // Info.TabSize)
+                    parts.append(tabs(tab_padding) or "\t")
 
-                if self.dArr[self.currentArr].ArrType != EArrType.Type3.value:
-                    src_data_str += "\t// " + comment
+                if not is_type3:
+                    parts.append("\t// " + comment)
 
         # 배열 마지막에 닫는 괄호 추가 (추가 줄바꿈 명시적 포함)
-        if self.dArr[self.currentArr].RowCnt == self.dArr[self.currentArr].ReadSize.Row - 1:
-            src_data_str += "\r\n};\r\n\r\n"  # 추가 줄바꿈 포함
+        if arr.RowCnt == arr.ReadSize.Row - 1:
+            parts.append("\r\n};\r\n\r\n")
 
-        return src_data_str
+        return "".join(parts)
 
     def _apply_float_suffix(self, cell_str):
-        """셀 문자열에 Float Suffix 적용 (04_Python_Migration 방식 개선)"""
-        if not cell_str:
-            return cell_str
-
-        # Cython 버전 우선 사용 (성능 최적화)
-        if ENABLE_FLOAT_SUFFIX and USE_CYTHON_CAL_LIST:
-            fast_add_float_suffix = safe_import_cython_function('code_generator_v2', 'fast_add_float_suffix')
-            if fast_add_float_suffix:
-                try:
-                    return fast_add_float_suffix(cell_str)
-                except Exception:
-                    pass  # 실패 시 Python 폴백
-
-        # Python 폴백 (04_Python_Migration 방식)
+        """셀 문자열에 Float Suffix 적용 (code_generator/float_suffix.py 단일 패스 커널)"""
         if not ENABLE_FLOAT_SUFFIX:
             return cell_str
-
-        # 정규식을 사용한 더 정확한 처리
-        import re
-
-        # 이미 f 접미사가 있는 경우 그대로 반환
-        if cell_str.endswith('f') or cell_str.endswith('F'):
-            return cell_str
-
-        # 주석이 포함된 경우 처리하지 않음
-        if '/*' in cell_str or '//' in cell_str:
-            return cell_str
-
-        try:
-            # 단어별로 분리해서 처리 (정규식 중복 적용 방지)
-            words = re.split(r'(\s+|[^\w\.])', cell_str)
-            result_words = []
-
-            for word in words:
-                if not word or not re.match(r'^\d+\.?\d*$', word):
-                    result_words.append(word)
-                    continue
-
-                # 이미 f가 있으면 건드리지 않음
-                if word.endswith('f') or word.endswith('F'):
-                    result_words.append(word)
-                    continue
-
-                # 소수점이 있는 숫자: 1.5 -> 1.5f, 3. -> 3.f
-                if '.' in word:
-                    result_words.append(word + 'f')
-                # 정수: 1 -> 1.f
-                else:
-                    result_words.append(word + '.f')
-
-            cell_str = ''.join(result_words)
-
-        except Exception as e:
-            # 정규식 오류 시 간단한 방식으로 폴백
-            try:
-                # 소수점이 있는 숫자
-                if '.' in cell_str and cell_str.replace('.', '').replace('-', '').isdigit():
-                    if not cell_str.endswith('f') and not cell_str.endswith('F'):
-                        return cell_str + 'f'
-                # 정수 (0 포함)
-                elif cell_str.isdigit():
-                    return cell_str + '.f'
-                # 음수 정수
-                elif cell_str.startswith('-') and cell_str[1:].isdigit():
-                    return cell_str + '.f'
-            except:
-                pass
-
-        return cell_str
+        return apply_float_suffix(cell_str)
 
     def _apply_float_suffix_to_float32_block(self, block_str):
-        """FLOAT32 블록에 Float Suffix 적용 (04_Python_Migration 방식)"""
-        if not block_str:
-            return block_str
-
-        if not ENABLE_FLOAT_SUFFIX:
-            return block_str
-
-        # Cython 버전 사용 (C 수준 성능 - 정규식 없음)
-        if USE_CYTHON_CAL_LIST:
-            fast_add_float_suffix = safe_import_cython_function('code_generator_v2', 'fast_add_float_suffix')
-            if fast_add_float_suffix:
-                try:
-                    # 1. Float suffix 적용
-                    result = fast_add_float_suffix(block_str)
-                    return result
-                except Exception:
-                    pass  # 실패 시 Python 폴백
-
-        # Python 폴백 (정규식 버전)
-        if not hasattr(self, 'float_suffix_patterns') or not self.float_suffix_patterns:
-            return block_str
-
-        # 주석 보존
-        comments = {}
-        comment_count = 0
-
-        # 블록 주석 처리
-        for comment in self.float_suffix_patterns['block_comment'].finditer(block_str):
-            placeholder = f"__COMMENT_BLOCK_{comment_count}__"
-            comments[placeholder] = comment.group(0)
-            block_str = block_str.replace(comment.group(0), placeholder)
-            comment_count += 1
-
-        # 라인 주석 처리
-        for comment in self.float_suffix_patterns['line_comment'].finditer(block_str):
-            placeholder = f"__COMMENT_LINE_{comment_count}__"
-            comments[placeholder] = comment.group(0)
-            block_str = block_str.replace(comment.group(0), placeholder)
-            comment_count += 1
-
-        # 숫자 패턴 적용
-        block_str = self.float_suffix_patterns['decimal'].sub(r'\1f', block_str)
-        block_str = self.float_suffix_patterns['decimal_point_only'].sub(r'\1f', block_str)
-        block_str = self.float_suffix_patterns['integer'].sub(r'\1.f', block_str)
-        block_str = self.float_suffix_patterns['zero'].sub(r'0.f', block_str)
-
-        # 수식 내 숫자 처리
-        block_str = self.float_suffix_patterns['expression_decimal'].sub(r'\1\2\3f', block_str)
-        block_str = self.float_suffix_patterns['expression_int'].sub(r'\1\2\3.f', block_str)
-
-        # 괄호 내 숫자 처리
-        block_str = self.float_suffix_patterns['paren_decimal'].sub(r'(\1\2f', block_str)
-        block_str = self.float_suffix_patterns['paren_int'].sub(r'(\1\2.f', block_str)
-
-        # 정수형 타입에 잘못 붙은 .f 제거
-        if 'integer_types' in self.float_suffix_patterns:
-            block_str = self.float_suffix_patterns['integer_types'].sub(r'\1\2', block_str)
-
-        # 주석 복원
-        for placeholder, comment in comments.items():
-            block_str = block_str.replace(placeholder, comment)
-
-        return block_str
+        """FLOAT32 블록에 Float Suffix 적용 (블록 전체를 커널에서 한 번에 처리)"""
+        return self._apply_float_suffix(block_str)
 
     def add_float_suffix(self, cell_str, array_type):
         """
@@ -1146,11 +963,11 @@ class CalList:
                     break
 
             self.dTempCode[self.currentTitle].insert(len(self.dTempCode[self.currentTitle]) - cnt,
-                                                    ["$PRGM_END", self.currentPRGM, "", "", "", ""])
+                                                    ("$PRGM_END", self.currentPRGM, "", "", "", ""))
             self.currentPRGM = ""
 
         if key_str in self.fi.dPragma and self.mkMode != EMkMode.PRGM_SET:
-            self.dTempCode[self.currentTitle].append(["$PRGM_SET", key_str, "", "", "", ""])
+            self.dTempCode[self.currentTitle].append(("$PRGM_SET", key_str, "", "", "", ""))
             self.currentPRGM = key_str
 
     def writePragma(self, mode, key_str, empty_line):
@@ -1192,16 +1009,10 @@ class CalList:
         key_str = self.dItem["Keyword"].Str
         desc_str = self.dItem["Description"].Str
 
-        # Cython 최적화 적용 (빠른 검증) - 안전한 동적 import
+        # Cython 최적화 적용 (빠른 검증)
         if USE_CYTHON_CAL_LIST:
-            fast_chk_cal_list_processing = safe_import_cython_function('code_generator_v2', 'fast_chk_cal_list_processing')
-            if fast_chk_cal_list_processing:
-                try:
-                    errors = fast_chk_cal_list_processing(name_str, val_str, type_str, key_str, desc_str)
-                    for error in errors:
-                        logging.debug(f"Validation error at row {row}: {error}")
-                except Exception as e:
-                    logging.debug(f"Cython 검증 처리 중 오류 발생, Python 폴백 사용: {e}")
+            for error in _chk_cal_list_kernel(name_str, val_str, type_str, key_str, desc_str):
+                logging.debug(f"Validation error at row {row}: {error}")
 
         # 기존 Python 버전 (상세 검증)
 
@@ -1231,8 +1042,7 @@ class CalList:
                 else:
                     temp_mk_file = EMkFile.All
 
-                if title not in self.titleList:
-                    self.titleList[title] = temp_mk_file
+                self.titleOrder.append((title, temp_mk_file))
 
             if self.currentTitle.endswith(Info.EndPrjtName) and self.pragSet:
                 Info.WriteErrCell(EErrType.PrgmWrite, self.ShtName, row, self.dItem["OpCode"].Col)
@@ -1275,7 +1085,7 @@ class CalList:
             if self.dArr[self.currentArr].ArrType == EArrType.Type2.value:
                 self.dItem["Value"].Str = ""
                 for i in range(self.dArr[self.currentArr].OrignalSize.Col):
-                    arr_value = Info.ReadCell(self.shtData, row, self.dItem["Value"].Col + 1 + i)
+                    arr_value = self.read_cell(row, self.dItem["Value"].Col + 1 + i)
 
                     if not arr_value:
                         Info.WriteErrCell(EErrType.EmptyCell, self.ShtName, row, self.dItem["Value"].Col + 1 + i)
@@ -1394,18 +1204,6 @@ class CalList:
         key_str = self.dItem["Keyword"].Str
         desc_str = self.dItem["Description"].Str
 
-        # Cython 최적화 적용 (빠른 임시 저장) - 안전한 동적 import
-        if USE_CYTHON_CAL_LIST:
-            fast_save_temp_list_processing = safe_import_cython_function('code_generator_v2', 'fast_save_temp_list_processing')
-            if fast_save_temp_list_processing:
-                try:
-                    temp_item = fast_save_temp_list_processing(op_code_str, key_str, type_str, name_str, val_str, desc_str)
-                    # 결과 검증 후 사용
-                    if temp_item and len(temp_item) == 6:
-                        op_code_str, key_str, type_str, name_str, val_str, desc_str = temp_item
-                except Exception:
-                    pass  # 실패 시 Python 폴백
-
         if (self.mkMode == EMkMode.TITLE or self.mkMode == EMkMode.TITLE_S or
             self.mkMode == EMkMode.TITLE_H):
             self.currentTitle = self.mkMode.name + "+" + key_str
@@ -1415,7 +1213,7 @@ class CalList:
             self.mkMode == EMkMode.TITLE_H):
             self.setPragmaSection(key_str, row)
 
-        self.dTempCode[self.currentTitle].append([op_code_str, key_str, type_str, name_str, val_str, desc_str])
+        self.dTempCode[self.currentTitle].append((op_code_str, key_str, type_str, name_str, val_str, desc_str))
 
         # alignment 정보 저장
         if (self.mkMode == EMkMode.DEFINE or self.mkMode == EMkMode.STR_MEM or
@@ -1459,36 +1257,14 @@ class CalList:
         val_str = line_str[4]
         desc_str = line_str[5]
 
-        # Cython 직접 호출을 통한 통합 처리 (Excel 셀 처리 + 데이터 변환 + Float Suffix)
+        # Cython 통합 처리 (셀 값 문자열화 + Float Suffix)
         if CYTHON_CODE_GEN_AVAILABLE:
             try:
-                # 1. Excel 셀 값 처리 (Cython 직접 호출)
-                try:
-                    from excel_processor_v2 import process_cell_value_fast
-                    val_str = process_cell_value_fast(str(val_str))
-                except ImportError:
-                    val_str = str(val_str) if val_str is not None else ""
-
-                # 2. 데이터 타입 변환 (Cython 직접 호출)
-                if type_str and val_str:
-                    try:
-                        from data_processor import fast_data_type_conversion
-                        converted_data = fast_data_type_conversion([val_str], type_str)
-                        if converted_data and len(converted_data) > 0:
-                            val_str = converted_data[0]
-                    except ImportError:
-                        pass
-
-                # 3. Float Suffix 처리 (이미 enhanced_excel_cell_processing에서 처리됨)
-                # 추가 Float Suffix 처리가 필요한 경우
+                val_str = str(val_str) if val_str is not None else ""
+
+                # Float Suffix 처리
                 if ENABLE_FLOAT_SUFFIX and type_str == "FLOAT32" and val_str:
-                    if USE_CYTHON_CAL_LIST:
-                        fast_add_float_suffix = safe_import_cython_function('code_generator_v2', 'fast_add_float_suffix')
-                        if fast_add_float_suffix:
-                            try:
-                                val_str = fast_add_float_suffix(val_str)
-                            except Exception:
-                                pass
+                    val_str = self._apply_float_suffix(val_str)
             except Exception as e:
                 logging.debug(f"Cython 래퍼 처리 실패, Python 폴백 사용: {e}")
                 # Python 폴백
@@ -1563,7 +1339,7 @@ class CalList:
                     self.mkFile = EMkFile.All
 
             self.prjtDepth = -1
-            self.frontTab = ""
+            self.frontDepth = 0
             self.currentTitle = mk_mode.name + "+" + key_str
             self.currentPrjtDef = ""
 
@@ -1593,38 +1369,14 @@ class CalList:
                     src_data_str += temp_str
 
         elif mk_mode == EMkMode.DEFINE:
-            # Cython 직접 호출을 통한 DEFINE 코드 생성 (안전한 동적 import)
-            if CYTHON_CODE_GEN_AVAILABLE:
-                fast_define_code_generation = safe_import_cython_function('code_generator_v2', 'fast_define_code_generation')
-                if fast_define_code_generation:
-                    try:
-                        temp_str = fast_define_code_generation(
-                            name_str, val_str, desc_str, name_align, val_align, 4  # tab_size=4
-                        )
-                        if temp_str and isinstance(temp_str, str) and "#define" in temp_str:
-                            # Cython DEFINE 코드 생성 성공 (로그 제거)
-                            pass
-                        else:
-                            raise Exception("Cython DEFINE 생성 결과 없음")
-                    except Exception as e:
-                        logging.debug(f"Cython DEFINE 생성 실패, Python 폴백: {e}")
-                        # Python 폴백
-                    pad_tab_cnt = self.calculatePad(name_align, len(name_str), False, 1)
-                    temp_str = "#define\t" + name_str.ljust(pad_tab_cnt, '\t')
-                    if desc_str:
-                        pad_tab_cnt = self.calculatePad(val_align, len(val_str), False, 1)
-                        temp_str += val_str.ljust(pad_tab_cnt, '\t') + desc_str
-                    else:
-                        temp_str += val_str
+            # Cython DEFINE 생성 결과는 항상 같은 Python 결과로 덮어썼으므로 Python 경로만 사용
+            pad_tab_cnt = self.calculatePad(name_align, len(name_str), False, 1)
+            temp_str = "#define\t" + name_str.ljust(pad_tab_cnt, '\t')
+            if desc_str:
+                pad_tab_cnt = self.calculatePad(val_align, len(val_str), False, 1)
+                temp_str += val_str.ljust(pad_tab_cnt, '\t') + desc_str
             else:
-                # 기존 Python 방식
-                pad_tab_cnt = self.calculatePad(name_align, len(name_str), False, 1)
-                temp_str = "#define\t" + name_str.ljust(pad_tab_cnt, '\t')
-                if desc_str:
-                    pad_tab_cnt = self.calculatePad(val_align, len(val_str), False, 1)
-                    temp_str += val_str.ljust(pad_tab_cnt, '\t') + desc_str
-                else:
-                    temp_str += val_str
+                temp_str += val_str
 
             if self.mkFile != EMkFile.Src:
                 hdr_data_str = temp_str
@@ -1807,21 +1559,11 @@ class CalList:
             # Cython 래퍼를 통한 VARIABLE 코드 생성
             if CYTHON_CODE_GEN_AVAILABLE:
                 try:
-                    # Cython 직접 호출로 변수 코드 생성
-                    # 안전한 동적 import 사용
-                    fast_variable_code_generation = safe_import_cython_function('code_generator_v2', 'fast_variable_code_generation')
-                    if fast_variable_code_generation:
-                        try:
-                            generated_code = fast_variable_code_generation(
-                                key_str, type_str, name_str, val_str, desc_str,
-                                key_align, type_align, name_align, val_align, 4  # tab_size=4
-                            )
-                        except Exception:
-                            # Cython 실패 시 Python 폴백
-                            generated_code = (f"const {type_str} {name_str} = {val_str};", f"extern const {type_str} {name_str};")
-                    else:
-                        # Cython 없으면 Python 폴백
-                        generated_code = (f"const {type_str} {name_str} = {val_str};", f"extern const {type_str} {name_str};")
+                    # Cython 커널로 변수 코드 생성 (없거나 실패하면 단순 Python 폴백)
+                    generated_code = _variable_code_kernel(
+                        key_str, type_str, name_str, val_str, desc_str,
+                        key_align, type_align, name_align, val_align, 4  # tab_size=4
+                    )
                     if generated_code and isinstance(generated_code, tuple) and len(generated_code) == 2:
                         # Cython이 반환하는 (src_code, hdr_code) 튜플 사용
                         src_data_str = generated_code[0]
@@ -2012,71 +1754,36 @@ class CalList:
     def writeCode(self, mk_mode, code_str, src):
         """코드 작성"""
         if mk_mode == EMkMode.PRJT_DEF:
-            self.frontTab = ""
-            for i in range(self.prjtDepth, 0, -1):
-                self.frontTab += "\t"
+            self.frontDepth = max(self.prjtDepth, 0)
 
         if code_str or mk_mode == EMkMode.DESCRIPT:
+            code_list = self.dSrcCode[self.currentTitle] if src else self.dHdrCode[self.currentTitle]
+            front = "\t" * self.frontDepth
+
             if "\r\n" in code_str:
                 if code_str.endswith("\r\n"):
                     temp = code_str[:-2]
                 else:
                     temp = code_str
 
-                temp = temp.replace("\r", "")
-                split = temp.split('\n')
+                split = temp.replace("\r", "").split('\n')
 
                 if code_str.endswith("\r\n"):
                     split[-1] += "\r\n"
 
-                for item in split:
-                    if src:
-                        self.dSrcCode[self.currentTitle].append(self.frontTab + item)
-                    else:
-                        self.dHdrCode[self.currentTitle].append(self.frontTab + item)
-            else:
-                if src:
-                    self.dSrcCode[self.currentTitle].append(self.frontTab + code_str)
+                if front:
+                    code_list.extend([front + item for item in split])
                 else:
-                    self.dHdrCode[self.currentTitle].append(self.frontTab + code_str)
+                    code_list.extend(split)
+            else:
+                code_list.append(front + code_str)
 
         if mk_mode == EMkMode.PRJT_DEF and self.currentPrjtDef:
-            self.frontTab += "\t"
+            self.frontDepth += 1
 
     def calculatePad(self, align, str_len, type_flag, add_tab):
-        """패딩 계산 - 간소화"""
-        # 캐시 키 생성 (같은 매개변수로 호출되는 경우가 많음)
-        cache_key = (align, str_len, type_flag, add_tab)
-
-        # 클래스에 캐시 딕셔너리가 없으면 생성
-        if not hasattr(self, 'pad_cache'):
-            self.pad_cache = {}
-
-        # 캐시에 결과가 있으면 반환
-        if cache_key in self.pad_cache:
-            return self.pad_cache[cache_key]
-
-        # 계산 로직
-        rt = 0
-
-        if type_flag:
-            align += 1
-            str_len += 1
-
-        rt = (align // Info.TabSize) - (str_len // Info.TabSize) + 1
-
-        if type_flag:
-            rt += 1
-        else:
-            rt += str_len
-
-        if (align % Info.TabSize) >= (Info.TabSize - add_tab):
-            rt += 1
-
-        # 결과 캐싱
-        self.pad_cache[cache_key] = rt
-
-        return rt
+        """패딩 계산 (code_generator.layout.pad_count - 프로세스 전체 메모이제이션)"""
+        return pad_count(align, str_len, type_flag, add_tab)
 
     def add_float_suffix_v2(self, val_str, type_str):
         """FLOAT32 타입 변수의 숫자에 f 접미사를 추가하는 함수 - Cython 최적화 (V2)"""
@@ -2095,112 +1802,7 @@ class CalList:
         if "FLOAT32" not in type_str:
             return val_str
 
-        # 이미 접미사가 있는 경우는 처리하지 않음
-        if val_str.endswith('f') or val_str.endswith('F'):
-            return val_str
-
-        if USE_CYTHON_CAL_LIST:
-            fast_float_suffix_regex_replacement = safe_import_cython_function('regex_optimizer', 'fast_float_suffix_regex_replacement')
-            if fast_float_suffix_regex_replacement:
-                try:
-                    # Cython 최적화 버전 사용 (C 수준 성능)
-                    return fast_float_suffix_regex_replacement(val_str)
-                except Exception as e:
-                    logging.warning(f"Cython Float Suffix 처리 중 오류 발생, Python 폴백 사용: {e}")
-                    # 오류 발생 시 Python 폴백으로 처리
-
-        # 기존 Python 버전 (폴백) - 들여쓰기 수정
-
-        # 주석 처리 및 문자열 보존
-        comments = {}
-        strings = {}
-        comment_count = 0
-        string_count = 0
-
-        # 블록 주석 처리 - 사전 컴파일된 정규식 사용
-        block_comments = self.block_comment_pattern.finditer(val_str)
-        for comment in block_comments:
-            placeholder = f"__COMMENT_BLOCK_{comment_count}__"
-            comments[placeholder] = comment.group(0)
-            val_str = val_str.replace(comment.group(0), placeholder)
-            comment_count += 1
-
-        # 라인 주석 처리 - 사전 컴파일된 정규식 사용
-        line_comments = self.line_comment_pattern.finditer(val_str)
-        for comment in line_comments:
-            placeholder = f"__COMMENT_LINE_{comment_count}__"
-            comments[placeholder] = comment.group(0)
-            val_str = val_str.replace(comment.group(0), placeholder)
-            comment_count += 1
-
-        # 문자열 리터럴 처리 - 사전 컴파일된 정규식 사용
-        strings_found = self.string_pattern.finditer(val_str)
-        for string in strings_found:
-            placeholder = f"__STRING_{string_count}__"
-            strings[placeholder] = string.group(0)
-            val_str = val_str.replace(string.group(0), placeholder)
-            string_count += 1
-
-        # 배열 인덱스 패턴 보존 - 사전 컴파일된 정규식 사용
-        array_indices = {}
-        idx_count = 0
-
-        array_indices_found = self.array_index_pattern.finditer(val_str)
-        for match in array_indices_found:
-            placeholder = f"__ARRAY_IDX_{idx_count}__"
-            array_indices[placeholder] = match.group(0)
-            val_str = val_str.replace(match.group(0), placeholder)
-            idx_count += 1
-
-        # 배열 캐스팅 패턴 보존 - 사전 컴파일된 정규식 사용
-        cast_count = 0
-        cast_matches = {}
-
-        cast_found = self.cast_pattern.finditer(val_str)
-        for match in cast_found:
-            placeholder = f"__CAST_{cast_count}__"
-            cast_matches[placeholder] = match.group(0)
-            val_str = val_str.replace(match.group(0), placeholder)
-            cast_count += 1
-
-        # 수정할 문자열
-        modified_val = val_str
-
-        # 1. 소수점이 있는 숫자 (x.y 형태): 1.0, 0.5 등 - 사전 컴파일된 정규식 사용
-        modified_val = self.decimal_pattern.sub(r'\1f', modified_val)
-
-        # 2. 소수점 뒤에 숫자가 없는 경우 (x. 형태): 3., 400. 등 - 사전 컴파일된 정규식 사용
-        modified_val = self.decimal_point_only_pattern.sub(r'\1f', modified_val)
-
-        # 3. 정수 리터럴 (단독으로 사용되는 경우만): 1, 2, 3 등 - 사전 컴파일된 정규식 사용
-        modified_val = self.integer_pattern.sub(r'\1.f', modified_val)
-
-        # 4. 0: 제로 (단독으로 사용되는 경우만) - 사전 컴파일된 정규식 사용
-        modified_val = self.zero_pattern.sub(r'0.f', modified_val)
-
-        # 배열 내 단일 값에도 .f 접미사 추가 - 사전 컴파일된 정규식 사용 (기존 로직 유지)
-        modified_val = self.array_value_pattern.sub(r'\1\2.f\3', modified_val)
-
-        # 2차원 배열의 마지막 값에 대한 특별 처리 - 사전 컴파일된 정규식 사용 (기존 로직 유지)
-        modified_val = self.array_last_value_pattern.sub(r'\1\2.f\3', modified_val)
-
-        # 캐스팅 패턴 복원
-        for placeholder, cast in cast_matches.items():
-            modified_val = modified_val.replace(placeholder, cast)
-
-        # 배열 인덱스 복원
-        for placeholder, index in array_indices.items():
-            modified_val = modified_val.replace(placeholder, index)
-
-        # 문자열 복원
-        for placeholder, string in strings.items():
-            modified_val = modified_val.replace(placeholder, string)
-
-        # 주석 복원
-        for placeholder, comment in comments.items():
-            modified_val = modified_val.replace(placeholder, comment)
-
-        return modified_val
+        return apply_float_suffix(val_str)
 
     # cal_list.py에 추가
     def safe_get_from_dict(self, dict_obj, key, default=None):
@@ -2223,7 +1825,7 @@ class CalList:
         try:
             if self.shtData and 0 <= row < len(self.shtData):
                 if 0 <= col < len(self.shtData[row]):
-                    return Info.ReadCell(self.shtData, row, col)
+                    return self.read_cell(row, col)
                 else:
                     logging.warning(f"열 인덱스 범위 초과: row={row}, col={col}, max_col={len(self.shtData[row])-1}")
             else:
@@ -0,0 +1,186 @@
+"""
+CalList 행 해석 엔진 (ReadCalList의 행 단위 상태 기계)
+
+ReadCalList가 행마다 수행하던 chk_op_code → readRow → chkCalList → saveTempList 중
+상태가 단순한 OpCode(SUBTITLE, DESCRIPT, DEFINE, TYPEDEF, STR_MEM, STR_DEF, ENUM, ENUM_MEM,
+ENUM_END, VARIABLE, CODE)는 CellInfos/dItem을 거치지 않고 엔진 안에서 바로 처리합니다.
+- OpCode는 정수 모드 코드 딕셔너리로 한 번에 판별
+- 셀 값은 CalList의 정규화된 시트 뷰(SheetView.read)로 직접 읽음
+- 임시 코드 레코드는 6-튜플 (op, keyword, type, name, value, description)
+- 정렬 길이(itemLength)는 지역 정수로 유지하고 필요할 때만 CalList에 반영
+
+타이틀/배열/프로젝트 정의/프라그마처럼 CalList 상태를 크게 바꾸는 OpCode는
+CalList._process_row()로 넘겨 기존 로직 그대로 처리합니다 (그 전에 마지막 행 상태를 dItem에 반영).
+
+Cython 엔진(cython_extensions.cal_list_engine)이 있으면 같은 동작의 cdef class를 사용합니다.
+"""
+
+import logging
+
+from core.info import Info, EMkMode, EErrType
+
+# 엔진이 직접 처리하는 OpCode 모드 코드 (EMkMode.value)
+_M_SUBTITLE = EMkMode.SUBTITLE.value
+_M_DESCRIPT = EMkMode.DESCRIPT.value
+_M_DEFINE = EMkMode.DEFINE.value
+_M_TYPEDEF = EMkMode.TYPEDEF.value
+_M_STR_MEM = EMkMode.STR_MEM.value
+_M_STR_DEF = EMkMode.STR_DEF.value
+_M_ENUM = EMkMode.ENUM.value
+_M_ENUM_MEM = EMkMode.ENUM_MEM.value
+_M_ENUM_END = EMkMode.ENUM_END.value
+_M_VARIABLE = EMkMode.VARIABLE.value
+_M_CODE = EMkMode.CODE.value
+
+SIMPLE_MODES = frozenset((_M_SUBTITLE, _M_DESCRIPT, _M_DEFINE, _M_TYPEDEF, _M_STR_MEM, _M_STR_DEF,
+                          _M_ENUM, _M_ENUM_MEM, _M_ENUM_END, _M_VARIABLE, _M_CODE))
+
+# 정렬 길이를 갱신하는 모드 / 정렬 길이를 ArrAlignList에 확정하고 초기화하는 모드 (saveTempList와 동일)
+ALIGN_UPDATE_MODES = frozenset((_M_DEFINE, _M_STR_MEM, _M_ENUM_MEM, _M_VARIABLE))
+ALIGN_PUSH_MODES = frozenset((_M_SUBTITLE, _M_DESCRIPT, _M_STR_DEF, _M_ENUM_END))
+
+
+def opcode_table():
+    """OpCode 문자열 → (모드 코드, EMkMode)"""
+    return {op: (mode.value, mode) for op, mode in Info.dOpCode.items()}
+
+
+class CalListRowEnginePython:
+    """CalList 행 해석 엔진 (Python 구현) - Cython CalListRowEngine과 같은 동작"""
+
+    def __init__(self, cal_list):
+        self.cl = cal_list
+        self.read = cal_list.read_cell
+        self.opcodes = opcode_table()
+
+        items = cal_list.dItem
+        self.op_col = items["OpCode"].Col
+        self.key_col = items["Keyword"].Col
+        self.type_col = items["Type"].Col
+        self.name_dflt_col = cal_list.nameDfltCol
+        self.mem_dflt_col = cal_list.memDfltCol
+        self.val_dflt_col = cal_list.valDfltCol
+        self.desc_dflt_col = cal_list.descDfltCol
+
+        # 마지막으로 엔진이 처리한 행의 값 (ARR_MEM 등 넘겨받는 행은 이전 행의 dItem 값을 사용하므로 반영 필요)
+        self.last = None  # (op, key, type, name, val, desc, name_col)
+
+    def _write_err(self, err_type, row, col):
+        Info.WriteErrCell(err_type, self.cl.ShtName, row, col)
+
+    def _sync_to_cal_list(self, lengths):
+        """엔진 상태를 CalList(dItem, itemLength)에 반영"""
+        cl = self.cl
+        cl.itemLength = list(lengths)
+        if self.last is not None:
+            op, key, type_str, name, val, desc, name_col = self.last
+            items = cl.dItem
+            items["OpCode"].Str = op
+            items["Keyword"].Str = key
+            items["Type"].Str = type_str
+            items["Name"].Str = name
+            items["Name"].Col = name_col
+            items["Value"].Str = val
+            items["Value"].Col = self.val_dflt_col
+            items["Description"].Str = desc
+            items["Description"].Col = self.desc_dflt_col
+            self.last = None
+
+    def run(self, start_row: int, end_row: int):
+        """start_row ~ end_row-1 행 처리"""
+        cl = self.cl
+        read = self.read
+        opcodes = self.opcodes
+        write_err = self._write_err
+        empty_err = EErrType.EmptyCell
+        op_col, key_col, type_col = self.op_col, self.key_col, self.type_col
+        val_col, desc_col = self.val_dflt_col, self.desc_dflt_col
+        pragma = cl.fi.dPragma
+        lengths = list(cl.itemLength)
+        last_mode = None
+
+        for row in range(start_row, end_row):
+            op = read(row, op_col)
+            entry = opcodes.get(op)
+            if entry is None:
+                last_mode = EMkMode.NONE
+                if op:
+                    write_err(EErrType.OpCode, row, op_col)
+                continue
+
+            code, mode = entry
+            last_mode = mode
+            if code not in SIMPLE_MODES:
+                # 상태를 크게 바꾸는 행은 기존 CalList 로직으로 처리
+                self._sync_to_cal_list(lengths)
+                cl._process_row(row)
+                lengths = list(cl.itemLength)
+                continue
+
+            name_col = self.mem_dflt_col if code == _M_STR_MEM or code == _M_ENUM_MEM else self.name_dflt_col
+            key = read(row, key_col)
+            type_str = read(row, type_col)
+            name = read(row, name_col)
+            val = read(row, val_col)
+            desc = read(row, desc_col)
+
+            # chkCalList
+            if code == _M_VARIABLE:
+                if not key:
+                    write_err(empty_err, row, key_col)
+                if not type_str:
+                    write_err(empty_err, row, type_col)
+                if not name:
+                    write_err(empty_err, row, name_col)
+                if not val:
+                    write_err(empty_err, row, val_col)
+                elif "[" in val or "]" in val:
+                    write_err(EErrType.OpCode, row, op_col)
+            elif code == _M_DEFINE:
+                if not name:
+                    write_err(empty_err, row, name_col)
+                if not val:
+                    write_err(empty_err, row, val_col)
+            elif code == _M_STR_MEM:
+                if not type_str:
+                    write_err(empty_err, row, type_col)
+                if not name:
+                    write_err(empty_err, row, name_col)
+            elif code in (_M_SUBTITLE, _M_STR_DEF, _M_ENUM_MEM, _M_CODE):
+                if not name:
+                    write_err(empty_err, row, name_col)
+
+            # saveTempList
+            if code == _M_VARIABLE and pragma and (key in pragma or cl.currentPRGM in pragma):
+                cl.mkMode = mode
+                cl.setPragmaSection(key, row)
+            cl.dTempCode[cl.currentTitle].append((op, key, type_str, name, val, desc))
+
+            if code in ALIGN_UPDATE_MODES:
+                if len(key) > lengths[0]:
+                    lengths[0] = len(key)
+                if len(type_str) > lengths[1]:
+                    lengths[1] = len(type_str)
+                if len(name) > lengths[2]:
+                    lengths[2] = len(name)
+                if len(val) > lengths[3]:
+                    lengths[3] = len(val)
+            elif code in ALIGN_PUSH_MODES:
+                cl.ArrAlignList.append(lengths)
+                lengths = [0, 0, 0, 0]
+
+            self.last = (op, key, type_str, name, val, desc, name_col)
+
+        self._sync_to_cal_list(lengths)
+        if last_mode is not None:
+            cl.mkMode = cl.mkModeOld = last_mode
+
+
+# Cython 엔진 안전 import
+try:
+    from cython_extensions.cal_list_engine import CalListRowEngine
+    CAL_LIST_ENGINE_CYTHON = True
+except ImportError:
+    CalListRowEngine = CalListRowEnginePython
+    CAL_LIST_ENGINE_CYTHON = False
+    logging.debug("CalList 행 엔진 Cython 모듈 없음 - Python 구현 사용")
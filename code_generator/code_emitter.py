@@ -0,0 +1,153 @@
+"""
+코드 출력 싱크 (MakeCode가 .c/.h 라인을 내보내는 대상)
+
+- ListSink: QListWidget/LineBuffer(addItem 인터페이스)를 감싸는 어댑터 (GUI 경로, 버퍼만 필요한 경우)
+- FileLineSink: 라인을 받는 즉시 버퍼링된 파일(<파일명>.tmp)에 기록하고 commit() 시 최종 파일로 교체
+  (라인 리스트를 만들지 않으므로 출력 크기와 무관하게 메모리 사용량이 일정)
+
+CalList의 타이틀별 코드 조각(dSrcCode/dHdrCode 리스트)은 add_segment()로 복사 없이 참조하여 기록합니다.
+싱크는 마지막 라인만 기억합니다 (make_code_title의 빈 줄 판단용).
+"""
+
+import os
+import logging
+from typing import Dict, Iterable, List, Optional
+
+# 파일 싱크 쓰기 버퍼 크기
+_FILE_BUFFER_SIZE = 1 << 16
+
+
+class LineSink:
+    """코드 라인 출력 대상 기본 클래스"""
+
+    def __init__(self):
+        self.line_count = 0
+        self.last_line: Optional[str] = None
+
+    def _write(self, line: str):
+        raise NotImplementedError
+
+    def add(self, line: str):
+        self._write(line)
+        self.line_count += 1
+        self.last_line = line
+
+    def add_lines(self, lines: Iterable[str]):
+        for line in lines:
+            self.add(line)
+
+    def add_segment(self, lines: List[str], indent: str = ""):
+        """CalList 코드 조각 기록 (라인 끝 공백 제거 + 들여쓰기, 조각 리스트는 복사하지 않음)"""
+        if not lines:
+            return
+        write = self._write
+        line = ""
+        for line in lines:
+            line = indent + line.rstrip()
+            write(line)
+        self.line_count += len(lines)
+        self.last_line = line
+
+    def last_line_empty(self) -> bool:
+        return self.line_count > 0 and not self.last_line
+
+
+class ListSink(LineSink):
+    """addItem 인터페이스(QListWidget, LineBuffer) 어댑터 - 내용은 위젯이 보관"""
+
+    def __init__(self, widget):
+        super().__init__()
+        self.widget = widget
+
+    def _write(self, line: str):
+        self.widget.addItem(line)
+
+    def last_line_empty(self) -> bool:
+        # 위젯은 외부에서 clear()될 수 있으므로 항상 위젯 상태로 판단
+        count = self.widget.count()
+        if count <= 0:
+            return False
+        item = self.widget.item(count - 1)
+        return bool(item) and not item.text()
+
+
+class FileLineSink(LineSink):
+    """
+    버퍼링된 파일 싱크 - write_group_files와 같은 형식(라인마다 '\\n', UTF-8)으로 기록
+
+    commit()으로 임시 파일을 최종 경로로 교체하고, discard()로 임시 파일을 삭제합니다.
+    QListWidget 호환 메서드(addItem, count, item)도 제공하므로 lb_src/lb_hdr 자리에 그대로 사용할 수 있습니다.
+    """
+
+    def __init__(self, file_path: str):
+        super().__init__()
+        self.file_path = file_path
+        self.temp_path = file_path + ".tmp"
+        self._file = open(self.temp_path, 'w', encoding='utf-8', buffering=_FILE_BUFFER_SIZE)
+
+    def _write(self, line: str):
+        self._file.write(line)
+        self._file.write('\n')
+
+    # QListWidget 호환 (MakeCode 외부에서 lb로 사용되는 경우)
+    def addItem(self, text):
+        self.add(str(text))
+
+    def count(self) -> int:
+        return self.line_count
+
+    def clear(self):
+        """기록 내용 초기화 (임시 파일을 비움)"""
+        self._file.seek(0)
+        self._file.truncate()
+        self.line_count = 0
+        self.last_line = None
+
+    def item(self, index: int):
+        """마지막 라인만 조회 가능 (스트리밍 싱크는 이전 라인을 보관하지 않음)"""
+        if self.line_count and index == self.line_count - 1:
+            return _LastItem(self.last_line)
+        return None
+
+    def commit(self) -> str:
+        """임시 파일을 닫고 최종 파일로 교체 - 최종 경로 반환"""
+        self._file.close()
+        os.replace(self.temp_path, self.file_path)
+        return self.file_path
+
+    def discard(self):
+        """기록 중인 임시 파일 삭제 (생성 실패 시)"""
+        try:
+            if not self._file.closed:
+                self._file.close()
+            if os.path.exists(self.temp_path):
+                os.remove(self.temp_path)
+        except OSError as e:
+            logging.warning(f"⚠ 임시 코드 파일 삭제 실패: {self.temp_path} ({e})")
+
+
+class _LastItem:
+    __slots__ = ('_text',)
+
+    def __init__(self, text):
+        self._text = text
+
+    def text(self) -> str:
+        return self._text
+
+
+def as_sink(target) -> LineSink:
+    """lb_src/lb_hdr 인자를 LineSink로 변환 (이미 싱크면 그대로)"""
+    if isinstance(target, LineSink):
+        return target
+    return ListSink(target)
+
+
+def commit_file_sinks(sinks: Iterable[FileLineSink], file_types: Iterable[str]) -> List[Dict]:
+    """파일 싱크들을 확정하고 write_group_files와 같은 형식의 파일 정보 목록 반환"""
+    written = []
+    for sink, file_type in zip(sinks, file_types):
+        file_path = sink.commit()
+        written.append({'name': os.path.basename(file_path), 'size': os.path.getsize(file_path),
+                        'type': file_type, 'path': file_path})
+    return written
@@ -148,17 +148,45 @@ class FileInfo:
             err_cnt += 1
             Info.WriteErrCell(EErrType.FileName, self.sht_name, self.dFileInfo["S_FILE"].Row, self.dFileInfo["S_FILE"].Col)
         
-        if temp_src_name in Info.FileList:
+        if self.chk_file_exist():
             err_cnt += 1
-            Info.WriteErrCell(EErrType.FileExist, self.sht_name, self.dFileInfo["S_FILE"].Row, self.dFileInfo["S_FILE"].Col)
-        else:
-            Info.FileList.append(temp_src_name)
         
         if err_cnt > 0:
             return True
         else:
             return False
     
+    def chk_file_exist(self):
+        """다른 그룹에서 이미 정의한 파일명인지 확인 (없으면 Info.FileList에 등록)"""
+        temp_src_name = self.dFileInfo["S_FILE"].Str[:-2]
+        if temp_src_name in Info.FileList:
+            Info.WriteErrCell(EErrType.FileExist, self.sht_name, self.dFileInfo["S_FILE"].Row, self.dFileInfo["S_FILE"].Col)
+            return True
+        Info.FileList.append(temp_src_name)
+        return False
+    
+    def export_ir(self) -> Dict:
+        """Read() 결과(파일 경로, 파일 정보 셀, 프라그마) 추출 - 시트 IR 캐시용 (JSON 저장 가능한 값만 사용)"""
+        return {
+            "MkFilePath": self.MkFilePath,
+            "dFileInfo": {key: [cell.Row, cell.Col, cell.Str] for key, cell in self.dFileInfo.items()},
+            "dPragma": {key: [vars(prag) for prag in prag_list] for key, prag_list in self.dPragma.items()}
+        }
+    
+    def apply_ir(self, ir: Dict):
+        """캐시된 Read() 결과 적용 후 파일명 중복 확인 (Read()와 같은 반환값)"""
+        self.MkFilePath = ir["MkFilePath"]
+        self.dFileInfo.clear()
+        self.dFileInfo.update({key: CellInfos(*cell) for key, cell in ir["dFileInfo"].items()})
+        self.dPragma = {}
+        for key, prag_list in ir["dPragma"].items():
+            self.dPragma[key] = []
+            for fields in prag_list:
+                prag = SPragInfo()
+                prag.__dict__.update(fields)
+                self.dPragma[key].append(prag)
+        return self.chk_file_exist()
+    
     def Read(self):
         """파일정보 시트 읽기"""
         err_cnt = 0
@@ -0,0 +1,54 @@
+"""
+FLOAT32 값 Float Suffix 재작성 (단일 패스 토크나이저)
+
+CalList 배열/변수 값에 적용되는 규칙 (기존 CalList._apply_float_suffix와 동일한 결과):
+- 빈 문자열, f/F로 끝나는 값, 주석(/* 또는 //)이 포함된 값은 그대로 반환
+- [\\w.] 연속 구간(토큰)이 \\d+\\.?\\d* 형태인 숫자 리터럴에만 접미사 추가
+  1 → 1.f, 3. → 3.f, 1.5 → 1.5f (1e5, 0x10, .5, 1.2.3, 이름 안의 숫자는 그대로)
+- 큰따옴표 문자열 리터럴("...") 안의 숫자는 건드리지 않음
+
+Cython 커널(cython_extensions.float_suffix)이 있으면 UTF-8 버퍼를 한 번 훑어 처리하고,
+없으면 같은 규칙의 정규식 한 번짜리 치환으로 처리합니다.
+"""
+
+import re
+import logging
+
+# 숫자 리터럴 토큰 또는 문자열 리터럴 (문자열은 그대로 두기 위해 함께 매칭)
+_LITERAL_RE = re.compile(r'"(?:\\.|[^"\\])*"|(?<![\w.])\d+(?:\.\d*)?(?![\w.])')
+
+
+def _suffix_literal(match) -> str:
+    token = match.group(0)
+    if token[0] == '"':
+        return token
+    return token + ('f' if '.' in token else '.f')
+
+
+def rewrite_float_literals_python(text: str) -> str:
+    """숫자 리터럴에 f 접미사 추가 (주석 판단 없이 재작성만) - Cython 커널과 동일한 결과"""
+    return _LITERAL_RE.sub(_suffix_literal, text)
+
+
+def apply_float_suffix_python(text: str) -> str:
+    """CalList Float Suffix 규칙 적용 (Python 구현)"""
+    if not text or text[-1] in 'fF' or '/*' in text or '//' in text:
+        return text
+    return _LITERAL_RE.sub(_suffix_literal, text)
+
+
+# Cython 커널 디스패치 (모듈 로드 시 한 번만 조회, 호출 수는 log_performance_status에서 보고)
+try:
+    from core.kernels import register_kernel
+    apply_float_suffix = register_kernel('apply_float_suffix', 'float_suffix',
+                                         fallback=apply_float_suffix_python)
+    rewrite_float_literals = register_kernel('rewrite_float_literals', 'float_suffix',
+                                             fallback=rewrite_float_literals_python)
+    FLOAT_SUFFIX_KERNEL_AVAILABLE = apply_float_suffix.available
+except ImportError:
+    apply_float_suffix = apply_float_suffix_python
+    rewrite_float_literals = rewrite_float_literals_python
+    FLOAT_SUFFIX_KERNEL_AVAILABLE = False
+
+if not FLOAT_SUFFIX_KERNEL_AVAILABLE:
+    logging.debug("Float Suffix Cython 커널 없음 - Python 구현 사용")
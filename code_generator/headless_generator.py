@@ -0,0 +1,473 @@
+"""
+GUI 비의존 코드 생성 코어
+
+DB 파일 경로를 입력받아 그룹별 .c/.h 코드 버퍼와 오류 목록(Info.ErrList)을 반환합니다.
+진행률 보고와 취소는 Qt 호출 대신 주입된 GenerationObserver를 통해 처리되므로
+워커 스레드, 서브프로세스, CI(명령행) 환경에서 그대로 사용할 수 있습니다.
+"""
+
+import os
+import time
+import logging
+import traceback
+from typing import Dict, List, Optional
+
+from core.info import Info
+from core.data_parser import DataParser
+from code_generator.code_emitter import FileLineSink, commit_file_sinks
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import USE_SHEET_IR_CACHE
+except ImportError:
+    USE_SHEET_IR_CACHE = False
+
+
+class _LineItem:
+    """QListWidgetItem 호환 최소 구현 (text()만 지원)"""
+    __slots__ = ('_text',)
+
+    def __init__(self, text: str):
+        self._text = text
+
+    def text(self) -> str:
+        return self._text
+
+
+class LineBuffer:
+    """
+    MakeCode/CalList가 사용하는 QListWidget 인터페이스(addItem, count, item, clear)의
+    순수 Python 구현 - QApplication 없이 코드 라인을 수집
+    """
+
+    def __init__(self):
+        self._items: List[_LineItem] = []
+
+    def addItem(self, text):
+        self._items.append(_LineItem(str(text)))
+
+    def count(self) -> int:
+        return len(self._items)
+
+    def item(self, index: int) -> Optional[_LineItem]:
+        if 0 <= index < len(self._items):
+            return self._items[index]
+        return None
+
+    def clear(self):
+        self._items = []
+
+    def lines(self) -> List[str]:
+        """수집된 전체 라인 반환"""
+        return [item.text() for item in self._items]
+
+
+class GenerationObserver:
+    """
+    코드 생성 진행률/취소 관찰자 기본 구현 (아무 동작도 하지 않음)
+
+    GUI는 진행률 대화상자 갱신, 워커 프로세스는 큐 전송,
+    CLI는 콘솔 출력 등 필요한 메서드만 재정의하여 사용합니다.
+    """
+
+    def on_progress(self, progress: int, message: str):
+        """진행률 보고 (0~100)"""
+        pass
+
+    def on_group_finished(self, group: 'GeneratedGroup'):
+        """그룹 하나의 코드 생성 완료"""
+        pass
+
+    def is_cancelled(self) -> bool:
+        """True 반환 시 다음 진행률 보고 시점에 InterruptedError로 중단"""
+        return False
+
+    def make_callback(self, base: float = 0.0, span: float = 100.0, prefix: str = ""):
+        """
+        MakeCode/CalList의 progress_callback(progress, message) 형태로 변환
+
+        Args:
+            base: 전체 진행률에서의 시작 위치
+            span: 전체 진행률에서 차지하는 폭
+            prefix: 메시지 앞에 붙일 문자열
+        """
+        def callback(progress_val, message):
+            if self.is_cancelled():
+                raise InterruptedError("사용자가 코드 생성을 취소했습니다.")
+            ratio = max(0, min(100, progress_val)) / 100.0
+            self.on_progress(int(base + ratio * span), f"{prefix}{message}")
+
+        return callback
+
+
+class GeneratedGroup:
+    """그룹($(Group)FileInfo + CalList) 하나의 코드 생성 결과"""
+
+    def __init__(self, group_name: str):
+        self.group_name = group_name
+        self.src_file_name = ""
+        self.hdr_file_name = ""
+        self.src_lines: List[str] = []
+        self.hdr_lines: List[str] = []
+        self.errors: List[str] = []  # Info.ErrList 복사본
+        self.message = ""
+        self.reused = False  # 증분 생성: 변경이 없어 기존 출력 파일 재사용
+        self.written_files: List[Dict] = []  # 스트리밍 생성 시 저장된 파일 정보 (라인 버퍼는 비어 있음)
+
+    @property
+    def success(self) -> bool:
+        return not self.errors and bool(self.src_file_name)
+
+
+class DBGenerationResult:
+    """DB 하나의 코드 생성 결과"""
+
+    def __init__(self, db_file: str):
+        self.db_file = db_file
+        self.db_name = os.path.basename(db_file)
+        self.status = 'failed'  # 'success' / 'failed' / 'skipped' / 'cancelled'
+        self.error = ""
+        self.groups: List[GeneratedGroup] = []
+        self.written_files: List[Dict] = []
+        self.elapsed = 0.0
+
+    @property
+    def errors(self) -> List[str]:
+        """모든 그룹의 오류 목록"""
+        return [err for group in self.groups for err in group.errors]
+
+    @property
+    def message(self) -> str:
+        """그룹별 결과 메시지 합본 (GUI 결과 대화상자용)"""
+        return "".join(group.message for group in self.groups)
+
+
+def classify_dollar_sheets(dollar_sheets: List[Dict]) -> Dict[str, Dict]:
+    """
+    $ 시트를 그룹별(FileInfo 1개 + CalList N개)로 분류
+    (main.generate_code_for_single_db_copy_with_tracking과 동일한 규칙)
+    """
+    d_xls = {}
+
+    for sheet_info in dollar_sheets:
+        sheet_name = sheet_info['name']
+
+        if sheet_name.startswith("$(") and ")" in sheet_name:
+            temp_sht_name = sheet_name[1:].split(')')
+            group_name = temp_sht_name[0].replace("(", "")
+            sheet_type = temp_sht_name[1] if len(temp_sht_name) > 1 else ""
+
+            if group_name not in d_xls:
+                d_xls[group_name] = {"FileInfoSht": None, "CalListSht": []}
+
+            if sheet_type == "FileInfo":
+                d_xls[group_name]["FileInfoSht"] = sheet_info
+            elif sheet_type in ["CalList", "CalData", "Caldata", "COMMON"] or sheet_type.startswith("_") or sheet_type == "END":
+                d_xls[group_name]["CalListSht"].append(sheet_info)
+
+        elif sheet_name.startswith("$") and not sheet_name.startswith("$("):
+            sheet_type = sheet_name[1:].strip()
+            group_name = "Default"
+
+            if group_name not in d_xls:
+                d_xls[group_name] = {"FileInfoSht": None, "CalListSht": []}
+
+            if sheet_type == "FileInfo":
+                d_xls[group_name]["FileInfoSht"] = sheet_info
+            else:
+                # CalData/CalList/_프로젝트/UNDEFINED 및 알 수 없는 타입 모두 CalList로 처리 (C# 호환)
+                d_xls[group_name]["CalListSht"].append(sheet_info)
+
+    return d_xls
+
+
+def resolve_base_name(group_name: str, file_info_sht) -> str:
+    """FileInfo 시트에서 출력 파일명(확장자 제외) 결정"""
+    if file_info_sht is None:
+        return group_name
+
+    s_file = Info.ReadCell(file_info_sht.Data, 9, 3)
+    if s_file and s_file.endswith('.c'):
+        return s_file[:-2]
+
+    s_file_alt = Info.ReadCell(file_info_sht.Data, 8, 2)
+    if s_file_alt and s_file_alt.endswith('.c'):
+        return s_file_alt[:-2]
+
+    return group_name
+
+
+def reset_info_state():
+    """Info 클래스 전역 상태 초기화 (그룹 단위)"""
+    if hasattr(Info, 'ErrList'):
+        Info.ErrList = []
+    if hasattr(Info, 'FileList'):
+        Info.FileList = []
+    if hasattr(Info, 'PrjtList'):
+        Info.PrjtList = []
+
+
+class _GroupSurrogate:
+    """MakeCode 입력용 시트 묶음 (OriginalFileSurrogate와 동일한 속성)"""
+
+    def __init__(self, file_info_sht, cal_list_shts):
+        self.FileInfoSht = file_info_sht
+        self.CalListSht = cal_list_shts
+
+
+def generate_group(source_file_name: str, group_name: str, file_info_sht, cal_list_shts: List,
+                   progress_callback=None, fragment_cache=None, output_dir: Optional[str] = None,
+                   sheet_ir=None) -> GeneratedGroup:
+    """
+    SShtInfo 묶음으로 그룹 하나의 코드를 생성
+
+    output_dir가 없으면 라인 버퍼(src_lines/hdr_lines)만 채우고,
+    있으면 코드를 <파일명>.tmp에 바로 스트리밍한 뒤 성공 시에만 .c/.h로 교체합니다 (written_files).
+
+    Args:
+        source_file_name: 파일 생성 정보에 기록할 원본 이름 (DB 파일명)
+        group_name: 그룹명
+        file_info_sht: FileInfo 시트 SShtInfo
+        cal_list_shts: CalList 시트 SShtInfo 목록
+        progress_callback: progress_callback(progress, message)
+        fragment_cache: 증분 생성용 시트 조각 캐시 (incremental_cache.SheetFragmentCache)
+        output_dir: 지정 시 .c/.h 파일로 스트리밍 저장
+        sheet_ir: 시트 IR 영구 캐시 (sheet_ir_cache.GroupSheetIR) - 캐시된 시트는 파싱 생략
+    """
+    from code_generator.make_code import MakeCode
+
+    group = GeneratedGroup(group_name)
+    reset_info_state()
+
+    base_name = resolve_base_name(group_name, file_info_sht)
+    target_file_name = f"{base_name}.c"
+    if output_dir:
+        lb_src = FileLineSink(os.path.join(output_dir, f"{base_name}.c"))
+        lb_hdr = FileLineSink(os.path.join(output_dir, f"{base_name}.h"))
+    else:
+        lb_src = LineBuffer()
+        lb_hdr = LineBuffer()
+    committed = False
+
+    try:
+        make_code = MakeCode(_GroupSurrogate(file_info_sht, cal_list_shts), lb_src, lb_hdr)
+        make_code.fragment_cache = fragment_cache
+        make_code.sheet_ir = sheet_ir
+
+        if make_code.ChkShtInfo():
+            group.errors = list(Info.ErrList) if Info.ErrList else ["알 수 없는 검증 오류"]
+            group.message = f"❌ 그룹 '{group_name}' 정보 검증 오류:\n" + "\n".join(group.errors) + "\n\n"
+            return group
+
+        make_code.ReadXlstoCode(progress_callback)
+        make_code.ConvXlstoCode(source_file_name, target_file_name, progress_callback)
+
+        if Info.ErrList:
+            group.errors = list(Info.ErrList)
+            group.message = f"❌ 그룹 '{group_name}' 코드 변환 중 오류:\n" + "\n".join(group.errors) + "\n\n"
+            return group
+
+        group.src_file_name = f"{base_name}.c"
+        group.hdr_file_name = f"{base_name}.h"
+        if output_dir:
+            group.written_files = commit_file_sinks((lb_src, lb_hdr), ('C 소스', 'C 헤더'))
+            committed = True
+        else:
+            group.src_lines = lb_src.lines()
+            group.hdr_lines = lb_hdr.lines()
+        group.message = f"✅ 그룹 '{group_name}' 코드 생성 완료: {group.src_file_name}, {group.hdr_file_name}\n\n"
+        return group
+
+    finally:
+        if output_dir and not committed:
+            # 검증/변환 오류 또는 예외 - 기존 출력 파일은 그대로 두고 임시 파일만 삭제
+            lb_src.discard()
+            lb_hdr.discard()
+        reset_info_state()
+
+
+def write_group_files(group: GeneratedGroup, output_dir: str) -> List[Dict]:
+    """그룹 코드 버퍼를 .c/.h 파일로 저장하고 파일 정보 목록 반환"""
+    written = []
+    for file_name, lines, file_type in ((group.src_file_name, group.src_lines, 'C 소스'),
+                                        (group.hdr_file_name, group.hdr_lines, 'C 헤더')):
+        file_path = os.path.join(output_dir, file_name)
+        with open(file_path, 'w', encoding='utf-8') as f:
+            for line in lines:
+                f.write(line + '\n')
+        written.append({'name': file_name, 'size': os.path.getsize(file_path), 'type': file_type, 'path': file_path})
+    return written
+
+
+def _read_lines(file_path: str) -> List[str]:
+    """저장된 코드 파일을 라인 버퍼로 다시 읽기 (write_group_files의 역변환)"""
+    with open(file_path, 'r', encoding='utf-8') as f:
+        return f.read().split('\n')[:-1]
+
+
+def _reuse_group(group_name: str, outputs: List[Dict]) -> GeneratedGroup:
+    """변경 없는 그룹의 기존 출력 파일로 GeneratedGroup 구성"""
+    group = GeneratedGroup(group_name)
+    group.reused = True
+    for output in outputs:
+        if output['name'].endswith('.c'):
+            group.src_file_name = output['name']
+            group.src_lines = _read_lines(output['path'])
+        else:
+            group.hdr_file_name = output['name']
+            group.hdr_lines = _read_lines(output['path'])
+    group.message = f"✅ 그룹 '{group_name}' 변경 없음 (기존 파일 유지): {group.src_file_name}, {group.hdr_file_name}\n\n"
+    return group
+
+
+def generate_database(db_file: str, output_dir: Optional[str] = None,
+                      observer: Optional[GenerationObserver] = None,
+                      incremental: bool = False, use_sheet_ir: Optional[bool] = None) -> DBGenerationResult:
+    """
+    DB 파일 하나의 모든 $ 시트 그룹 코드 생성
+
+    Args:
+        db_file: DB 파일 경로
+        output_dir: 지정 시 .c/.h 파일 저장 (None이면 버퍼만 반환)
+        observer: 진행률/취소 관찰자
+        incremental: 시트 내용 해시 기반 증분 생성 (output_dir 필요)
+        use_sheet_ir: 시트 IR 영구 캐시 사용 여부 (None이면 USE_SHEET_IR_CACHE 설정)
+
+    Returns:
+        DBGenerationResult
+    """
+    from data_manager.db_handler_v2 import DBHandlerV2
+
+    observer = observer or GenerationObserver()
+    result = DBGenerationResult(db_file)
+    start_time = time.time()
+    db_handler = None
+    ir_store = None
+
+    try:
+        db_handler = DBHandlerV2(db_file, read_only=True)  # 코드 생성은 DB 파일을 바꾸지 않음
+
+        sheets = db_handler.get_sheets()
+        dollar_sheets = [s for s in sheets if s.get('is_dollar_sheet', False)]
+        if not dollar_sheets:
+            result.status = 'skipped'
+            result.error = '코드 생성할 $ 시트가 없음'
+            return result
+
+        if output_dir:
+            os.makedirs(output_dir, exist_ok=True)
+
+        cache = None
+        if incremental and output_dir:
+            from code_generator.incremental_cache import IncrementalCodeCache
+            cache = IncrementalCodeCache(output_dir)
+
+        if USE_SHEET_IR_CACHE if use_sheet_ir is None else use_sheet_ir:
+            from code_generator.sheet_ir_cache import SheetIRStore
+            ir_store = SheetIRStore()
+            if not ir_store.available:
+                ir_store = None
+
+        d_xls = classify_dollar_sheets(dollar_sheets)
+        group_count = len(d_xls)
+        span = 100.0 / group_count
+
+        for group_index, (group_name, group_data) in enumerate(d_xls.items()):
+            fileinfo_sheet = group_data["FileInfoSht"]
+            callist_sheets = group_data["CalListSht"]
+
+            if not fileinfo_sheet or not callist_sheets:
+                group = GeneratedGroup(group_name)
+                group.errors = ["FileInfo 또는 CalList 시트 누락"]
+                group.message = f"❌ 그룹 '{group_name}': FileInfo 또는 CalList 시트 누락\n\n"
+                result.groups.append(group)
+                continue
+
+            callback = observer.make_callback(group_index * span, span, f"[{group_name}] ")
+
+            fragment_cache = None
+            group_ir = None
+            if cache is not None or ir_store is not None:
+                file_info_key = (fileinfo_sheet['name'], db_handler.get_sheet_content_hash(fileinfo_sheet['id']))
+                cal_list_keys = [(s['name'], db_handler.get_sheet_content_hash(s['id'])) for s in callist_sheets]
+
+            if cache is not None:
+                outputs = cache.lookup_group(group_name, result.db_name, file_info_key, cal_list_keys)
+                if outputs:
+                    group = _reuse_group(group_name, outputs)
+                    result.groups.append(group)
+                    result.written_files.extend(outputs)
+                    callback(100, "변경 없음 - 기존 파일 유지")
+                    observer.on_group_finished(group)
+                    continue
+
+                fragment_cache = cache.fragment_cache(file_info_key[1], cal_list_keys)
+
+            if ir_store is not None:
+                group_ir = ir_store.group(file_info_key, cal_list_keys)
+
+            callback(0, "시트 데이터 로드 중...")
+
+            try:
+                # FileInfo는 파일명 결정에 셀을 직접 읽으므로 항상 로드, IR이 있는 CalList 시트는 데이터 로드 생략
+                file_info_sht = DataParser.prepare_sheet_for_existing_code(
+                    fileinfo_sheet['name'], db_handler.get_sheet_data_for_code_gen(fileinfo_sheet['id']))
+                cal_list_shts = [DataParser.prepare_sheet_for_existing_code(
+                    cal_sheet['name'],
+                    [] if group_ir is not None and group_ir.has_cal_list(index) else db_handler.get_sheet_data_for_code_gen(cal_sheet['id']))
+                    for index, cal_sheet in enumerate(callist_sheets)]
+                if group_ir is not None and group_ir.hits:
+                    logging.info(f"시트 IR 캐시 [{group_name}]: {group_ir.hits}/{len(callist_sheets) + 1}개 시트 파싱 생략")
+
+                group = generate_group(result.db_name, group_name, file_info_sht, cal_list_shts, callback, fragment_cache,
+                                       output_dir, group_ir)
+            except InterruptedError:
+                raise
+            except Exception as group_error:
+                logging.error(f"그룹 '{group_name}' 처리 중 예외 발생: {group_error}\n{traceback.format_exc()}")
+                group = GeneratedGroup(group_name)
+                group.errors = [str(group_error)]
+                group.message = f"❌ 그룹 '{group_name}' 처리 중 예외 발생: {str(group_error)}\n\n"
+
+            result.groups.append(group)
+
+            if output_dir and group.success:
+                written = group.written_files
+                result.written_files.extend(written)
+                if cache is not None:
+                    cache.record_group(group_name, result.db_name, file_info_key, cal_list_keys, written, fragment_cache)
+                    logging.info(f"증분 생성 [{group_name}]: 시트 조각 재사용 {fragment_cache.hits}개, 재생성 {len(cal_list_keys) - fragment_cache.hits}개")
+            elif cache is not None:
+                cache.forget_group(group_name)
+
+            observer.on_group_finished(group)
+
+        if cache is not None:
+            cache.save(list(d_xls.keys()))
+        if ir_store is not None:
+            ir_store.flush()
+
+        if any(group.success for group in result.groups):
+            result.status = 'success'
+        else:
+            result.error = f'파일 생성 실패: 생성된 파일이 없습니다.\n결과: {result.message}'
+
+        if result.errors:
+            logging.warning(f"DB '{result.db_name}' 코드 생성 중 일부 오류 발생 ({len(result.errors)}건)")
+
+        observer.on_progress(100, "코드 생성 완료")
+
+    except InterruptedError as e:
+        result.status = 'cancelled'
+        result.error = f'사용자 취소: {str(e)}'
+    except Exception as e:
+        result.error = str(e)
+        logging.error(f"❌ DB 코드 생성 실패 [{result.db_name}]: {e}\n{traceback.format_exc()}")
+    finally:
+        if ir_store is not None:
+            ir_store.close()
+        if db_handler is not None:
+            db_handler.disconnect()
+        result.elapsed = time.time() - start_time
+
+    return result
@@ -0,0 +1,266 @@
+"""
+증분 코드 생성 캐시
+
+시트별 내용 해시(DBHandlerV2.get_sheet_content_hash)와 그룹별 생성 파일 목록을
+출력 디렉토리의 .codegen_cache/manifest.json에 기록합니다.
+
+- 그룹의 모든 시트 해시가 같고 출력 파일이 그대로면 그룹 전체를 건너뜁니다.
+- 일부 시트만 바뀐 경우 바뀐 시트만 ReadCalList를 다시 수행하고,
+  나머지 시트는 캐시된 dSrcCode/dHdrCode 조각(fragments/*.json)을 재사용합니다.
+- 조각은 JSON으로 저장 (캐시 파일을 읽어도 코드가 실행되지 않음)
+"""
+
+import os
+import json
+import hashlib
+import logging
+from typing import Dict, List, Optional, Tuple
+
+from core.info import Info
+
+CACHE_FORMAT_VERSION = 2
+CACHE_DIR_NAME = ".codegen_cache"
+MANIFEST_FILE_NAME = "manifest.json"
+FRAGMENT_SUFFIX = ".json"
+
+# 생성 결과에 영향을 주는 모듈 (저장소 루트 기준) - 소스가 바뀌면 캐시 전체 무효화
+# (SheetIRCache 키도 이 지문을 사용하므로 시트 IR을 만드는 모듈도 포함)
+_GENERATOR_MODULES = (
+    "code_generator/cal_list.py",
+    "code_generator/cal_list_engine.py",
+    "code_generator/code_emitter.py",
+    "code_generator/file_info.py",
+    "code_generator/float_suffix.py",
+    "code_generator/layout.py",
+    "code_generator/make_code.py",
+    "code_generator/sheet_ir_cache.py",
+    "core/info.py",
+    "core/kernels.py",
+    "core/sheet_view.py",
+    "core/sparse_sheet.py",
+)
+
+# 생성 경로에서 사용하는 Cython 커널 (cython_extensions.<이름>) - 컴파일된 바이너리 내용을 지문에 포함
+_GENERATOR_KERNELS = ("cal_list_engine", "code_generator_v2", "float_suffix", "sparse_sheet")
+
+_fingerprint_cache: Optional[str] = None
+
+
+def generator_fingerprint() -> str:
+    """코드 생성기 버전/설정 지문 (생성 로직이나 Float Suffix 설정이 바뀌면 달라짐)"""
+    global _fingerprint_cache
+    if _fingerprint_cache is not None:
+        return _fingerprint_cache
+
+    hasher = hashlib.sha1()
+    hasher.update(f"{CACHE_FORMAT_VERSION}|{Info.APP_VERSION}".encode('utf-8'))
+
+    try:
+        from core.performance_settings import ENABLE_FLOAT_SUFFIX
+    except ImportError:
+        ENABLE_FLOAT_SUFFIX = True
+    from code_generator.cal_list import CYTHON_CODE_GEN_AVAILABLE
+    hasher.update(f"|{ENABLE_FLOAT_SUFFIX}|{CYTHON_CODE_GEN_AVAILABLE}".encode('utf-8'))
+
+    root_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    for module_name in _GENERATOR_MODULES:
+        hasher.update(f"|{module_name}|".encode('utf-8'))
+        _hash_file(hasher, os.path.join(root_dir, *module_name.split("/")))
+
+    for kernel_name in _GENERATOR_KERNELS:
+        hasher.update(f"|{kernel_name}|".encode('utf-8'))
+        binary_path = _extension_binary(kernel_name)
+        if binary_path:
+            _hash_file(hasher, binary_path)
+
+    _fingerprint_cache = hasher.hexdigest()
+    return _fingerprint_cache
+
+
+def _hash_file(hasher, file_path: str):
+    try:
+        with open(file_path, 'rb') as f:
+            for block in iter(lambda: f.read(1 << 20), b""):
+                hasher.update(block)
+    except OSError:
+        # 패키징된 환경 등 소스가 없으면 버전 정보만 사용
+        hasher.update(b"-")
+
+
+def _extension_binary(kernel_name: str) -> Optional[str]:
+    """컴파일된 cython_extensions.<kernel_name> 파일 경로 (없거나 Python 모듈이면 None, import하지 않음)"""
+    import importlib.machinery
+    import importlib.util
+    try:
+        spec = importlib.util.find_spec(f"cython_extensions.{kernel_name}")
+    except (ImportError, ValueError):
+        return None
+    origin = getattr(spec, "origin", None) if spec is not None else None
+    if origin and origin.endswith(tuple(importlib.machinery.EXTENSION_SUFFIXES)):
+        return origin
+    return None
+
+
+def _file_stamp(file_path: str) -> Optional[List[int]]:
+    """출력 파일 변경 감지용 (크기, 수정시각)"""
+    try:
+        stat = os.stat(file_path)
+        return [stat.st_size, stat.st_mtime_ns]
+    except OSError:
+        return None
+
+
+class SheetFragmentCache:
+    """
+    그룹 하나에 대한 CalList 시트 조각 캐시 (MakeCode.fragment_cache 인터페이스)
+
+    조각 키는 (생성기 지문, FileInfo 해시, 시트명, 시트 해시)로 결정되므로
+    FileInfo 시트가 바뀌면 해당 그룹의 모든 조각이 자동으로 무효화됩니다.
+    """
+
+    def __init__(self, fragment_dir: str, file_info_hash: str, sheet_hashes: List[Tuple[str, str]]):
+        self.fragment_dir = fragment_dir
+        self.keys = []
+        for sheet_name, sheet_hash in sheet_hashes:
+            key_src = f"{generator_fingerprint()}|{file_info_hash}|{sheet_name}|{sheet_hash}"
+            self.keys.append(hashlib.sha1(key_src.encode('utf-8')).hexdigest())
+        self.hits = 0
+        self.misses = 0
+
+    def _path(self, index: int) -> str:
+        return os.path.join(self.fragment_dir, f"{self.keys[index]}{FRAGMENT_SUFFIX}")
+
+    def restore(self, index: int, cal_list) -> bool:
+        """캐시된 조각이 있으면 cal_list에 적용하고 True 반환"""
+        if index >= len(self.keys):
+            return False
+        try:
+            with open(self._path(index), 'r', encoding='utf-8') as f:
+                fragment = json.load(f)
+            cal_list.apply_fragment(fragment)
+        except (OSError, ValueError, KeyError, TypeError):
+            # 없거나 손상된 조각 - ReadCalList로 다시 생성
+            self.misses += 1
+            return False
+
+        self.hits += 1
+        return True
+
+    def store(self, index: int, cal_list):
+        """ReadCalList 결과 조각 저장"""
+        if index >= len(self.keys):
+            return
+        try:
+            os.makedirs(self.fragment_dir, exist_ok=True)
+            temp_path = self._path(index) + ".tmp"
+            with open(temp_path, 'w', encoding='utf-8') as f:
+                json.dump(cal_list.export_fragment(), f, ensure_ascii=False, separators=(',', ':'))
+            os.replace(temp_path, self._path(index))
+        except (OSError, TypeError, ValueError) as e:
+            logging.warning(f"⚠ 코드 조각 캐시 저장 실패 ({cal_list.ShtName}): {e}")
+
+
+class IncrementalCodeCache:
+    """출력 디렉토리 단위 증분 생성 매니페스트"""
+
+    def __init__(self, output_dir: str):
+        self.output_dir = output_dir
+        self.cache_dir = os.path.join(output_dir, CACHE_DIR_NAME)
+        self.fragment_dir = os.path.join(self.cache_dir, "fragments")
+        self.manifest_path = os.path.join(self.cache_dir, MANIFEST_FILE_NAME)
+        self.manifest = self._load_manifest()
+
+    def _empty_manifest(self) -> Dict:
+        return {"version": CACHE_FORMAT_VERSION, "fingerprint": generator_fingerprint(), "groups": {}}
+
+    def _load_manifest(self) -> Dict:
+        try:
+            with open(self.manifest_path, 'r', encoding='utf-8') as f:
+                manifest = json.load(f)
+        except (OSError, ValueError):
+            return self._empty_manifest()
+
+        if manifest.get("version") != CACHE_FORMAT_VERSION or manifest.get("fingerprint") != generator_fingerprint():
+            logging.info("코드 생성기 변경 감지 - 증분 생성 캐시 초기화")
+            return self._empty_manifest()
+        return manifest
+
+    @staticmethod
+    def _signature(db_name: str, file_info: Tuple[str, str], cal_lists: List[Tuple[str, str]]) -> Dict:
+        return {
+            "db_name": db_name,
+            "file_info": list(file_info),
+            "cal_lists": [list(item) for item in cal_lists]
+        }
+
+    def lookup_group(self, group_name: str, db_name: str, file_info: Tuple[str, str],
+                     cal_lists: List[Tuple[str, str]]) -> Optional[List[Dict]]:
+        """
+        그룹이 변경되지 않았으면 이전 출력 파일 정보 목록 반환
+
+        Args:
+            file_info: (FileInfo 시트명, 해시)
+            cal_lists: [(CalList 시트명, 해시), ...] - 순서 포함 비교
+        """
+        entry = self.manifest["groups"].get(group_name)
+        if not entry or entry.get("signature") != self._signature(db_name, file_info, cal_lists):
+            return None
+
+        outputs = []
+        for output in entry.get("outputs", []):
+            file_path = os.path.join(self.output_dir, output["name"])
+            if _file_stamp(file_path) != output.get("stamp"):
+                return None
+            outputs.append({'name': output["name"], 'size': output["stamp"][0], 'type': output["type"], 'path': file_path})
+        return outputs or None
+
+    def fragment_cache(self, file_info_hash: str, cal_lists: List[Tuple[str, str]]) -> SheetFragmentCache:
+        """그룹용 시트 조각 캐시 생성"""
+        return SheetFragmentCache(self.fragment_dir, file_info_hash, cal_lists)
+
+    def record_group(self, group_name: str, db_name: str, file_info: Tuple[str, str],
+                     cal_lists: List[Tuple[str, str]], written_files: List[Dict],
+                     fragment_cache: Optional[SheetFragmentCache] = None):
+        """그룹 생성 결과를 매니페스트에 기록"""
+        self.manifest["groups"][group_name] = {
+            "signature": self._signature(db_name, file_info, cal_lists),
+            "outputs": [{"name": f['name'], "type": f['type'], "stamp": _file_stamp(f['path'])} for f in written_files],
+            "fragments": list(fragment_cache.keys) if fragment_cache else []
+        }
+
+    def forget_group(self, group_name: str):
+        """실패한 그룹은 매니페스트에서 제거 (다음 생성 시 전체 재생성)"""
+        self.manifest["groups"].pop(group_name, None)
+
+    def save(self, active_groups: Optional[List[str]] = None):
+        """
+        매니페스트 저장 및 사용되지 않는 조각 파일 정리
+
+        Args:
+            active_groups: 이번 생성에서 존재한 그룹 목록 (나머지 그룹 항목은 제거)
+        """
+        if active_groups is not None:
+            for group_name in list(self.manifest["groups"]):
+                if group_name not in active_groups:
+                    del self.manifest["groups"][group_name]
+
+        try:
+            os.makedirs(self.cache_dir, exist_ok=True)
+            temp_path = self.manifest_path + ".tmp"
+            with open(temp_path, 'w', encoding='utf-8') as f:
+                json.dump(self.manifest, f, ensure_ascii=False, indent=1)
+            os.replace(temp_path, self.manifest_path)
+        except OSError as e:
+            logging.warning(f"⚠ 증분 생성 매니페스트 저장 실패: {e}")
+            return
+
+        referenced = {key for entry in self.manifest["groups"].values() for key in entry.get("fragments", [])}
+        if os.path.isdir(self.fragment_dir):
+            for file_name in os.listdir(self.fragment_dir):
+                key, suffix = os.path.splitext(file_name)
+                # 이전 형식(.pkl) 조각도 함께 정리
+                if suffix == ".pkl" or (suffix == FRAGMENT_SUFFIX and key not in referenced):
+                    try:
+                        os.remove(os.path.join(self.fragment_dir, file_name))
+                    except OSError:
+                        pass
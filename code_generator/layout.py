@@ -0,0 +1,90 @@
+"""
+코드 정렬(탭 패딩) 레이아웃
+
+- pad_count: CalList.calculatePad 계산 결과를 프로세스 전체에서 메모이제이션 (인스턴스별 캐시 대신)
+- tabs / spaces: 길이별로 미리 만든 탭/공백 문자열 조회 (ljust 반복 대신 테이블 조회)
+- ArrayLayout: 배열(ArrInfos) 하나의 열별 정렬 정보를 한 번에 계산해 두고
+  writeArrMem이 행마다 열 정보를 다시 계산하지 않도록 함
+
+패딩 계산식은 calculatePad와 동일합니다 (Info.TabSize 기준).
+"""
+
+from functools import lru_cache
+from typing import List
+
+from core.info import Info
+
+TAB_SIZE = Info.TabSize
+
+# 자주 쓰이는 길이의 탭/공백 문자열 테이블
+_RUN_TABLE_SIZE = 128
+_TAB_RUNS = ["\t" * n for n in range(_RUN_TABLE_SIZE)]
+_SPACE_RUNS = [" " * n for n in range(_RUN_TABLE_SIZE)]
+
+
+def tabs(count: int) -> str:
+    """탭 count개 (0 이하이면 빈 문자열)"""
+    if count <= 0:
+        return ""
+    if count < _RUN_TABLE_SIZE:
+        return _TAB_RUNS[count]
+    return "\t" * count
+
+
+def spaces(count: int) -> str:
+    """공백 count개 (0 이하이면 빈 문자열)"""
+    if count <= 0:
+        return ""
+    if count < _RUN_TABLE_SIZE:
+        return _SPACE_RUNS[count]
+    return " " * count
+
+
+@lru_cache(maxsize=8192)
+def pad_count(align: int, str_len: int, type_flag: bool, add_tab: int) -> int:
+    """패딩 탭 수 계산 (CalList.calculatePad와 동일)"""
+    if type_flag:
+        align += 1
+        str_len += 1
+
+    rt = (align // TAB_SIZE) - (str_len // TAB_SIZE) + 1
+
+    if type_flag:
+        rt += 1
+    else:
+        rt += str_len
+
+    if (align % TAB_SIZE) >= (TAB_SIZE - add_tab):
+        rt += 1
+
+    return rt
+
+
+def _type_pad_base(align: int) -> int:
+    """pad_count(align - 1, L - 1, True, 1) == _type_pad_base(align) - L // TAB_SIZE"""
+    return align // TAB_SIZE + 2 + (1 if align % TAB_SIZE >= TAB_SIZE - 1 else 0)
+
+
+class ArrayLayout:
+    """
+    배열 하나의 열별 정렬 정보 (readyArrMemMake 이후 AlignmentSize/AnnotateCol이 확정된 상태에서 생성)
+
+    comma_base[c]: 콤마 뒤 탭 패딩 기준값 - 탭 수 = comma_base[c] - (셀 바이트 길이 + 1) // TAB_SIZE
+    last_base[c]: 마지막 열 뒤 탭 패딩 기준값 - 탭 수 = last_base[c] - 셀 바이트 길이 // TAB_SIZE
+    """
+    __slots__ = ('align', 'align_count', 'annotate_rows', 'annotate_col', 'annotate_first', 'annotate_next',
+                 'comma_base', 'last_base')
+
+    def __init__(self, arr: 'ArrInfos', col_count: int):
+        align: List[int] = list(arr.AlignmentSize)
+        annotate_cols = set(arr.AnnotateCol)
+
+        self.align = align
+        self.align_count = len(align)
+        self.annotate_rows = frozenset(arr.AnnotateRow)
+        self.annotate_col = [c in annotate_cols for c in range(col_count)]
+        # 주석 블록의 첫 열 (이전 열이 주석 열이 아님) / 다음 열도 주석 열
+        self.annotate_first = [c == 0 or (c - 1) not in annotate_cols for c in range(col_count)]
+        self.annotate_next = [(c + 1) in annotate_cols for c in range(col_count)]
+        self.comma_base = [_type_pad_base(a + 1) for a in align]
+        self.last_base = [_type_pad_base(a) for a in align]
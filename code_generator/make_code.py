@@ -1,28 +1,24 @@
 from typing import Dict, List, Optional
-from PySide6.QtWidgets import QListWidget
 import os
 from datetime import datetime
 
 from core.info import Info, EErrType, EMkFile, EMkMode, CellInfos
 from code_generator.file_info import FileInfo
 from code_generator.cal_list import CalList
+from code_generator.code_emitter import as_sink
 
 # 메인 코드 최상단에 추가
 import traceback
 import logging
 import sys
 
-# Cython 최적화 함수들을 필요할 때 동적으로 import (안전한 방식)
-def safe_import_cython_function(module_name, function_name):
-    """Cython 함수를 안전하게 import하는 헬퍼 함수"""
-    try:
-        # cython_extensions 경로 추가
-        if not module_name.startswith('cython_extensions.'):
-            module_name = f'cython_extensions.{module_name}'
-        module = __import__(module_name, fromlist=[function_name])
-        return getattr(module, function_name)
-    except (ImportError, AttributeError):
-        return None
+# Cython 커널 디스패치 (모듈 로드 시 한 번만 조회)
+from core.kernels import register_kernel
+
+# 계측 (비활성화 시 no-op)
+from core.tracing import tracer, traced
+
+_write_cal_list_kernel = register_kernel('fast_write_cal_list_processing', 'code_generator_v2')
 
 # 성능 설정 안전 import
 try:
@@ -46,6 +42,9 @@ class MakeCode:
         self.of = of
         self.lb_src = lb_src
         self.lb_hdr = lb_hdr
+        # 출력 싱크 (QListWidget/LineBuffer는 어댑터로 감싸고, FileLineSink는 그대로 파일에 스트리밍)
+        self.src_sink = as_sink(lb_src)
+        self.hdr_sink = as_sink(lb_hdr)
 
         self.dFileInfo: Dict[str, CellInfos] = {}
         self.titleList: Dict[str, int] = {}
@@ -59,6 +58,14 @@ class MakeCode:
         self.MkFilePath = ""
         self.prjt_def_title = ""  # 추가된 변수
 
+        # 증분 생성용 시트 조각 캐시 (restore(index, cl) / store(index, cl) 제공 객체, 없으면 항상 전체 생성)
+        self.fragment_cache = None
+
+        # 시트 IR 영구 캐시 (sheet_ir_cache.GroupSheetIR, 없으면 항상 시트를 파싱)
+        self.sheet_ir = None
+        self.ir_restored = set()  # IR로 ChkCalListPos/ReadCalList 결과를 복원한 CalList 인덱스
+
+    @traced("make_code.chk_sht_info", "code_gen")
     def ChkShtInfo(self):
         """시트 정보 체크"""
         err_ret = False
@@ -68,7 +75,11 @@ class MakeCode:
         self.dFileInfo = {}
         self.fi = FileInfo(self.of.FileInfoSht, self.dFileInfo)
 
-        err_ret = self.fi.Read()
+        err_ret = self.sheet_ir.restore_file_info(self.fi) if self.sheet_ir is not None else None
+        if err_ret is None:
+            err_ret = self.fi.Read()
+            if not err_ret and self.sheet_ir is not None:
+                self.sheet_ir.store_file_info(self.fi)
         if err_ret:
             err_cnt += 1
         else:
@@ -79,10 +90,16 @@ class MakeCode:
         # CalList 시트 체크
         self.titleList = {}
         self.cl = []
+        self.ir_restored = set()
 
         for i in range(len(self.of.CalListSht)):
             self.cl.append(CalList(self.fi, self.titleList, self.of.CalListSht[i]))
-            err_ret = self.cl[i].ChkCalListPos()
+            if self.sheet_ir is not None and self.sheet_ir.restore_cal_list(i, self.cl[i]):
+                self.ir_restored.add(i)
+                err_ret = False
+            else:
+                with tracer.span("cal_list.chk_pos", "code_gen", sheet=self.cl[i].ShtName):
+                    err_ret = self.cl[i].ChkCalListPos()
 
             if err_ret:
                 err_cnt += 1
@@ -144,11 +161,11 @@ class MakeCode:
 
         return err_flag
 
+    @traced("make_code.read_xls", "code_gen")
     def ReadXlstoCode(self, progress_callback=None):
         """엑셀 파일 읽고 코드 생성 - 응답성 개선"""
         import time
         import os
-        from PySide6.QtWidgets import QApplication
 
         # psutil 모듈 확인 및 메모리 모니터링 설정
         try:
@@ -194,9 +211,6 @@ class MakeCode:
 
                 logging.info(f"시트 {i+1}/{len(self.cl)} 처리 중: {self.cl[i].ShtName}")
 
-                # UI 응답성 유지 - 더 자주 호출
-                QApplication.processEvents()
-
                 # 메모리 사용량 체크 (2GB 제한)
                 if memory_monitoring:
                     current_memory = process.memory_info().rss / 1024 / 1024  # MB
@@ -218,16 +232,27 @@ class MakeCode:
                         except InterruptedError:
                             raise
 
-                    # UI 응답성 유지
-                    QApplication.processEvents()
-
                     try:
-                        self.cl[i].ReadCalList(progress_callback)
+                        if i in self.ir_restored:
+                            logging.info(f"시트 {self.cl[i].ShtName} 변경 없음 - 시트 IR 캐시 사용")
+                        elif self.fragment_cache is not None and self.fragment_cache.restore(i, self.cl[i]):
+                            logging.info(f"시트 {self.cl[i].ShtName} 변경 없음 - 캐시된 코드 조각 사용")
+                        else:
+                            err_cnt_before = len(Info.ErrList)
+                            self.cl[i].ReadCalList(progress_callback)
+                            if len(Info.ErrList) == err_cnt_before:
+                                if self.fragment_cache is not None:
+                                    self.fragment_cache.store(i, self.cl[i])
+                                if self.sheet_ir is not None:
+                                    self.sheet_ir.store_cal_list(i, self.cl[i])
                     except InterruptedError as e:
                         # 사용자가 취소한 경우
                         logging.info(f"시트 {self.cl[i].ShtName} 처리 중 사용자가 취소함: {str(e)}")
                         raise  # 예외를 상위로 전파
 
+                    # 타이틀 등록 (시트 순서대로 - 먼저 등록된 시트의 생성 파일 설정 유지)
+                    self.cl[i].register_titles()
+
                     # 시트 처리 완료 알림
                     if progress_callback:
                         try:
@@ -263,10 +288,10 @@ class MakeCode:
         else:
             logging.info(f"ReadXlstoCode 완료 (소요시간: {time.time() - start_time:.1f}초)")
 
+    @traced("make_code.conv_code", "code_gen")
     def ConvXlstoCode(self, source_file_name="", target_file_name="", progress_callback=None):
         """엑셀 파일 변환하여 코드 생성 - 응답성 개선"""
         import time
-        from PySide6.QtWidgets import QApplication
 
         start_time = time.time()
 
@@ -287,7 +312,6 @@ class MakeCode:
                 raise  # 예외를 상위로 전파
 
         self.make_conv_info_code(source_file_name)
-        QApplication.processEvents()
 
         if progress_callback:
             try:
@@ -297,7 +321,6 @@ class MakeCode:
                 logging.info(f"시작 코드 생성 중 사용자가 취소함: {str(e)}")
                 raise
         self.make_start_code()
-        QApplication.processEvents()
 
         if progress_callback:
             try:
@@ -307,7 +330,6 @@ class MakeCode:
                 logging.info(f"파일 정보 코드 생성 중 사용자가 취소함: {str(e)}")
                 raise
         self.make_file_info_code(target_file_name)
-        QApplication.processEvents()
 
         if progress_callback:
             try:
@@ -317,7 +339,6 @@ class MakeCode:
                 logging.info(f"CAL 리스트 코드 생성 중 사용자가 취소함: {str(e)}")
                 raise
         self.make_cal_list_code()
-        QApplication.processEvents()
 
         if progress_callback:
             try:
@@ -327,7 +348,6 @@ class MakeCode:
                 logging.info(f"종료 코드 생성 중 사용자가 취소함: {str(e)}")
                 raise
         self.make_end_code()
-        QApplication.processEvents()
 
         if progress_callback:
             try:
@@ -387,11 +407,9 @@ class MakeCode:
         conv_info_lines.append("*/")
         conv_info_lines.append("")
 
-        # 소스 및 헤더 파일 모두에 추가 - UI 배치 최적화 (한 번에 추가)
-        for line in conv_info_lines:
-            self.lb_src.addItem(line)
-        for line in conv_info_lines:
-            self.lb_hdr.addItem(line)
+        # 소스 및 헤더 파일 모두에 추가
+        self.src_sink.add_lines(conv_info_lines)
+        self.hdr_sink.add_lines(conv_info_lines)
 
     def make_start_code(self):
         """시작 코드 생성 - 성능 최적화"""
@@ -411,12 +429,8 @@ class MakeCode:
         hdr_lines = common_lines.copy()
         hdr_lines[1:1] = ["*                                   H E A D E R   F I L E                                   *"]
 
-        # 한 번에 추가
-        for line in src_lines:
-            self.lb_src.addItem(line)
-
-        for line in hdr_lines:
-            self.lb_hdr.addItem(line)
+        self.src_sink.add_lines(src_lines)
+        self.hdr_sink.add_lines(hdr_lines)
 
     def make_file_info_code(self, target_file_name=""):
         """파일 정보 코드 생성 - 안전성 강화"""
@@ -460,27 +474,25 @@ class MakeCode:
             # 기본 파일 정보 생성
             self.fi.Write()
 
-        # 소스/헤더 리스트를 한 번에 추가 - UI 배치 최적화
-        for src in self.fi.SrcList:
-            self.lb_src.addItem(src)
-        for hdr in self.fi.HdrList:
-            self.lb_hdr.addItem(hdr)
+        # 소스/헤더 파일 정보 라인 기록
+        self.src_sink.add_lines(self.fi.SrcList)
+        self.hdr_sink.add_lines(self.fi.HdrList)
 
         # 인클루드 코드 생성 (최적화된 버전 사용)
-        self.make_include_code(True, self.lb_src, target_file_name)
-        self.make_include_code(False, self.lb_hdr, target_file_name)
+        self.make_include_code(True, self.src_sink, target_file_name)
+        self.make_include_code(False, self.hdr_sink, target_file_name)
 
-    def make_include_code(self, is_src, lb, target_file_name=""):
+    def make_include_code(self, is_src, sink, target_file_name=""):
         """인클루드 코드 생성"""
         incl_str = ""
 
         if not is_src:
             incl_str = self.get_hdr_upper_name()
 
-            lb.addItem(f"#ifndef {incl_str}")
-            lb.addItem(f"#define {incl_str}")
+            sink.add(f"#ifndef {incl_str}")
+            sink.add(f"#define {incl_str}")
 
-        self.make_code_title(lb, "INCLUDES")
+        self.make_code_title(sink, "INCLUDES")
 
         if is_src:
             # 소스 파일의 경우 먼저 해당 헤더 파일을 인클루드
@@ -488,11 +500,11 @@ class MakeCode:
                 # 타겟 파일명이 제공된 경우 동적으로 헤더 파일명 생성
                 base_name = target_file_name.replace(".c", "").replace(".h", "")
                 header_file = f"{base_name}.h"
-                lb.addItem(f'#include "{header_file}"')
+                sink.add(f'#include "{header_file}"')
             else:
                 header_file = self.dFileInfo["H_FILE"].Str
                 if header_file:
-                    lb.addItem(f'#include "{header_file}"')
+                    sink.add(f'#include "{header_file}"')
 
             # 추가 인클루드 파일들
             incl_str = self.dFileInfo["S_INCL"].Str
@@ -506,7 +518,7 @@ class MakeCode:
                         header_file = self.dFileInfo["H_FILE"].Str
 
                     if inc != header_file:  # 중복 방지
-                        lb.addItem(f'#include "{inc}"')
+                        sink.add(f'#include "{inc}"')
         else:
             incl_str = self.dFileInfo["H_INCL"].Str
             if incl_str:
@@ -516,10 +528,10 @@ class MakeCode:
                 # C# 출력과 같이 인클루드 문장들이 연속적으로 출력되도록 처리
                 if includes:
                     includes_formatted = '\n'.join([f'#include "{inc}"' for inc in includes])
-                    lb.addItem(includes_formatted)
+                    sink.add(includes_formatted)
 
 
-    def make_code_title(self, lb, title_str):
+    def make_code_title(self, sink, title_str):
         """코드 제목 생성 - 성능 최적화"""
         if title_str.endswith(Info.EndPrjtName):
             return
@@ -529,25 +541,13 @@ class MakeCode:
             title_name = title_str.split('+')
             title_str = title_name[1]
 
-        # 라인 리스트에 빈 줄이 있는지 확인
-        empty_line = False
-        if lb.count() > 0:
-            last_item = lb.item(lb.count() - 1)
-            if last_item and not last_item.text():
-                empty_line = True
+        # 직전 라인이 빈 줄이 아니면 빈 줄 추가
+        if not sink.last_line_empty():
+            sink.add("")
 
-        # 미리 모든 라인을 생성
-        lines = []
-        if not empty_line:
-            lines.append("")
-
-        lines.append(Info.StartAnnotation[1])
-        lines.append(f"\t{title_str}")
-        lines.append(Info.EndAnnotation[1])
-
-        # 한 번에 추가
-        for line in lines:
-            lb.addItem(line)
+        sink.add(Info.StartAnnotation[1])
+        sink.add(f"\t{title_str}")
+        sink.add(Info.EndAnnotation[1])
 
     def make_cal_list_code(self):
         """Cal 리스트를 코드로 생성 - Cython 성능 최적화"""
@@ -562,7 +562,7 @@ class MakeCode:
 
             # Cython 최적화 버전으로 대량 처리 (임시 비활성화 - Float Suffix 오류 회피)
             if False and all_temp_code_items:  # 임시로 비활성화
-                processed_items = fast_write_cal_list_processing(all_temp_code_items)
+                processed_items = _write_cal_list_kernel(all_temp_code_items)
                 logging.info(f"✓ Cython 최적화로 {len(processed_items)}개 코드 항목 처리 완료")
 
         # 기존 Python 버전 (상세 처리)
@@ -601,13 +601,15 @@ class MakeCode:
 
             # 타이틀 추가
             if mk_file != EMkFile.Src:
-                self.make_code_title(self.lb_hdr, title_name)
+                self.make_code_title(self.hdr_sink, title_name)
             if mk_file != EMkFile.Hdr:
-                self.make_code_title(self.lb_src, title_name)
+                self.make_code_title(self.src_sink, title_name)
 
-            # 코드 생성 - 먼저 버퍼에 모아서 한 번에 처리
-            src_buffer = []
-            hdr_buffer = []
+            # 코드 생성 - 시트 조각(dSrcCode/dHdrCode)을 복사 없이 싱크에 바로 기록
+            src_sink = self.src_sink
+            hdr_sink = self.hdr_sink
+            src_start = src_sink.line_count
+            hdr_start = hdr_sink.line_count
 
             # 시트별로 처리
             for sht in range(len(self.cl)):
@@ -653,68 +655,41 @@ class MakeCode:
                                 def_str += "\t"
                             def_str += f"\t// {prjt_desc}"
 
-                    # 조건부 코드를 각 버퍼에 추가
+                    # 조건부 코드 시작 라인 기록
                     if info['has_non_common_src'] and src_list:
-                        src_buffer.append("")
-                        src_buffer.append(def_str)
-                        if not (src_list[0].strip().startswith("\r\n") if src_list else False):
-                            src_buffer.append("")
+                        src_sink.add("")
+                        src_sink.add(def_str)
+                        if not src_list[0].strip().startswith("\r\n"):
+                            src_sink.add("")
 
                     if info['has_non_common_hdr'] and hdr_list:
-                        hdr_buffer.append("")
-                        hdr_buffer.append(def_str)
-                        if not (hdr_list[0].strip().startswith("\r\n") if hdr_list else False):
-                            hdr_buffer.append("")
+                        hdr_sink.add("")
+                        hdr_sink.add(def_str)
+                        if not hdr_list[0].strip().startswith("\r\n"):
+                            hdr_sink.add("")
 
                     tab_flag = True
 
                 tab_str = "\t" if tab_flag else ""
 
-                # 소스 코드 처리
-                if src_list:
-                    for line in src_list:
-                        src_buffer.append(f"{tab_str}{line.rstrip()}")
+                # 소스/헤더 코드 조각 기록
+                src_sink.add_segment(src_list, tab_str)
+                hdr_sink.add_segment(hdr_list, tab_str)
 
-                # 헤더 코드 처리
-                if hdr_list:
-                    for line in hdr_list:
-                        hdr_buffer.append(f"{tab_str}{line.rstrip()}")
-
-            # 조건부 컴파일 종료 추가
+            # 조건부 컴파일 종료 추가 (이 타이틀에서 기록한 라인이 있을 때만)
             if self.prjt_def_title:
-                # 소스 코드 조건부 컴파일 종료
-                if info['has_non_common_src'] and src_buffer:
-                    else_lines = []
-                    if Info.ElsePrjtName not in self.PrjtList:
-                        else_lines.append("#else")
-                        else_lines.append(f"\t#error undefined {self.prjt_def_title} MACRO")
-                        else_lines.append("")
-                    else_lines.append("#endif")
-                    else_lines.append("")
-
-                    src_buffer.append("")
-                    src_buffer.extend(else_lines)
-
-                # 헤더 코드 조건부 컴파일 종료
-                if info['has_non_common_hdr'] and hdr_buffer:
-                    else_lines = []
-                    if Info.ElsePrjtName not in self.PrjtList:
-                        else_lines.append("#else")
-                        else_lines.append(f"\t#error undefined {self.prjt_def_title} MACRO")
-                        else_lines.append("")
-                    else_lines.append("#endif")
+                else_lines = [""]
+                if Info.ElsePrjtName not in self.PrjtList:
+                    else_lines.append("#else")
+                    else_lines.append(f"\t#error undefined {self.prjt_def_title} MACRO")
                     else_lines.append("")
+                else_lines.append("#endif")
+                else_lines.append("")
 
-                    hdr_buffer.append("")
-                    hdr_buffer.extend(else_lines)
-
-            # 버퍼의 모든 라인을 한 번에 추가 - UI 배치 최적화
-            for line in src_buffer:
-                self.lb_src.addItem(line)
-            for line in hdr_buffer:
-                self.lb_hdr.addItem(line)
-
-
+                if info['has_non_common_src'] and src_sink.line_count > src_start:
+                    src_sink.add_lines(else_lines)
+                if info['has_non_common_hdr'] and hdr_sink.line_count > hdr_start:
+                    hdr_sink.add_lines(else_lines)
 
     def make_end_code(self):
         """파일 끝 작성 - 성능 최적화"""
@@ -736,11 +711,8 @@ class MakeCode:
             Info.EndAnnotation[0]
         ]
 
-        # 한 번에 추가 - UI 배치 최적화
-        for line in src_lines:
-            self.lb_src.addItem(line)
-        for line in hdr_lines:
-            self.lb_hdr.addItem(line)
+        self.src_sink.add_lines(src_lines)
+        self.hdr_sink.add_lines(hdr_lines)
 
     def get_hdr_upper_name(self):
         """헤더 파일 이름 대문자 변환"""
@@ -0,0 +1,214 @@
+"""
+다중 DB 병렬 코드 생성 스케줄러
+
+DB 하나당 워커 프로세스 하나를 할당하여 headless_generator.generate_database
+(ChkShtInfo → ReadXlstoCode → ConvXlstoCode)를 GUI 없이 실행합니다.
+진행률은 공유 큐로 메인 프로세스에 전달되고, 취소는 공유 이벤트로 워커에 전달됩니다.
+"""
+
+import os
+import time
+import queue
+import logging
+import multiprocessing
+from concurrent.futures import ProcessPoolExecutor, wait, FIRST_COMPLETED
+from typing import Callable, Dict, List, Optional, Tuple
+
+from code_generator.headless_generator import GenerationObserver, generate_database
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import CODE_GEN_MAX_WORKERS, USE_INCREMENTAL_CODE_GEN
+except ImportError:
+    CODE_GEN_MAX_WORKERS = 0
+    USE_INCREMENTAL_CODE_GEN = False
+
+# 워커 → 메인 진행률 메시지 최소 간격 (초)
+PROGRESS_REPORT_INTERVAL = 0.2
+
+
+class _QueueObserver(GenerationObserver):
+    """워커 프로세스용 관찰자: 진행률은 공유 큐로 전송, 취소는 공유 이벤트로 확인"""
+
+    def __init__(self, db_name: str, progress_queue=None, cancel_event=None):
+        self.db_name = db_name
+        self.progress_queue = progress_queue
+        self.cancel_event = cancel_event
+        self._last_report = 0.0
+
+    def on_progress(self, progress: int, message: str):
+        if self.progress_queue is None:
+            return
+        now = time.time()
+        if progress >= 100 or now - self._last_report >= PROGRESS_REPORT_INTERVAL:
+            self._last_report = now
+            try:
+                self.progress_queue.put_nowait((self.db_name, int(progress), message))
+            except Exception:
+                pass
+
+    def is_cancelled(self) -> bool:
+        return self.cancel_event is not None and self.cancel_event.is_set()
+
+
+def generate_db_worker(db_file: str, output_dir: str, progress_queue=None, cancel_event=None,
+                       incremental: bool = USE_INCREMENTAL_CODE_GEN, use_sheet_ir: Optional[bool] = None) -> Dict:
+    """
+    워커 프로세스 진입점: DB 하나의 모든 그룹 코드를 생성하고 파일로 저장
+
+    Args:
+        db_file: DB 파일 경로
+        output_dir: DB별 출력 디렉토리
+        progress_queue: (db_name, progress, message) 진행률 전달 큐
+        cancel_event: 취소 요청 이벤트
+        incremental: 시트 해시 기반 증분 생성 여부
+        use_sheet_ir: 시트 IR 영구 캐시 사용 여부 (None이면 USE_SHEET_IR_CACHE 설정)
+
+    Returns:
+        결과 딕셔너리 (status: 'success' / 'failed' / 'skipped' / 'cancelled') - 프로세스 간 전달을 위해 dict 사용
+    """
+    db_name = os.path.basename(db_file)
+    observer = _QueueObserver(db_name, progress_queue, cancel_event)
+    result = generate_database(db_file, output_dir, observer, incremental, use_sheet_ir)
+
+    return {
+        'db_name': result.db_name,
+        'db_file': result.db_file,
+        'output_dir': output_dir,
+        'status': result.status,
+        'result': result.message,
+        'error': result.error,
+        'errors': result.errors,
+        'generated_files': [{k: v for k, v in f.items() if k != 'path'} for f in result.written_files],
+        'file_count': len(result.written_files),
+        'reused_groups': [group.group_name for group in result.groups if group.reused],
+        'elapsed': result.elapsed
+    }
+
+
+class ParallelCodeGenerator:
+    """
+    다중 DB 코드 생성을 프로세스 풀로 분산 실행하는 스케줄러
+
+    메인(GUI) 스레드는 run() 안에서 주기적으로 progress_handler를 호출받으므로
+    그 안에서 진행률 대화상자 갱신 및 이벤트 처리를 수행하면 됩니다.
+    """
+
+    def __init__(self, max_workers: Optional[int] = None, poll_interval: float = 0.1,
+                 incremental: bool = USE_INCREMENTAL_CODE_GEN, use_sheet_ir: Optional[bool] = None):
+        if not max_workers:
+            max_workers = CODE_GEN_MAX_WORKERS or os.cpu_count() or 1
+        self.max_workers = max(1, int(max_workers))
+        self.poll_interval = poll_interval
+        self.incremental = incremental
+        self.use_sheet_ir = use_sheet_ir
+
+    def run(self, db_files: List[str], output_dir: str,
+            progress_handler: Optional[Callable[[str, int, str, int], None]] = None,
+            cancel_checker: Optional[Callable[[], bool]] = None) -> Tuple[List[Dict], List[Dict]]:
+        """
+        DB 목록을 병렬로 코드 생성
+
+        Args:
+            db_files: DB 파일 경로 목록
+            output_dir: 출력 루트 디렉토리 (DB명 하위 폴더에 저장)
+            progress_handler: (db_name, progress, message, completed_count) 콜백
+            cancel_checker: True 반환 시 취소 요청
+
+        Returns:
+            (성공 목록, 실패 목록) - show_multiple_code_generation_result_improved 형식
+        """
+        successful, failed = [], []
+        if not db_files:
+            return successful, failed
+
+        worker_count = min(self.max_workers, len(db_files))
+        logging.info(f"🚀 병렬 코드 생성 시작: {len(db_files)}개 DB, 워커 {worker_count}개")
+        start_time = time.time()
+
+        # Windows/PyInstaller 호환을 위해 spawn 컨텍스트 사용
+        ctx = multiprocessing.get_context('spawn')
+        with ctx.Manager() as manager:
+            progress_queue = manager.Queue()
+            cancel_event = manager.Event()
+
+            with ProcessPoolExecutor(max_workers=worker_count, mp_context=ctx) as pool:
+                futures = {}
+                for db_file in db_files:
+                    db_name = os.path.basename(db_file)
+                    db_output_dir = os.path.join(output_dir, os.path.splitext(db_name)[0])
+                    future = pool.submit(generate_db_worker, db_file, db_output_dir, progress_queue, cancel_event,
+                                         self.incremental, self.use_sheet_ir)
+                    futures[future] = (db_name, db_output_dir)
+
+                pending = set(futures)
+                completed = 0
+
+                while pending:
+                    done, pending = wait(pending, timeout=self.poll_interval, return_when=FIRST_COMPLETED)
+
+                    for future in done:
+                        completed += 1
+                        db_name, db_output_dir = futures[future]
+                        self._collect(future, db_name, db_output_dir, successful, failed)
+                        if progress_handler:
+                            progress_handler(db_name, 100, "완료", completed)
+
+                    self._drain_progress(progress_queue, progress_handler, completed)
+
+                    if cancel_checker and cancel_checker() and not cancel_event.is_set():
+                        logging.info("사용자가 병렬 코드 생성을 취소했습니다.")
+                        cancel_event.set()
+                        for future in pending:
+                            future.cancel()
+
+                self._drain_progress(progress_queue, progress_handler, completed)
+
+        logging.info(f"병렬 코드 생성 완료: 성공 {len(successful)}개, 실패 {len(failed)}개 "
+                     f"(총 소요시간: {time.time() - start_time:.1f}초)")
+        return successful, failed
+
+    @staticmethod
+    def _collect(future, db_name: str, db_output_dir: str, successful: List[Dict], failed: List[Dict]):
+        """완료된 future 결과를 성공/실패 목록에 분류"""
+        if future.cancelled():
+            failed.append({'db_name': db_name, 'error': '사용자 취소', 'output_dir': db_output_dir})
+            return
+
+        try:
+            result = future.result()
+        except Exception as e:
+            # 워커 프로세스 비정상 종료 등
+            logging.error(f"❌ 워커 실행 실패 [{db_name}]: {e}")
+            failed.append({'db_name': db_name, 'error': str(e), 'output_dir': db_output_dir})
+            return
+
+        if result['status'] == 'success':
+            successful.append({
+                'db_name': result['db_name'],
+                'output_dir': result['output_dir'],
+                'result': result['result'],
+                'generated_files': result['generated_files'],
+                'file_count': result['file_count']
+            })
+            logging.info(f"✅ 병렬 코드 생성 성공: {db_name} ({result['file_count']}개 파일, {result['elapsed']:.1f}초)")
+        else:
+            failed.append({
+                'db_name': result['db_name'],
+                'error': result['error'],
+                'output_dir': result['output_dir']
+            })
+            logging.warning(f"⚠️ 병렬 코드 생성 실패: {db_name} - {result['error']}")
+
+    @staticmethod
+    def _drain_progress(progress_queue, progress_handler, completed: int):
+        """큐에 쌓인 진행률 메시지를 모두 꺼내 핸들러로 전달"""
+        while True:
+            try:
+                db_name, progress_val, message = progress_queue.get_nowait()
+            except queue.Empty:
+                break
+            except Exception:
+                break
+            if progress_handler:
+                progress_handler(db_name, progress_val, message, completed)
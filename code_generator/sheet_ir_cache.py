@@ -0,0 +1,213 @@
+"""
+시트 IR(파싱 결과) 영구 캐시
+
+FileInfo 시트의 Read() 결과(파일 정보 셀, 프라그마 섹션, 생성 경로)와
+CalList 시트의 ChkCalListPos/ReadCalList 결과(아이템 열 위치, 프로젝트 정의, 타이틀별 코드 조각)를
+사용자 캐시 디렉토리의 SQLite 파일(sheet_ir.db, 메모리 매핑 조회)에 세션 간 보관합니다.
+
+- 키: 생성기 지문 + 시트 내용 해시 (CalList는 파싱 결과가 프라그마 정보에 의존하므로 FileInfo 해시 포함)
+  → 시트가 바뀌면 키가 달라지므로 별도 무효화 없이 새로 파싱
+- 오류 없이 처리된 시트만 저장 (오류 메시지 재현 없이 IR만으로 같은 결과)
+- IR은 JSON으로 저장 (캐시 파일을 읽어도 코드가 실행되지 않음, 읽을 수 없는 항목은 다시 파싱)
+- 출력 디렉토리와 무관하므로 어느 경로로 생성하든, 앱을 다시 시작해도 재사용
+- DB 파일(.db)은 Git으로 관리되므로 DB 안에 쓰지 않고 별도 캐시 파일 사용
+- 용량 제한(SHEET_IR_CACHE_MAX_MB)을 넘으면 오래 사용하지 않은 항목부터 제거
+"""
+
+import os
+import sys
+import json
+import time
+import sqlite3
+import hashlib
+import logging
+from typing import Dict, List, Optional, Tuple
+
+from code_generator.incremental_cache import generator_fingerprint
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import SHEET_IR_CACHE_DIR, SHEET_IR_CACHE_MAX_MB
+except ImportError:
+    SHEET_IR_CACHE_DIR = ""
+    SHEET_IR_CACHE_MAX_MB = 256
+
+IR_CACHE_FILE_NAME = "sheet_ir.db"
+IR_FORMAT_VERSION = 2  # 저장 형식이 바뀌면 증가 (키에 포함되므로 이전 형식 항목은 조회되지 않고 용량 정리 때 제거)
+_MMAP_SIZE = 256 * 1024 * 1024
+
+
+def default_cache_dir() -> str:
+    """사용자별 캐시 디렉토리 (Windows: %LOCALAPPDATA%, 그 외: ~/.cache)"""
+    if SHEET_IR_CACHE_DIR:
+        return SHEET_IR_CACHE_DIR
+    if sys.platform == "win32":
+        base = os.environ.get("LOCALAPPDATA") or os.path.expanduser("~")
+    else:
+        base = os.environ.get("XDG_CACHE_HOME") or os.path.join(os.path.expanduser("~"), ".cache")
+    return os.path.join(base, "AutoCalEditor")
+
+
+class SheetIRStore:
+    """SQLite 기반 IR 저장소 (여러 워커 프로세스가 같은 파일을 동시에 사용 가능 - WAL)"""
+
+    def __init__(self, cache_dir: Optional[str] = None, max_mb: int = SHEET_IR_CACHE_MAX_MB):
+        self.cache_dir = cache_dir or default_cache_dir()
+        self.path = os.path.join(self.cache_dir, IR_CACHE_FILE_NAME)
+        self.max_bytes = max(1, int(max_mb)) * 1024 * 1024
+        self.conn: Optional[sqlite3.Connection] = None
+        self.hits = 0
+        self.misses = 0
+
+        try:
+            os.makedirs(self.cache_dir, exist_ok=True)
+            self.conn = sqlite3.connect(self.path, timeout=10)
+            self.conn.execute("PRAGMA journal_mode=WAL")
+            self.conn.execute("PRAGMA synchronous=NORMAL")
+            self.conn.execute(f"PRAGMA mmap_size={_MMAP_SIZE}")
+            self.conn.execute("""
+                CREATE TABLE IF NOT EXISTS sheet_ir (
+                    key TEXT PRIMARY KEY,
+                    kind TEXT NOT NULL,
+                    sheet_name TEXT NOT NULL,
+                    size INTEGER NOT NULL,
+                    last_used REAL NOT NULL,
+                    payload BLOB NOT NULL
+                )
+            """)
+            self.conn.execute("CREATE INDEX IF NOT EXISTS idx_sheet_ir_last_used ON sheet_ir(last_used)")
+            self.conn.commit()
+        except (OSError, sqlite3.Error) as e:
+            logging.warning(f"⚠ 시트 IR 캐시 사용 불가 ({self.path}): {e}")
+            self.close()
+
+    @property
+    def available(self) -> bool:
+        return self.conn is not None
+
+    def get_many(self, keys: List[str]) -> Dict[str, Dict]:
+        """여러 키의 IR을 한 번에 조회 - {키: IR} (없거나 읽을 수 없는 키는 제외)"""
+        result: Dict[str, Dict] = {}
+        if self.conn is None or not keys:
+            return result
+        try:
+            placeholders = ",".join("?" * len(keys))
+            rows = self.conn.execute(f"SELECT key, payload FROM sheet_ir WHERE key IN ({placeholders})", keys).fetchall()
+            if rows:
+                now = time.time()
+                self.conn.executemany("UPDATE sheet_ir SET last_used = ? WHERE key = ?", [(now, key) for key, _ in rows])
+        except sqlite3.Error as e:
+            logging.debug(f"시트 IR 조회 실패: {e}")
+            return result
+
+        for key, payload in rows:
+            try:
+                ir = json.loads(bytes(payload).decode('utf-8'))
+            except ValueError as e:
+                logging.debug(f"시트 IR 읽기 실패 ({key}): {e}")
+                continue
+            if isinstance(ir, dict):
+                result[key] = ir
+        self.hits += len(result)
+        self.misses += len(set(keys)) - len(result)
+        return result
+
+    def put(self, key: str, kind: str, sheet_name: str, ir: Dict):
+        if self.conn is None:
+            return
+        try:
+            payload = json.dumps(ir, ensure_ascii=False, separators=(',', ':')).encode('utf-8')
+            self.conn.execute(
+                "INSERT OR REPLACE INTO sheet_ir (key, kind, sheet_name, size, last_used, payload) VALUES (?, ?, ?, ?, ?, ?)",
+                (key, kind, sheet_name, len(payload), time.time(), sqlite3.Binary(payload)))
+        except (sqlite3.Error, TypeError, ValueError) as e:
+            logging.warning(f"⚠ 시트 IR 저장 실패 ({sheet_name}): {e}")
+
+    def flush(self):
+        """변경 내용 커밋 후 용량 제한 초과분 제거 (오래 사용하지 않은 항목부터)"""
+        if self.conn is None:
+            return
+        try:
+            self.conn.commit()
+            total = self.conn.execute("SELECT COALESCE(SUM(size), 0) FROM sheet_ir").fetchone()[0]
+            if total > self.max_bytes:
+                removed = 0
+                for key, size in self.conn.execute("SELECT key, size FROM sheet_ir ORDER BY last_used").fetchall():
+                    if total <= self.max_bytes * 0.8:
+                        break
+                    self.conn.execute("DELETE FROM sheet_ir WHERE key = ?", (key,))
+                    total -= size
+                    removed += 1
+                self.conn.commit()
+                logging.info(f"시트 IR 캐시 정리: {removed}개 항목 제거")
+        except sqlite3.Error as e:
+            logging.warning(f"⚠ 시트 IR 캐시 커밋 실패: {e}")
+
+    def close(self):
+        if self.conn is not None:
+            try:
+                self.conn.close()
+            except sqlite3.Error:
+                pass
+            self.conn = None
+
+    def group(self, file_info: Tuple[str, str], cal_lists: List[Tuple[str, str]]) -> 'GroupSheetIR':
+        return GroupSheetIR(self, file_info, cal_lists)
+
+
+def _key(*parts: str) -> str:
+    return hashlib.sha1("|".join((generator_fingerprint(), str(IR_FORMAT_VERSION)) + parts).encode('utf-8')).hexdigest()
+
+
+class GroupSheetIR:
+    """
+    그룹 하나(FileInfo + CalList 시트들)의 IR 조회/저장 (MakeCode.sheet_ir 인터페이스)
+
+    Args:
+        file_info: (FileInfo 시트명, 내용 해시)
+        cal_lists: [(CalList 시트명, 내용 해시), ...] - MakeCode.cl과 같은 순서
+    """
+
+    def __init__(self, store: SheetIRStore, file_info: Tuple[str, str], cal_lists: List[Tuple[str, str]]):
+        self.store = store
+        self.file_info_name = file_info[0]
+        self.file_info_key = _key("FileInfo", file_info[0], file_info[1])
+        self.cal_list_names = [name for name, _ in cal_lists]
+        self.cal_list_keys = [_key("CalList", file_info[1], name, sheet_hash) for name, sheet_hash in cal_lists]
+
+        # 그룹의 IR을 한 번에 읽어 둠 (시트 데이터 로드 생략 판단과 복원이 같은 스냅샷을 사용)
+        self.loaded = store.get_many([self.file_info_key] + self.cal_list_keys)
+
+    # 시트 데이터 로드 생략 판단용
+    def has_cal_list(self, index: int) -> bool:
+        return index < len(self.cal_list_keys) and self.cal_list_keys[index] in self.loaded
+
+    @property
+    def hits(self) -> int:
+        return len(self.loaded)
+
+    # FileInfo
+    def restore_file_info(self, fi) -> Optional[bool]:
+        """캐시된 Read() 결과 적용 - 캐시가 없으면 None, 있으면 Read()와 같은 오류 여부"""
+        ir = self.loaded.get(self.file_info_key)
+        if ir is None:
+            return None
+        return fi.apply_ir(ir)
+
+    def store_file_info(self, fi):
+        self.store.put(self.file_info_key, "FileInfo", self.file_info_name, fi.export_ir())
+
+    # CalList
+    def restore_cal_list(self, index: int, cal_list) -> bool:
+        """캐시된 ChkCalListPos/ReadCalList 결과가 있으면 적용하고 True 반환"""
+        if index >= len(self.cal_list_keys):
+            return False
+        ir = self.loaded.get(self.cal_list_keys[index])
+        if ir is None:
+            return False
+        cal_list.apply_ir(ir)
+        return True
+
+    def store_cal_list(self, index: int, cal_list):
+        if index < len(self.cal_list_keys):
+            self.store.put(self.cal_list_keys[index], "CalList", cal_list.ShtName, cal_list.export_ir())
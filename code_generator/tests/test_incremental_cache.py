@@ -0,0 +1,171 @@
+"""
+증분 코드 생성 캐시(code_generator/incremental_cache) 회귀 테스트
+
+- 시트 조각이 JSON으로 저장/복원되고, 손상된 조각은 재생성 대상이 되는지
+- 시트 내용 해시가 같은 그룹은 건너뛰고, 일부 시트만 바뀐 그룹은 나머지 시트 조각을 재사용하는지
+- 증분 생성 결과가 전체 재생성 결과와 같은지
+
+실행: python -m unittest discover -t . -s code_generator/tests
+"""
+
+import os
+import json
+import shutil
+import logging
+import tempfile
+import unittest
+
+from core.info import EMkFile
+from code_generator.cal_list import CalList
+from code_generator.incremental_cache import IncrementalCodeCache, SheetFragmentCache, CACHE_DIR_NAME
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+SAMPLE_DB = os.path.join(ROOT_DIR, "database", "04_EVTC387 출력 관련 Cal.db")
+
+
+def _fragment_holder(sheet_name="$Sheet", src=None, hdr=None, title_order=None):
+    """export_fragment/apply_fragment만 사용하는 CalList (시트 데이터 없이 생성)"""
+    cal_list = CalList.__new__(CalList)
+    cal_list.ShtName = sheet_name
+    cal_list.dSrcCode = src if src is not None else {}
+    cal_list.dHdrCode = hdr if hdr is not None else {}
+    cal_list.titleOrder = title_order if title_order is not None else []
+    return cal_list
+
+
+class SheetFragmentCacheTest(unittest.TestCase):
+    def setUp(self):
+        self.temp_dir = tempfile.mkdtemp()
+        self.fragment_dir = os.path.join(self.temp_dir, "fragments")
+
+    def tearDown(self):
+        shutil.rmtree(self.temp_dir, ignore_errors=True)
+
+    def test_round_trip_is_json(self):
+        cache = SheetFragmentCache(self.fragment_dir, "fi", [("$A", "h1")])
+        source = _fragment_holder("$A", {"Macros": ["#define A 1", "한글 주석"]}, {"Defines": ["extern int a;"]},
+                                  [("Macros", EMkFile.Src), ("Defines", EMkFile.All)])
+        cache.store(0, source)
+
+        with open(cache._path(0), 'r', encoding='utf-8') as f:
+            self.assertEqual(json.load(f)["titleOrder"], [["Macros", 0], ["Defines", 2]])
+
+        target = _fragment_holder("$A")
+        self.assertTrue(SheetFragmentCache(self.fragment_dir, "fi", [("$A", "h1")]).restore(0, target))
+        self.assertEqual(target.dSrcCode, source.dSrcCode)
+        self.assertEqual(target.dHdrCode, source.dHdrCode)
+        self.assertEqual(target.titleOrder, [("Macros", EMkFile.Src), ("Defines", EMkFile.All)])
+
+    def test_corrupt_fragment_is_a_miss(self):
+        cache = SheetFragmentCache(self.fragment_dir, "fi", [("$A", "h1")])
+        cache.store(0, _fragment_holder("$A", {"T": ["x"]}))
+        with open(cache._path(0), 'w', encoding='utf-8') as f:
+            f.write('{"dSrcCode": ')
+
+        self.assertFalse(cache.restore(0, _fragment_holder("$A")))
+        self.assertEqual((cache.hits, cache.misses), (0, 1))
+
+    def test_key_depends_on_sheet_and_file_info_hash(self):
+        base = SheetFragmentCache(self.fragment_dir, "fi", [("$A", "h1"), ("$B", "h2")])
+        changed_sheet = SheetFragmentCache(self.fragment_dir, "fi", [("$A", "h1"), ("$B", "h3")])
+        changed_file_info = SheetFragmentCache(self.fragment_dir, "fi2", [("$A", "h1"), ("$B", "h2")])
+
+        self.assertEqual(base.keys[0], changed_sheet.keys[0])
+        self.assertNotEqual(base.keys[1], changed_sheet.keys[1])
+        self.assertTrue(set(base.keys).isdisjoint(changed_file_info.keys))
+
+    def test_save_removes_unreferenced_and_legacy_fragments(self):
+        cache = IncrementalCodeCache(self.temp_dir)
+        fragments = cache.fragment_cache("fi", [("$A", "h1")])
+        fragments.store(0, _fragment_holder("$A"))
+        stale = SheetFragmentCache(cache.fragment_dir, "fi", [("$A", "old")])
+        stale.store(0, _fragment_holder("$A"))
+        legacy_path = os.path.join(cache.fragment_dir, "legacy.pkl")
+        open(legacy_path, 'wb').close()
+
+        cache.record_group("G", "db", ("$G_FileInfo", "fi"), [("$A", "h1")], [], fragments)
+        cache.save(["G"])
+
+        self.assertEqual(sorted(os.listdir(cache.fragment_dir)), [os.path.basename(fragments._path(0))])
+
+
+@unittest.skipUnless(os.path.isfile(SAMPLE_DB), "샘플 DB 없음")
+class IncrementalGenerationTest(unittest.TestCase):
+    """샘플 DB 복사본으로 증분 생성 ↔ 전체 재생성 비교 (Default 그룹: CalList 시트 2개)"""
+
+    def setUp(self):
+        logging.disable(logging.CRITICAL)
+        self.temp_dir = tempfile.mkdtemp()
+        self.db_file = os.path.join(self.temp_dir, "sample.db")
+        shutil.copyfile(SAMPLE_DB, self.db_file)
+        self.output_dir = os.path.join(self.temp_dir, "incremental")
+
+        self.fragment_caches = []
+        original = IncrementalCodeCache.fragment_cache
+
+        def capture(cache, file_info_hash, cal_lists):
+            fragment_cache = original(cache, file_info_hash, cal_lists)
+            self.fragment_caches.append(fragment_cache)
+            return fragment_cache
+
+        IncrementalCodeCache.fragment_cache = capture
+        self.addCleanup(setattr, IncrementalCodeCache, "fragment_cache", original)
+
+    def tearDown(self):
+        logging.disable(logging.NOTSET)
+        shutil.rmtree(self.temp_dir, ignore_errors=True)
+
+    def _generate(self, output_dir, incremental=True):
+        from code_generator.headless_generator import generate_database
+        self.fragment_caches = []
+        result = generate_database(self.db_file, output_dir, incremental=incremental, use_sheet_ir=False)
+        self.assertEqual(result.status, 'success', result.error)
+        return result
+
+    def _set_cell(self, sheet_name, row, col, value):
+        from data_manager.db_handler_v2 import DBHandlerV2
+        db_handler = DBHandlerV2(self.db_file)
+        try:
+            # 샘플 DB 시트명에는 끝 공백이 있을 수 있음
+            sheet = next(s for s in db_handler.get_sheets() if s['name'].strip() == sheet_name)
+            db_handler.set_cell_value(sheet['id'], row, col, value)
+        finally:
+            db_handler.disconnect()
+
+    @staticmethod
+    def _read_outputs(output_dir):
+        outputs = {}
+        for file_name in sorted(os.listdir(output_dir)):
+            if file_name.endswith(('.c', '.h')):
+                with open(os.path.join(output_dir, file_name), 'r', encoding='utf-8', errors='replace') as f:
+                    outputs[file_name] = [line for line in f if '파일 생성일' not in line]
+        return outputs
+
+    def test_unchanged_group_is_reused(self):
+        self._generate(self.output_dir)
+        self.assertTrue(os.path.isfile(os.path.join(self.output_dir, CACHE_DIR_NAME, "manifest.json")))
+
+        result = self._generate(self.output_dir)
+        self.assertTrue(result.groups and all(group.reused for group in result.groups))
+        self.assertEqual(self.fragment_caches, [])
+
+    def test_partial_group_reuses_unchanged_sheets(self):
+        self._generate(self.output_dir)
+        self._set_cell("$CalData", 11, 9, "112")
+
+        result = self._generate(self.output_dir)
+        self.assertFalse(any(group.reused for group in result.groups))
+        self.assertEqual(len(self.fragment_caches), 1)
+        fragment_cache = self.fragment_caches[0]
+        self.assertEqual((fragment_cache.hits, fragment_cache.misses), (1, 1))
+
+        full_dir = os.path.join(self.temp_dir, "full")
+        self._generate(full_dir, incremental=False)
+        incremental_outputs = self._read_outputs(self.output_dir)
+        self.assertTrue(incremental_outputs)
+        self.assertEqual(incremental_outputs, self._read_outputs(full_dir))
+        self.assertTrue(any("112" in line for lines in incremental_outputs.values() for line in lines))
+
+
+if __name__ == '__main__':
+    unittest.main()
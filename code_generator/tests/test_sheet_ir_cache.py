@@ -0,0 +1,128 @@
+"""
+시트 IR 영구 캐시(code_generator/sheet_ir_cache) 회귀 테스트
+
+- IR이 JSON으로 저장되고, 읽을 수 없는 항목은 건너뛰는지
+- 캐시된 IR로 생성한 결과가 처음 파싱한 결과와 같은지
+
+실행: python -m unittest discover -t . -s code_generator/tests
+"""
+
+import os
+import json
+import shutil
+import sqlite3
+import logging
+import tempfile
+import unittest
+
+from code_generator.sheet_ir_cache import SheetIRStore, IR_CACHE_FILE_NAME
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+SAMPLE_DB = os.path.join(ROOT_DIR, "database", "04_EVTC387 출력 관련 Cal.db")
+
+
+class SheetIRStoreTest(unittest.TestCase):
+    def setUp(self):
+        self.temp_dir = tempfile.mkdtemp()
+        self.store = SheetIRStore(self.temp_dir)
+        self.assertTrue(self.store.available)
+
+    def tearDown(self):
+        self.store.close()
+        shutil.rmtree(self.temp_dir, ignore_errors=True)
+
+    def test_round_trip_is_json(self):
+        ir = {"MkFilePath": "out/경로", "items": {"Name": [3, 5]}, "fragment": {"titleOrder": [["T", 2]]}}
+        self.store.put("k1", "CalList", "$A", ir)
+        self.store.flush()
+
+        self.assertEqual(self.store.get_many(["k1", "missing"]), {"k1": ir})
+        self.assertEqual((self.store.hits, self.store.misses), (1, 1))
+        payload = self.store.conn.execute("SELECT payload FROM sheet_ir WHERE key = 'k1'").fetchone()[0]
+        self.assertEqual(json.loads(bytes(payload).decode('utf-8')), ir)
+
+    def test_unreadable_payload_is_skipped(self):
+        self.store.put("good", "CalList", "$A", {"a": 1})
+        for key, payload in (("bad", b"\x80\x04\x95not json"), ("list", b"[1, 2]")):
+            self.store.conn.execute(
+                "INSERT INTO sheet_ir (key, kind, sheet_name, size, last_used, payload) VALUES (?, 'CalList', '$B', ?, 0, ?)",
+                (key, len(payload), sqlite3.Binary(payload)))
+        self.store.flush()
+
+        self.assertEqual(self.store.get_many(["good", "bad", "list"]), {"good": {"a": 1}})
+
+    def test_unserializable_ir_is_not_stored(self):
+        with self.assertLogs(level='WARNING'):
+            self.store.put("k1", "CalList", "$A", {"obj": object()})
+        self.store.flush()
+        self.assertEqual(self.store.get_many(["k1"]), {})
+
+
+@unittest.skipUnless(os.path.isfile(SAMPLE_DB), "샘플 DB 없음")
+class SheetIRGenerationTest(unittest.TestCase):
+    """샘플 DB 복사본을 IR 캐시 없이/있이 생성해 결과 비교"""
+
+    def setUp(self):
+        logging.disable(logging.CRITICAL)
+        self.temp_dir = tempfile.mkdtemp()
+        self.db_file = os.path.join(self.temp_dir, "sample.db")
+        shutil.copyfile(SAMPLE_DB, self.db_file)
+
+        # default_cache_dir()가 임시 디렉토리를 사용하도록 설정
+        self.cache_home = os.path.join(self.temp_dir, "cache")
+        saved = {name: os.environ.get(name) for name in ("XDG_CACHE_HOME", "LOCALAPPDATA")}
+        os.environ["XDG_CACHE_HOME"] = os.environ["LOCALAPPDATA"] = self.cache_home
+        self.addCleanup(self._restore_env, saved)
+
+    @staticmethod
+    def _restore_env(saved):
+        for name, value in saved.items():
+            if value is None:
+                os.environ.pop(name, None)
+            else:
+                os.environ[name] = value
+
+    def tearDown(self):
+        logging.disable(logging.NOTSET)
+        shutil.rmtree(self.temp_dir, ignore_errors=True)
+
+    def _generate(self, name, use_sheet_ir):
+        from code_generator.headless_generator import generate_database
+        output_dir = os.path.join(self.temp_dir, name)
+        result = generate_database(self.db_file, output_dir, use_sheet_ir=use_sheet_ir)
+        self.assertEqual(result.status, 'success', result.error)
+
+        outputs = {}
+        for file_name in sorted(os.listdir(output_dir)):
+            with open(os.path.join(output_dir, file_name), 'r', encoding='utf-8', errors='replace') as f:
+                outputs[file_name] = [line for line in f if '파일 생성일' not in line]
+        return outputs
+
+    def _cache_rows(self):
+        cache_file = os.path.join(self.cache_home, "AutoCalEditor", IR_CACHE_FILE_NAME)
+        if not os.path.isfile(cache_file):
+            return []
+        conn = sqlite3.connect(cache_file)
+        try:
+            return conn.execute("SELECT kind, payload FROM sheet_ir").fetchall()
+        finally:
+            conn.close()
+
+    def test_cached_ir_gives_same_output(self):
+        parsed = self._generate("parsed", use_sheet_ir=False)
+        self.assertEqual(self._cache_rows(), [])
+
+        first = self._generate("first", use_sheet_ir=True)
+        rows = self._cache_rows()
+        self.assertEqual(sorted(kind for kind, _ in rows), ["CalList", "CalList", "FileInfo"])
+        for _, payload in rows:
+            self.assertIsInstance(json.loads(bytes(payload).decode('utf-8')), dict)
+
+        cached = self._generate("cached", use_sheet_ir=True)
+        self.assertTrue(parsed)
+        self.assertEqual(first, parsed)
+        self.assertEqual(cached, parsed)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,329 @@
+"""
+데이터 처리 커널 (정렬 / 조인 / 맵 연산 / LRU 캐시)
+
+cython_extensions.data_processor의 커널과 같은 결과를 내는 Python 구현을 폴백으로 함께 등록합니다.
+USE_CYTHON_DATA_PROC가 꺼져 있으면 Cython 함수가 있어도 폴백만 사용합니다.
+
+- keyed_sort(data_list, sort_key, reverse): 키를 한 번만 계산하는 안정 정렬 ("numeric"/"string")
+- hash_join(left, right, left_key, right_key): 키 열 등가 조인 [(left_row, right_row)]
+- hash_match(outer_list, inner_list): outer 원소 중 inner에 있는 것
+- map_elementwise / map_affine / map_interp2d: Cal 맵(행 우선 1차원 double 버퍼) 연산
+  (array('d')와 numpy float64 배열은 Cython 커널에서 복사 없이 사용)
+- LRUCache(max_size): get/put O(1) LRU 캐시
+
+Cython 커널과 폴백의 결과 일치/속도는 check_kernel_parity()로 확인합니다
+(python benchmark_cli.py --kernel-parity, 단위 테스트는 core/tests/test_data_kernels.py).
+"""
+
+import time
+import random
+import logging
+import operator
+from array import array
+from bisect import bisect_right
+from collections import OrderedDict
+from typing import Callable, Dict, List, Optional
+
+from core.kernels import register_kernel
+
+try:
+    from core.performance_settings import USE_CYTHON_DATA_PROC
+except ImportError:
+    USE_CYTHON_DATA_PROC = True
+
+
+# ----------------------------------------------------------------------
+# Python 구현 (Cython 커널과 같은 규칙)
+# ----------------------------------------------------------------------
+def numeric_sort_key(item) -> float:
+    """숫자 정렬 키 (None/변환 불가/NaN → 0.0, -0.0 → 0.0)"""
+    if item is None:
+        return 0.0
+    try:
+        value = float(item)
+    except (TypeError, ValueError, OverflowError):
+        return 0.0
+    if value != value:
+        return 0.0
+    return value + 0.0
+
+
+def string_sort_key(item) -> str:
+    return "" if item is None else str(item)
+
+
+def keyed_sort_python(data_list: list, sort_key: str, reverse: bool = False) -> list:
+    """키를 원소마다 한 번 계산한 뒤 안정 정렬 (알 수 없는 sort_key는 원래 순서 그대로)"""
+    if sort_key == "numeric":
+        keys = [numeric_sort_key(item) for item in data_list]
+    elif sort_key == "string":
+        keys = [string_sort_key(item) for item in data_list]
+    else:
+        return list(data_list)
+    return [data_list[i] for i in sorted(range(len(data_list)), key=keys.__getitem__, reverse=reverse)]
+
+
+def hash_join_python(left: list, right: list, left_key: int = 0, right_key: int = 0) -> list:
+    """키 열 등가 조인 → [(left_row, right_row)] (left 순서, 같은 키의 right는 원래 순서)"""
+    buckets: Dict = {}
+    for row in right:
+        buckets.setdefault(row[right_key], []).append(row)
+    result = []
+    for row in left:
+        matches = buckets.get(row[left_key])
+        if matches:
+            result.extend((row, other) for other in matches)
+    return result
+
+
+def hash_match_python(outer_list: list, inner_list: list) -> list:
+    """outer 원소 중 inner에 있는 것 (outer 순서/중복 유지, 해시할 수 없는 원소가 있으면 선형 탐색)"""
+    try:
+        lookup = set(inner_list)
+        return [item for item in outer_list if item in lookup]
+    except TypeError:
+        return [item for item in outer_list if item in inner_list]
+
+
+_MAP_OPERATIONS = {
+    "add": operator.add,
+    "subtract": operator.sub,
+    "multiply": operator.mul,
+    "divide": operator.truediv,
+}
+
+
+def map_elementwise_python(map_a, map_b, operation: str) -> array:
+    """같은 크기 두 맵의 원소별 연산 (add/subtract/multiply/divide) → array('d')"""
+    func = _MAP_OPERATIONS.get(operation)
+    if func is None:
+        raise ValueError(f"지원하지 않는 연산: {operation}")
+    if len(map_a) != len(map_b):
+        raise ValueError(f"맵 크기가 다릅니다: {len(map_a)} != {len(map_b)}")
+    return array('d', map(func, map(float, map_a), map(float, map_b)))
+
+
+def map_affine_python(values, scale: float, offset: float) -> array:
+    """맵 전체에 value * scale + offset 적용 → array('d')"""
+    scale, offset = float(scale), float(offset)
+    return array('d', [float(value) * scale + offset for value in values])
+
+
+def _axis_cell(axis, x: float):
+    """오름차순 축에서 x가 속한 구간 시작 인덱스와 구간 내 비율 (범위 밖은 양 끝으로 고정, NaN이면 비율도 NaN)"""
+    if x != x:
+        return 0, x
+    n = len(axis)
+    if n < 2 or x <= axis[0]:
+        return 0, 0.0
+    if x >= axis[n - 1]:
+        return n - 2, 1.0
+    lo = bisect_right(axis, x) - 1
+    return lo, (x - axis[lo]) / (axis[lo + 1] - axis[lo])
+
+
+def map_interp2d_python(x_axis, y_axis, values, x: float, y: float) -> float:
+    """2차원 맵 쌍선형 보간 (values는 len(y_axis) x len(x_axis) 행 우선, x/y가 NaN이면 NaN)"""
+    cols, rows = len(x_axis), len(y_axis)
+    if cols == 0 or rows == 0 or len(values) != rows * cols:
+        raise ValueError(f"맵 크기가 축과 맞지 않습니다: {len(values)} != {rows} x {cols}")
+    xs = [float(v) for v in x_axis]
+    ys = [float(v) for v in y_axis]
+    xi, fx = _axis_cell(xs, float(x))
+    yi, fy = _axis_cell(ys, float(y))
+    x1 = xi + 1 if cols > 1 else xi
+    y1 = yi + 1 if rows > 1 else yi
+
+    v00, v01 = float(values[yi * cols + xi]), float(values[yi * cols + x1])
+    v10, v11 = float(values[y1 * cols + xi]), float(values[y1 * cols + x1])
+    top = v00 + (v01 - v00) * fx
+    bottom = v10 + (v11 - v10) * fx
+    return top + (bottom - top) * fy
+
+
+class LRUCachePython:
+    """최대 크기가 정해진 LRU 캐시 (조회/저장 시 최근 사용으로 이동, 넘치면 가장 오래 사용하지 않은 항목 제거)"""
+
+    def __init__(self, max_size: int):
+        if max_size < 1:
+            raise ValueError("max_size는 1 이상이어야 합니다")
+        self.max_size = max_size
+        self.hits = 0
+        self.misses = 0
+        self._items: OrderedDict = OrderedDict()
+
+    def clear(self):
+        self._items.clear()
+
+    def __len__(self):
+        return len(self._items)
+
+    def __contains__(self, key):
+        """존재 여부만 확인 (사용 순서는 바꾸지 않음)"""
+        return key in self._items
+
+    def get(self, key, default=None):
+        try:
+            value = self._items[key]
+        except KeyError:
+            self.misses += 1
+            return default
+        self._items.move_to_end(key)
+        self.hits += 1
+        return value
+
+    def put(self, key, value):
+        items = self._items
+        if key in items:
+            items.move_to_end(key)
+        elif len(items) >= self.max_size:
+            items.popitem(last=False)
+        items[key] = value
+
+    def pop(self, key, default=None):
+        return self._items.pop(key, default)
+
+    def keys(self) -> list:
+        """오래된 순서의 키 목록"""
+        return list(self._items)
+
+
+# ----------------------------------------------------------------------
+# 커널 디스패치
+# ----------------------------------------------------------------------
+def _register(name: str, fallback: Callable):
+    kernel = register_kernel(name, 'data_processor', fallback=fallback)
+    if not USE_CYTHON_DATA_PROC:
+        kernel.native = None
+    return kernel
+
+
+keyed_sort = _register('fast_keyed_sort', keyed_sort_python)
+hash_join = _register('fast_hash_join', hash_join_python)
+hash_match = _register('fast_hash_match', hash_match_python)
+map_elementwise = _register('fast_map_elementwise', map_elementwise_python)
+map_affine = _register('fast_map_affine', map_affine_python)
+map_interp2d = _register('fast_map_interp2d', map_interp2d_python)
+
+try:
+    if not USE_CYTHON_DATA_PROC:
+        raise ImportError("USE_CYTHON_DATA_PROC 꺼짐")
+    from cython_extensions.data_processor import LRUCache
+    LRU_CACHE_CYTHON = True
+except ImportError:
+    LRUCache = LRUCachePython
+    LRU_CACHE_CYTHON = False
+    logging.debug("데이터 처리 Cython 커널 없음 - Python 구현 사용")
+
+
+# ----------------------------------------------------------------------
+# Cython 커널 ↔ Python 폴백 일치/속도 확인
+# ----------------------------------------------------------------------
+def _sample_values(rng: random.Random, size: int) -> list:
+    pool = [None, "", "abc", "1e3", "-0", "nan", True, -0.0, float('nan'), 10 ** 400]
+    values = []
+    for _ in range(size):
+        roll = rng.random()
+        if roll < 0.6:
+            values.append(round(rng.uniform(-1000, 1000), rng.choice((0, 2))))
+        elif roll < 0.8:
+            values.append(rng.randint(-50, 50))
+        else:
+            values.append(rng.choice(pool))
+    return values
+
+
+def _lru_trace(cache_class, operations) -> list:
+    cache = cache_class(64)
+    trace = []
+    for op, key in operations:
+        if op == 0:
+            trace.append(cache.get(key))
+        elif op == 1:
+            cache.put(key, key * 2)
+        else:
+            trace.append(cache.pop(key))
+    trace.append((cache.keys(), len(cache), cache.hits, cache.misses))
+    return trace
+
+
+def _same(a, b) -> bool:
+    """결과 비교 (NaN 원소는 같은 객체 위치이면 동일, 실수는 1e-12 상대 오차 허용)"""
+    if isinstance(a, float) and isinstance(b, float):
+        return a == b or abs(a - b) <= 1e-12 * max(abs(a), abs(b)) or (a != a and b != b)
+    if isinstance(a, (list, tuple, array)) and isinstance(b, (list, tuple, array)):
+        return len(a) == len(b) and all(x is y or _same(x, y) for x, y in zip(a, b))
+    return a == b
+
+
+def check_kernel_parity(size: int = 20000, seed: int = 0, repeat: int = 3) -> List[Dict]:
+    """
+    커널별로 같은 입력을 Cython 함수와 Python 폴백에 넣어 결과와 소요 시간 비교
+
+    Returns:
+        [{'kernel', 'native', 'match', 'native_ms', 'fallback_ms', 'speedup'}, ...]
+        (Cython 함수가 없으면 native=False, 폴백만 측정)
+    """
+    rng = random.Random(seed)
+    values = _sample_values(rng, size)
+    words = [f"K{rng.randint(0, size // 4)}" for _ in range(size)]
+    left = [(word, i) for i, word in enumerate(words)]
+    right = [(f"K{rng.randint(0, size // 4)}", -i) for i in range(size // 2)]
+    side = max(2, int(size ** 0.5))
+    x_axis = array('d', sorted(rng.sample(range(side * 10), side)))
+    y_axis = array('d', sorted(rng.sample(range(side * 10), side)))
+    map_a = array('d', (rng.uniform(-100, 100) for _ in range(side * side)))
+    map_b = array('d', (rng.uniform(1, 100) for _ in range(side * side)))
+    points = [(rng.uniform(-10, side * 11), rng.uniform(-10, side * 11)) for _ in range(2000)]
+    nan = float('nan')
+    points += [(nan, 5.0), (5.0, nan), (nan, nan), (float('inf'), -float('inf'))]
+    map_nan = array('d', map_a)
+    for i in range(0, len(map_nan), 7):
+        map_nan[i] = nan
+    lru_ops = [(rng.randint(0, 2), rng.randint(0, 200)) for _ in range(size)]
+
+    cases = [
+        (keyed_sort, "numeric", lambda f: f(values, "numeric", False)),
+        (keyed_sort, "numeric reverse", lambda f: f(values, "numeric", True)),
+        (keyed_sort, "string", lambda f: f(values, "string", False)),
+        (hash_join, "", lambda f: f(left, right, 0, 0)),
+        (hash_match, "", lambda f: f(words, words[: size // 3])),
+        (map_elementwise, "subtract", lambda f: f(map_a, map_b, "subtract")),
+        (map_elementwise, "divide", lambda f: f(map_a, map_b, "divide")),
+        (map_affine, "", lambda f: f(map_a, 0.01, -40.0)),
+        (map_elementwise, "nan", lambda f: f(map_nan, map_b, "multiply")),
+        (map_affine, "nan", lambda f: f(map_nan, 0.01, -40.0)),
+        (map_interp2d, "", lambda f: [f(x_axis, y_axis, map_a, x, y) for x, y in points]),
+        (map_interp2d, "nan", lambda f: [f(x_axis, y_axis, map_nan, x, y) for x, y in points]),
+    ]
+
+    def measure(func, call):
+        best, result = None, None
+        for _ in range(max(1, repeat)):
+            start = time.perf_counter()
+            result = call(func)
+            elapsed = time.perf_counter() - start
+            best = elapsed if best is None else min(best, elapsed)
+        return result, best * 1000
+
+    report = []
+    for kernel, label, call in cases:
+        fallback_result, fallback_ms = measure(kernel.fallback, call)
+        entry = {'kernel': f"{kernel.name} {label}".strip(), 'native': kernel.available,
+                 'match': True, 'native_ms': None, 'fallback_ms': fallback_ms, 'speedup': None}
+        if kernel.available:
+            native_result, native_ms = measure(kernel.native, call)
+            entry.update(match=_same(native_result, fallback_result), native_ms=native_ms,
+                         speedup=fallback_ms / native_ms if native_ms else None)
+        report.append(entry)
+
+    # LRU 캐시: 같은 연산 순서의 반환값/최종 상태 비교
+    lru_entry = {'kernel': "LRUCache", 'native': LRU_CACHE_CYTHON, 'match': True,
+                 'native_ms': None, 'fallback_ms': None, 'speedup': None}
+    fallback_trace, lru_entry['fallback_ms'] = measure(LRUCachePython, lambda c: _lru_trace(c, lru_ops))
+    if LRU_CACHE_CYTHON:
+        native_trace, lru_entry['native_ms'] = measure(LRUCache, lambda c: _lru_trace(c, lru_ops))
+        lru_entry['match'] = native_trace == fallback_trace
+        lru_entry['speedup'] = lru_entry['fallback_ms'] / lru_entry['native_ms'] if lru_entry['native_ms'] else None
+    report.append(lru_entry)
+    return report
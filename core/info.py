@@ -1,6 +1,8 @@
 from enum import Enum
 from typing import Dict, List, Any
 
+from core.sparse_sheet import SparseSheet
+
 
 class EMkFile(Enum):
     Src = 0
@@ -159,6 +161,9 @@ class Info:
     @staticmethod
     def ReadCell(data, row, col):
         """셀 데이터 읽기"""
+        # CSR 시트(SparseSheet)는 행 리스트 없이 직접 조회
+        if type(data) is SparseSheet:
+            return data.read_cell(row, col)
         try:
             # 인덱스 범위 체크
             if row < len(data) and col < len(data[row]):
@@ -297,6 +302,7 @@ class ArrInfos:
         self.IdxOn = False
         self.LineAdd = False
         self.ElementType = ""  # 배열 요소의 타입 정보 저장
+        self.Layout = None  # 열별 정렬 정보 캐시 (code_generator.layout.ArrayLayout, writeArrMem에서 생성)
 
 class SCellPos:
     """셀 위치 구조체"""
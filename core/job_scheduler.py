@@ -0,0 +1,525 @@
+"""
+공용 백그라운드 작업 스케줄러
+
+가져오기/코드 생성/내보내기/Git 작업을 GUI 스레드 밖의 작업 스레드 풀에서 실행합니다.
+- 우선순위: 숫자가 작을수록 먼저 실행 (같은 우선순위는 제출 순서)
+- 자원 키(resource): 같은 키의 작업은 동시에 하나만 실행 (예: Info 전역 상태를 쓰는 'codegen', 'git')
+  키가 다르거나 없는 작업은 겹쳐 실행되므로 다음 Excel 가져오기와 이전 DB 코드 생성을 동시에 진행할 수 있습니다.
+- 취소: 작업마다 CancellationToken (작업 그룹 토큰의 자식) - 작업 함수는 토큰을 확인하고 중단
+- 진행률: JobContext.report()로 보고, 작업 그룹은 소속 작업 진행률을 합산
+- 결과: Job은 concurrent.futures.Future를 감싸며, 리스너로 시작/진행률/완료가 전달됩니다.
+CPU를 많이 쓰는 작업(다중 DB 코드 생성, xlsx 병렬 가져오기/내보내기)은 작업 스레드가 기존 프로세스 풀
+(ParallelCodeGenerator 등)을 구동하므로 이 모듈은 Qt에 의존하지 않습니다 (Qt 연결은 ui/job_bridge.py).
+
+사용 예:
+    from core.job_scheduler import get_job_scheduler
+
+    def export_job(ctx, db_file):
+        for i, sheet in enumerate(sheets):
+            ctx.check()  # 취소 시 JobCancelled
+            ...
+            ctx.report(i * 100 // len(sheets), sheet['name'])
+        return summary
+
+    job = get_job_scheduler().submit(export_job, db_file, name="CSV 내보내기", resource="git")
+    job.add_done_callback(lambda job: print(job.state, job.result()))
+"""
+
+import os
+import time
+import heapq
+import logging
+import itertools
+import threading
+import traceback
+from concurrent.futures import Future
+from typing import Callable, Dict, List, Optional
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import JOB_SCHEDULER_MAX_WORKERS
+except ImportError:
+    JOB_SCHEDULER_MAX_WORKERS = 0
+
+# 우선순위 (작을수록 먼저 실행)
+PRIORITY_HIGH = 0
+PRIORITY_NORMAL = 10
+PRIORITY_LOW = 20
+
+# 리스너 진행률 알림 최소 간격 (초) - 작업 함수는 얼마나 자주 보고해도 됨
+PROGRESS_NOTIFY_INTERVAL = 0.1
+
+# 작업 상태
+PENDING = 'pending'
+RUNNING = 'running'
+DONE = 'done'
+FAILED = 'failed'
+CANCELLED = 'cancelled'
+
+
+class JobCancelled(InterruptedError):
+    """취소 토큰으로 중단된 작업 (기존 InterruptedError 처리 경로와 호환)"""
+    pass
+
+
+class CancellationToken:
+    """
+    구조적 취소 토큰
+
+    부모 토큰이 취소되면 모든 자식 토큰도 취소됩니다 (작업 그룹 → 작업 → 하위 단계).
+    threading.Event와 같은 is_set()을 제공하므로 cancel_event를 받는 기존 함수에 그대로 전달할 수 있습니다.
+    """
+
+    def __init__(self, parent: Optional['CancellationToken'] = None):
+        self._event = threading.Event()
+        self._lock = threading.Lock()
+        self._children: List['CancellationToken'] = []
+        self._callbacks: List[Callable[[], None]] = []
+        if parent is not None:
+            parent._add_child(self)
+
+    def child(self) -> 'CancellationToken':
+        """이 토큰과 함께 취소되는 자식 토큰"""
+        return CancellationToken(self)
+
+    def cancel(self):
+        with self._lock:
+            if self._event.is_set():
+                return
+            self._event.set()
+            children = list(self._children)
+            callbacks = list(self._callbacks)
+        for child in children:
+            child.cancel()
+        for callback in callbacks:
+            try:
+                callback()
+            except Exception as e:
+                logging.warning(f"⚠ 취소 콜백 오류: {e}")
+
+    def on_cancel(self, callback: Callable[[], None]):
+        """취소 시 호출할 콜백 등록 (이미 취소되었으면 즉시 호출, 호출 스레드는 cancel()을 부른 스레드)"""
+        with self._lock:
+            if not self._event.is_set():
+                self._callbacks.append(callback)
+                return
+        callback()
+
+    @property
+    def cancelled(self) -> bool:
+        return self._event.is_set()
+
+    def is_set(self) -> bool:
+        return self._event.is_set()
+
+    def wait(self, timeout: Optional[float] = None) -> bool:
+        return self._event.wait(timeout)
+
+    def raise_if_cancelled(self, message: str = "작업이 취소되었습니다."):
+        if self._event.is_set():
+            raise JobCancelled(message)
+
+    def _add_child(self, child: 'CancellationToken'):
+        with self._lock:
+            cancelled = self._event.is_set()
+            if not cancelled:
+                self._children.append(child)
+        if cancelled:
+            child.cancel()
+
+
+class JobContext:
+    """작업 함수에 첫 인자로 전달되는 실행 문맥 (진행률 보고, 취소 확인)"""
+
+    def __init__(self, job: 'Job'):
+        self.job = job
+        self.token = job.token
+
+    def report(self, progress: float, message: str = ""):
+        """진행률 보고 (0~100, 리스너 알림은 PROGRESS_NOTIFY_INTERVAL 간격으로 제한)"""
+        self.job._report(progress, message)
+
+    def cancelled(self) -> bool:
+        return self.token.cancelled
+
+    def check(self, message: str = "작업이 취소되었습니다."):
+        """취소되었으면 JobCancelled 발생"""
+        self.token.raise_if_cancelled(message)
+
+    def generation_observer(self, base: float = 0.0, span: float = 100.0):
+        """
+        headless_generator.generate_database용 관찰자
+        (진행률은 이 작업으로 보고, 취소는 토큰 확인 → 다음 진행률 보고 시점에 InterruptedError)
+        """
+        from code_generator.headless_generator import GenerationObserver
+
+        context = self
+
+        class _JobObserver(GenerationObserver):
+            def on_progress(self, progress: int, message: str):
+                context.report(base + max(0, min(100, progress)) * span / 100.0, message)
+
+            def is_cancelled(self) -> bool:
+                return context.token.cancelled
+
+        return _JobObserver()
+
+
+class Job:
+    """
+    스케줄러에 제출된 작업 핸들 (Future 형태)
+
+    state: PENDING → RUNNING → DONE / FAILED / CANCELLED
+    작업 함수가 취소 요청 후에도 정상 반환하면(부분 결과) DONE으로 완료됩니다.
+    """
+
+    def __init__(self, scheduler: 'JobScheduler', job_id: int, name: str, fn: Callable, args: tuple, kwargs: dict,
+                 priority: int, resource: Optional[str], token: CancellationToken, group: Optional['JobGroup']):
+        self.scheduler = scheduler
+        self.id = job_id
+        self.name = name
+        self.priority = priority
+        self.resource = resource
+        self.token = token
+        self.group = group
+        self.state = PENDING
+        self.progress = 0.0
+        self.message = ""
+        self.error: Optional[BaseException] = None
+        self.error_traceback = ""
+        self.submitted_at = time.time()
+        self.started_at: Optional[float] = None
+        self.finished_at: Optional[float] = None
+        self.future: Future = Future()
+        self._fn = fn
+        self._args = args
+        self._kwargs = kwargs
+        self._last_notify = 0.0
+
+    # ------------------------------------------------------------------
+    # Future 인터페이스
+    # ------------------------------------------------------------------
+    def result(self, timeout: Optional[float] = None):
+        """작업 결과 (실패 시 작업 예외, 취소 시 JobCancelled 또는 CancelledError)"""
+        return self.future.result(timeout)
+
+    def exception(self, timeout: Optional[float] = None):
+        return self.future.exception(timeout)
+
+    def done(self) -> bool:
+        return self.future.done()
+
+    def add_done_callback(self, callback: Callable[['Job'], None]):
+        """완료 시 callback(job) 호출 (작업 스레드에서 호출됨 - GUI 갱신은 JobSignalBridge 사용)"""
+        self.future.add_done_callback(lambda _future: callback(self))
+
+    def cancel(self):
+        """취소 요청 - 대기 중이면 바로 제거, 실행 중이면 토큰으로 중단 요청"""
+        self.token.cancel()
+
+    @property
+    def elapsed(self) -> float:
+        if self.started_at is None:
+            return 0.0
+        return (self.finished_at or time.time()) - self.started_at
+
+    # ------------------------------------------------------------------
+    # 내부
+    # ------------------------------------------------------------------
+    def _report(self, progress: float, message: str):
+        self.progress = max(0.0, min(100.0, float(progress)))
+        if message:
+            self.message = message
+        now = time.time()
+        if self.progress >= 100 or now - self._last_notify >= PROGRESS_NOTIFY_INTERVAL:
+            self._last_notify = now
+            self.scheduler._notify('on_job_progress', self)
+
+    def _run(self):
+        self.state = RUNNING
+        self.started_at = time.time()
+        self.scheduler._notify('on_job_started', self)
+        try:
+            result = self._fn(JobContext(self), *self._args, **self._kwargs)
+        except InterruptedError as e:
+            self.state = CANCELLED
+            self.error = e if isinstance(e, JobCancelled) else JobCancelled(str(e))
+            self.future.set_exception(self.error)
+            logging.info(f"작업 취소됨 [{self.name}]: {e}")
+        except BaseException as e:
+            self.state = FAILED
+            self.error = e
+            self.error_traceback = traceback.format_exc()
+            self.future.set_exception(e)
+            logging.error(f"❌ 작업 실패 [{self.name}]: {e}\n{self.error_traceback}")
+        else:
+            self.state = DONE
+            self.progress = 100.0
+            self.future.set_result(result)
+        finally:
+            self.finished_at = time.time()
+            self._fn = self._args = self._kwargs = None
+
+
+class JobGroup:
+    """
+    여러 작업을 묶는 단위 (공통 취소 토큰, 진행률 합산)
+
+    사용 예:
+        group = scheduler.create_group("다중 DB 내보내기")
+        for db_file in db_files:
+            scheduler.submit(export_db, db_file, group=group)
+        group.cancel()  # 소속 작업 전체 취소
+    """
+
+    def __init__(self, name: str, token: Optional[CancellationToken] = None):
+        self.name = name
+        self.token = token or CancellationToken()
+        self.jobs: List[Job] = []
+        self._lock = threading.Lock()
+
+    def _add(self, job: Job):
+        with self._lock:
+            self.jobs.append(job)
+
+    def cancel(self):
+        self.token.cancel()
+
+    def progress(self) -> float:
+        """소속 작업 진행률 평균 (완료된 작업은 100)"""
+        with self._lock:
+            jobs = list(self.jobs)
+        if not jobs:
+            return 0.0
+        return sum(100.0 if job.done() else job.progress for job in jobs) / len(jobs)
+
+    def done(self) -> bool:
+        with self._lock:
+            return all(job.done() for job in self.jobs)
+
+    def results(self) -> List[Job]:
+        with self._lock:
+            return list(self.jobs)
+
+
+class JobListener:
+    """스케줄러 이벤트 수신 기본 구현 (작업 스레드에서 호출됨)"""
+
+    def on_job_submitted(self, job: Job):
+        pass
+
+    def on_job_started(self, job: Job):
+        pass
+
+    def on_job_progress(self, job: Job):
+        pass
+
+    def on_job_finished(self, job: Job):
+        pass
+
+
+class JobScheduler:
+    """우선순위/자원 키 기반 작업 스레드 풀 (작업 스레드는 필요할 때 max_workers까지 생성)"""
+
+    def __init__(self, max_workers: Optional[int] = None, name: str = "Job"):
+        if not max_workers:
+            max_workers = JOB_SCHEDULER_MAX_WORKERS or min(4, os.cpu_count() or 1)
+        self.max_workers = max(1, int(max_workers))
+        self.name = name
+        self._cond = threading.Condition()
+        self._queue: List[tuple] = []  # (priority, seq, job) 힙
+        self._seq = itertools.count()
+        self._ids = itertools.count(1)
+        self._busy_resources: Dict[str, int] = {}  # 자원 키 → 실행 중인 작업 ID
+        self._active: Dict[int, Job] = {}  # 대기/실행 중 작업
+        self._workers: List[threading.Thread] = []
+        self._idle_workers = 0
+        self._listeners: List[JobListener] = []
+        self._shutdown = False
+
+    # ------------------------------------------------------------------
+    # 제출 / 조회
+    # ------------------------------------------------------------------
+    def submit(self, fn: Callable, *args, name: str = "", priority: int = PRIORITY_NORMAL,
+               resource: Optional[str] = None, group: Optional[JobGroup] = None,
+               token: Optional[CancellationToken] = None, **kwargs) -> Job:
+        """
+        작업 제출: fn(ctx: JobContext, *args, **kwargs)를 작업 스레드에서 실행
+
+        Args:
+            fn: 작업 함수 (반환값이 Job.result())
+            name: 로그/진행률 표시용 이름
+            priority: 작을수록 먼저 실행 (PRIORITY_HIGH/NORMAL/LOW)
+            resource: 같은 키의 작업은 동시에 하나만 실행
+            group: 소속 작업 그룹 (그룹 토큰의 자식 토큰 사용)
+            token: 부모 취소 토큰 (group과 함께 지정하면 token 우선)
+
+        Returns:
+            Job
+        """
+        parent = token if token is not None else (group.token if group is not None else None)
+        with self._cond:
+            if self._shutdown:
+                raise RuntimeError("작업 스케줄러가 종료되었습니다.")
+            job = Job(self, next(self._ids), name or getattr(fn, '__name__', 'job'), fn, args, kwargs,
+                      priority, resource, CancellationToken(parent), group)
+            self._active[job.id] = job
+            heapq.heappush(self._queue, (priority, next(self._seq), job))
+            if group is not None:
+                group._add(job)
+            self._ensure_worker()
+            self._cond.notify()
+
+        job.token.on_cancel(lambda: self._discard_pending(job))
+        logging.info(f"작업 예약 [{job.id}] {job.name} (우선순위 {priority}"
+                     f"{', 자원 ' + resource if resource else ''})")
+        self._notify('on_job_submitted', job)
+        return job
+
+    def create_group(self, name: str, token: Optional[CancellationToken] = None) -> JobGroup:
+        return JobGroup(name, token)
+
+    def active_jobs(self) -> List[Job]:
+        """대기/실행 중 작업 (제출 순서)"""
+        with self._cond:
+            return sorted(self._active.values(), key=lambda job: job.id)
+
+    def is_resource_busy(self, resource: str) -> bool:
+        """해당 자원 키의 작업이 대기 또는 실행 중인지"""
+        with self._cond:
+            return any(job.resource == resource for job in self._active.values())
+
+    def overall_progress(self) -> float:
+        """대기/실행 중 작업 전체 진행률 평균"""
+        jobs = self.active_jobs()
+        if not jobs:
+            return 100.0
+        return sum(job.progress for job in jobs) / len(jobs)
+
+    def add_listener(self, listener: JobListener):
+        with self._cond:
+            if listener not in self._listeners:
+                self._listeners.append(listener)
+
+    def remove_listener(self, listener: JobListener):
+        with self._cond:
+            if listener in self._listeners:
+                self._listeners.remove(listener)
+
+    def cancel_all(self):
+        for job in self.active_jobs():
+            job.cancel()
+
+    def shutdown(self, wait: bool = True, timeout: Optional[float] = None):
+        """새 작업 제출을 막고 남은 작업을 모두 취소 (wait=True면 실행 중 작업 종료 대기)"""
+        with self._cond:
+            self._shutdown = True
+            workers = list(self._workers)
+            self._cond.notify_all()
+        self.cancel_all()
+        if wait:
+            deadline = None if timeout is None else time.time() + timeout
+            for worker in workers:
+                worker.join(None if deadline is None else max(0.0, deadline - time.time()))
+
+    # ------------------------------------------------------------------
+    # 작업 스레드
+    # ------------------------------------------------------------------
+    def _ensure_worker(self):
+        """대기 중인 작업 스레드가 없으면 새로 생성 (_cond 보유 상태에서 호출)"""
+        if self._idle_workers > 0 or len(self._workers) >= self.max_workers:
+            return
+        worker = threading.Thread(target=self._worker_loop, name=f"{self.name}Worker-{len(self._workers) + 1}",
+                                  daemon=True)
+        self._workers.append(worker)
+        worker.start()
+
+    def _next_runnable(self) -> Optional[Job]:
+        """우선순위 순으로 자원 키가 비어 있는 첫 작업 꺼내기 (_cond 보유 상태에서 호출)"""
+        skipped = []
+        job = None
+        while self._queue:
+            entry = heapq.heappop(self._queue)
+            candidate = entry[2]
+            if candidate.state != PENDING:
+                continue  # 대기 중 취소됨
+            if candidate.resource and candidate.resource in self._busy_resources:
+                skipped.append(entry)
+                continue
+            job = candidate
+            break
+        for entry in skipped:
+            heapq.heappush(self._queue, entry)
+        if job is not None and job.resource:
+            self._busy_resources[job.resource] = job.id
+        return job
+
+    def _worker_loop(self):
+        while True:
+            with self._cond:
+                job = self._next_runnable()
+                while job is None:
+                    if self._shutdown:
+                        return
+                    self._idle_workers += 1
+                    self._cond.wait()
+                    self._idle_workers -= 1
+                    job = self._next_runnable()
+                # 대기 중 취소와 경합하지 않도록 잠금 안에서 실행 상태로 전환
+                job.future.set_running_or_notify_cancel()
+                job.state = RUNNING
+
+            try:
+                job._run()
+            finally:
+                with self._cond:
+                    if job.resource and self._busy_resources.get(job.resource) == job.id:
+                        del self._busy_resources[job.resource]
+                    self._active.pop(job.id, None)
+                    self._cond.notify_all()  # 같은 자원 키로 기다리던 작업 실행
+                logging.info(f"작업 종료 [{job.id}] {job.name}: {job.state} ({job.elapsed:.1f}초)")
+                self._notify('on_job_finished', job)
+
+    def _discard_pending(self, job: Job):
+        """대기 중인 작업 취소 (실행 중이면 작업 함수가 토큰을 확인해 중단)"""
+        with self._cond:
+            if job.state != PENDING:
+                return
+            job.state = CANCELLED
+            job.error = JobCancelled("실행 전 취소되었습니다.")
+            self._active.pop(job.id, None)
+        job.future.cancel()
+        job.future.set_running_or_notify_cancel()
+        logging.info(f"작업 취소됨 (실행 전) [{job.id}] {job.name}")
+        self._notify('on_job_finished', job)
+
+    def _notify(self, method: str, job: Job):
+        with self._cond:
+            listeners = list(self._listeners)
+        for listener in listeners:
+            try:
+                getattr(listener, method)(job)
+            except Exception as e:
+                logging.warning(f"⚠ 작업 리스너 오류 ({method}): {e}")
+
+
+_scheduler: Optional[JobScheduler] = None
+_scheduler_lock = threading.Lock()
+
+
+def get_job_scheduler() -> JobScheduler:
+    """프로세스 공용 스케줄러 (첫 호출 시 생성)"""
+    global _scheduler
+    with _scheduler_lock:
+        if _scheduler is None:
+            _scheduler = JobScheduler()
+        return _scheduler
+
+
+def shutdown_job_scheduler(wait: bool = True, timeout: Optional[float] = 5.0):
+    """앱 종료 시 남은 작업 취소 및 작업 스레드 정리"""
+    global _scheduler
+    with _scheduler_lock:
+        scheduler, _scheduler = _scheduler, None
+    if scheduler is not None:
+        scheduler.shutdown(wait, timeout)
@@ -0,0 +1,132 @@
+"""
+Cython 커널 디스패치 테이블
+
+Cython 함수를 호출할 때마다 동적 import 하지 않고, 모듈 로드 시 register_kernel()로 한 번만 찾아
+Kernel 객체에 고정합니다. Cython 함수가 없거나 실행 중 예외가 나면 함께 등록한 Python 폴백을 호출합니다.
+커널별 Cython 호출 수(hits)와 폴백 호출 수(fallbacks)는 log_performance_status()에서 보고됩니다.
+
+사용 예:
+    _read_kernel = register_kernel('fast_read_cal_list_processing', 'code_generator_v2',
+                                   fallback=lambda *args: [])
+    rows = _read_kernel(sht_data, start, end, items)
+"""
+
+import logging
+import threading
+from contextlib import contextmanager
+from typing import Callable, Dict, Optional
+
+# 커널 이름 → Kernel (등록 순서 유지)
+_KERNELS: Dict[str, 'Kernel'] = {}
+_lock = threading.Lock()
+
+
+def _resolve(module_name: str, function_name: str) -> Optional[Callable]:
+    """cython_extensions.<module>.<function> 조회 (없으면 None)"""
+    if not module_name.startswith('cython_extensions.'):
+        module_name = f'cython_extensions.{module_name}'
+    try:
+        module = __import__(module_name, fromlist=[function_name])
+        return getattr(module, function_name)
+    except (ImportError, AttributeError):
+        return None
+
+
+class Kernel:
+    """한 번 조회된 Cython 함수와 Python 폴백, 호출 카운터"""
+    __slots__ = ('name', 'module', 'native', 'fallback', 'hits', 'fallbacks', 'errors')
+
+    def __init__(self, name: str, module: str, native: Optional[Callable], fallback: Optional[Callable]):
+        self.name = name
+        self.module = module
+        self.native = native
+        self.fallback = fallback
+        self.hits = 0        # Cython 함수 호출 수
+        self.fallbacks = 0   # Python 폴백 호출 수 (Cython 없음 + Cython 예외)
+        self.errors = 0      # Cython 함수 예외 수
+
+    @property
+    def available(self) -> bool:
+        return self.native is not None
+
+    def __call__(self, *args):
+        """Cython 함수 호출, 없거나 예외 시 Python 폴백 (폴백도 없으면 예외 전파)"""
+        native = self.native
+        if native is not None:
+            try:
+                result = native(*args)
+                self.hits += 1
+                return result
+            except Exception as e:
+                self.errors += 1
+                if self.fallback is None:
+                    raise
+                logging.debug(f"Cython 커널 {self.name} 실패, Python 폴백 사용: {e}")
+        elif self.fallback is None:
+            raise RuntimeError(f"커널 {self.name}: Cython 함수와 Python 폴백이 모두 없습니다")
+        self.fallbacks += 1
+        return self.fallback(*args)
+
+    def reset_stats(self):
+        self.hits = self.fallbacks = self.errors = 0
+
+
+def register_kernel(name: str, module: str, function: Optional[str] = None,
+                    fallback: Optional[Callable] = None) -> Kernel:
+    """
+    커널 등록 (이미 등록된 이름이면 기존 Kernel 반환 - 폴백이 없던 경우에만 채움)
+
+    Args:
+        name: 커널 이름 (통계 표시용, 보통 Cython 함수 이름)
+        module: cython_extensions 아래 모듈 이름
+        function: Cython 함수 이름 (None이면 name과 같음)
+        fallback: 같은 인자를 받는 Python 구현
+    """
+    with _lock:
+        kernel = _KERNELS.get(name)
+        if kernel is None:
+            kernel = _KERNELS[name] = Kernel(name, module, _resolve(module, function or name), fallback)
+        elif kernel.fallback is None:
+            kernel.fallback = fallback
+    return kernel
+
+
+def get_kernel(name: str) -> Optional[Kernel]:
+    return _KERNELS.get(name)
+
+
+def kernel_stats() -> Dict[str, Dict]:
+    """커널별 {'module', 'native', 'hits', 'fallbacks', 'errors'}"""
+    return {
+        name: {
+            'module': k.module,
+            'native': k.available,
+            'hits': k.hits,
+            'fallbacks': k.fallbacks,
+            'errors': k.errors,
+        }
+        for name, k in list(_KERNELS.items())
+    }
+
+
+def reset_kernel_stats():
+    for kernel in list(_KERNELS.values()):
+        kernel.reset_stats()
+
+
+@contextmanager
+def python_fallbacks_only():
+    """
+    벤치마크/비교용: 폴백이 있는 모든 커널을 일시적으로 Python 폴백으로만 실행
+    (with 블록을 벗어나면 Cython 함수 복원)
+    """
+    with _lock:
+        saved = {name: k.native for name, k in _KERNELS.items() if k.fallback is not None}
+        for name in saved:
+            _KERNELS[name].native = None
+    try:
+        yield
+    finally:
+        with _lock:
+            for name, native in saved.items():
+                _KERNELS[name].native = native
@@ -9,21 +9,88 @@ USE_CYTHON_CODE_GEN = True
 USE_CYTHON_DATA_PROC = True
 USE_CYTHON_CAL_LIST = True
 
+# CalList 행 해석 엔진 사용 (단순 OpCode 행을 dItem/CellInfos 없이 처리, False면 행마다 기존 경로)
+USE_CAL_LIST_ROW_ENGINE = True
+
 # Float Suffix 기능 설정 (중요: 누락되면 import 에러 발생)
 ENABLE_FLOAT_SUFFIX = True
 
 # 성능 모니터링
 ENABLE_PERFORMANCE_MONITORING = True
 
+# 계측 (core.tracing span/카운터 - 코드 > 성능 보고서에서 확인, Chrome trace JSON 내보내기)
+ENABLE_TRACING = False
+TRACE_BUFFER_SIZE = 100000  # 링 버퍼에 유지하는 최대 span 수
+
 # 배치 처리 크기
 EXCEL_BATCH_SIZE = 1000
 CODE_GEN_BATCH_SIZE = 500
 DB_BATCH_SIZE = 2000
 
+# 행/열 삽입·삭제를 논리 순서 테이블(axis_order)로 처리 (셀 좌표 재작성 생략, 코드 생성 시 정리)
+USE_AXIS_ORDER_INDIRECTION = True
+
+# 새 DB 파일의 SQLite 페이지 크기 (기존 DB는 변경되지 않음)
+DB_PAGE_SIZE = 8192
+
+# 다중 DB 관리 (DBManager)
+DB_LAZY_OPEN = True  # DB를 추가할 때 바로 연결하지 않고 첫 사용 시 조회 전용으로 연결 (쓰기 시 자동 전환)
+DB_MAX_OPEN_CONNECTIONS = 4  # 동시에 열어 두는 DB 연결 수 (초과 시 오래 사용하지 않은 DB부터 닫음, 현재 DB 제외)
+DB_IDLE_RELEASE_SEC = 300  # 이 시간 동안 사용하지 않은 DB 연결 닫기 (다시 사용하면 자동 재연결)
+DB_CACHE_BUDGET_MB = 256  # 열린 DB 연결 전체가 나눠 쓰는 SQLite 페이지 캐시 한도
+DB_MMAP_BUDGET_MB = 512  # 열린 DB 연결 전체가 나눠 쓰는 메모리 맵 한도
+USE_SYMBOL_INDEX = True  # DB 간 심볼 역색인 (심볼 검색, 코드 생성 전 중복 정의 확인)
+
+# Excel 가져오기 엔진 ('stream': xlsx 파일 직접 파싱, 'xlwings': Excel 실행 후 읽기)
+# xls/xlsb 등 스트리밍 불가 형식은 항상 xlwings 사용
+EXCEL_IMPORT_ENGINE = "stream"
+EXCEL_IMPORT_MAX_WORKERS = 0  # 다중 Excel 가져오기 워커 프로세스 수 (0이면 CPU 코어 수)
+
+# Excel 내보내기 엔진 ('stream': xlsx 파일 직접 작성, 'xlwings': Excel 실행 후 쓰기)
+EXCEL_EXPORT_ENGINE = "stream"
+EXCEL_EXPORT_MAX_WORKERS = 0  # 다중 DB 내보내기 워커 프로세스 수 (0이면 CPU 코어 수)
+
+# 코드 생성 시 시트를 CSR(희소 행) 형식으로 로드 (2차원 리스트 생성 생략)
+USE_SPARSE_SHEET_LOADER = True
+
+# 그리드(VirtualizedGridModel) 블록 캐시 설정
+GRID_BLOCK_ROWS = 256       # 한 번의 범위 쿼리로 읽는 행 수
+GRID_CACHE_BLOCKS = 64      # 캐시에 유지하는 최대 블록 수 (LRU)
+GRID_PREFETCH_BLOCKS = 2    # 스크롤 방향으로 미리 읽는 블록 수
+USE_GRID_PREFETCH = True    # 백그라운드 스레드 선읽기 사용
+
+# 셀 편집 지연 저장 (편집 저널) - 마지막 편집 후 이 시간이 지나면 한 트랜잭션으로 DB 반영
+EDIT_JOURNAL_IDLE_MS = 500
+EDIT_JOURNAL_MAX_PENDING = 5000  # 대기 셀이 이 개수를 넘으면 즉시 반영
+
 # 캐시 설정
 CELL_CACHE_MAX_SIZE = 100000
 MEMORY_POOL_SIZE = 1000
 
+# 병렬 코드 생성 설정 (다중 DB 코드 생성 시 DB별 워커 프로세스 사용)
+USE_PARALLEL_CODE_GEN = True
+CODE_GEN_MAX_WORKERS = 0  # 0이면 CPU 코어 수 사용
+
+# 증분 코드 생성 (시트 내용 해시가 같은 그룹/시트는 이전 결과 재사용)
+USE_INCREMENTAL_CODE_GEN = True
+
+# 시트 IR 영구 캐시 (FileInfo/CalList 파싱 결과를 세션 간 재사용, 시트 내용 해시로 무효화)
+USE_SHEET_IR_CACHE = True
+SHEET_IR_CACHE_DIR = ""  # 빈 값이면 사용자 캐시 디렉토리 (%LOCALAPPDATA%/AutoCalEditor, ~/.cache/AutoCalEditor)
+SHEET_IR_CACHE_MAX_MB = 256
+
+# Git 상태 캐시 (브랜치/상태를 캐시하고 git 메타데이터·history 서명이 바뀔 때만 git 실행)
+GIT_STATUS_CACHE_TTL_SEC = 10  # 서명이 같아도 이 시간이 지나면 다시 조회 (외부 편집 대비)
+
+# 단계적 시작 (창과 마지막 DB를 먼저 표시하고 Git 관리자/브랜치 목록/무거운 모듈은 백그라운드에서 준비)
+USE_STAGED_STARTUP = True
+STARTUP_WARMUP_DELAY_MS = 0  # 창 표시 후 백그라운드 준비 시작까지 대기 시간
+
+# 공용 작업 스케줄러 (가져오기/코드 생성/내보내기/Git 작업을 작업 스레드에서 실행, 모달리스 진행률 대화상자)
+# 끄면 기존처럼 GUI 스레드에서 진행률 대화상자와 이벤트 처리로 실행
+USE_JOB_SCHEDULER = True
+JOB_SCHEDULER_MAX_WORKERS = 0  # 동시에 실행하는 작업 수 (0이면 CPU 코어 수, 최대 4)
+
 def get_cython_status():
     """Cython 모듈 사용 가능 여부 확인"""
     status = {}
@@ -45,6 +112,24 @@ def get_cython_status():
         status['data_processor'] = True
     except ImportError:
         status['data_processor'] = False
+
+    try:
+        import cython_extensions.sparse_sheet
+        status['sparse_sheet'] = True
+    except ImportError:
+        status['sparse_sheet'] = False
+
+    try:
+        import cython_extensions.float_suffix
+        status['float_suffix'] = True
+    except ImportError:
+        status['float_suffix'] = False
+
+    try:
+        import cython_extensions.cal_list_engine
+        status['cal_list_engine'] = True
+    except ImportError:
+        status['cal_list_engine'] = False
     
     return status
 
@@ -63,3 +148,17 @@ def log_performance_status():
         logging.info("🚀 모든 Cython 최적화 모듈이 활성화되었습니다!")
     else:
         logging.warning("⚠ 일부 Cython 모듈을 사용할 수 없습니다. Python 폴백을 사용합니다.")
+
+    # 커널별 Cython/폴백 호출 수 (core.kernels 디스패치 테이블)
+    try:
+        from core.kernels import kernel_stats
+        stats = kernel_stats()
+    except ImportError:
+        stats = {}
+    if stats:
+        logging.info("=== Cython 커널 호출 통계 ===")
+        for name, info in stats.items():
+            mark = "✓" if info['native'] else "❌"
+            error_text = f", Cython 오류 {info['errors']}" if info['errors'] else ""
+            logging.info(f"{mark} {info['module']}.{name}: Cython {info['hits']}회, "
+                         f"폴백 {info['fallbacks']}회{error_text}")
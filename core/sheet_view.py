@@ -0,0 +1,96 @@
+"""
+정규화된 읽기 전용 시트 뷰 (CalList 셀 조회용)
+
+시트 데이터(SparseSheet 또는 2차원 리스트)를 로드 시점에 한 번만 문자열 변환/공백 제거하여
+행별 튜플로 보관합니다. 조회는 인덱스 비교 두 번과 튜플 인덱싱뿐이므로
+(row, col) 키 딕셔너리 캐시(해시/튜플 생성)나 셀마다 반복되는 str().strip()이 필요 없습니다.
+
+- read(row, col): Info.ReadCell과 같은 결과 (범위 밖/빈 셀은 빈 문자열)
+- 행 튜플은 마지막 비어있지 않은 셀까지만 저장 (뒤쪽 빈 셀은 범위 밖과 동일하게 빈 문자열)
+- SparseSheet는 문자열 테이블 단위로 정규화 (같은 문자열은 한 번만 strip)
+"""
+
+from typing import List, Sequence, Tuple
+
+from core.sparse_sheet import SparseSheet
+
+_EMPTY_ROW: Tuple[str, ...] = ()
+
+
+def _normalize(value) -> str:
+    """Info.ReadCell과 같은 정규화 (None → 빈 문자열, 그 외 문자열 변환 후 공백 제거)"""
+    if value is None:
+        return ""
+    return str(value).strip()
+
+
+def _trim(cells: List[str]) -> Tuple[str, ...]:
+    end = len(cells)
+    while end and not cells[end - 1]:
+        end -= 1
+    return tuple(cells[:end]) if end else _EMPTY_ROW
+
+
+class SheetView:
+    """
+    정규화된 시트 셀의 불변 뷰
+
+    사용 예:
+        view = SheetView.of(sht_info.Data)
+        read = view.read
+        value = read(row, col)
+    """
+    __slots__ = ('rows', 'row_count', 'col_count', 'cell_count')
+
+    def __init__(self, rows: Sequence[Tuple[str, ...]], col_count: int):
+        self.rows: Tuple[Tuple[str, ...], ...] = tuple(rows)
+        self.row_count = len(self.rows)
+        self.col_count = col_count
+        self.cell_count = sum(len(r) for r in self.rows)
+
+    @classmethod
+    def of(cls, data) -> 'SheetView':
+        """SparseSheet / 2차원 리스트 / SheetView에서 생성"""
+        if isinstance(data, SheetView):
+            return data
+        if type(data) is SparseSheet:
+            return cls.from_sparse(data)
+        return cls.from_dense(data or [])
+
+    @classmethod
+    def from_sparse(cls, sheet: SparseSheet) -> 'SheetView':
+        strings = [s.strip() for s in sheet.strings]
+        row_ptr, col_idx, val_idx = sheet.row_ptr, sheet.col_idx, sheet.val_idx
+        rows = []
+        for row in range(sheet.row_count):
+            lo, hi = row_ptr[row], row_ptr[row + 1]
+            if lo == hi:
+                rows.append(_EMPTY_ROW)
+                continue
+            cells = [""] * (col_idx[hi - 1] + 1)
+            for i in range(lo, hi):
+                cells[col_idx[i]] = strings[val_idx[i]]
+            rows.append(_trim(cells))
+        return cls(rows, sheet.col_count)
+
+    @classmethod
+    def from_dense(cls, data: List[List]) -> 'SheetView':
+        rows = [_trim([_normalize(v) for v in row_data]) if row_data else _EMPTY_ROW for row_data in data]
+        return cls(rows, max((len(r) for r in data), default=0))
+
+    def read(self, row: int, col: int) -> str:
+        """셀 값 (범위 밖이면 빈 문자열)"""
+        if 0 <= row < self.row_count:
+            cells = self.rows[row]
+            if 0 <= col < len(cells):
+                return cells[col]
+        return ""
+
+    def row(self, row: int) -> Tuple[str, ...]:
+        """정규화된 행 튜플 (범위 밖이면 빈 튜플)"""
+        if 0 <= row < self.row_count:
+            return self.rows[row]
+        return _EMPTY_ROW
+
+    def __len__(self) -> int:
+        return self.row_count
@@ -0,0 +1,191 @@
+"""
+CSR(압축 희소 행) 형식 시트 데이터
+
+DB cells 테이블을 (row, col) 순으로 한 번 스캔하여 만들며, 행마다 Python 리스트를 만들지 않습니다.
+- row_ptr[r] ~ row_ptr[r+1]: r행 셀들의 구간
+- col_idx[i]: i번째 셀의 열 번호 (행 내 오름차순)
+- val_idx[i]: i번째 셀 값의 문자열 테이블 인덱스 (같은 문자열은 한 번만 저장)
+
+기존 코드(Info.ReadCell, CalList, FileInfo)가 사용하는 len(data), data[row], len(data[row]),
+data[row][col] 접근은 SparseRow 뷰로 호환됩니다.
+"""
+
+from array import array
+from bisect import bisect_left
+from typing import Iterable, List, Optional, Tuple
+import logging
+
+# Cython 최적화 모듈 import (CSR 조회/생성)
+try:
+    from cython_extensions.sparse_sheet import CSRIndex, fast_build_csr
+    USE_CYTHON_SPARSE = True
+except ImportError:
+    USE_CYTHON_SPARSE = False
+    logging.debug("Cython sparse_sheet 모듈 없음, Python 폴백 사용")
+
+
+def build_csr_python(cells: Iterable[Tuple[int, int, str]]):
+    """
+    (row, col, value) 정렬 스트림에서 CSR 배열 생성 (Python 폴백)
+
+    Returns:
+        (row_ptr, col_idx, val_idx, strings, row_count, col_count)
+    """
+    row_ptr = array('i', [0])
+    col_idx = array('i')
+    val_idx = array('i')
+    strings: List[str] = [""]
+    intern = {"": 0}
+
+    current_row = 0
+    max_col = -1
+
+    for row, col, value in cells:
+        while current_row < row:
+            row_ptr.append(len(col_idx))
+            current_row += 1
+
+        if not isinstance(value, str):
+            value = str(value)
+        index = intern.get(value)
+        if index is None:
+            index = len(strings)
+            intern[value] = index
+            strings.append(value)
+
+        col_idx.append(col)
+        val_idx.append(index)
+        if col > max_col:
+            max_col = col
+
+    row_count = current_row + 1 if len(col_idx) else 0
+    if row_count:
+        row_ptr.append(len(col_idx))
+    else:
+        row_ptr = array('i', [0])
+
+    return row_ptr, col_idx, val_idx, strings, row_count, max_col + 1
+
+
+class SparseRow:
+    """SparseSheet의 한 행에 대한 읽기 전용 뷰 (list[str] 호환)"""
+    __slots__ = ('_sheet', '_row')
+
+    def __init__(self, sheet: 'SparseSheet', row: int):
+        self._sheet = sheet
+        self._row = row
+
+    def __len__(self) -> int:
+        return self._sheet.col_count
+
+    def __getitem__(self, col):
+        if isinstance(col, slice):
+            return [self._sheet.get(self._row, c) for c in range(*col.indices(self._sheet.col_count))]
+        if col < 0:
+            col += self._sheet.col_count
+        if col < 0 or col >= self._sheet.col_count:
+            raise IndexError("열 인덱스 범위 초과")
+        return self._sheet.get(self._row, col)
+
+    def __iter__(self):
+        return iter(self._sheet.dense_row(self._row))
+
+
+class SparseSheet:
+    """
+    CSR 형식 시트 데이터 (get_sheet_data의 2차원 리스트 대체)
+
+    크기 의미는 get_sheet_data와 동일: 행 수 = 최대 행 + 1, 열 수 = 최대 열 + 1
+    """
+    __slots__ = ('row_count', 'col_count', 'row_ptr', 'col_idx', 'val_idx', 'strings', '_index')
+
+    def __init__(self, row_ptr, col_idx, val_idx, strings: List[str], row_count: int, col_count: int):
+        self.row_ptr = row_ptr
+        self.col_idx = col_idx
+        self.val_idx = val_idx
+        self.strings = strings
+        self.row_count = row_count
+        self.col_count = col_count
+        self._index = CSRIndex(row_ptr, col_idx, val_idx, row_count) if USE_CYTHON_SPARSE and row_count else None
+
+    @classmethod
+    def from_cells(cls, cells: Iterable[Tuple[int, int, str]]) -> 'SparseSheet':
+        """(row, col) 오름차순 정렬된 (row, col, value) 스트림에서 생성"""
+        if USE_CYTHON_SPARSE:
+            cells = cells if isinstance(cells, list) else list(cells)
+            return cls(*fast_build_csr(cells))
+        return cls(*build_csr_python(cells))
+
+    @classmethod
+    def from_dense(cls, data: List[List]) -> 'SparseSheet':
+        """기존 2차원 리스트에서 생성 (빈 값 제외, 크기는 원본 유지)"""
+        cells = [(r, c, value) for r, row_data in enumerate(data) for c, value in enumerate(row_data)
+                 if value is not None and value != ""]
+        sheet = cls(*build_csr_python(cells))
+        # 빈 행/열로 끝나는 경우에도 원본 크기 유지
+        if len(data) > sheet.row_count:
+            pad = len(data) - sheet.row_count
+            last = sheet.row_ptr[-1]
+            sheet.row_ptr.extend([last] * pad)
+            sheet.row_count = len(data)
+            sheet._index = CSRIndex(sheet.row_ptr, sheet.col_idx, sheet.val_idx, sheet.row_count) if USE_CYTHON_SPARSE else None
+        sheet.col_count = max(sheet.col_count, max((len(r) for r in data), default=0))
+        return sheet
+
+    def get(self, row: int, col: int) -> str:
+        """원본 셀 값 (없으면 빈 문자열)"""
+        if row < 0 or row >= self.row_count:
+            return ""
+        if self._index is not None:
+            return self.strings[self._index.find(row, col)]
+
+        lo = self.row_ptr[row]
+        hi = self.row_ptr[row + 1]
+        i = bisect_left(self.col_idx, col, lo, hi)
+        if i < hi and self.col_idx[i] == col:
+            return self.strings[self.val_idx[i]]
+        return ""
+
+    def read_cell(self, row: int, col: int) -> str:
+        """Info.ReadCell과 동일한 결과 (범위 밖이면 빈 문자열, 공백 제거)"""
+        if col >= self.col_count:
+            return ""
+        return self.get(row, col).strip()
+
+    def dense_row(self, row: int) -> List[str]:
+        """한 행을 리스트로 펼치기 (내보내기/디버깅용)"""
+        result = [""] * self.col_count
+        for i in range(self.row_ptr[row], self.row_ptr[row + 1]):
+            result[self.col_idx[i]] = self.strings[self.val_idx[i]]
+        return result
+
+    def to_dense(self) -> List[List[str]]:
+        """get_sheet_data와 동일한 2차원 리스트로 변환"""
+        return [self.dense_row(row) for row in range(self.row_count)]
+
+    @property
+    def cell_count(self) -> int:
+        return len(self.col_idx)
+
+    @property
+    def nbytes(self) -> int:
+        """인덱스 배열 메모리 사용량 (문자열 테이블 제외)"""
+        return (len(self.row_ptr) + len(self.col_idx) + len(self.val_idx)) * self.col_idx.itemsize
+
+    def __len__(self) -> int:
+        return self.row_count
+
+    def __bool__(self) -> bool:
+        return self.row_count > 0
+
+    def __getitem__(self, row):
+        if isinstance(row, slice):
+            return [SparseRow(self, r) for r in range(*row.indices(self.row_count))]
+        if row < 0:
+            row += self.row_count
+        if row < 0 or row >= self.row_count:
+            raise IndexError("행 인덱스 범위 초과")
+        return SparseRow(self, row)
+
+    def __iter__(self):
+        return (SparseRow(self, r) for r in range(self.row_count))
@@ -0,0 +1,69 @@
+"""
+앱 시작 단계별 소요 시간 기록
+
+프로세스 시작(모듈 import)부터 창 표시, 마지막 DB 로드, 백그라운드 준비(Git/모듈 warm-up)까지
+단계별 소요 시간을 로그로 남기고, 추적이 켜져 있으면 tracer span으로도 기록합니다.
+작업 스레드에서 기록하는 단계도 있으므로 기록은 잠금으로 보호합니다.
+
+사용 예:
+    from core.startup_profiler import startup_profiler
+
+    with startup_profiler.phase("ui"):
+        self.init_ui()
+    startup_profiler.mark("window_shown")
+    startup_profiler.log_summary()
+"""
+
+import time
+import logging
+import threading
+from contextlib import contextmanager
+from typing import Dict, List, Tuple
+
+from core.tracing import tracer
+
+
+class StartupProfiler:
+    def __init__(self):
+        self.origin = time.perf_counter()
+        self.phases: List[Tuple[str, float, float]] = []  # (이름, 시작 오프셋, 소요 시간) - 초 단위
+        self.marks: Dict[str, float] = {}
+        self._lock = threading.Lock()
+
+    def elapsed(self) -> float:
+        """프로세스 시작 기준 경과 시간 (초)"""
+        return time.perf_counter() - self.origin
+
+    @contextmanager
+    def phase(self, name: str):
+        start = time.perf_counter()
+        try:
+            with tracer.span(f"startup.{name}", "startup"):
+                yield
+        finally:
+            duration = time.perf_counter() - start
+            with self._lock:
+                self.phases.append((name, start - self.origin, duration))
+            logging.info(f"⏱ 시작 단계 '{name}': {duration * 1000:.1f}ms "
+                         f"(시작 후 {(start - self.origin + duration) * 1000:.1f}ms)")
+
+    def mark(self, name: str):
+        """시점 기록 (예: 창 표시, 사용 가능 상태)"""
+        offset = self.elapsed()
+        with self._lock:
+            self.marks[name] = offset
+        logging.info(f"⏱ 시작 시점 '{name}': 시작 후 {offset * 1000:.1f}ms")
+
+    def log_summary(self):
+        with self._lock:
+            phases = list(self.phases)
+            marks = dict(self.marks)
+        logging.info("=== 시작 단계별 소요 시간 ===")
+        for name, offset, duration in phases:
+            logging.info(f"  {name}: {duration * 1000:.1f}ms (시작 후 {offset * 1000:.1f}ms부터)")
+        for name, offset in sorted(marks.items(), key=lambda item: item[1]):
+            logging.info(f"  [{name}] 시작 후 {offset * 1000:.1f}ms")
+
+
+# 프로세스 전체 공유 인스턴스 (main 모듈 import 시점이 기준)
+startup_profiler = StartupProfiler()
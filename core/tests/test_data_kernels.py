@@ -0,0 +1,156 @@
+"""
+데이터 처리 커널(core/data_kernels) 회귀 테스트
+
+- Python 폴백이 단순 기준 구현과 같은 결과를 내는지 (정렬 안정성, 조인 순서, LRU 제거 순서, 보간 경계/NaN)
+- Cython 커널이 있으면 같은 입력(NaN 포함)에서 폴백과 결과가 같은지 (check_kernel_parity)
+
+실행: python -m unittest discover -t . -s core/tests
+"""
+
+import math
+import random
+import unittest
+from array import array
+from collections import OrderedDict
+
+from core import data_kernels as dk
+
+NAN = float('nan')
+
+
+class KeyedSortTest(unittest.TestCase):
+    def setUp(self):
+        self.values = [3, "1e3", None, -0.0, "abc", 2.5, NAN, 3.0, "nan", True, 0, -7]
+
+    def test_numeric_is_stable_and_maps_invalid_to_zero(self):
+        expected = sorted(self.values, key=dk.numeric_sort_key)
+        self.assertEqual(dk.keyed_sort_python(self.values, "numeric"), expected)
+        # 0.0 키(None/"abc"/NaN/"nan"/-0.0/0)는 원래 순서 유지
+        zero_keys = [v for v in dk.keyed_sort_python(self.values, "numeric") if dk.numeric_sort_key(v) == 0.0]
+        self.assertEqual([repr(v) for v in zero_keys],
+                         [repr(v) for v in self.values if dk.numeric_sort_key(v) == 0.0])
+
+    def test_numeric_reverse_keeps_equal_keys_in_original_order(self):
+        result = dk.keyed_sort_python([1, 2.0, 1.0, 2], "numeric", True)
+        self.assertEqual([repr(v) for v in result], ["2.0", "2", "1", "1.0"])
+
+    def test_string_and_unknown_key(self):
+        self.assertEqual(dk.keyed_sort_python(["b", None, "a"], "string"), [None, "a", "b"])
+        self.assertEqual(dk.keyed_sort_python([3, 1, 2], "unknown"), [3, 1, 2])
+
+
+class HashJoinTest(unittest.TestCase):
+    def test_matches_nested_loop_order(self):
+        rng = random.Random(1)
+        left = [(rng.randint(0, 20), i) for i in range(200)]
+        right = [(rng.randint(0, 20), -i) for i in range(100)]
+        expected = [(l, r) for l in left for r in right if l[0] == r[0]]
+        self.assertEqual(dk.hash_join_python(left, right, 0, 0), expected)
+
+    def test_hash_match_unhashable_falls_back_to_linear_search(self):
+        self.assertEqual(dk.hash_match_python([[1], [2], [1]], [[1]]), [[1], [1]])
+        self.assertEqual(dk.hash_match_python(["a", "b", "a"], ["a"]), ["a", "a"])
+
+
+class MapKernelTest(unittest.TestCase):
+    def setUp(self):
+        self.x_axis = array('d', [0.0, 10.0, 20.0])
+        self.y_axis = array('d', [0.0, 100.0])
+        self.values = array('d', [0.0, 1.0, 2.0,
+                                  10.0, 11.0, 12.0])
+
+    def test_elementwise_and_affine(self):
+        self.assertEqual(list(dk.map_elementwise_python([1, 2], [3, 4], "multiply")), [3.0, 8.0])
+        self.assertEqual(list(dk.map_affine_python([1, 2], 0.5, -1)), [-0.5, 0.0])
+        with self.assertRaises(ValueError):
+            dk.map_elementwise_python([1], [1, 2], "add")
+        with self.assertRaises(ZeroDivisionError):
+            dk.map_elementwise_python([1], [0], "divide")
+
+    def test_interp2d_grid_points_midpoints_and_clamping(self):
+        f = dk.map_interp2d_python
+        self.assertEqual(f(self.x_axis, self.y_axis, self.values, 10.0, 100.0), 11.0)
+        self.assertEqual(f(self.x_axis, self.y_axis, self.values, 5.0, 50.0), 5.5)
+        self.assertEqual(f(self.x_axis, self.y_axis, self.values, -5.0, -1.0), 0.0)
+        self.assertEqual(f(self.x_axis, self.y_axis, self.values, 99.0, 999.0), 12.0)
+        self.assertEqual(f(self.x_axis, self.y_axis, self.values, math.inf, -math.inf), 2.0)
+
+    def test_interp2d_nan_coordinate_returns_nan(self):
+        f = dk.map_interp2d_python
+        for x, y in ((NAN, 5.0), (5.0, NAN), (NAN, NAN)):
+            self.assertTrue(math.isnan(f(self.x_axis, self.y_axis, self.values, x, y)), (x, y))
+        # 디스패치 커널(Cython 또는 폴백)도 같은 규칙
+        self.assertTrue(math.isnan(dk.map_interp2d(self.x_axis, self.y_axis, self.values, NAN, 5.0)))
+
+    def test_interp2d_nan_values_propagate_only_to_neighbours(self):
+        values = array('d', self.values)
+        values[0] = NAN
+        f = dk.map_interp2d_python
+        self.assertTrue(math.isnan(f(self.x_axis, self.y_axis, values, 5.0, 50.0)))
+        self.assertEqual(f(self.x_axis, self.y_axis, values, 15.0, 50.0), 6.5)
+
+    def test_interp2d_size_mismatch(self):
+        with self.assertRaises(ValueError):
+            dk.map_interp2d_python(self.x_axis, self.y_axis, self.values[:5], 0.0, 0.0)
+
+
+class LRUCacheTest(unittest.TestCase):
+    def _check(self, cache_class):
+        cache = cache_class(2)
+        cache.put("a", 1)
+        cache.put("b", 2)
+        self.assertEqual(cache.get("a"), 1)  # a가 최근 사용
+        cache.put("c", 3)  # b 제거
+        self.assertNotIn("b", cache)
+        self.assertEqual(cache.keys(), ["a", "c"])
+        self.assertEqual(cache.pop("a"), 1)
+        self.assertEqual(cache.get("a", "missing"), "missing")
+        self.assertEqual((len(cache), cache.hits, cache.misses), (1, 1, 1))
+        with self.assertRaises(ValueError):
+            cache_class(0)
+
+    def test_python_cache(self):
+        self._check(dk.LRUCachePython)
+
+    def test_dispatched_cache(self):
+        self._check(dk.LRUCache)
+
+    def test_matches_ordered_dict_model(self):
+        rng = random.Random(2)
+        operations = [(rng.randint(0, 2), rng.randint(0, 30)) for _ in range(3000)]
+        model, trace = OrderedDict(), []
+        for op, key in operations:
+            if op == 0:
+                if key in model:
+                    model.move_to_end(key)
+                trace.append(model.get(key))
+            elif op == 1:
+                if key in model:
+                    model.move_to_end(key)
+                elif len(model) >= 64:
+                    model.popitem(last=False)
+                model[key] = key * 2
+            else:
+                trace.append(model.pop(key, None))
+        self.assertEqual(dk._lru_trace(dk.LRUCachePython, operations)[:-1], trace)
+        self.assertEqual(dk._lru_trace(dk.LRUCachePython, operations)[-1][0], list(model))
+
+
+class KernelParityTest(unittest.TestCase):
+    def test_native_kernels_match_fallbacks(self):
+        report = dk.check_kernel_parity(size=3000, repeat=1)
+        labels = [entry['kernel'] for entry in report]
+        self.assertIn("fast_map_interp2d nan", labels)
+        mismatched = [entry['kernel'] for entry in report if not entry['match']]
+        self.assertEqual(mismatched, [])
+
+    @unittest.skipUnless(dk.map_interp2d.available, "Cython data_processor 없음")
+    def test_native_interp2d_nan_matches_fallback(self):
+        x_axis, y_axis = array('d', [0, 1]), array('d', [0, 1])
+        values = array('d', [0, 1, 2, 3])
+        for x, y in ((NAN, 0.5), (0.5, NAN), (NAN, NAN)):
+            self.assertTrue(math.isnan(dk.map_interp2d.native(x_axis, y_axis, values, x, y)))
+
+
+if __name__ == "__main__":
+    unittest.main()
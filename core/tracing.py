@@ -0,0 +1,201 @@
+"""
+경량 계측 (스코프 span + 카운터)
+
+코드 생성/DB 조회/CSV 내보내기/git 호출 등 핵심 구간을 span으로 기록하고,
+마지막 실행 결과를 Chrome trace JSON(chrome://tracing, Perfetto)으로 내보내거나
+성능 보고서(시트별 소요 시간, 초당 행 수, 캐시 적중률)로 요약합니다.
+
+- 비활성화 상태(기본값, ENABLE_TRACING = False)에서는 span()이 공유 no-op 객체를 반환하고
+  traced 데코레이터는 플래그 확인 한 번 후 원래 함수를 그대로 호출합니다.
+- span 이벤트는 고정 크기 링 버퍼(deque)에 쌓이므로 오래 실행해도 메모리가 늘지 않습니다.
+
+사용 예:
+    from core.tracing import tracer, traced
+
+    with tracer.span("cal_list.read", "code_gen", sheet=sheet_name):
+        ...
+    tracer.count("cal_list.rows", row_count)
+
+    @traced("db.get_sheet_data", "db")
+    def get_sheet_data(self, sheet_id): ...
+"""
+
+import os
+import json
+import time
+import threading
+from collections import deque
+from functools import wraps
+from typing import Dict, List, Optional
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import ENABLE_TRACING, TRACE_BUFFER_SIZE
+except ImportError:
+    ENABLE_TRACING = False
+    TRACE_BUFFER_SIZE = 100000
+
+
+class _NullSpan:
+    """비활성화 상태의 span (아무것도 기록하지 않음)"""
+    __slots__ = ()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc, tb):
+        return False
+
+    def set(self, **args):
+        pass
+
+
+_NULL_SPAN = _NullSpan()
+
+
+class _Span:
+    """완료 시 Chrome trace 'X'(complete) 이벤트 하나를 기록하는 span"""
+    __slots__ = ('tracer', 'name', 'cat', 'args', 'start')
+
+    def __init__(self, tracer: 'Tracer', name: str, cat: str, args: Dict):
+        self.tracer = tracer
+        self.name = name
+        self.cat = cat
+        self.args = args
+        self.start = 0
+
+    def __enter__(self):
+        self.start = time.perf_counter_ns()
+        return self
+
+    def __exit__(self, exc_type, exc, tb):
+        end = time.perf_counter_ns()
+        if exc_type is not None:
+            self.args['error'] = exc_type.__name__
+        self.tracer._record(self.name, self.cat, self.start, end - self.start, self.args)
+        return False
+
+    def set(self, **args):
+        """span 진행 중 인자 추가 (예: 처리한 행 수)"""
+        self.args.update(args)
+
+
+class Tracer:
+    """span 이벤트 링 버퍼와 카운터"""
+
+    def __init__(self, enabled: bool = ENABLE_TRACING, buffer_size: int = TRACE_BUFFER_SIZE):
+        self.enabled = enabled
+        self.events: deque = deque(maxlen=max(1000, int(buffer_size)))
+        self.counters: Dict[str, float] = {}
+        self.run_label = ""
+        self.run_started = time.perf_counter_ns()
+        self._lock = threading.Lock()
+
+    # ------------------------------------------------------------------
+    # 기록
+    # ------------------------------------------------------------------
+    def span(self, name: str, cat: str = "app", **args):
+        """with 블록 구간 기록 (비활성화 시 no-op)"""
+        if not self.enabled:
+            return _NULL_SPAN
+        return _Span(self, name, cat, args)
+
+    def count(self, name: str, value: float = 1):
+        """카운터 누적 (비활성화 시 무시)"""
+        if not self.enabled:
+            return
+        with self._lock:
+            self.counters[name] = self.counters.get(name, 0) + value
+
+    def _record(self, name: str, cat: str, start_ns: int, dur_ns: int, args: Dict):
+        self.events.append((name, cat, start_ns, dur_ns, threading.get_ident(), args))
+
+    # ------------------------------------------------------------------
+    # 실행 단위 관리
+    # ------------------------------------------------------------------
+    def set_enabled(self, enabled: bool):
+        self.enabled = bool(enabled)
+
+    def begin_run(self, label: str = ""):
+        """새 실행 시작 - 이전 이벤트/카운터 비움"""
+        with self._lock:
+            self.events.clear()
+            self.counters = {}
+            self.run_label = label
+            self.run_started = time.perf_counter_ns()
+
+    # ------------------------------------------------------------------
+    # 내보내기 / 요약
+    # ------------------------------------------------------------------
+    def export_chrome_trace(self, file_path: str) -> int:
+        """Chrome trace JSON 저장 - 기록된 이벤트 수 반환"""
+        pid = os.getpid()
+        base = self.run_started
+        trace_events = [{
+            'name': name, 'cat': cat, 'ph': 'X', 'pid': pid, 'tid': tid,
+            'ts': (start - base) / 1000.0, 'dur': dur / 1000.0, 'args': args,
+        } for name, cat, start, dur, tid, args in list(self.events)]
+
+        end_ts = max((e['ts'] + e['dur'] for e in trace_events), default=0.0)
+        for name, value in sorted(self.counters.items()):
+            trace_events.append({'name': name, 'ph': 'C', 'pid': pid, 'tid': 0, 'ts': end_ts, 'args': {'value': value}})
+
+        with open(file_path, 'w', encoding='utf-8') as f:
+            json.dump({'traceEvents': trace_events, 'displayTimeUnit': 'ms',
+                       'otherData': {'run': self.run_label}}, f, ensure_ascii=False)
+        return len(trace_events)
+
+    def summary(self) -> Dict:
+        """
+        마지막 실행 요약
+            spans: {이름: {'count', 'total_ms', 'max_ms'}}
+            sheets: [{'sheet', 'span', 'ms', 'rows', 'rows_per_sec'}] - 'sheet' 인자가 있는 span
+            counters: {이름: 값}
+            hit_rates: {캐시 이름: 적중률} - '<이름>.hits' / '<이름>.misses' 카운터 쌍
+        """
+        spans: Dict[str, Dict] = {}
+        sheets: List[Dict] = []
+        for name, _cat, _start, dur, _tid, args in list(self.events):
+            ms = dur / 1e6
+            entry = spans.setdefault(name, {'count': 0, 'total_ms': 0.0, 'max_ms': 0.0})
+            entry['count'] += 1
+            entry['total_ms'] += ms
+            entry['max_ms'] = max(entry['max_ms'], ms)
+
+            sheet = args.get('sheet')
+            if sheet is not None:
+                rows = args.get('rows', 0)
+                sheets.append({'sheet': sheet, 'span': name, 'ms': ms, 'rows': rows,
+                               'rows_per_sec': rows / (ms / 1000.0) if rows and ms else 0.0})
+
+        counters = dict(self.counters)
+        hit_rates = {}
+        for key, hits in counters.items():
+            if key.endswith('.hits'):
+                cache_name = key[:-len('.hits')]
+                total = hits + counters.get(cache_name + '.misses', 0)
+                if total:
+                    hit_rates[cache_name] = hits / total
+
+        return {'run': self.run_label, 'spans': spans, 'sheets': sheets, 'counters': counters, 'hit_rates': hit_rates}
+
+
+# 프로세스 전역 트레이서
+tracer = Tracer()
+
+
+def traced(name: Optional[str] = None, cat: str = "app"):
+    """함수 전체를 span으로 기록하는 데코레이터 (비활성화 시 플래그 확인 후 바로 호출)"""
+    def decorator(func):
+        span_name = name or func.__qualname__
+
+        @wraps(func)
+        def wrapper(*args, **kwargs):
+            if not tracer.enabled:
+                return func(*args, **kwargs)
+            with _Span(tracer, span_name, cat, {}):
+                return func(*args, **kwargs)
+
+        return wrapper
+
+    return decorator
@@ -0,0 +1,216 @@
+# cal_list_engine.pyx
+# cython: language_level=3
+# cython: boundscheck=False
+# cython: wraparound=False
+# cython: cdivision=True
+
+"""
+CalList 행 해석 엔진 (Cython)
+code_generator/cal_list_engine.py의 CalListRowEnginePython과 동일한 동작
+
+- 셀 값은 CalList의 정규화된 시트 뷰(SheetView) 행 튜플을 직접 인덱싱 (문자열 변환/공백 제거 없음)
+- OpCode → 정수 모드 코드, 열 위치와 정렬 길이는 C 정수로 유지
+- 단순 OpCode 행의 오류 체크/임시 코드 레코드(6-튜플)/정렬 길이 갱신을 엔진 안에서 처리
+- 타이틀/배열/프로젝트 정의/프라그마 행은 CalList._process_row()로 넘김
+"""
+
+import cython
+from cython import boundscheck, wraparound
+
+from core.info import Info, EMkMode, EErrType
+
+cdef int M_SUBTITLE = EMkMode.SUBTITLE.value
+cdef int M_DESCRIPT = EMkMode.DESCRIPT.value
+cdef int M_DEFINE = EMkMode.DEFINE.value
+cdef int M_TYPEDEF = EMkMode.TYPEDEF.value
+cdef int M_STR_MEM = EMkMode.STR_MEM.value
+cdef int M_STR_DEF = EMkMode.STR_DEF.value
+cdef int M_ENUM = EMkMode.ENUM.value
+cdef int M_ENUM_MEM = EMkMode.ENUM_MEM.value
+cdef int M_ENUM_END = EMkMode.ENUM_END.value
+cdef int M_VARIABLE = EMkMode.VARIABLE.value
+cdef int M_CODE = EMkMode.CODE.value
+
+
+cdef inline bint _is_simple(int code):
+    return (code == M_SUBTITLE or code == M_DESCRIPT or code == M_DEFINE or code == M_TYPEDEF or
+            code == M_STR_MEM or code == M_STR_DEF or code == M_ENUM or code == M_ENUM_MEM or
+            code == M_ENUM_END or code == M_VARIABLE or code == M_CODE)
+
+
+cdef class CalListRowEngine:
+    """CalList 행 해석 엔진 - CalListRowEngine(cal_list).run(start_row, end_row)"""
+
+    cdef object cl
+    cdef dict opcodes
+    cdef tuple rows
+    cdef Py_ssize_t row_count
+
+    cdef int op_col, key_col, type_col
+    cdef int name_dflt_col, mem_dflt_col, val_dflt_col, desc_dflt_col
+    cdef int len_key, len_type, len_name, len_val
+
+    # 마지막으로 엔진이 처리한 행의 값 (has_last가 참일 때만 유효)
+    cdef bint has_last
+    cdef str last_op, last_key, last_type, last_name, last_val, last_desc
+    cdef int last_name_col
+
+    def __init__(self, cal_list):
+        self.cl = cal_list
+        self.opcodes = {op: (mode.value, mode) for op, mode in Info.dOpCode.items()}
+
+        self.rows = cal_list.sheetView.rows
+        self.row_count = len(self.rows)
+
+        items = cal_list.dItem
+        self.op_col = items["OpCode"].Col
+        self.key_col = items["Keyword"].Col
+        self.type_col = items["Type"].Col
+        self.name_dflt_col = cal_list.nameDfltCol
+        self.mem_dflt_col = cal_list.memDfltCol
+        self.val_dflt_col = cal_list.valDfltCol
+        self.desc_dflt_col = cal_list.descDfltCol
+        self.has_last = False
+
+    @boundscheck(False)
+    @wraparound(False)
+    cdef str _read(self, int row, int col):
+        """SheetView.read와 같은 결과"""
+        cdef tuple cells
+        if row < 0 or row >= self.row_count:
+            return ""
+        cells = <tuple>self.rows[row]
+        if col < 0 or col >= len(cells):
+            return ""
+        return <str>cells[col]
+
+    cdef _write_err(self, object err_type, int row, int col):
+        Info.WriteErrCell(err_type, self.cl.ShtName, row, col)
+
+    cdef _load_lengths(self):
+        lengths = self.cl.itemLength
+        self.len_key = lengths[0]
+        self.len_type = lengths[1]
+        self.len_name = lengths[2]
+        self.len_val = lengths[3]
+
+    cdef _sync_to_cal_list(self):
+        """엔진 상태를 CalList(dItem, itemLength)에 반영"""
+        cl = self.cl
+        cl.itemLength = [self.len_key, self.len_type, self.len_name, self.len_val]
+        if self.has_last:
+            items = cl.dItem
+            items["OpCode"].Str = self.last_op
+            items["Keyword"].Str = self.last_key
+            items["Type"].Str = self.last_type
+            items["Name"].Str = self.last_name
+            items["Name"].Col = self.last_name_col
+            items["Value"].Str = self.last_val
+            items["Value"].Col = self.val_dflt_col
+            items["Description"].Str = self.last_desc
+            items["Description"].Col = self.desc_dflt_col
+            self.has_last = False
+
+    @boundscheck(False)
+    @wraparound(False)
+    def run(self, int start_row, int end_row):
+        """start_row ~ end_row-1 행 처리"""
+        cdef int row, code, name_col
+        cdef str op, key, type_str, name, val, desc
+        cdef tuple entry
+        cdef object found, mode
+        cdef object last_mode = None
+        cdef object cl = self.cl
+        cdef object empty_err = EErrType.EmptyCell
+        cdef object pragma = cl.fi.dPragma
+        cdef dict opcodes = self.opcodes
+        cdef int val_col = self.val_dflt_col
+        cdef int desc_col = self.desc_dflt_col
+
+        self._load_lengths()
+
+        for row in range(start_row, end_row):
+            op = self._read(row, self.op_col)
+            found = opcodes.get(op)
+            if found is None:
+                last_mode = EMkMode.NONE
+                if op:
+                    self._write_err(EErrType.OpCode, row, self.op_col)
+                continue
+
+            entry = <tuple>found
+            code = entry[0]
+            mode = entry[1]
+            last_mode = mode
+            if not _is_simple(code):
+                # 상태를 크게 바꾸는 행은 기존 CalList 로직으로 처리
+                self._sync_to_cal_list()
+                cl._process_row(row)
+                self._load_lengths()
+                continue
+
+            name_col = self.mem_dflt_col if (code == M_STR_MEM or code == M_ENUM_MEM) else self.name_dflt_col
+            key = self._read(row, self.key_col)
+            type_str = self._read(row, self.type_col)
+            name = self._read(row, name_col)
+            val = self._read(row, val_col)
+            desc = self._read(row, desc_col)
+
+            # chkCalList
+            if code == M_VARIABLE:
+                if not key:
+                    self._write_err(empty_err, row, self.key_col)
+                if not type_str:
+                    self._write_err(empty_err, row, self.type_col)
+                if not name:
+                    self._write_err(empty_err, row, name_col)
+                if not val:
+                    self._write_err(empty_err, row, val_col)
+                elif "[" in val or "]" in val:
+                    self._write_err(EErrType.OpCode, row, self.op_col)
+            elif code == M_DEFINE:
+                if not name:
+                    self._write_err(empty_err, row, name_col)
+                if not val:
+                    self._write_err(empty_err, row, val_col)
+            elif code == M_STR_MEM:
+                if not type_str:
+                    self._write_err(empty_err, row, self.type_col)
+                if not name:
+                    self._write_err(empty_err, row, name_col)
+            elif code == M_SUBTITLE or code == M_STR_DEF or code == M_ENUM_MEM or code == M_CODE:
+                if not name:
+                    self._write_err(empty_err, row, name_col)
+
+            # saveTempList
+            if code == M_VARIABLE and pragma and (key in pragma or cl.currentPRGM in pragma):
+                cl.mkMode = mode
+                cl.setPragmaSection(key, row)
+            cl.dTempCode[cl.currentTitle].append((op, key, type_str, name, val, desc))
+
+            if code == M_DEFINE or code == M_STR_MEM or code == M_ENUM_MEM or code == M_VARIABLE:
+                if len(key) > self.len_key:
+                    self.len_key = len(key)
+                if len(type_str) > self.len_type:
+                    self.len_type = len(type_str)
+                if len(name) > self.len_name:
+                    self.len_name = len(name)
+                if len(val) > self.len_val:
+                    self.len_val = len(val)
+            elif code == M_SUBTITLE or code == M_DESCRIPT or code == M_STR_DEF or code == M_ENUM_END:
+                cl.ArrAlignList.append([self.len_key, self.len_type, self.len_name, self.len_val])
+                self.len_key = self.len_type = self.len_name = self.len_val = 0
+
+            self.has_last = True
+            self.last_op = op
+            self.last_key = key
+            self.last_type = type_str
+            self.last_name = name
+            self.last_val = val
+            self.last_desc = desc
+            self.last_name_col = name_col
+
+        self._sync_to_cal_list()
+        if last_mode is not None:
+            cl.mkMode = last_mode
+            cl.mkModeOld = last_mode
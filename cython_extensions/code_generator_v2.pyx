@@ -7,6 +7,12 @@
 import cython
 from cython import boundscheck, wraparound
 
+# Float Suffix 단일 패스 커널 (빌드되지 않았으면 같은 규칙의 Python 구현)
+try:
+    from cython_extensions.float_suffix import apply_float_suffix as _apply_float_suffix
+except ImportError:
+    from code_generator.float_suffix import apply_float_suffix_python as _apply_float_suffix
+
 @boundscheck(False)
 @wraparound(False)
 def fast_read_cal_list_processing(list sht_data, int start_row, int end_row, list item_list):
@@ -42,7 +48,7 @@ def fast_write_cal_list_processing(list temp_code_items):
     writeCalList의 코드 생성 최적화
     """
     cdef int i, length
-    cdef list line_str
+    cdef object line_str  # 임시 코드 레코드 (6-튜플)
     cdef str op_code, key_str, type_str, name_str, val_str, desc_str
     cdef list processed_items = []
     
@@ -413,23 +419,23 @@ cdef int calculate_pad_cython(int align, int str_len, bint type_flag, int add_ta
 @wraparound(False)
 cdef str ljust_cython(str text, int width):
     """
-    Python의 ljust() 함수를 Cython으로 구현
+    Python의 ljust() 함수를 Cython으로 구현 (문자 단위 반복 대신 한 번에 채움)
     """
-    cdef str result = text
-    while len(result) < width:
-        result += " "
-    return result
+    cdef Py_ssize_t pad = width - len(text)
+    if pad <= 0:
+        return text
+    return text + " " * pad
 
 @boundscheck(False)
 @wraparound(False)
 cdef str ljust_with_tabs(str text, int target_width):
     """
-    Python의 ljust(width, '\t') 함수를 Cython으로 구현
+    Python의 ljust(width, '\t') 함수를 Cython으로 구현 (문자 단위 반복 대신 한 번에 채움)
     """
-    cdef str result = text
-    while len(result) < target_width:
-        result += "\t"
-    return result
+    cdef Py_ssize_t pad = target_width - len(text)
+    if pad <= 0:
+        return text
+    return text + "\t" * pad
 
 @boundscheck(False)
 @wraparound(False)
@@ -526,46 +532,11 @@ def fast_array_processing(list temp_arr, int row, int max_col, bint enable_float
 # Float Suffix 최적화 함수들 (04_Python_Migration에서 이식)
 # ========================================
 
-@boundscheck(False)
-@wraparound(False)
 def fast_add_float_suffix(str block_str):
     """
-    FLOAT32 블록에 Float Suffix 적용 (간단한 버전)
+    FLOAT32 블록에 Float Suffix 적용 - float_suffix 단일 패스 커널로 위임 (기존 호출부 호환용)
     """
-    if not block_str:
-        return block_str
-
-    # Python 정규식을 사용한 안전한 처리
-    import re
-
-    # 주석 보호
-    if '/*' in block_str or '//' in block_str:
-        return block_str
-
-    # 단어별로 분리해서 처리 (정규식 중복 적용 방지)
-    words = re.split(r'(\s+|[^\w\.])', block_str)
-    result_words = []
-
-    for word in words:
-        if not word or not re.match(r'^\d+\.?\d*$', word):
-            result_words.append(word)
-            continue
-
-        # 이미 f가 있으면 건드리지 않음
-        if word.endswith('f') or word.endswith('F'):
-            result_words.append(word)
-            continue
-
-        # 소수점이 있는 숫자: 1.5 -> 1.5f, 3. -> 3.f
-        if '.' in word:
-            result_words.append(word + 'f')
-        # 정수: 1 -> 1.f
-        else:
-            result_words.append(word + '.f')
-
-    block_str = ''.join(result_words)
-
-    return block_str
+    return _apply_float_suffix(block_str)
 
 
 
@@ -6,6 +6,14 @@
 
 import cython
 from cython import boundscheck, wraparound
+from cpython.array cimport array, clone
+from cpython.float cimport PyFloat_CheckExact, PyFloat_AS_DOUBLE
+from libc.stdint cimport uint64_t
+from libc.string cimport memcpy, memset
+from libc.math cimport isnan
+
+# 이보다 짧은 목록은 기수 정렬 대신 timsort (카운트 배열 초기화 비용이 더 큼)
+cdef Py_ssize_t RADIX_SORT_MIN = 256
 
 @boundscheck(False)
 @wraparound(False)
@@ -69,28 +77,6 @@ def fast_sheet_data_loading(list raw_data, int max_row, int max_col):
     return sheet_data
 
 
-@boundscheck(False)
-@wraparound(False)
-def fast_cell_cache_management(dict cache, int max_size):
-    """
-    셀 캐시 관리 최적화
-    cal_list.py의 cached_read_cell 최적화
-    """
-    cdef int current_size, remove_count, i
-    cdef list keys_to_remove
-    
-    current_size = len(cache)
-    
-    if current_size >= max_size:
-        remove_count = max_size // 3  # 1/3 제거
-        keys_to_remove = list(cache.keys())[:remove_count]
-        
-        for i in range(remove_count):
-            del cache[keys_to_remove[i]]
-    
-    return len(cache)
-
-
 @boundscheck(False)
 @wraparound(False)
 def fast_data_type_conversion(list data_list, str target_type):
@@ -154,46 +140,6 @@ def fast_data_type_conversion(list data_list, str target_type):
     return converted_data
 
 
-@boundscheck(False)
-@wraparound(False)
-def fast_matrix_operations(list matrix_a, list matrix_b, str operation):
-    """
-    행렬 연산 최적화
-    """
-    cdef int i, j, rows_a, cols_a, rows_b, cols_b
-    cdef list result = []
-    cdef list row_result
-    cdef double val_a, val_b
-    
-    if not matrix_a or not matrix_b:
-        return result
-    
-    rows_a = len(matrix_a)
-    cols_a = len(matrix_a[0]) if rows_a > 0 else 0
-    rows_b = len(matrix_b)
-    cols_b = len(matrix_b[0]) if rows_b > 0 else 0
-    
-    if operation == "add" and rows_a == rows_b and cols_a == cols_b:
-        for i in range(rows_a):
-            row_result = []
-            for j in range(cols_a):
-                val_a = float(matrix_a[i][j]) if matrix_a[i][j] is not None else 0.0
-                val_b = float(matrix_b[i][j]) if matrix_b[i][j] is not None else 0.0
-                row_result.append(val_a + val_b)
-            result.append(row_result)
-    
-    elif operation == "subtract" and rows_a == rows_b and cols_a == cols_b:
-        for i in range(rows_a):
-            row_result = []
-            for j in range(cols_a):
-                val_a = float(matrix_a[i][j]) if matrix_a[i][j] is not None else 0.0
-                val_b = float(matrix_b[i][j]) if matrix_b[i][j] is not None else 0.0
-                row_result.append(val_a - val_b)
-            result.append(row_result)
-    
-    return result
-
-
 @boundscheck(False)
 @wraparound(False)
 def fast_data_filtering(list data_list, str filter_type, object filter_value):
@@ -261,52 +207,6 @@ def fast_data_filtering(list data_list, str filter_type, object filter_value):
     return filtered_data
 
 
-@boundscheck(False)
-@wraparound(False)
-def fast_data_sorting(list data_list, str sort_key, bint reverse):
-    """
-    데이터 정렬 최적화
-    """
-    cdef int i, j, length
-    cdef list sorted_data = data_list.copy()
-    cdef object temp, item_i, item_j
-    cdef str str_i, str_j
-    cdef double num_i, num_j
-    cdef bint should_swap
-    
-    if not data_list:
-        return sorted_data
-    
-    length = len(sorted_data)
-    
-    # 버블 정렬 (단순하지만 Cython에서 빠름)
-    for i in range(length - 1):
-        for j in range(length - 1 - i):
-            item_i = sorted_data[j]
-            item_j = sorted_data[j + 1]
-            should_swap = False
-            
-            if sort_key == "string":
-                str_i = str(item_i) if item_i is not None else ""
-                str_j = str(item_j) if item_j is not None else ""
-                should_swap = (str_i > str_j) if not reverse else (str_i < str_j)
-            
-            elif sort_key == "numeric":
-                try:
-                    num_i = float(item_i) if item_i is not None else 0.0
-                    num_j = float(item_j) if item_j is not None else 0.0
-                    should_swap = (num_i > num_j) if not reverse else (num_i < num_j)
-                except:
-                    should_swap = False
-            
-            if should_swap:
-                temp = sorted_data[j]
-                sorted_data[j] = sorted_data[j + 1]
-                sorted_data[j + 1] = temp
-    
-    return sorted_data
-
-
 @boundscheck(False)
 @wraparound(False)
 def fast_data_grouping(list data_list, str group_key):
@@ -558,39 +458,411 @@ def fast_list_comprehension_replacement(list input_list, str operation, object f
     return result
 
 
+# ----------------------------------------------------------------------
+# 정렬 / 조인 / 맵 연산 / LRU 커널
+# (Python 폴백과 결과가 같아야 함 - core/data_kernels.py, benchmark_cli.py --kernel-parity로 확인)
+# ----------------------------------------------------------------------
+
+cdef inline double _numeric_key(object item):
+    """숫자 정렬 키 (None/변환 불가/NaN → 0.0, -0.0 → 0.0) - data_kernels.numeric_sort_key와 같은 규칙"""
+    cdef double d
+    if item is None:
+        return 0.0
+    if PyFloat_CheckExact(item):
+        d = PyFloat_AS_DOUBLE(item)
+    else:
+        try:
+            d = float(item)
+        except (TypeError, ValueError, OverflowError):
+            return 0.0
+    if isnan(d):
+        return 0.0
+    return d + 0.0
+
+
+cdef inline uint64_t _sortable_bits(double d):
+    """double을 부호 없는 정수 순서가 같은 비트열로 변환 (음수는 전체 반전, 양수는 부호 비트 설정)"""
+    cdef uint64_t bits
+    memcpy(&bits, &d, sizeof(double))
+    if bits >> 63:
+        return ~bits
+    return bits | (<uint64_t>1 << 63)
+
+
+@boundscheck(False)
+@wraparound(False)
+def fast_keyed_sort(list data_list, str sort_key, bint reverse):
+    """
+    키 기준 안정 정렬 (fast_data_sorting의 버블 정렬 대체)
+
+    키는 원소마다 한 번만 계산합니다.
+    - "numeric": double 키를 16비트 4단계 LSD 기수 정렬 (O(n), 안정 - reverse여도 같은 키는 원래 순서)
+    - "string": str 키로 timsort
+    - 그 외: 원래 순서 그대로 복사
+    """
+    cdef Py_ssize_t n = len(data_list)
+    cdef Py_ssize_t i, p
+    cdef uint64_t* keys
+    cdef int* order
+    cdef int* buffer
+    cdef int* swap
+    cdef int* counts
+    cdef int total, count, c
+    cdef unsigned int digit
+    cdef array key_array, order_array, buffer_array, count_array
+    cdef list string_keys, result
+
+    if sort_key == "string":
+        string_keys = [("" if item is None else str(item)) for item in data_list]
+        return [data_list[i] for i in sorted(range(n), key=string_keys.__getitem__, reverse=reverse)]
+    if sort_key != "numeric" or n < 2:
+        return list(data_list)
+    if n < RADIX_SORT_MIN:
+        float_keys = [_numeric_key(data_list[i]) for i in range(n)]
+        return [data_list[i] for i in sorted(range(n), key=float_keys.__getitem__, reverse=reverse)]
+
+    key_array = clone(array('Q'), n, False)
+    order_array = clone(array('i'), n, False)
+    buffer_array = clone(array('i'), n, False)
+    keys = <uint64_t*>key_array.data.as_voidptr
+    order = order_array.data.as_ints
+    buffer = buffer_array.data.as_ints
+    # 카운트 배열은 힙에 (작업 스레드 스택 크기가 작을 수 있음)
+    count_array = clone(array('i'), 65536, False)
+    counts = count_array.data.as_ints
+
+    for i in range(n):
+        keys[i] = _sortable_bits(_numeric_key(data_list[i]))
+        if reverse:
+            keys[i] = ~keys[i]
+        order[i] = <int>i
+
+    for p in range(4):
+        memset(counts, 0, 65536 * sizeof(int))
+        for i in range(n):
+            counts[(keys[order[i]] >> (16 * p)) & 0xFFFF] += 1
+        if counts[(keys[order[0]] >> (16 * p)) & 0xFFFF] == n:
+            continue  # 이 자릿수가 모두 같으면 단계 생략
+        total = 0
+        for c in range(65536):
+            count = counts[c]
+            counts[c] = total
+            total += count
+        for i in range(n):
+            digit = (keys[order[i]] >> (16 * p)) & 0xFFFF
+            buffer[counts[digit]] = order[i]
+            counts[digit] += 1
+        swap = order
+        order = buffer
+        buffer = swap
+
+    result = [None] * n
+    for i in range(n):
+        result[i] = data_list[order[i]]
+    return result
+
+
 @boundscheck(False)
 @wraparound(False)
-def fast_nested_loop_optimization(list outer_list, list inner_list, str operation):
+def fast_hash_join(list left, list right, Py_ssize_t left_key, Py_ssize_t right_key):
     """
-    중첩 루프 최적화
-    이중/삼중 반복문 성능 최적화
+    left/right 행(시퀀스) 목록을 키 열로 등가 조인 (O(n + m), 중첩 루프 대체)
+
+    Returns:
+        [(left_row, right_row), ...] - left 순서, 같은 키의 right는 원래 순서
     """
-    cdef int i, j, outer_len, inner_len
+    cdef dict buckets = {}
     cdef list result = []
-    cdef object outer_item, inner_item
-    cdef tuple pair
+    cdef list matches
+    cdef object row, other, key
+
+    for row in right:
+        key = row[right_key]
+        matches = buckets.get(key)
+        if matches is None:
+            buckets[key] = [row]
+        else:
+            matches.append(row)
 
-    if not outer_list or not inner_list:
-        return result
+    for row in left:
+        matches = buckets.get(row[left_key])
+        if matches is not None:
+            for other in matches:
+                result.append((row, other))
+    return result
+
+
+@boundscheck(False)
+@wraparound(False)
+def fast_hash_match(list outer_list, list inner_list):
+    """
+    outer 원소 중 inner에 있는 것 (outer 순서/중복 유지) - 중첩 루프 find_matches 대체
+
+    해시할 수 없는 원소가 있으면 선형 탐색으로 처리합니다.
+    """
+    cdef set lookup
+    cdef object item
+    try:
+        lookup = set(inner_list)
+        return [item for item in outer_list if item in lookup]
+    except TypeError:
+        return [item for item in outer_list if item in inner_list]
+
+
+cdef const double[:] _as_doubles(object values):
+    """double 버퍼로 보기 (array('d')/numpy float64는 복사 없음, 그 외 시퀀스는 array('d')로 변환)"""
+    cdef const double[:] view
+    try:
+        view = values
+    except (TypeError, ValueError, BufferError):
+        view = array('d', values)
+    return view
+
+
+@boundscheck(False)
+@wraparound(False)
+def fast_map_elementwise(object map_a, object map_b, str operation):
+    """
+    같은 크기의 두 맵(행 우선 1차원 double 버퍼)의 원소별 연산 (add/subtract/multiply/divide)
+
+    Returns:
+        array('d')
+    """
+    cdef const double[:] a = _as_doubles(map_a)
+    cdef const double[:] b = _as_doubles(map_b)
+    cdef Py_ssize_t n = a.shape[0]
+    cdef Py_ssize_t i
+    cdef array result
+    cdef double* out
+    cdef int op
+
+    if b.shape[0] != n:
+        raise ValueError(f"맵 크기가 다릅니다: {n} != {b.shape[0]}")
+    if operation == "add":
+        op = 0
+    elif operation == "subtract":
+        op = 1
+    elif operation == "multiply":
+        op = 2
+    elif operation == "divide":
+        op = 3
+    else:
+        raise ValueError(f"지원하지 않는 연산: {operation}")
+
+    result = clone(array('d'), n, False)
+    out = result.data.as_doubles
+    if op == 0:
+        for i in range(n):
+            out[i] = a[i] + b[i]
+    elif op == 1:
+        for i in range(n):
+            out[i] = a[i] - b[i]
+    elif op == 2:
+        for i in range(n):
+            out[i] = a[i] * b[i]
+    else:
+        for i in range(n):
+            if b[i] == 0.0:
+                raise ZeroDivisionError("float division by zero")
+            out[i] = a[i] / b[i]
+    return result
 
-    outer_len = len(outer_list)
-    inner_len = len(inner_list)
-
-    if operation == "cartesian_product":
-        for i in range(outer_len):
-            outer_item = outer_list[i]
-            for j in range(inner_len):
-                inner_item = inner_list[j]
-                pair = (outer_item, inner_item)
-                result.append(pair)
-
-    elif operation == "find_matches":
-        for i in range(outer_len):
-            outer_item = outer_list[i]
-            for j in range(inner_len):
-                inner_item = inner_list[j]
-                if outer_item == inner_item:
-                    result.append(outer_item)
-                    break  # 첫 번째 매치만
 
+@boundscheck(False)
+@wraparound(False)
+def fast_map_affine(object values, double scale, double offset):
+    """맵 전체에 value * scale + offset 적용 (raw ↔ 물리값 변환) → array('d')"""
+    cdef const double[:] v = _as_doubles(values)
+    cdef Py_ssize_t n = v.shape[0]
+    cdef Py_ssize_t i
+    cdef array result = clone(array('d'), n, False)
+    cdef double* out = result.data.as_doubles
+    cdef double product
+    for i in range(n):
+        product = v[i] * scale  # 곱셈/덧셈을 나눠 FMA 축약 방지 (Python 폴백과 같은 반올림)
+        out[i] = product + offset
     return result
+
+
+cdef inline Py_ssize_t _axis_cell(const double[:] axis, double x, double* frac):
+    """오름차순 축에서 x가 속한 구간 시작 인덱스와 구간 내 비율 (범위 밖은 양 끝으로 고정, NaN이면 비율도 NaN)"""
+    cdef Py_ssize_t n = axis.shape[0]
+    cdef Py_ssize_t lo = 0, hi, mid
+    if isnan(x):
+        frac[0] = x
+        return 0
+    if n < 2 or x <= axis[0]:
+        frac[0] = 0.0
+        return 0
+    if x >= axis[n - 1]:
+        frac[0] = 1.0
+        return n - 2
+    hi = n - 1
+    while hi - lo > 1:
+        mid = (lo + hi) >> 1
+        if axis[mid] <= x:
+            lo = mid
+        else:
+            hi = mid
+    frac[0] = (x - axis[lo]) / (axis[lo + 1] - axis[lo])
+    return lo
+
+
+@boundscheck(False)
+@wraparound(False)
+def fast_map_interp2d(object x_axis, object y_axis, object values, double x, double y):
+    """
+    2차원 맵 쌍선형 보간 (values는 len(y_axis) x len(x_axis) 행 우선, 축 범위 밖은 끝값으로 고정, x/y가 NaN이면 NaN)
+    """
+    cdef const double[:] xs = _as_doubles(x_axis)
+    cdef const double[:] ys = _as_doubles(y_axis)
+    cdef const double[:] v = _as_doubles(values)
+    cdef Py_ssize_t cols = xs.shape[0], rows = ys.shape[0]
+    cdef Py_ssize_t xi, yi, x1, y1
+    cdef double fx, fy, top, bottom, t
+
+    if cols == 0 or rows == 0 or v.shape[0] != rows * cols:
+        raise ValueError(f"맵 크기가 축과 맞지 않습니다: {v.shape[0]} != {rows} x {cols}")
+    xi = _axis_cell(xs, x, &fx)
+    yi = _axis_cell(ys, y, &fy)
+    x1 = xi + 1 if cols > 1 else xi
+    y1 = yi + 1 if rows > 1 else yi
+
+    t = (v[yi * cols + x1] - v[yi * cols + xi]) * fx
+    top = v[yi * cols + xi] + t
+    t = (v[y1 * cols + x1] - v[y1 * cols + xi]) * fx
+    bottom = v[y1 * cols + xi] + t
+    t = (bottom - top) * fy
+    return top + t
+
+
+cdef class LRUCache:
+    """
+    최대 크기가 정해진 LRU 캐시 (fast_cell_cache_management의 임의 제거 대체)
+
+    항목 위치(slot)를 dict로 찾고, 사용 순서는 C int 배열의 이중 연결 리스트로 관리합니다.
+    get/put은 O(1)이며, 넘치면 가장 오래 사용하지 않은 항목부터 제거합니다.
+    (data_kernels.LRUCachePython과 같은 동작)
+    """
+    cdef dict _slots
+    cdef list _keys
+    cdef list _values
+    cdef array _links
+    cdef int* _prev
+    cdef int* _next
+    cdef int _head
+    cdef int _tail
+    cdef int _free
+    cdef readonly int max_size
+    cdef public long hits
+    cdef public long misses
+
+    def __init__(self, int max_size):
+        if max_size < 1:
+            raise ValueError("max_size는 1 이상이어야 합니다")
+        self.max_size = max_size
+        self._links = clone(array('i'), 2 * max_size, False)
+        self._prev = self._links.data.as_ints
+        self._next = self._prev + max_size
+        self.hits = 0
+        self.misses = 0
+        self.clear()
+
+    def clear(self):
+        cdef int i
+        self._slots = {}
+        self._keys = [None] * self.max_size
+        self._values = [None] * self.max_size
+        for i in range(self.max_size):
+            self._next[i] = i + 1
+        self._next[self.max_size - 1] = -1
+        self._free = 0
+        self._head = -1
+        self._tail = -1
+
+    cdef inline void _unlink(self, int slot):
+        cdef int p = self._prev[slot], n = self._next[slot]
+        if p >= 0:
+            self._next[p] = n
+        else:
+            self._head = n
+        if n >= 0:
+            self._prev[n] = p
+        else:
+            self._tail = p
+
+    cdef inline void _append(self, int slot):
+        self._prev[slot] = self._tail
+        self._next[slot] = -1
+        if self._tail >= 0:
+            self._next[self._tail] = slot
+        else:
+            self._head = slot
+        self._tail = slot
+
+    def __len__(self):
+        return len(self._slots)
+
+    def __contains__(self, key):
+        """존재 여부만 확인 (사용 순서는 바꾸지 않음)"""
+        return key in self._slots
+
+    def get(self, key, default=None):
+        cdef object found = self._slots.get(key)
+        cdef int slot
+        if found is None:
+            self.misses += 1
+            return default
+        slot = <int>found
+        if slot != self._tail:
+            self._unlink(slot)
+            self._append(slot)
+        self.hits += 1
+        return self._values[slot]
+
+    def put(self, key, value):
+        cdef object found = self._slots.get(key)
+        cdef int slot
+        if found is not None:
+            slot = <int>found
+            self._values[slot] = value
+            if slot != self._tail:
+                self._unlink(slot)
+                self._append(slot)
+            return
+        if self._free < 0:
+            # 가득 참 - 가장 오래 사용하지 않은 항목 자리 재사용
+            slot = self._head
+            self._unlink(slot)
+            del self._slots[self._keys[slot]]
+        else:
+            slot = self._free
+            self._free = self._next[slot]
+        self._keys[slot] = key
+        self._values[slot] = value
+        self._slots[key] = slot
+        self._append(slot)
+
+    def pop(self, key, default=None):
+        cdef object found = self._slots.pop(key, None)
+        cdef int slot
+        cdef object value
+        if found is None:
+            return default
+        slot = <int>found
+        self._unlink(slot)
+        value = self._values[slot]
+        self._keys[slot] = None
+        self._values[slot] = None
+        self._next[slot] = self._free
+        self._free = slot
+        return value
+
+    def keys(self):
+        """오래된 순서의 키 목록"""
+        cdef list result = []
+        cdef int slot = self._head
+        while slot >= 0:
+            result.append(self._keys[slot])
+            slot = self._next[slot]
+        return result
@@ -6,6 +6,13 @@
 
 import cython
 from cython import boundscheck, wraparound
+from cpython.float cimport PyFloat_CheckExact, PyFloat_AS_DOUBLE
+from cpython.long cimport PyLong_CheckExact
+from cpython.unicode cimport PyUnicode_CheckExact
+from libc.math cimport floor, fabs, isfinite
+
+# 이 범위 안의 정수값 float는 long long으로 바로 문자열화 (밖이면 Python int 변환)
+cdef double _EXACT_INT_LIMIT = 9007199254740992.0  # 2**53
 
 @boundscheck(False)
 @wraparound(False)
@@ -51,6 +58,81 @@ def fast_process_excel_data(values):
     return cells_data
 
 
+cdef inline str _format_cell(object val):
+    """셀 값 하나를 DB 저장 문자열로 (process_cell_value_fast와 같은 규칙, 타입 확인은 C 수준)"""
+    cdef double d
+    if PyUnicode_CheckExact(val):
+        return <str>val
+    if PyFloat_CheckExact(val):
+        d = PyFloat_AS_DOUBLE(val)
+        if isfinite(d) and d == floor(d):
+            if fabs(d) < _EXACT_INT_LIMIT:
+                return str(<long long>d)
+            return str(int(val))
+        return str(val)
+    if PyLong_CheckExact(val):
+        return str(val)
+    # bool("True"/"False"), datetime 등
+    return str(val)
+
+
+@boundscheck(False)
+@wraparound(False)
+def bulk_cell_params(values):
+    """
+    used_range.value 블록 전체를 한 번에 (row, col, value) 목록으로 변환
+
+    fast_process_excel_data + fast_batch_cell_processing을 한 반복으로 합친 버전:
+    숫자 서식(정수값 float → 정수 문자열)과 빈 값 제외를 같은 루프에서 처리하며,
+    결과는 DBHandlerV2.batch_insert_cells(..., prepared=True)의 executemany 파라미터로 그대로 사용됩니다.
+    """
+    cdef Py_ssize_t i, j, rows, cols
+    cdef list params = []
+    cdef list row_list
+    cdef object val, row
+    cdef str value_str
+
+    if values is None:
+        return params
+
+    if not isinstance(values, (list, tuple)):
+        # 단일 셀
+        value_str = _format_cell(values)
+        if value_str.strip():
+            params.append((0, 0, value_str))
+        return params
+
+    rows = len(values)
+    for i in range(rows):
+        row = values[i]
+        if type(row) is list:
+            row_list = <list>row
+            cols = len(row_list)
+            for j in range(cols):
+                val = row_list[j]
+                if val is None:
+                    continue
+                value_str = _format_cell(val)
+                if value_str and value_str.strip():
+                    params.append((i, j, value_str))
+        elif isinstance(row, tuple):
+            cols = len(row)
+            for j in range(cols):
+                val = row[j]
+                if val is None:
+                    continue
+                value_str = _format_cell(val)
+                if value_str and value_str.strip():
+                    params.append((i, j, value_str))
+        elif row is not None:
+            # 1차원 데이터 (한 행 또는 한 열 범위)
+            value_str = _format_cell(row)
+            if value_str and value_str.strip():
+                params.append((0, i, value_str))
+
+    return params
+
+
 @boundscheck(False)
 @wraparound(False)
 def process_cell_value_fast(cell_value):
@@ -0,0 +1,173 @@
+# float_suffix.pyx
+# cython: language_level=3
+# cython: boundscheck=False
+# cython: wraparound=False
+# cython: cdivision=True
+
+"""
+FLOAT32 Float Suffix 단일 패스 재작성 커널
+code_generator/float_suffix.py의 rewrite_float_literals_python / apply_float_suffix_python과 동일한 결과
+
+입력을 UTF-8 바이트로 한 번 훑으면서 문자열 리터럴은 그대로 복사하고,
+[\w.] 토큰이 \d+\.?\d* 형태이면 'f' 또는 '.f'를 출력 버퍼에 바로 덧붙입니다.
+"""
+
+import cython
+from cython import boundscheck, wraparound
+from libc.stdlib cimport malloc, free
+from libc.string cimport memcpy
+from cpython.bytes cimport PyBytes_FromStringAndSize
+
+# 문자 분류
+DEF CLS_SEP = 0     # 구분자 (공백, 구두점 등 [^\w.])
+DEF CLS_WORD = 1    # 숫자가 아닌 단어 문자 (\w)
+DEF CLS_DIGIT = 2   # 숫자 (\d)
+DEF CLS_DOT = 3     # '.'
+
+
+cdef inline int _ascii_class(unsigned char c):
+    if c >= 48 and c <= 57:
+        return CLS_DIGIT
+    if (c >= 65 and c <= 90) or (c >= 97 and c <= 122) or c == 95:
+        return CLS_WORD
+    if c == 46:
+        return CLS_DOT
+    return CLS_SEP
+
+
+cdef int _char_class(const unsigned char* s, Py_ssize_t i, Py_ssize_t n, Py_ssize_t* length):
+    """i 위치 문자의 분류와 바이트 길이 (비ASCII는 Python 유니코드 규칙 사용 - re의 \w/\d와 동일)"""
+    cdef unsigned char c = s[i]
+    cdef unsigned int cp
+    cdef Py_ssize_t size, k
+
+    if c < 0x80:
+        length[0] = 1
+        return _ascii_class(c)
+
+    if c >= 0xF0:
+        size = 4
+        cp = c & 0x07
+    elif c >= 0xE0:
+        size = 3
+        cp = c & 0x0F
+    else:
+        size = 2
+        cp = c & 0x1F
+    if i + size > n:
+        size = n - i
+    for k in range(1, size):
+        cp = (cp << 6) | (s[i + k] & 0x3F)
+    length[0] = size
+
+    ch = chr(cp)
+    if ch.isdecimal():
+        return CLS_DIGIT
+    if ch.isalnum():
+        return CLS_WORD
+    return CLS_SEP
+
+
+cdef Py_ssize_t _string_end(const unsigned char* s, Py_ssize_t i, Py_ssize_t n):
+    """
+    i 위치 '"'로 시작하는 문자열 리터럴의 끝(닫는 따옴표 다음) 위치, 닫히지 않으면 -1
+    정규식 "(?:\\.|[^"\\])*" 과 동일 (역슬래시 다음 줄바꿈은 매칭 실패)
+    """
+    cdef Py_ssize_t j = i + 1
+    cdef unsigned char c
+    while j < n:
+        c = s[j]
+        if c == 34:  # '"'
+            return j + 1
+        if c == 92:  # '\\'
+            if j + 1 >= n or s[j + 1] == 10:
+                return -1
+            j += 2
+            continue
+        j += 1
+    return -1
+
+
+@boundscheck(False)
+@wraparound(False)
+def rewrite_float_literals(str text):
+    """숫자 리터럴에 f 접미사 추가 (주석 판단 없이 재작성만)"""
+    cdef bytes data = text.encode('utf-8')
+    cdef const unsigned char* s = data
+    cdef Py_ssize_t n = len(data)
+    cdef Py_ssize_t i = 0, o = 0, j, length, start
+    cdef int cls, state
+    cdef bint has_digit = False
+    cdef char* out
+
+    # 숫자가 하나도 없으면 그대로 반환 (비ASCII 문자가 있으면 유니코드 숫자일 수 있으므로 계속 진행)
+    for j in range(n):
+        if (s[j] >= 48 and s[j] <= 57) or s[j] >= 0x80:
+            has_digit = True
+            break
+    if not has_digit:
+        return text
+
+    # 숫자 토큰마다 최대 2바이트 추가 (토큰 사이에는 구분자가 최소 1개)
+    out = <char*>malloc(2 * n + 2)
+    if out == NULL:
+        raise MemoryError()
+
+    try:
+        while i < n:
+            if s[i] == 34:
+                j = _string_end(s, i, n)
+                if j > 0:
+                    memcpy(out + o, s + i, j - i)
+                    o += j - i
+                    i = j
+                    continue
+
+            cls = _char_class(s, i, n, &length)
+            if cls == CLS_SEP:
+                memcpy(out + o, s + i, length)
+                o += length
+                i += length
+                continue
+
+            # [\w.] 토큰: state 0=시작, 1=정수부, 2=소수점 이후, 3=숫자 리터럴 아님
+            start = i
+            state = 0
+            while i < n:
+                if s[i] == 34:
+                    break
+                cls = _char_class(s, i, n, &length)
+                if cls == CLS_SEP:
+                    break
+                if cls == CLS_DIGIT:
+                    if state == 0:
+                        state = 1
+                elif cls == CLS_DOT:
+                    if state == 1:
+                        state = 2
+                    else:
+                        state = 3
+                else:
+                    state = 3
+                i += length
+
+            memcpy(out + o, s + start, i - start)
+            o += i - start
+            if state == 1:
+                out[o] = 46   # '.'
+                out[o + 1] = 102  # 'f'
+                o += 2
+            elif state == 2:
+                out[o] = 102
+                o += 1
+
+        return PyBytes_FromStringAndSize(out, o).decode('utf-8')
+    finally:
+        free(out)
+
+
+def apply_float_suffix(str text):
+    """CalList Float Suffix 규칙 적용 (빈 값/f 접미사/주석 포함 값은 그대로)"""
+    if not text or text[-1] in 'fF' or '/*' in text or '//' in text:
+        return text
+    return rewrite_float_literals(text)
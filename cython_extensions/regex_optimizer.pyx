@@ -7,124 +7,7 @@
 import cython
 from cython import boundscheck, wraparound
 
-@boundscheck(False)
-@wraparound(False)
-def fast_float_suffix_regex_replacement(str val_str):
-    """
-    Float Suffix 정규식 처리 최적화 (안전한 버전)
-    cal_list.py의 add_float_suffix에서 사용되는 복잡한 정규식 대체
-    """
-    # 입력 검증
-    if not val_str or not isinstance(val_str, str):
-        return str(val_str) if val_str is not None else ""
-
-    # 간단한 케이스 먼저 처리 (성능 최적화)
-    if not val_str.strip():
-        return val_str
-
-    # 이미 접미사가 있는 경우
-    if val_str.endswith(('f', 'F')):
-        return val_str
-
-    # 주석이 포함된 경우 복잡한 처리 필요
-    if '/*' in val_str or '//' in val_str:
-        return process_complex_float_suffix_safe(val_str)
-
-    # 단순한 숫자에만 접미사 적용
-    return apply_simple_float_suffix_safe(val_str)
-
-
-@boundscheck(False)
-@wraparound(False)
-def apply_simple_float_suffix_safe(str val_str):
-    """
-    단순한 숫자에 Float Suffix 적용 (안전한 버전)
-    """
-    cdef int i, length
-    cdef bint has_dot = False
-    cdef bint is_number = True
-    cdef str c
-
-    if not val_str:
-        return val_str
-
-    length = len(val_str)
-    if length == 0:
-        return val_str
-
-    # 숫자인지 확인 (안전한 문자열 처리)
-    for i in range(length):
-        c = val_str[i]  # 문자열 인덱싱으로 안전하게 처리
-        
-        if c == '.':
-            if has_dot:
-                is_number = False
-                break
-            has_dot = True
-        elif c == '-' and i == 0:
-            continue
-        elif not (c >= '0' and c <= '9'):
-            is_number = False
-            break
-
-    if not is_number:
-        return val_str
-
-    # Float suffix 추가
-    if has_dot:
-        return val_str + 'f'
-    else:
-        if val_str == '0':
-            return '0.f'
-        else:
-            return val_str + '.f'
-
-
-@boundscheck(False)
-@wraparound(False)
-def process_complex_float_suffix_safe(str val_str):
-    """
-    복잡한 문자열의 Float Suffix 처리 (주석 포함) - 안전한 버전
-    """
-    # 복잡한 경우는 Python 정규식 사용 (안전성 우선)
-    import re
-
-    try:
-        # 주석 보존을 위한 임시 치환
-        comments = {}
-        comment_count = 0
-        modified_val = val_str
-
-        # 블록 주석 처리
-        block_comment_pattern = re.compile(r'/\*.*?\*/', re.DOTALL)
-        block_comments = list(block_comment_pattern.finditer(modified_val))
-        for comment in block_comments:
-            placeholder = f"__COMMENT_BLOCK_{comment_count}__"
-            comments[placeholder] = comment.group(0)
-            modified_val = modified_val.replace(comment.group(0), placeholder)
-            comment_count += 1
-
-        # 라인 주석 처리
-        line_comment_pattern = re.compile(r'//.*?(?=\n|$)')
-        line_comments = list(line_comment_pattern.finditer(modified_val))
-        for comment in line_comments:
-            placeholder = f"__COMMENT_LINE_{comment_count}__"
-            comments[placeholder] = comment.group(0)
-            modified_val = modified_val.replace(comment.group(0), placeholder)
-            comment_count += 1
-
-        # 주석이 제거된 부분에만 Float Suffix 적용
-        modified_val = apply_simple_float_suffix_safe(modified_val)
-
-        # 주석 복원
-        for placeholder, comment in comments.items():
-            modified_val = modified_val.replace(placeholder, comment)
-
-        return modified_val
-    except Exception:
-        # 오류 발생 시 원본 반환
-        return val_str
-
+# Float Suffix 처리는 float_suffix.pyx 단일 패스 커널로 통합됨
 
 @boundscheck(False)
 @wraparound(False)
@@ -0,0 +1,109 @@
+# sparse_sheet.pyx
+# cython: language_level=3
+# cython: boundscheck=False
+# cython: wraparound=False
+# cython: cdivision=True
+
+import cython
+from cython import boundscheck, wraparound
+from cpython.array cimport array, clone
+
+
+cdef class CSRIndex:
+    """
+    CSR 시트 셀 위치 조회 (core/sparse_sheet.py의 SparseSheet 내부용)
+    row_ptr/col_idx/val_idx는 array('i')를 typed memoryview로 참조 (복사 없음)
+    """
+    cdef int[:] row_ptr
+    cdef int[:] col_idx
+    cdef int[:] val_idx
+    cdef int row_count
+
+    def __init__(self, row_ptr, col_idx, val_idx, int row_count):
+        self.row_ptr = row_ptr
+        self.col_idx = col_idx
+        self.val_idx = val_idx
+        self.row_count = row_count
+
+    @boundscheck(False)
+    @wraparound(False)
+    cpdef int find(self, int row, int col):
+        """(row, col) 셀의 문자열 테이블 인덱스 반환 (없으면 0 = 빈 문자열)"""
+        cdef int lo, hi, mid, c
+
+        if row < 0 or row >= self.row_count:
+            return 0
+
+        lo = self.row_ptr[row]
+        hi = self.row_ptr[row + 1]
+
+        # 행 내 열 번호 이진 탐색
+        while lo < hi:
+            mid = (lo + hi) >> 1
+            c = self.col_idx[mid]
+            if c < col:
+                lo = mid + 1
+            elif c > col:
+                hi = mid
+            else:
+                return self.val_idx[mid]
+        return 0
+
+
+@boundscheck(False)
+@wraparound(False)
+def fast_build_csr(list cells):
+    """
+    (row, col) 오름차순 정렬된 (row, col, value) 목록에서 CSR 배열 생성
+    core/sparse_sheet.py의 build_csr_python과 동일한 결과
+
+    Returns:
+        (row_ptr, col_idx, val_idx, strings, row_count, col_count)
+    """
+    cdef int n = len(cells)
+    cdef array template = array('i')
+    cdef array col_idx = clone(template, n, False)
+    cdef array val_idx = clone(template, n, False)
+    cdef array row_ptr
+    cdef int[:] col_view = col_idx
+    cdef int[:] val_view = val_idx
+    cdef list strings = [""]
+    cdef dict intern = {"": 0}
+    cdef list row_starts = [0]
+    cdef int i, row, col, index
+    cdef int current_row = 0
+    cdef int max_col = -1
+    cdef tuple cell
+    cdef object value, found
+
+    for i in range(n):
+        cell = cells[i]
+        row = cell[0]
+        col = cell[1]
+        value = cell[2]
+        if not isinstance(value, str):
+            value = str(value)
+
+        while current_row < row:
+            row_starts.append(i)
+            current_row += 1
+
+        found = intern.get(value)
+        if found is None:
+            index = len(strings)
+            intern[value] = index
+            strings.append(value)
+        else:
+            index = found
+
+        col_view[i] = col
+        val_view[i] = index
+        if col > max_col:
+            max_col = col
+
+    if n > 0:
+        row_starts.append(n)
+        row_ptr = array('i', row_starts)
+        return row_ptr, col_idx, val_idx, strings, current_row + 1, max_col + 1
+
+    return array('i', [0]), col_idx, val_idx, strings, 0, 0
@@ -0,0 +1,137 @@
+"""
+시트 행/열 논리 순서 (화면 인덱스 → 물리 인덱스 간접 참조)
+
+행/열 삽입·삭제 시 그 아래(오른쪽) 모든 셀의 좌표를 다시 쓰지 않고,
+axis_order 테이블의 순서 항목만 추가/삭제합니다.
+- cells.row / cells.col 은 한 번 부여되면 바뀌지 않는 물리 번호입니다.
+- axis_order(sheet_id, axis, physical, ord): ord 오름차순 위치가 화면 인덱스입니다.
+- 삽입은 이웃 ord 사이 값을 부여하므로 다른 항목을 수정하지 않습니다 (간격이 소진되면 한 번 재정렬).
+- 순서 항목이 없는 시트/축은 물리 번호 == 화면 인덱스 (기존 DB와 동일)
+
+코드 생성/내보내기/CSV 히스토리는 DBHandlerV2.visual_cells()로 메모리에서 화면 좌표로 변환해 읽습니다 (DB는 변경하지 않음).
+- axis_order 테이블은 처음 행/열을 삽입·삭제할 때 생성됩니다.
+"""
+
+from typing import Dict, List, Optional, Tuple
+
+AXIS_ROW = 0
+AXIS_COL = 1
+
+AXIS_ORDER_TABLE_SQL = '''
+    CREATE TABLE IF NOT EXISTS axis_order (
+        sheet_id INTEGER NOT NULL,
+        axis INTEGER NOT NULL,
+        physical INTEGER NOT NULL,
+        ord REAL NOT NULL,
+        PRIMARY KEY (sheet_id, axis, physical),
+        FOREIGN KEY (sheet_id) REFERENCES sheets (id) ON DELETE CASCADE
+    ) WITHOUT ROWID
+'''
+
+# 삽입 위치의 ord 간격이 이보다 작아지면 전체 재정렬 (부동소수점 정밀도 보호)
+_MIN_ORD_GAP = 1e-7
+
+
+class AxisOrder:
+    """
+    한 시트 한 축(행 또는 열)의 화면 인덱스 ↔ 물리 번호 매핑
+
+    physicals[v]는 화면 인덱스 v의 물리 번호, ords[v]는 저장된 정렬 키입니다.
+    매핑 길이를 넘는 화면 인덱스는 next_physical부터 순서대로 대응됩니다 (아직 셀이 없는 영역).
+    """
+    __slots__ = ('physicals', 'ords', 'next_physical', '_visual_of')
+
+    def __init__(self, physicals: List[int], ords: List[float]):
+        self.physicals = physicals
+        self.ords = ords
+        self.next_physical = max(physicals) + 1 if physicals else 0
+        self._visual_of: Optional[Dict[int, int]] = None
+
+    @classmethod
+    def identity(cls, count: int) -> 'AxisOrder':
+        """물리 번호 == 화면 인덱스인 초기 매핑"""
+        return cls(list(range(count)), [float(i) for i in range(count)])
+
+    def __len__(self) -> int:
+        return len(self.physicals)
+
+    def to_physical(self, visual: int) -> int:
+        if visual < len(self.physicals):
+            return self.physicals[visual]
+        return self.next_physical + (visual - len(self.physicals))
+
+    def to_visual(self, physical: int) -> Optional[int]:
+        if self._visual_of is None:
+            self._visual_of = {p: v for v, p in enumerate(self.physicals)}
+        return self._visual_of.get(physical)
+
+    def entries(self) -> List[Tuple[int, float]]:
+        return list(zip(self.physicals, self.ords))
+
+    def ensure_length(self, count: int) -> List[Tuple[int, float]]:
+        """
+        화면 인덱스 count-1까지 매핑 확장 (셀 쓰기 전에 호출)
+
+        Returns:
+            새로 추가된 (physical, ord) 항목
+        """
+        added = []
+        last_ord = self.ords[-1] if self.ords else -1.0
+        while len(self.physicals) < count:
+            last_ord += 1.0
+            physical = self.next_physical
+            self.next_physical += 1
+            self.physicals.append(physical)
+            self.ords.append(last_ord)
+            added.append((physical, last_ord))
+        if added and self._visual_of is not None:
+            base = len(self.physicals) - len(added)
+            for i, (physical, _) in enumerate(added):
+                self._visual_of[physical] = base + i
+        return added
+
+    def insert(self, visual: int, count: int) -> Tuple[List[Tuple[int, float]], bool]:
+        """
+        화면 인덱스 visual 위치에 빈 항목 count개 삽입
+
+        Returns:
+            (새 항목 목록, 재정렬 여부) - 재정렬된 경우 entries() 전체를 다시 저장해야 함
+        """
+        added = self.ensure_length(visual)
+        lower = self.ords[visual - 1] if visual > 0 else (self.ords[0] - count - 1 if self.ords else -1.0)
+        upper = self.ords[visual] if visual < len(self.ords) else lower + count + 1
+
+        renormalized = (upper - lower) / (count + 1) < _MIN_ORD_GAP
+        new_physicals = list(range(self.next_physical, self.next_physical + count))
+        self.next_physical += count
+
+        if renormalized:
+            self.physicals[visual:visual] = new_physicals
+            self.ords = [float(i) for i in range(len(self.physicals))]
+            new_entries = [(p, float(visual + i)) for i, p in enumerate(new_physicals)]
+        else:
+            step = (upper - lower) / (count + 1)
+            new_ords = [lower + step * (i + 1) for i in range(count)]
+            self.physicals[visual:visual] = new_physicals
+            self.ords[visual:visual] = new_ords
+            new_entries = list(zip(new_physicals, new_ords))
+
+        self._visual_of = None
+        return added + new_entries, renormalized
+
+    def remove(self, visual: int, count: int) -> List[int]:
+        """
+        화면 인덱스 visual부터 count개 항목 제거
+
+        Returns:
+            제거된 물리 번호 목록 (해당 셀 삭제용)
+        """
+        removed = self.physicals[visual:visual + count]
+        del self.physicals[visual:visual + count]
+        del self.ords[visual:visual + count]
+        self._visual_of = None
+        return removed
+
+    def visual_range_physicals(self, start: int, count: int) -> List[int]:
+        """화면 인덱스 구간 [start, start+count)의 물리 번호 목록"""
+        return [self.to_physical(v) for v in range(start, start + count)]
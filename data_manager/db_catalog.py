@@ -0,0 +1,97 @@
+"""
+DB 시트 목록 카탈로그 (연결하지 않은 DB의 시트 목록 캐시)
+
+DB 파일별 시트 목록(get_sheets 결과)을 파일 서명(크기/수정 시각, -wal 포함)과 함께
+사용자 캐시 디렉토리의 작은 JSON 파일에 보관합니다. 서명이 같으면 DB를 열지 않고 재사용하며,
+다른 프로그램이나 Git 체크아웃으로 파일이 바뀌면 서명이 달라져 다시 읽습니다.
+"""
+
+import os
+import json
+import logging
+from typing import Dict, List, Optional
+
+CATALOG_FILE_NAME = "db_catalog.json"
+
+
+def default_catalog_path() -> str:
+    """카탈로그 파일 경로 (시트 IR 캐시와 같은 사용자 캐시 디렉토리)"""
+    from code_generator.sheet_ir_cache import default_cache_dir
+    return os.path.join(default_cache_dir(), CATALOG_FILE_NAME)
+
+
+def file_signature(db_file: str) -> List[int]:
+    """DB 파일과 WAL 파일의 [크기, 수정 시각(ns)] (없는 파일은 0) - 커밋 내용은 WAL에 먼저 기록되므로 함께 확인"""
+    signature = []
+    for path in (db_file, db_file + "-wal"):
+        try:
+            stat = os.stat(path)
+            signature += [stat.st_size, stat.st_mtime_ns]
+        except OSError:
+            signature += [0, 0]
+    return signature
+
+
+class DBCatalog:
+    """
+    사용 예:
+        catalog = DBCatalog()
+        sheets = catalog.get(db_file)
+        if sheets is None:
+            sheets = db_handler.get_sheets()
+            catalog.put(db_file, sheets)
+        catalog.save()
+    """
+
+    def __init__(self, path: Optional[str] = None):
+        self.path = path or default_catalog_path()
+        self.entries: Dict[str, Dict] = self._load()
+        self._dirty = False
+
+    def _load(self) -> Dict[str, Dict]:
+        try:
+            with open(self.path, 'r', encoding='utf-8') as f:
+                entries = json.load(f)
+            return entries if isinstance(entries, dict) else {}
+        except (OSError, ValueError):
+            return {}
+
+    @staticmethod
+    def _key(db_file: str) -> str:
+        return os.path.normcase(os.path.abspath(db_file))
+
+    def get(self, db_file: str) -> Optional[List[Dict]]:
+        """파일이 마지막 기록 이후 바뀌지 않았으면 시트 목록 사본, 아니면 None"""
+        entry = self.entries.get(self._key(db_file))
+        if not entry or entry.get('signature') != file_signature(db_file):
+            return None
+        return [dict(sheet) for sheet in entry.get('sheets', [])]
+
+    def put(self, db_file: str, sheets: List[Dict]):
+        """현재 파일 서명으로 시트 목록 기록"""
+        entry = {'signature': file_signature(db_file), 'sheets': [dict(sheet) for sheet in sheets]}
+        key = self._key(db_file)
+        if self.entries.get(key) != entry:
+            self.entries[key] = entry
+            self._dirty = True
+
+    def forget(self, db_file: str):
+        if self.entries.pop(self._key(db_file), None) is not None:
+            self._dirty = True
+
+    def save(self):
+        """변경된 경우에만 임시 파일에 쓴 뒤 교체"""
+        if not self._dirty:
+            return
+        # 더 이상 없는 DB 파일 항목 정리
+        for key in [key for key in self.entries if not os.path.exists(key)]:
+            del self.entries[key]
+        try:
+            os.makedirs(os.path.dirname(self.path), exist_ok=True)
+            temp_file = self.path + ".tmp"
+            with open(temp_file, 'w', encoding='utf-8') as f:
+                json.dump(self.entries, f, ensure_ascii=False)
+            os.replace(temp_file, self.path)
+            self._dirty = False
+        except OSError as e:
+            logging.warning(f"⚠ DB 카탈로그 저장 실패 ({self.path}): {e}")
@@ -0,0 +1,327 @@
+"""
+DB 셀 단위 의미 비교 (Git 변경사항 검토용)
+
+두 버전의 DBHandlerV2 데이터베이스(작업 사본 vs HEAD blob)를 시트 이름으로 짝지은 뒤
+시트마다 (row, col) 정렬 커서를 행 단위로 묶어 비교합니다.
+
+- 앞/뒤 공통 행은 바로 건너뛰고, 남은 구간만 행 정렬(insert/delete 감지) 후 셀 비교
+  (구간 길이가 같거나 너무 크면 위치 기준 병합 비교)
+- 결과: 바뀐 셀, 삽입/삭제된 행, 영향받는 코드 생성 심볼($ 시트의 Name 열 값)
+- HEAD blob은 sqlite3 deserialize로 메모리에 올려 읽음 (임시 CSV 없음, Python 3.10 이하는 임시 DB 파일 경유)
+- 행/열 논리 순서가 있는 시트는 화면 좌표로 비교
+"""
+
+import time
+import sqlite3
+import logging
+from difflib import SequenceMatcher
+from typing import Dict, Iterable, List, Optional, Set, Tuple
+
+# 계측 (비활성화 시 no-op)
+from core.tracing import tracer
+
+# 행 정렬(SequenceMatcher)을 시도하는 최대 구간 행 수 (넘으면 위치 기준 비교)
+ROW_ALIGN_MAX_ROWS = 20000
+
+# $ 시트 아이템 헤더 (CalList.dItem 키와 동일)
+_ITEM_HEADERS = ("OpCode", "Keyword", "Type", "Name", "Value", "Description")
+
+_EMPTY_ROW: Tuple[str, ...] = ()
+
+
+def column_letter(col: int) -> str:
+    """0부터 시작하는 열 번호를 'A', 'AB' 형식으로 변환"""
+    name = ""
+    num = col
+    while num >= 0:
+        name = chr(65 + (num % 26)) + name
+        num = num // 26 - 1
+    return name
+
+
+def cell_address(row: int, col: int) -> str:
+    return f"{column_letter(col)}{row + 1}"
+
+
+class CellChange:
+    __slots__ = ('old_row', 'new_row', 'col', 'old', 'new')
+
+    def __init__(self, old_row: int, new_row: int, col: int, old: str, new: str):
+        self.old_row = old_row
+        self.new_row = new_row
+        self.col = col
+        self.old = old
+        self.new = new
+
+
+class SheetDiff:
+    """시트 하나의 비교 결과"""
+
+    def __init__(self, name: str, status: str = "modified"):
+        self.name = name
+        self.status = status  # 'modified' / 'added' / 'removed' / 'unchanged'
+        self.changed_cells: List[CellChange] = []
+        self.inserted_rows: List[Tuple[int, Tuple[str, ...]]] = []  # (새 행 번호, 행 값)
+        self.removed_rows: List[Tuple[int, Tuple[str, ...]]] = []  # (이전 행 번호, 행 값)
+        self.symbols: Set[str] = set()
+        self.cell_count = 0
+
+    @property
+    def changed(self) -> bool:
+        return bool(self.changed_cells or self.inserted_rows or self.removed_rows) or self.status in ("added", "removed")
+
+
+class DbDiff:
+    """DB 전체 비교 결과"""
+
+    def __init__(self):
+        self.sheets: List[SheetDiff] = []
+        self.elapsed = 0.0
+        self.compared_cells = 0
+
+    @property
+    def changed_sheets(self) -> List[SheetDiff]:
+        return [s for s in self.sheets if s.changed]
+
+    @property
+    def symbols(self) -> Set[str]:
+        result = set()
+        for sheet in self.sheets:
+            result |= sheet.symbols
+        return result
+
+
+class _SheetSource:
+    """DB 연결에서 시트 목록/행 읽기 (axis_order 테이블이 없는 이전 버전 DB도 지원)"""
+
+    def __init__(self, conn: sqlite3.Connection):
+        self.conn = conn
+        self.handler = None
+        has_axis = conn.execute(
+            "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'axis_order'").fetchone() is not None
+        if has_axis:
+            # 화면 좌표 변환(visual_cells)은 DBHandlerV2 구현 재사용 (연결만 연결, 테이블 초기화 없음)
+            from data_manager.db_handler_v2 import DBHandlerV2
+            self.handler = DBHandlerV2()
+            self.handler.conn = conn
+            self.handler.cursor = conn.cursor()
+
+    def sheets(self) -> Dict[str, Dict]:
+        cursor = self.conn.cursor()
+        cursor.row_factory = None
+        cursor.execute("SELECT id, name, is_dollar_sheet FROM sheets ORDER BY sheet_order, id")
+        return {name: {'id': sheet_id, 'name': name, 'is_dollar_sheet': bool(dollar)}
+                for sheet_id, name, dollar in cursor.fetchall()}
+
+    def _cells(self, sheet_id: int) -> Iterable[Tuple[int, int, str]]:
+        if self.handler is not None:
+            visual_cells = self.handler.visual_cells(sheet_id)
+            if visual_cells is not None:
+                return visual_cells
+        cursor = self.conn.cursor()
+        cursor.row_factory = None
+        cursor.execute("""
+            SELECT row, col, value FROM cells
+            WHERE sheet_id = ? AND value IS NOT NULL AND value != ''
+            ORDER BY row, col
+        """, (sheet_id,))
+        return cursor
+
+    def rows(self, sheet_id: int) -> Tuple[List[Tuple[str, ...]], int]:
+        """행별 값 튜플 목록 (빈 행은 빈 튜플, 행 끝의 빈 셀 없음)과 셀 수"""
+        rows: List[Tuple[str, ...]] = []
+        current_row = -1
+        cells: List[str] = []
+        count = 0
+        for row, col, value in self._cells(sheet_id):
+            if row != current_row:
+                if current_row >= 0:
+                    rows.append(tuple(cells))
+                rows.extend([_EMPTY_ROW] * (row - current_row - 1))
+                cells = []
+                current_row = row
+            if col >= len(cells):
+                cells.extend([""] * (col + 1 - len(cells)))
+            cells[col] = str(value)
+            count += 1
+        if current_row >= 0:
+            rows.append(tuple(cells))
+        return rows, count
+
+
+def _name_column(rows: List[Tuple[str, ...]]) -> Tuple[int, int]:
+    """$ 시트의 (아이템 헤더 행, Name 열) - 헤더가 없으면 (-1, -1)"""
+    for row_index, row in enumerate(rows):
+        if "Name" in row and all(header in row for header in _ITEM_HEADERS):
+            return row_index, row.index("Name")
+    return -1, -1
+
+
+def _cell(row: Tuple[str, ...], col: int) -> str:
+    return row[col] if 0 <= col < len(row) else ""
+
+
+def _compare_rows(diff: SheetDiff, old_index: int, old_row: Tuple[str, ...], new_index: int, new_row: Tuple[str, ...]):
+    for col in range(max(len(old_row), len(new_row))):
+        old_value = _cell(old_row, col)
+        new_value = _cell(new_row, col)
+        if old_value != new_value:
+            diff.changed_cells.append(CellChange(old_index, new_index, col, old_value, new_value))
+
+
+def diff_sheet_rows(name: str, old_rows: List[Tuple[str, ...]], new_rows: List[Tuple[str, ...]],
+                    dollar_sheet: bool = False) -> SheetDiff:
+    """행 목록 두 개 비교"""
+    diff = SheetDiff(name)
+    old_count, new_count = len(old_rows), len(new_rows)
+
+    # 앞/뒤 공통 행 건너뛰기
+    lo = 0
+    limit = min(old_count, new_count)
+    while lo < limit and old_rows[lo] == new_rows[lo]:
+        lo += 1
+    old_hi, new_hi = old_count, new_count
+    while old_hi > lo and new_hi > lo and old_rows[old_hi - 1] == new_rows[new_hi - 1]:
+        old_hi -= 1
+        new_hi -= 1
+
+    old_mid = old_rows[lo:old_hi]
+    new_mid = new_rows[lo:new_hi]
+    if old_mid or new_mid:
+        if len(old_mid) == len(new_mid) or max(len(old_mid), len(new_mid)) > ROW_ALIGN_MAX_ROWS:
+            # 위치 기준 병합 비교 (행 수가 같으면 삽입/삭제 없이 셀만 바뀐 경우가 대부분)
+            for offset in range(min(len(old_mid), len(new_mid))):
+                if old_mid[offset] != new_mid[offset]:
+                    _compare_rows(diff, lo + offset, old_mid[offset], lo + offset, new_mid[offset])
+            for offset in range(len(new_mid), len(old_mid)):
+                diff.removed_rows.append((lo + offset, old_mid[offset]))
+            for offset in range(len(old_mid), len(new_mid)):
+                diff.inserted_rows.append((lo + offset, new_mid[offset]))
+        else:
+            matcher = SequenceMatcher(None, old_mid, new_mid, autojunk=False)
+            for tag, i1, i2, j1, j2 in matcher.get_opcodes():
+                if tag == 'equal':
+                    continue
+                paired = min(i2 - i1, j2 - j1) if tag == 'replace' else 0
+                for k in range(paired):
+                    _compare_rows(diff, lo + i1 + k, old_mid[i1 + k], lo + j1 + k, new_mid[j1 + k])
+                for k in range(i1 + paired, i2):
+                    diff.removed_rows.append((lo + k, old_mid[k]))
+                for k in range(j1 + paired, j2):
+                    diff.inserted_rows.append((lo + k, new_mid[k]))
+
+    # 빈 행 삽입/삭제는 셀 변경이 아니므로 표시 대상에서 제외
+    diff.inserted_rows = [(r, v) for r, v in diff.inserted_rows if v]
+    diff.removed_rows = [(r, v) for r, v in diff.removed_rows if v]
+
+    if dollar_sheet:
+        _collect_symbols(diff, old_rows, new_rows)
+
+    if not diff.changed:
+        diff.status = "unchanged"
+    return diff
+
+
+def _collect_symbols(diff: SheetDiff, old_rows: List[Tuple[str, ...]], new_rows: List[Tuple[str, ...]]):
+    """바뀐 행의 Name 열 값 (아이템 헤더 아래 행만)"""
+    old_header, old_col = _name_column(old_rows)
+    new_header, new_col = _name_column(new_rows)
+
+    def add(rows, header, col, row_index):
+        if col >= 0 and row_index > header:
+            # 배열 선언(NAME[SIZE])은 심볼 이름만
+            symbol = _cell(rows[row_index], col).split('[', 1)[0].strip()
+            if symbol:
+                diff.symbols.add(symbol)
+
+    for change in diff.changed_cells:
+        add(old_rows, old_header, old_col, change.old_row)
+        add(new_rows, new_header, new_col, change.new_row)
+    for row_index, _ in diff.removed_rows:
+        add(old_rows, old_header, old_col, row_index)
+    for row_index, _ in diff.inserted_rows:
+        add(new_rows, new_header, new_col, row_index)
+
+
+def diff_connections(old_conn: Optional[sqlite3.Connection], new_conn: Optional[sqlite3.Connection]) -> DbDiff:
+    """
+    두 DB 연결 비교 (한쪽이 None이면 해당 쪽 시트가 모두 추가/삭제된 것으로 처리)
+    """
+    start_time = time.time()
+    result = DbDiff()
+    old_source = _SheetSource(old_conn) if old_conn is not None else None
+    new_source = _SheetSource(new_conn) if new_conn is not None else None
+    old_sheets = old_source.sheets() if old_source else {}
+    new_sheets = new_source.sheets() if new_source else {}
+
+    names = list(new_sheets) + [name for name in old_sheets if name not in new_sheets]
+    for name in names:
+        old_sheet = old_sheets.get(name)
+        new_sheet = new_sheets.get(name)
+        with tracer.span("db_diff.sheet", "git", sheet=name):
+            old_rows, old_cells = old_source.rows(old_sheet['id']) if old_sheet else ([], 0)
+            new_rows, new_cells = new_source.rows(new_sheet['id']) if new_sheet else ([], 0)
+            dollar = bool((new_sheet or old_sheet)['is_dollar_sheet'])
+            diff = diff_sheet_rows(name, old_rows, new_rows, dollar)
+        if old_sheet is None:
+            diff.status = "added"
+        elif new_sheet is None:
+            diff.status = "removed"
+        diff.cell_count = max(old_cells, new_cells)
+        result.compared_cells += old_cells + new_cells
+        result.sheets.append(diff)
+
+    result.elapsed = time.time() - start_time
+    logging.info(f"DB 셀 비교 완료: 시트 {len(result.sheets)}개 (변경 {len(result.changed_sheets)}개), "
+                 f"셀 {result.compared_cells}개, {result.elapsed * 1000:.0f}ms")
+    return result
+
+
+def connect_blob(blob: bytes) -> sqlite3.Connection:
+    """
+    DB 파일 내용(bytes)을 메모리 DB로 열기
+
+    WAL 모드로 저장된 파일은 메모리 DB로 열 수 없으므로 헤더의 읽기/쓰기 버전(18, 19번째 바이트)을
+    legacy(1)로 바꿔서 엽니다 (커밋된 파일에는 WAL 내용이 없으므로 데이터는 동일).
+    """
+    data = bytearray(blob)
+    if len(data) >= 100 and data[18] == 2 and data[19] == 2:
+        data[18] = data[19] = 1
+    conn = sqlite3.connect(":memory:")
+    if hasattr(conn, 'deserialize'):
+        conn.deserialize(bytes(data))
+        return conn
+
+    # Python 3.10 이하: 메모리 DB로 복원 (backup API)
+    conn.close()
+    import os
+    import tempfile
+    fd, temp_path = tempfile.mkstemp(suffix=".db")
+    try:
+        with os.fdopen(fd, 'wb') as f:
+            f.write(data)
+        source = sqlite3.connect(temp_path)
+        conn = sqlite3.connect(":memory:")
+        source.backup(conn)
+        source.close()
+    finally:
+        os.remove(temp_path)
+    return conn
+
+
+def connect_readonly(db_file: str) -> sqlite3.Connection:
+    """작업 사본 DB를 읽기 전용으로 열기 (GUI가 열고 있어도 안전)"""
+    from pathlib import Path
+    return sqlite3.connect(f"{Path(db_file).resolve().as_uri()}?mode=ro", uri=True)
+
+
+def diff_db_file(head_blob: Optional[bytes], db_file: Optional[str]) -> DbDiff:
+    """HEAD blob(없으면 새 파일)과 작업 사본(없으면 삭제된 파일) 비교"""
+    old_conn = connect_blob(head_blob) if head_blob else None
+    new_conn = connect_readonly(db_file) if db_file else None
+    try:
+        return diff_connections(old_conn, new_conn)
+    finally:
+        for conn in (old_conn, new_conn):
+            if conn is not None:
+                conn.close()
@@ -1,8 +1,36 @@
 import sqlite3
-from typing import Dict, List, Any, Tuple, Optional
+from typing import Dict, Iterable, List, Any, Set, Tuple, Optional
 import os
 import logging
 import gc
+import time
+import hashlib
+import functools
+from contextlib import contextmanager
+
+from core.sparse_sheet import SparseSheet
+from core.tracing import traced
+from data_manager.axis_order import AxisOrder, AXIS_ORDER_TABLE_SQL, AXIS_ROW, AXIS_COL
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import USE_SPARSE_SHEET_LOADER
+except ImportError:
+    USE_SPARSE_SHEET_LOADER = True
+
+try:
+    from core.performance_settings import DB_PAGE_SIZE
+except ImportError:
+    DB_PAGE_SIZE = 8192
+
+try:
+    from core.performance_settings import USE_AXIS_ORDER_INDIRECTION
+except ImportError:
+    USE_AXIS_ORDER_INDIRECTION = False
+
+# 연결별 기본 메모리 설정 (DBManager가 관리하는 연결은 set_memory_limits로 예산 분배)
+DEFAULT_CACHE_SIZE = 100000  # PRAGMA cache_size (페이지 수)
+DEFAULT_MMAP_SIZE = 268435456  # PRAGMA mmap_size (256MB)
 
 # Cython 최적화 모듈 import (성능 향상)
 try:
@@ -18,58 +46,281 @@ except ImportError as e:
     logging.warning(f"⚠ Cython DB 모듈 로드 실패, Python 폴백 사용: {e}")
 
 
+# cells 저장 스키마 버전 (PRAGMA user_version)
+# - V2: id AUTOINCREMENT + UNIQUE(sheet_id, row, col) + 보조 인덱스 2개 (셀 데이터가 4번 저장됨)
+# - V3: (sheet_id, row, col) 클러스터드 PRIMARY KEY, WITHOUT ROWID (셀 데이터 1번 저장, 행 조회는 범위 스캔)
+CELLS_SCHEMA_VERSION = 3
+
+CELLS_TABLE_SQL = '''
+    CREATE TABLE IF NOT EXISTS {table_name} (
+        sheet_id INTEGER NOT NULL,
+        row INTEGER NOT NULL,
+        col INTEGER NOT NULL,
+        value TEXT,
+        PRIMARY KEY (sheet_id, row, col),
+        FOREIGN KEY (sheet_id) REFERENCES sheets (id) ON DELETE CASCADE
+    ) WITHOUT ROWID
+'''
+
+# V2 스키마의 보조 인덱스 (마이그레이션 시 제거, V2 DB 대량 가져오기 중에는 삭제 후 마지막에 한 번만 재생성)
+# UNIQUE(sheet_id, row, col) 자동 인덱스는 ON CONFLICT 처리에 필요하므로 유지
+LEGACY_CELL_INDEXES = {
+    "idx_cells_sheet_row": "CREATE INDEX IF NOT EXISTS idx_cells_sheet_row ON cells(sheet_id, row)",
+    "idx_cells_sheet_row_col": "CREATE INDEX IF NOT EXISTS idx_cells_sheet_row_col ON cells(sheet_id, row, col)",
+}
+
+# 조회 전용 연결로 열 수 있는 스키마에 있어야 하는 테이블 (없으면 init_tables 필요, 셀 스키마 V2/V3 모두 가능)
+REQUIRED_TABLES = ("sheets", "cells")
+
+
+def writes(method):
+    """DB를 변경하는 메서드 표시 - 조회 전용 연결이면 실행 전에 쓰기 가능하게 전환"""
+    @functools.wraps(method)
+    def wrapper(self, *args, **kwargs):
+        if self._query_only or self._conn is None:
+            self.ensure_writable()
+        return method(self, *args, **kwargs)
+    return wrapper
+
+
 class DBHandlerV2:
     """단순화된 SQLite DB 연결 및 쿼리 처리 클래스 (2계층: DB → 시트)"""
 
-    def __init__(self, db_file: str = None):
+    def __init__(self, db_file: str = None, lazy: bool = False, read_only: bool = False):
         """
         DBHandlerV2 초기화
 
         Args:
             db_file: 데이터베이스 파일 경로 (None인 경우 연결하지 않음)
+            lazy: True면 conn/cursor 첫 사용 시 연결 (release()로 닫은 뒤에도 다시 사용하면 재연결)
+            read_only: True면 조회 전용 연결(PRAGMA query_only)로 열고 테이블 초기화 생략,
+                       변경 메서드 호출 시 쓰기 가능 연결로 자동 전환 (필요한 테이블이 없으면 처음부터 쓰기 가능)
         """
         self.db_file = db_file
         self.db_file_path = db_file  # Git 관련 코드 호환성을 위한 별칭
-        self.conn = None
-        self.cursor = None
+        self._conn = None
+        self._cursor = None
+        self._bulk_depth = 0  # bulk_ingest() 중첩 깊이
+        self._axis_orders = {}  # {(sheet_id, axis): AxisOrder 또는 None} - 행/열 논리 순서 캐시
+        self._axis_data_version = None  # PRAGMA data_version (다른 연결의 변경 감지용)
+        self._axis_table = None  # axis_order 테이블 존재 여부 캐시 (연결마다 다시 확인)
+
+        # 지연 연결 / 조회 전용 상태
+        self.lazy = lazy
+        self.prefer_read_only = read_only
+        self._query_only = False  # 현재 연결이 조회 전용인지
+        self._tables_ready = False  # 현재 연결에서 init_tables 완료 여부
+        self._closed = False  # disconnect() 호출 이후 (지연 재연결 안 함)
+        self.last_used = 0.0  # 마지막 conn/cursor 사용 시각 (time.monotonic)
+        self.cache_size = DEFAULT_CACHE_SIZE  # 양수: 페이지 수, 음수: KiB (SQLite 규칙)
+        self.mmap_size = DEFAULT_MMAP_SIZE
+        self.open_listener = None  # 연결이 열릴 때 호출 (DBManager 연결 예산 관리용)
+        self.change_listener = None  # 셀/시트 변경 커밋 후 호출 (심볼 색인 증분 갱신용)
 
         # DB 파일이 지정된 경우에만 연결 시도
-        if db_file is not None:
+        if db_file is not None and not lazy:
+            self._open_lazily()
+
+    # ------------------------------------------------------------------
+    # 연결 (지연 연결 / 조회 전용 / 해제)
+    # ------------------------------------------------------------------
+    @property
+    def conn(self) -> Optional[sqlite3.Connection]:
+        if self._conn is None and self.lazy and not self._closed and self.db_file is not None:
+            self._open_lazily()
+        self.last_used = time.monotonic()
+        return self._conn
+
+    @conn.setter
+    def conn(self, value):
+        self._conn = value
+
+    @property
+    def cursor(self) -> Optional[sqlite3.Cursor]:
+        if self._conn is None and self.lazy and not self._closed and self.db_file is not None:
+            self._open_lazily()
+        self.last_used = time.monotonic()
+        return self._cursor
+
+    @cursor.setter
+    def cursor(self, value):
+        self._cursor = value
+
+    @property
+    def is_open(self) -> bool:
+        return self._conn is not None and not self._closed
+
+    @property
+    def is_read_only(self) -> bool:
+        """현재 연결이 조회 전용인지 (연결 전이면 다음 연결 방식)"""
+        return self._query_only if self._conn is not None else self.prefer_read_only
+
+    def _open_lazily(self):
+        self.connect(read_only=self.prefer_read_only)
+        if not self._query_only:
+            self.init_tables()
+
+    def ensure_writable(self) -> None:
+        """쓰기 가능한 연결 보장 (조회 전용이면 query_only 해제 후 테이블 초기화)"""
+        if self._conn is None:
+            if self._closed or self.db_file is None:
+                return
             self.connect()
+        if self._query_only:
+            self._conn.execute("PRAGMA query_only = OFF")
+            self._query_only = False
+            logging.info(f"DB 쓰기 모드 전환: {self.db_file}")
+        if not self._tables_ready:
             self.init_tables()
 
-    def connect(self) -> None:
-        """DB 연결 설정 - 성능 최적화"""
+    def _schema_current(self) -> bool:
+        """init_tables 없이 사용할 수 있는 스키마인지 (필요한 테이블 모두 존재 - 셀 V2는 변환하지 않고 그대로 읽음)"""
         try:
-            self.conn = sqlite3.connect(self.db_file, check_same_thread=False)
-            self.conn.row_factory = sqlite3.Row  # 결과를 딕셔너리 형태로 가져오기 위해
-            self.cursor = self.conn.cursor()
+            placeholders = ",".join("?" * len(REQUIRED_TABLES))
+            tables = self._cursor.execute(
+                f"SELECT name FROM sqlite_master WHERE type = 'table' AND name IN ({placeholders})",
+                REQUIRED_TABLES
+            ).fetchall()
+            return len(tables) == len(REQUIRED_TABLES)
+        except sqlite3.Error:
+            return False
+
+    def cells_schema_version(self) -> int:
+        """셀 테이블 스키마 버전 (2: rowid 테이블, 3: WITHOUT ROWID, 0: 테이블 없음)"""
+        row = self.cursor.execute("SELECT sql FROM sqlite_master WHERE type = 'table' AND name = 'cells'").fetchone()
+        if row is None:
+            return 0
+        return CELLS_SCHEMA_VERSION if "WITHOUT ROWID" in (row[0] or "").upper() else 2
+
+    def needs_cells_migration(self) -> bool:
+        """V2 셀 테이블이라 migrate_cells_to_v3로 변환할 수 있는지"""
+        return self.cells_schema_version() == 2
+
+    def connect(self, read_only: bool = False) -> None:
+        """
+        DB 연결 설정 - 성능 최적화
+
+        Args:
+            read_only: 스키마가 최신이면 조회 전용(PRAGMA query_only)으로 열기 (테이블 초기화/커밋 없음)
+        """
+        try:
+            self._conn = sqlite3.connect(self.db_file, check_same_thread=False)
+            self._conn.row_factory = sqlite3.Row  # 결과를 딕셔너리 형태로 가져오기 위해
+            self._cursor = self._conn.cursor()
+            self._closed = False
+            self._query_only = False
+            self._tables_ready = False
+            # 새 연결은 data_version 기준이 다르므로 논리 순서 캐시 초기화
+            self._axis_orders.clear()
+            self._axis_data_version = None
+            self._axis_table = None
+
+            read_only = read_only and self._schema_current()
+
+            # 새 DB 파일은 첫 테이블 생성 전에 페이지 크기 지정 (WAL 전환 후에는 변경 불가)
+            if not read_only:
+                try:
+                    if self._cursor.execute("PRAGMA page_count").fetchone()[0] == 0:
+                        self._cursor.execute(f"PRAGMA page_size = {int(DB_PAGE_SIZE)}")
+                except sqlite3.Error as e:
+                    logging.warning(f"PRAGMA page_size 설정 실패: {e}")
 
             # SQLite 성능 최적화 설정
             performance_pragmas = [
                 "PRAGMA journal_mode = WAL",           # Write-Ahead Logging (동시성 향상)
                 "PRAGMA synchronous = NORMAL",         # 동기화 레벨 조정 (안전성 유지하면서 성능 향상)
-                "PRAGMA cache_size = 100000",          # 캐시 크기 증가 (100MB)
+                f"PRAGMA cache_size = {int(self.cache_size)}",  # 페이지 캐시 (DBManager 예산 분배 시 KiB 단위)
                 "PRAGMA temp_store = MEMORY",          # 임시 데이터를 메모리에 저장
-                "PRAGMA mmap_size = 268435456",        # 메모리 맵 크기 (256MB)
+                f"PRAGMA mmap_size = {int(self.mmap_size)}",    # 메모리 맵 크기
+                "PRAGMA foreign_keys = ON",            # 시트 삭제 시 셀 데이터 CASCADE 삭제
                 "PRAGMA optimize"                      # 쿼리 최적화 활성화
             ]
+            if read_only:
+                # 조회 전용: 파일을 바꿀 수 있는 PRAGMA 생략 (기존 DB는 이미 WAL)
+                performance_pragmas = [p for p in performance_pragmas
+                                       if "journal_mode" not in p and "optimize" not in p]
+                performance_pragmas.append("PRAGMA query_only = ON")
 
             for pragma in performance_pragmas:
                 try:
-                    self.cursor.execute(pragma)
+                    self._cursor.execute(pragma)
                 except sqlite3.Error as e:
                     logging.warning(f"PRAGMA 설정 실패: {pragma} - {e}")
 
-            logging.info(f"SQLite DB '{self.db_file}' 연결 성공 (V2, 성능 최적화 적용)")
+            self._query_only = read_only
+            self.last_used = time.monotonic()
+            mode = "조회 전용" if read_only else "성능 최적화 적용"
+            logging.info(f"SQLite DB '{self.db_file}' 연결 성공 (V2, {mode})")
         except sqlite3.Error as e:
             logging.error(f"SQLite 연결 오류: {e}")
             raise
 
+        if self.open_listener is not None:
+            try:
+                self.open_listener(self)
+            except Exception as e:
+                logging.warning(f"⚠ DB 연결 알림 처리 실패: {e}")
+
+    def set_memory_limits(self, cache_kib: int, mmap_bytes: int) -> None:
+        """페이지 캐시(KiB)/메모리 맵(바이트) 한도 설정 - 열려 있으면 즉시 적용, 아니면 다음 연결 시 적용"""
+        cache_size = -max(1, int(cache_kib))
+        mmap_size = max(0, int(mmap_bytes))
+        if cache_size == self.cache_size and mmap_size == self.mmap_size:
+            return
+        self.cache_size = cache_size
+        self.mmap_size = mmap_size
+        if self._conn is not None and not self._closed:
+            try:
+                self._conn.execute(f"PRAGMA cache_size = {cache_size}")
+                self._conn.execute(f"PRAGMA mmap_size = {mmap_size}")
+            except sqlite3.Error as e:
+                logging.debug(f"DB 메모리 한도 적용 실패 ({self.db_file}): {e}")
+
+    def can_release(self) -> bool:
+        """지금 연결을 닫아도 되는지 (지연 연결 핸들러, 트랜잭션/대량 가져오기 중 아님)"""
+        return (self.lazy and self._conn is not None and not self._closed
+                and self._bulk_depth == 0 and not self._conn.in_transaction)
+
+    def release(self) -> bool:
+        """
+        유휴 연결 닫기 (지연 연결 핸들러 전용) - 다음 conn/cursor 사용 시 자동으로 다시 연결
+
+        Returns:
+            닫았으면 True (진행 중인 트랜잭션이 있거나 지연 연결이 아니면 False)
+        """
+        if not self.can_release():
+            return False
+        try:
+            self._conn.close()
+        except sqlite3.Error as e:
+            logging.debug(f"DB 연결 해제 실패 ({self.db_file}): {e}")
+        self._conn = None
+        self._cursor = None
+        self._query_only = False
+        self._tables_ready = False
+        logging.info(f"유휴 DB 연결 해제: {self.db_file}")
+        return True
+
+    def _notify_change(self, sheet_id: Optional[int], rows: Optional[Set[int]] = None) -> None:
+        """
+        커밋된 변경 알림 (change_listener가 있을 때만)
+
+        Args:
+            sheet_id: 바뀐 시트 (None이면 여러 시트)
+            rows: 바뀐 화면 행 번호 (None이면 시트 전체 - 행/열 삽입·삭제, 시트 생성·삭제·이름 변경 등)
+        """
+        if self.change_listener is None:
+            return
+        try:
+            self.change_listener(self, sheet_id, rows)
+        except Exception as e:
+            logging.warning(f"⚠ 변경 알림 처리 실패 (sheet_id={sheet_id}): {e}")
+
     def disconnect(self) -> None:
         """DB 연결 종료"""
-        if self.conn:
-            self.conn.close()
+        self._closed = True
+        if self._conn:
+            self._conn.close()
             logging.info("SQLite DB 연결 종료 (V2)")
 
     def init_tables(self) -> None:
@@ -87,26 +338,23 @@ class DBHandlerV2:
                 )
             ''')
 
-            # 셀 데이터 테이블 (변경 없음)
-            self.cursor.execute('''
-            CREATE TABLE IF NOT EXISTS cells (
-                id INTEGER PRIMARY KEY AUTOINCREMENT,
-                sheet_id INTEGER NOT NULL,
-                row INTEGER NOT NULL,
-                col INTEGER NOT NULL,
-                value TEXT,
-                FOREIGN KEY (sheet_id) REFERENCES sheets (id) ON DELETE CASCADE,
-                UNIQUE(sheet_id, row, col)
-            )
-            ''')
+            # 셀 데이터 테이블 (새 DB는 V3: WITHOUT ROWID)
+            # 기존 V2 테이블은 그대로 사용 - 변환은 파일 전체를 다시 쓰므로 migrate_cells_to_v3를 명시적으로 호출할 때만
+            cells_version = self.cells_schema_version()
+            if cells_version == 0:
+                self.cursor.execute(CELLS_TABLE_SQL.format(table_name="cells"))
+                self.cursor.execute(f"PRAGMA user_version = {CELLS_SCHEMA_VERSION}")
+                cells_version = CELLS_SCHEMA_VERSION
 
             # 성능 최적화를 위한 인덱스 생성
+            # V3 cells는 클러스터드 PRIMARY KEY가 (sheet_id, row) 조회를 처리하므로 보조 인덱스 없음
+            # V2 cells는 보조 인덱스 유지 (대량 가져오기가 중단되어 빠진 경우 여기서 복구)
             performance_indexes = [
-                "CREATE INDEX IF NOT EXISTS idx_cells_sheet_row ON cells(sheet_id, row)",
-                "CREATE INDEX IF NOT EXISTS idx_cells_sheet_row_col ON cells(sheet_id, row, col)",
                 "CREATE INDEX IF NOT EXISTS idx_sheets_name ON sheets(name)",
                 "CREATE INDEX IF NOT EXISTS idx_sheets_dollar ON sheets(is_dollar_sheet)"
             ]
+            if cells_version == 2:
+                performance_indexes += list(LEGACY_CELL_INDEXES.values())
 
             for index_sql in performance_indexes:
                 try:
@@ -115,12 +363,122 @@ class DBHandlerV2:
                     logging.warning(f"인덱스 생성 실패: {index_sql} - {e}")
 
             self.conn.commit()
-            logging.info("테이블 초기화 완료 (V2, 성능 최적화 인덱스 포함)")
+            self._tables_ready = True
+            logging.info(f"테이블 초기화 완료 (셀 스키마 V{cells_version}, 성능 최적화 인덱스 포함)")
         except sqlite3.Error as e:
             logging.error(f"테이블 초기화 오류: {e}")
             self.conn.rollback()
             raise
 
+    @traced("db.migrate_cells_to_v3", "db")
+    def migrate_cells_to_v3(self) -> int:
+        """
+        V2 cells 테이블을 V3(WITHOUT ROWID) 스키마로 변환 (사용자가 명시적으로 요청할 때만 호출)
+
+        셀 값은 그대로 옮기며, 삭제된 시트에 남아 있던 셀(외래 키 미적용 시절의 잔여 데이터)은 제외합니다.
+        변환 후 VACUUM으로 파일 크기를 줄이므로 DB 파일 전체가 바뀝니다 (Git에서는 변경으로 표시).
+
+        Returns:
+            옮긴 셀 개수 (이미 V3이면 0)
+        """
+        self.ensure_writable()
+        if not self.needs_cells_migration():
+            return 0
+        start_time = time.time()
+        size_before = os.path.getsize(self.db_file) if self.db_file and os.path.exists(self.db_file) else 0
+
+        try:
+            self.conn.execute("BEGIN TRANSACTION")
+            self.cursor.execute("DROP TABLE IF EXISTS cells_v3")
+            self.cursor.execute(CELLS_TABLE_SQL.format(table_name="cells_v3"))
+            self.cursor.execute('''
+                INSERT INTO cells_v3 (sheet_id, row, col, value)
+                SELECT sheet_id, row, col, value FROM cells
+                WHERE sheet_id IN (SELECT id FROM sheets)
+                ORDER BY sheet_id, row, col
+            ''')
+            migrated_count = self.cursor.rowcount
+
+            # DROP TABLE 시 V2 인덱스(UNIQUE 자동 인덱스 포함)도 함께 제거됨
+            for index_name in LEGACY_CELL_INDEXES:
+                self.cursor.execute(f"DROP INDEX IF EXISTS {index_name}")
+            self.cursor.execute("DROP TABLE cells")
+            self.cursor.execute("ALTER TABLE cells_v3 RENAME TO cells")
+            self.cursor.execute(f"PRAGMA user_version = {CELLS_SCHEMA_VERSION}")
+            self.conn.commit()
+        except sqlite3.Error as e:
+            logging.error(f"❌ 셀 스키마 V3 마이그레이션 실패: {e}")
+            self.conn.rollback()
+            raise
+
+        try:
+            self.cursor.execute("VACUUM")
+        except sqlite3.Error as e:
+            logging.warning(f"⚠ 마이그레이션 후 VACUUM 실패 (데이터는 정상): {e}")
+
+        size_after = os.path.getsize(self.db_file) if self.db_file and os.path.exists(self.db_file) else 0
+        logging.info(f"✓ 셀 스키마 V3 마이그레이션 완료: {migrated_count}개 셀, "
+                     f"{size_before // 1024}KB → {size_after // 1024}KB ({time.time() - start_time:.2f}초)")
+        return migrated_count
+
+    @contextmanager
+    def bulk_ingest(self):
+        """
+        대량 가져오기 모드 (Excel → DB 변환용)
+
+        블록 안에서는 외래 키 검사를 끈 상태로 삽입하고, 블록이 끝나면 외래 키 설정을 되돌린 뒤
+        PRAGMA optimize로 통계를 갱신합니다. 중첩 호출 시 가장 바깥 블록만 적용됩니다.
+        V2 cells 테이블이면 보조 인덱스(LEGACY_CELL_INDEXES)를 블록 동안 삭제했다가 마지막에 한 번만
+        재생성합니다 (V3는 클러스터드 PRIMARY KEY 하나뿐이라 삭제할 인덱스 없음).
+
+        사용 예:
+            with db.bulk_ingest():
+                db.stream_insert_cells(sheet_id, batches)
+        """
+        self.ensure_writable()
+        self._bulk_depth += 1
+        if self._bulk_depth > 1:
+            try:
+                yield self
+            finally:
+                self._bulk_depth -= 1
+            return
+
+        start_time = time.time()
+        foreign_keys = 0
+        deferred_indexes = {}
+        try:
+            self.conn.commit()
+            foreign_keys = self.cursor.execute("PRAGMA foreign_keys").fetchone()[0]
+            self.cursor.execute("PRAGMA foreign_keys = OFF")
+            if self.cells_schema_version() == 2:
+                deferred_indexes = LEGACY_CELL_INDEXES
+                for index_name in deferred_indexes:
+                    self.cursor.execute(f"DROP INDEX IF EXISTS {index_name}")
+                self.conn.commit()
+                logging.info("대량 가져오기 모드 시작 (V2 보조 인덱스 지연 생성, 외래 키 검사 생략)")
+            else:
+                logging.info("대량 가져오기 모드 시작 (외래 키 검사 생략)")
+        except sqlite3.Error as e:
+            logging.warning(f"⚠ 대량 가져오기 모드 설정 실패 (일반 모드로 진행): {e}")
+
+        try:
+            yield self
+        finally:
+            self._bulk_depth -= 1
+            try:
+                self.conn.commit()
+                for index_sql in deferred_indexes.values():
+                    self.cursor.execute(index_sql)
+                self.cursor.execute(f"PRAGMA foreign_keys = {'ON' if foreign_keys else 'OFF'}")
+                self.cursor.execute("PRAGMA optimize")
+                self.conn.commit()
+                rebuilt = f", 보조 인덱스 {len(deferred_indexes)}개 재생성" if deferred_indexes else ""
+                logging.info(f"✓ 대량 가져오기 모드 종료 ({time.time() - start_time:.2f}초{rebuilt})")
+            except sqlite3.Error as e:
+                logging.error(f"❌ 대량 가져오기 모드 종료 처리 실패: {e}")
+
+    @writes
     def create_sheet_v2(self, sheet_name: str, is_dollar_sheet: bool = False,
                        sheet_order: int = 0, source_file: str = None,
                        replace_if_exists: bool = True) -> int:
@@ -159,6 +517,7 @@ class DBHandlerV2:
             )
             self.conn.commit()
             sheet_id = self.cursor.lastrowid
+            self._notify_change(sheet_id)
             logging.info(f"새 시트 '{sheet_name}' 생성 완료 (ID: {sheet_id})")
             return sheet_id
 
@@ -187,6 +546,7 @@ class DBHandlerV2:
             self.conn.rollback()
             raise
 
+    @traced("db.get_sheets", "db")
     def get_sheets(self) -> List[Dict[str, Any]]:
         """
         모든 시트 목록 조회
@@ -263,6 +623,7 @@ class DBHandlerV2:
             logging.error(f"시트명 조회 오류 ('{sheet_name}'): {e}")
             return None
 
+    @writes
     def rename_sheet(self, sheet_id: int, new_name: str, is_dollar_sheet: bool = None):
         """
         시트 이름 변경
@@ -283,21 +644,29 @@ class DBHandlerV2:
                 self.cursor.execute(query, (new_name, is_dollar_sheet, sheet_id))
 
             self.conn.commit()
+            self._notify_change(sheet_id)
         except Exception as e:
             logging.error(f"시트 이름 변경 오류: {e}")
             self.conn.rollback()
             raise
 
+    @writes
     def delete_sheet(self, sheet_id: int):
         """시트 삭제 (연관된 셀 데이터도 함께 삭제)"""
         try:
+            # 외래 키 검사가 꺼진 경우(대량 가져오기 모드)에도 셀이 남지 않도록 직접 삭제
+            self.cursor.execute("DELETE FROM cells WHERE sheet_id = ?", (sheet_id,))
+            self._execute_axis("DELETE FROM axis_order WHERE sheet_id = ?", (sheet_id,))
             self.cursor.execute("DELETE FROM sheets WHERE id = ?", (sheet_id,))
             self.conn.commit()
+            self._forget_axis_orders(sheet_id)
+            self._notify_change(sheet_id)
         except Exception as e:
             logging.error(f"시트 삭제 오류: {e}")
             self.conn.rollback()
             raise
 
+    @writes
     def delete_sheets_by_source_file(self, source_file: str) -> int:
         """
         특정 source_file의 모든 시트 삭제
@@ -320,10 +689,21 @@ class DBHandlerV2:
                 logging.info(f"삭제할 시트가 없습니다 (source_file: '{source_file}')")
                 return 0
 
-            # 시트들 삭제 (CASCADE로 연관된 셀 데이터도 자동 삭제)
+            # 시트들 삭제 (외래 키 검사가 꺼진 대량 가져오기 모드에서도 셀이 남지 않도록 셀 먼저 삭제)
+            self.cursor.execute(
+                "DELETE FROM cells WHERE sheet_id IN (SELECT id FROM sheets WHERE source_file = ?)",
+                (source_file,)
+            )
+            self._execute_axis(
+                "DELETE FROM axis_order WHERE sheet_id IN (SELECT id FROM sheets WHERE source_file = ?)",
+                (source_file,)
+            )
+            for sheet in sheets_to_delete:
+                self._forget_axis_orders(sheet[0])
             self.cursor.execute("DELETE FROM sheets WHERE source_file = ?", (source_file,))
             deleted_count = self.cursor.rowcount
             self.conn.commit()
+            self._notify_change(None)
 
             logging.info(f"source_file '{source_file}'의 {deleted_count}개 시트 삭제 완료")
             for sheet in sheets_to_delete:
@@ -337,9 +717,12 @@ class DBHandlerV2:
             raise
 
     # 셀 관련 메서드들은 기존과 동일
+    @writes
     def set_cell_value(self, sheet_id: int, row: int, col: int, value: str) -> None:
         """셀 값 설정"""
         try:
+            visual_row = row
+            row, col = self._to_physical(sheet_id, row, col, extend=True)
             self.cursor.execute(
                 """
                 INSERT INTO cells (sheet_id, row, col, value)
@@ -350,6 +733,7 @@ class DBHandlerV2:
                 (sheet_id, row, col, value, value)
             )
             self.conn.commit()
+            self._notify_change(sheet_id, {visual_row})
         except sqlite3.Error as e:
             logging.error(f"셀 값 설정 오류: {e}")
             self.conn.rollback()
@@ -358,6 +742,7 @@ class DBHandlerV2:
     def get_cell_value(self, sheet_id: int, row: int, col: int) -> str:
         """셀 값 가져오기"""
         try:
+            row, col = self._to_physical(sheet_id, row, col)
             self.cursor.execute(
                 "SELECT value FROM cells WHERE sheet_id = ? AND row = ? AND col = ?",
                 (sheet_id, row, col)
@@ -368,72 +753,95 @@ class DBHandlerV2:
             logging.error(f"셀 값 가져오기 오류: {e}")
             return ""
 
+    @traced("db.get_sheet_data", "db")
     def get_sheet_data(self, sheet_id: int) -> List[List[str]]:
         """시트의 모든 데이터를 2차원 배열 형태로 가져오기 - 성능 최적화"""
-        import gc
-
         try:
-            # 1. 시트 크기 먼저 확인 (단일 쿼리로 최적화)
-            self.cursor.execute("""
-                SELECT MAX(row) as max_row, MAX(col) as max_col, COUNT(*) as cell_count
-                FROM cells WHERE sheet_id = ? AND value IS NOT NULL AND value != ''
-            """, (sheet_id,))
-
-            result = self.cursor.fetchone()
-            if not result or result['max_row'] is None:
+            # (row, col) 순 단일 스캔으로 CSR 구성 후 펼치기 (LIMIT/OFFSET 페이징 제거)
+            sparse_sheet = self.get_sheet_data_sparse(sheet_id)
+            if not sparse_sheet:
                 return []
 
-            max_row, max_col, cell_count = result['max_row'], result['max_col'], result['cell_count']
-            logging.debug(f"시트 {sheet_id}: {max_row+1}x{max_col+1} 크기, {cell_count}개 셀")
+            sheet_data = sparse_sheet.to_dense()
+            logging.info(f"시트 {sheet_id} 데이터 로드 완료: {sparse_sheet.row_count}x{sparse_sheet.col_count}, {sparse_sheet.cell_count}개 셀")
+            return sheet_data
 
-            # 2. 희소 행렬로 초기화 (메모리 효율적)
-            sheet_data = [["" for _ in range(max_col + 1)] for _ in range(max_row + 1)]
+        except sqlite3.Error as e:
+            logging.error(f"시트 데이터 가져오기 오류: {e}")
+            raise
 
-            # 3. 배치 단위로 데이터 로드 (메모리 사용량 제어)
-            batch_size = 50000  # 5만개씩 처리
-            offset = 0
+    @traced("db.get_sheet_data_sparse", "db")
+    def get_sheet_data_sparse(self, sheet_id: int) -> SparseSheet:
+        """
+        시트 데이터를 CSR 형식(SparseSheet)으로 가져오기
 
-            while True:
-                # 배치 단위로 셀 데이터 가져오기 (빈 값 제외)
-                self.cursor.execute("""
+        인덱스(sheet_id, row, col) 순서로 한 번만 스캔하며, 행별 리스트나 셀별 dict를 만들지 않습니다.
+        크기 의미는 get_sheet_data와 동일합니다 (빈 값 셀 제외).
+        """
+        try:
+            visual_cells = self.visual_cells(sheet_id)
+            if visual_cells is not None:
+                # 행/열 논리 순서가 있는 시트: 화면 좌표로 변환 후 정렬
+                sparse_sheet = SparseSheet.from_cells(visual_cells)
+            else:
+                cursor = self.conn.cursor()
+                cursor.row_factory = None  # sqlite3.Row 대신 튜플로 받아 변환 비용 제거
+                cursor.execute("""
                     SELECT row, col, value FROM cells
                     WHERE sheet_id = ? AND value IS NOT NULL AND value != ''
                     ORDER BY row, col
-                    LIMIT ? OFFSET ?
-                """, (sheet_id, batch_size, offset))
+                """, (sheet_id,))
+                sparse_sheet = SparseSheet.from_cells(cursor.fetchall())
+            logging.debug(f"시트 {sheet_id} CSR 로드: {sparse_sheet.row_count}x{sparse_sheet.col_count}, "
+                          f"{sparse_sheet.cell_count}개 셀, 고유 문자열 {len(sparse_sheet.strings)}개")
+            return sparse_sheet
 
-                batch = self.cursor.fetchall()
+        except sqlite3.Error as e:
+            logging.error(f"시트 데이터(CSR) 가져오기 오류: {e}")
+            raise
+
+    def get_sheet_data_for_code_gen(self, sheet_id: int):
+        """
+        코드 생성용 시트 데이터 (USE_SPARSE_SHEET_LOADER 설정 시 CSR, 아니면 2차원 리스트)
+
+        논리 순서가 있는 시트는 메모리에서 화면 좌표로 변환합니다 (get_sheet_content_hash와 같은 방식, DB는 변경하지 않음).
+        """
+        if USE_SPARSE_SHEET_LOADER:
+            return self.get_sheet_data_sparse(sheet_id)
+        return self.get_sheet_data(sheet_id)
+
+    @traced("db.get_sheet_content_hash", "db")
+    def get_sheet_content_hash(self, sheet_id: int) -> str:
+        """
+        시트 셀 내용 해시 계산 (증분 코드 생성용)
+
+        get_sheet_data와 동일하게 빈 값을 제외한 셀을 (row, col) 순으로 SHA-1 해시합니다.
+        시트 데이터를 2차원 배열로 만들지 않으므로 전체 로드보다 훨씬 빠릅니다.
+        """
+        try:
+            hasher = hashlib.sha1()
+            visual_cells = self.visual_cells(sheet_id)
+            if visual_cells is not None:
+                hasher.update("".join(f"{cell[0]}\x1f{cell[1]}\x1f{cell[2]}\x1e" for cell in visual_cells).encode('utf-8'))
+                return hasher.hexdigest()
+
+            cursor = self.conn.cursor()
+            cursor.execute("""
+                SELECT row, col, value FROM cells
+                WHERE sheet_id = ? AND value IS NOT NULL AND value != ''
+                ORDER BY row, col
+            """, (sheet_id,))
+
+            while True:
+                batch = cursor.fetchmany(10000)
                 if not batch:
                     break
+                hasher.update("".join(f"{cell[0]}\x1f{cell[1]}\x1f{cell[2]}\x1e" for cell in batch).encode('utf-8'))
 
-                # 배치 데이터 처리 - Cython 최적화 활성화
-                try:
-                    from cython_extensions.data_processor import fast_sheet_data_loading
-                    # 배치를 Cython으로 빠르게 처리
-                    batch_dict = [{'row': cell['row'], 'col': cell['col'], 'value': cell['value']} for cell in batch]
-                    temp_sheet = fast_sheet_data_loading(batch_dict, max_row, max_col)
-                    # 결과를 기존 sheet_data에 병합
-                    for i in range(len(temp_sheet)):
-                        for j in range(len(temp_sheet[i])):
-                            if temp_sheet[i][j] is not None:
-                                sheet_data[i][j] = temp_sheet[i][j]
-                except ImportError:
-                    # Python 폴백
-                    for cell in batch:
-                        sheet_data[cell['row']][cell['col']] = cell['value']
-
-                offset += batch_size
-
-                # 대용량 데이터 처리 시 주기적 가비지 컬렉션
-                if offset % (batch_size * 4) == 0:  # 20만개마다
-                    gc.collect()
-                    logging.debug(f"시트 {sheet_id}: {offset}개 셀 처리 완료")
-
-            logging.info(f"시트 {sheet_id} 데이터 로드 완료: {max_row+1}x{max_col+1}, {cell_count}개 셀")
-            return sheet_data
+            return hasher.hexdigest()
 
         except sqlite3.Error as e:
-            logging.error(f"시트 데이터 가져오기 오류: {e}")
+            logging.error(f"시트 해시 계산 오류: {e}")
             raise
 
     def get_sheet_metadata(self, sheet_id: int) -> Dict[str, Any]:
@@ -449,6 +857,18 @@ class DBHandlerV2:
             max_row = result['max_row'] if result and result['max_row'] is not None else 0
             max_col = result['max_col'] if result and result['max_col'] is not None else 0
 
+            # 논리 순서가 있는 축은 셀이 있는 물리 번호 중 최대 화면 인덱스 사용
+            for axis, column in ((AXIS_ROW, "row"), (AXIS_COL, "col")):
+                order = self.get_axis_order(sheet_id, axis)
+                if order is not None:
+                    self.cursor.execute(f"SELECT DISTINCT {column} FROM cells WHERE sheet_id = ?", (sheet_id,))
+                    visuals = [order.to_visual(r[0]) for r in self.cursor.fetchall()]
+                    max_visual = max((v for v in visuals if v is not None), default=0)
+                    if axis == AXIS_ROW:
+                        max_row = max_visual
+                    else:
+                        max_col = max_visual
+
             # 최소값 설정
             max_row = max(max_row, 100)
             max_col = max(max_col, 50)
@@ -459,6 +879,7 @@ class DBHandlerV2:
             logging.error(f"시트 메타데이터 조회 오류: {e}")
             return {"max_row": 100, "max_col": 50}  # 오류 시 기본값
 
+    @traced("db.get_sheets", "db")
     def get_sheets(self) -> List[Dict[str, Any]]:
         """
         모든 시트 목록 조회 (V2 순수 방식)
@@ -513,13 +934,23 @@ class DBHandlerV2:
             logging.error(f"파일 목록 조회 오류: {e}")
             return []
 
-    def batch_insert_cells(self, sheet_id: int, cells_data: List[Tuple[int, int, str]]) -> None:
+    @staticmethod
+    def _insert_cells_sql(sheet_id: int) -> str:
+        """셀 일괄 삽입 SQL (sheet_id는 문장에 한 번만 지정 - 셀마다 (sheet_id, row, col, value) 튜플을 만들지 않음)"""
+        return f"INSERT INTO cells (sheet_id, row, col, value) VALUES ({int(sheet_id)}, ?, ?, ?)"
+
+    @traced("db.batch_insert_cells", "db")
+    @writes
+    def batch_insert_cells(self, sheet_id: int, cells_data: List[Tuple[int, int, str]],
+                           prepared: bool = False) -> None:
         """
         다수의 셀 데이터를 일괄 삽입 (성능 최적화 및 안정성 강화)
 
         Args:
             sheet_id: 시트 ID
             cells_data: (row, col, value) 튜플의 리스트
+            prepared: True면 cells_data가 이미 빈 값 제외/문자열 변환된 목록 (bulk_cell_params 결과)
+                      - 다시 가공하지 않고 executemany에 그대로 전달
         """
         if not cells_data:
             logging.warning(f"시트 {sheet_id}: 삽입할 셀 데이터가 없습니다.")
@@ -529,38 +960,32 @@ class DBHandlerV2:
             # 트랜잭션 시작
             self.conn.execute("BEGIN TRANSACTION")
 
-            # 기존 시트 데이터 삭제
+            # 기존 시트 데이터 삭제 (새 데이터는 화면 좌표이므로 논리 순서도 제거)
+            self._drop_axis_order(sheet_id)
             delete_result = self.cursor.execute("DELETE FROM cells WHERE sheet_id = ?", (sheet_id,))
             deleted_count = delete_result.rowcount
             logging.debug(f"시트 {sheet_id}: 기존 {deleted_count}개 셀 삭제")
 
             # 새 데이터 준비 (빈 값 제외) - Cython 최적화 활성화
-            try:
-                # Cython 최적화 버전 사용 (성능 향상)
-                from cython_extensions.data_processor import fast_db_batch_processing
-                processed_cells = fast_db_batch_processing(cells_data)
-                data = [(sheet_id, row, col, value) for row, col, value in processed_cells]
-                # DB 배치 처리 Cython 최적화 사용 (로그 제거)
-            except ImportError:
+            if prepared:
+                data = cells_data
+            elif USE_CYTHON_DB:
+                data = fast_db_batch_processing(cells_data)
+            else:
                 # Python 폴백
-                data = []
-                for row, col, value in cells_data:
-                    if value is not None and str(value).strip():  # 빈 문자열과 None 제외
-                        data.append((sheet_id, row, col, str(value)))
-                # DB 배치 처리 Python 폴백 사용 (로그 제거)
+                data = [(row, col, str(value)) for row, col, value in cells_data
+                        if value is not None and str(value).strip()]  # 빈 문자열과 None 제외
 
             # 새 데이터 일괄 삽입
             if data:
-                self.cursor.executemany(
-                    "INSERT INTO cells (sheet_id, row, col, value) VALUES (?, ?, ?, ?)",
-                    data
-                )
+                self.cursor.executemany(self._insert_cells_sql(sheet_id), data)
                 logging.info(f"시트 {sheet_id}: {len(data)}개 셀 일괄 삽입 완료 (원본 데이터: {len(cells_data)}개)")
             else:
                 logging.warning(f"시트 {sheet_id}: 유효한 데이터가 없어 삽입하지 않음")
 
             # 트랜잭션 커밋
             self.conn.commit()
+            self._notify_change(sheet_id)
 
         except sqlite3.Error as e:
             logging.error(f"시트 {sheet_id} 셀 일괄 삽입 오류: {e}")
@@ -571,6 +996,45 @@ class DBHandlerV2:
             self.conn.rollback()
             raise
 
+    @traced("db.stream_insert_cells", "db")
+    @writes
+    def stream_insert_cells(self, sheet_id: int, cell_batches: Iterable[List[Tuple[int, int, str]]]) -> int:
+        """
+        (row, col, value) 배치 스트림을 한 트랜잭션으로 삽입 (xlsx 스트리밍 가져오기용)
+
+        batch_insert_cells와 달리 전체 셀 목록을 메모리에 모으지 않으며,
+        빈 값 제외 규칙은 동일합니다. 새로 만든 시트에 사용하므로 기존 셀을 삭제하지 않습니다.
+
+        Args:
+            sheet_id: 시트 ID
+            cell_batches: (row, col, value) 튜플 리스트의 반복자
+
+        Returns:
+            삽입된 셀 개수
+        """
+        inserted = 0
+        try:
+            self.conn.execute("BEGIN TRANSACTION")
+
+            insert_sql = self._insert_cells_sql(sheet_id)
+            for cells_data in cell_batches:
+                data = [(row, col, str(value)) for row, col, value in cells_data
+                        if value is not None and str(value).strip()]
+                if data:
+                    self.cursor.executemany(insert_sql, data)
+                    inserted += len(data)
+
+            self.conn.commit()
+            self._notify_change(sheet_id)
+            logging.info(f"시트 {sheet_id}: {inserted}개 셀 스트리밍 삽입 완료")
+            return inserted
+
+        except Exception as e:
+            logging.error(f"시트 {sheet_id} 셀 스트리밍 삽입 오류: {e}")
+            self.conn.rollback()
+            raise
+
+    @writes
     def clear_sheet(self, sheet_id: int) -> None:
         """
         시트 내용 모두 지우기
@@ -580,19 +1044,27 @@ class DBHandlerV2:
         """
         try:
             self.cursor.execute("DELETE FROM cells WHERE sheet_id = ?", (sheet_id,))
+            self._drop_axis_order(sheet_id)
             self.conn.commit()
+            self._notify_change(sheet_id)
         except sqlite3.Error as e:
             logging.error(f"시트 내용 지우기 오류: {e}")
             self.conn.rollback()
             raise
 
+    @traced("db.update_cells", "db")
+    @writes
     def update_cells(self, sheet_id: int, cells_data: List[Tuple[int, int, str]]):
         """
         수정된 셀만 업데이트 (성능 최적화)
 
+        변경 목록을 임시 테이블에 한 번에 넣은 뒤 INSERT ... ON CONFLICT 한 번과
+        DELETE 한 번으로 반영합니다 (붙여넣기 등 대량 편집 시 셀별 SQL 실행 방지).
+        같은 셀이 여러 번 있으면 마지막 값이 적용됩니다.
+
         Args:
             sheet_id: 시트 ID
-            cells_data: (행, 열, 값) 튜플의 리스트
+            cells_data: (행, 열, 값) 튜플의 리스트 (빈 값은 삭제 - 희소 행렬 유지)
         """
         if not cells_data:
             return
@@ -601,25 +1073,46 @@ class DBHandlerV2:
             # 트랜잭션 시작
             self.conn.execute("BEGIN TRANSACTION")
 
-            for row, col, value in cells_data:
-                if value:  # 값이 있는 경우 - 저장/업데이트
-                    self.cursor.execute(
-                        """
-                        INSERT INTO cells (sheet_id, row, col, value)
-                        VALUES (?, ?, ?, ?)
-                        ON CONFLICT(sheet_id, row, col)
-                        DO UPDATE SET value = ?
-                        """,
-                        (sheet_id, row, col, value, value)
-                    )
-                else:  # 값이 비어있는 경우 - 삭제 (희소 행렬 유지)
-                    self.cursor.execute(
-                        "DELETE FROM cells WHERE sheet_id = ? AND row = ? AND col = ?",
-                        (sheet_id, row, col)
-                    )
+            self.cursor.execute(
+                """
+                CREATE TEMP TABLE IF NOT EXISTS cell_updates (
+                    row INTEGER NOT NULL,
+                    col INTEGER NOT NULL,
+                    value TEXT,
+                    PRIMARY KEY (row, col)
+                )
+                """
+            )
+            self.cursor.execute("DELETE FROM temp.cell_updates")
+            physical_cells = self._to_physical_many(sheet_id, [(row, col) for row, col, _ in cells_data], extend=True)
+            self.cursor.executemany(
+                "INSERT OR REPLACE INTO temp.cell_updates (row, col, value) VALUES (?, ?, ?)",
+                [(row, col, value if value else None) for (row, col), (_, _, value) in zip(physical_cells, cells_data)]
+            )
+
+            # 값이 있는 셀 - 저장/업데이트
+            self.cursor.execute(
+                """
+                INSERT INTO cells (sheet_id, row, col, value)
+                SELECT ?, row, col, value FROM temp.cell_updates WHERE value IS NOT NULL
+                ON CONFLICT(sheet_id, row, col) DO UPDATE SET value = excluded.value
+                """,
+                (sheet_id,)
+            )
+
+            # 값이 비어있는 셀 - 삭제
+            self.cursor.execute(
+                """
+                DELETE FROM cells
+                WHERE sheet_id = ? AND (row, col) IN (SELECT row, col FROM temp.cell_updates WHERE value IS NULL)
+                """,
+                (sheet_id,)
+            )
+            self.cursor.execute("DELETE FROM temp.cell_updates")
 
             # 트랜잭션 커밋
             self.conn.commit()
+            self._notify_change(sheet_id, {row for row, _, _ in cells_data})
 
         except Exception as e:
             # 오류 발생 시 롤백
@@ -639,19 +1132,80 @@ class DBHandlerV2:
             {열 번호: 값} 형태의 딕셔너리
         """
         try:
-            self.cursor.execute(
+            # 튜플 결과 커서 사용 (sqlite3.Row 생성 생략) - V3는 PK 범위 스캔, V2는 idx_cells_sheet_row 범위 스캔
+            row_order, col_order = self.get_axis_orders(sheet_id)
+            physical_row = row_order.to_physical(row) if row_order is not None else row
+            cursor = self.conn.cursor()
+            cursor.row_factory = None
+            cursor.execute(
                 "SELECT col, value FROM cells WHERE sheet_id = ? AND row = ? ORDER BY col",
-                (sheet_id, row)
+                (sheet_id, physical_row)
             )
 
             # 희소 행렬 방식으로 반환 (비어있는 셀은 딕셔너리에 포함되지 않음)
-            result = self.cursor.fetchall()
-            return {row['col']: row['value'] for row in result}
+            if col_order is None:
+                return dict(cursor.fetchall())
+            return {col_order.to_visual(col): value for col, value in cursor.fetchall()
+                    if col_order.to_visual(col) is not None}
 
         except Exception as e:
             logging.error(f"행 데이터 조회 오류 (sheet_id={sheet_id}, row={row}): {e}")
             return {}
 
+    @traced("db.get_rows_data", "db")
+    def get_rows_data(self, sheet_id: int, start_row: int, count: int) -> Dict[int, Dict[int, str]]:
+        """
+        연속된 행 구간 [start_row, start_row+count)을 한 번의 범위 쿼리로 가져오기 (그리드 블록 캐시용)
+
+        Returns:
+            {행 번호: {열 번호: 값}} - 셀이 없는 행은 포함되지 않음
+        """
+        rows: Dict[int, Dict[int, str]] = {}
+        if count <= 0:
+            return rows
+
+        try:
+            cursor = self.conn.cursor()
+            cursor.row_factory = None
+            row_order, col_order = self.get_axis_orders(sheet_id)
+
+            if row_order is None:
+                cursor.execute(
+                    "SELECT row, col, value FROM cells WHERE sheet_id = ? AND row >= ? AND row < ?",
+                    (sheet_id, start_row, start_row + count)
+                )
+                fetched = cursor.fetchall()
+            else:
+                # 논리 순서가 있으면 화면 구간의 물리 번호 목록으로 조회 (SQLite 변수 개수 제한 고려해 분할)
+                physicals = row_order.visual_range_physicals(start_row, count)
+                fetched = []
+                for i in range(0, len(physicals), 500):
+                    chunk = physicals[i:i + 500]
+                    cursor.execute(
+                        f"SELECT row, col, value FROM cells WHERE sheet_id = ? AND row IN ({','.join('?' * len(chunk))})",
+                        (sheet_id, *chunk)
+                    )
+                    fetched.extend(cursor.fetchall())
+                visual_of = {physical: start_row + i for i, physical in enumerate(physicals)}
+                fetched = [(visual_of[row], col, value) for row, col, value in fetched]
+
+            for row, col, value in fetched:
+                if col_order is not None:
+                    col = col_order.to_visual(col)
+                    if col is None:
+                        continue
+                row_data = rows.get(row)
+                if row_data is None:
+                    row_data = rows[row] = {}
+                row_data[col] = value
+            return rows
+
+        except Exception as e:
+            logging.error(f"행 구간 조회 오류 (sheet_id={sheet_id}, rows={start_row}~{start_row + count - 1}): {e}")
+            return {}
+
+    @traced("db.delete_rows_range", "db")
+    @writes
     def delete_rows_range(self, sheet_id: int, start_row: int, count: int) -> None:
         """
         지정된 범위의 행들을 삭제
@@ -667,16 +1221,12 @@ class DBHandlerV2:
 
             # 지정된 범위의 행들 삭제
             end_row = start_row + count - 1
-            self.cursor.execute(
-                "DELETE FROM cells WHERE sheet_id = ? AND row >= ? AND row <= ?",
-                (sheet_id, start_row, end_row)
-            )
-
-            deleted_count = self.cursor.rowcount
+            deleted_count = self._delete_axis_range(sheet_id, AXIS_ROW, start_row, count)
             logging.debug(f"시트 {sheet_id}: 행 {start_row}~{end_row} 삭제 완료 ({deleted_count}개 셀)")
 
             # 트랜잭션 커밋
             self.conn.commit()
+            self._notify_change(sheet_id)
 
         except sqlite3.Error as e:
             logging.error(f"행 삭제 오류 (sheet_id={sheet_id}, start_row={start_row}, count={count}): {e}")
@@ -687,6 +1237,8 @@ class DBHandlerV2:
             self.conn.rollback()
             raise
 
+    @traced("db.delete_columns_range", "db")
+    @writes
     def delete_columns_range(self, sheet_id: int, start_col: int, count: int) -> None:
         """
         지정된 범위의 열들을 삭제
@@ -702,16 +1254,12 @@ class DBHandlerV2:
 
             # 지정된 범위의 열들 삭제
             end_col = start_col + count - 1
-            self.cursor.execute(
-                "DELETE FROM cells WHERE sheet_id = ? AND col >= ? AND col <= ?",
-                (sheet_id, start_col, end_col)
-            )
-
-            deleted_count = self.cursor.rowcount
+            deleted_count = self._delete_axis_range(sheet_id, AXIS_COL, start_col, count)
             logging.debug(f"시트 {sheet_id}: 열 {start_col}~{end_col} 삭제 완료 ({deleted_count}개 셀)")
 
             # 트랜잭션 커밋
             self.conn.commit()
+            self._notify_change(sheet_id)
 
         except sqlite3.Error as e:
             logging.error(f"열 삭제 오류 (sheet_id={sheet_id}, start_col={start_col}, count={count}): {e}")
@@ -722,6 +1270,251 @@ class DBHandlerV2:
             self.conn.rollback()
             raise
 
+    # ------------------------------------------------------------------
+    # 행/열 논리 순서 (data_manager/axis_order.py)
+    # ------------------------------------------------------------------
+    def get_axis_order(self, sheet_id: int, axis: int) -> Optional[AxisOrder]:
+        """시트 축의 논리 순서 (없으면 None = 물리 번호가 곧 화면 인덱스)"""
+        self._sync_axis_cache()
+        return self._cached_axis_order(sheet_id, axis)
+
+    def get_axis_orders(self, sheet_id: int) -> Tuple[Optional[AxisOrder], Optional[AxisOrder]]:
+        """시트의 (행, 열) 논리 순서 - 캐시 유효성은 한 번만 확인 (셀 목록 일괄 변환용)"""
+        self._sync_axis_cache()
+        return self._cached_axis_order(sheet_id, AXIS_ROW), self._cached_axis_order(sheet_id, AXIS_COL)
+
+    def _sync_axis_cache(self):
+        """다른 연결(코드 생성 워커 등)이 커밋했으면 논리 순서 캐시 무효화"""
+        try:
+            data_version = self.conn.execute("PRAGMA data_version").fetchone()[0]
+        except sqlite3.Error:
+            data_version = None
+        if data_version != self._axis_data_version:
+            self._axis_orders.clear()
+            self._axis_data_version = data_version
+            self._axis_table = None
+
+    def _cached_axis_order(self, sheet_id: int, axis: int) -> Optional[AxisOrder]:
+        key = (sheet_id, axis)
+        if key not in self._axis_orders and not self._has_axis_table():
+            # 행/열 삽입·삭제를 한 번도 하지 않은 DB (이전 버전 DB 포함)
+            self._axis_orders[key] = None
+        if key not in self._axis_orders:
+            cursor = self.conn.cursor()
+            cursor.row_factory = None
+            try:
+                cursor.execute(
+                    "SELECT physical, ord FROM axis_order WHERE sheet_id = ? AND axis = ? ORDER BY ord",
+                    (sheet_id, axis)
+                )
+                rows = cursor.fetchall()
+            except sqlite3.OperationalError:
+                # 테이블 생성 트랜잭션이 롤백된 경우
+                self._axis_table = None
+                rows = []
+            self._axis_orders[key] = AxisOrder([r[0] for r in rows], [r[1] for r in rows]) if rows else None
+        return self._axis_orders[key]
+
+    def _has_axis_table(self) -> bool:
+        if self._axis_table is None:
+            self._axis_table = self.conn.execute(
+                "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'axis_order'").fetchone() is not None
+        return self._axis_table
+
+    def _ensure_axis_order(self, sheet_id: int, axis: int) -> AxisOrder:
+        """논리 순서가 없으면 현재 셀 범위로 초기 매핑 생성 (트랜잭션 안에서 호출)"""
+        order = self.get_axis_order(sheet_id, axis)
+        if order is None:
+            column = "row" if axis == AXIS_ROW else "col"
+            self.cursor.execute(f"SELECT MAX({column}) FROM cells WHERE sheet_id = ?", (sheet_id,))
+            max_index = self.cursor.fetchone()[0]
+            order = AxisOrder.identity(max_index + 1 if max_index is not None else 0)
+            self._save_axis_entries(sheet_id, axis, order.entries())
+            self._axis_orders[(sheet_id, axis)] = order
+        return order
+
+    def _execute_axis(self, sql: str, params=(), many: bool = False):
+        """axis_order 항목 삭제 - 테이블이 아직 없으면(논리 순서를 쓴 적 없는 DB) 생략"""
+        if not self._has_axis_table():
+            return
+        if many:
+            self.cursor.executemany(sql, params)
+        else:
+            self.cursor.execute(sql, params)
+
+    def _save_axis_entries(self, sheet_id: int, axis: int, entries: List[Tuple[int, float]]):
+        if entries:
+            if not self._has_axis_table():
+                # 처음 행/열 삽입·삭제할 때 생성 (사용하지 않는 DB에는 테이블을 만들지 않음)
+                self.cursor.execute(AXIS_ORDER_TABLE_SQL)
+                self._axis_table = True
+            self.cursor.executemany(
+                "INSERT OR REPLACE INTO axis_order (sheet_id, axis, physical, ord) VALUES (?, ?, ?, ?)",
+                [(sheet_id, axis, physical, ord_value) for physical, ord_value in entries]
+            )
+
+    def _drop_axis_order(self, sheet_id: int):
+        """시트의 논리 순서 항목 제거 (셀 좌표가 화면 좌표와 같아진 경우)"""
+        self._execute_axis("DELETE FROM axis_order WHERE sheet_id = ?", (sheet_id,))
+        self._forget_axis_orders(sheet_id)
+
+    def _forget_axis_orders(self, sheet_id: int):
+        self._axis_orders.pop((sheet_id, AXIS_ROW), None)
+        self._axis_orders.pop((sheet_id, AXIS_COL), None)
+
+    def _to_physical(self, sheet_id: int, row: int, col: int, extend: bool = False) -> Tuple[int, int]:
+        """
+        화면 좌표 → 물리 좌표
+
+        Args:
+            extend: 셀을 쓰는 경우 True - 매핑 범위 밖이면 매핑을 확장하여 물리 번호를 고정
+        """
+        return self._to_physical_many(sheet_id, [(row, col)], extend)[0]
+
+    def _to_physical_many(self, sheet_id: int, coords: List[Tuple[int, int]],
+                          extend: bool = False) -> List[Tuple[int, int]]:
+        """
+        화면 좌표 목록 → 물리 좌표 목록 (행/열 논리 순서는 한 번만 조회)
+
+        Args:
+            extend: 셀을 쓰는 경우 True - 매핑 범위 밖 좌표가 있으면 가장 큰 좌표까지 한 번에 확장
+        """
+        row_order, col_order = self.get_axis_orders(sheet_id)
+        if row_order is None and col_order is None:
+            return list(coords)
+
+        if extend and coords:
+            for axis, order in ((AXIS_ROW, row_order), (AXIS_COL, col_order)):
+                if order is not None:
+                    needed = max(coord[axis] for coord in coords) + 1
+                    if needed > len(order):
+                        self._save_axis_entries(sheet_id, axis, order.ensure_length(needed))
+
+        row_map = row_order.to_physical if row_order is not None else int
+        col_map = col_order.to_physical if col_order is not None else int
+        return [(row_map(row), col_map(col)) for row, col in coords]
+
+    def visual_cells(self, sheet_id: int) -> Optional[List[Tuple[int, int, str]]]:
+        """
+        논리 순서가 있는 시트의 (화면 행, 화면 열, 값) 목록 - (행, 열) 정렬
+
+        논리 순서가 없으면 None (호출자가 cells를 직접 순서대로 스캔)
+        """
+        row_order, col_order = self.get_axis_orders(sheet_id)
+        if row_order is None and col_order is None:
+            return None
+
+        cursor = self.conn.cursor()
+        cursor.row_factory = None
+        cursor.execute(
+            "SELECT row, col, value FROM cells WHERE sheet_id = ? AND value IS NOT NULL AND value != ''",
+            (sheet_id,)
+        )
+        cells = []
+        for row, col, value in cursor.fetchall():
+            if row_order is not None:
+                row = row_order.to_visual(row)
+            if col_order is not None:
+                col = col_order.to_visual(col)
+            if row is not None and col is not None:
+                cells.append((row, col, value))
+        cells.sort(key=lambda cell: (cell[0], cell[1]))
+        return cells
+
+    def _delete_axis_range(self, sheet_id: int, axis: int, start: int, count: int) -> int:
+        """화면 인덱스 구간의 셀 삭제 (행/열 자체는 유지) - 삭제된 셀 개수 반환"""
+        column = "row" if axis == AXIS_ROW else "col"
+        order = self.get_axis_order(sheet_id, axis)
+        if order is None:
+            self.cursor.execute(
+                f"DELETE FROM cells WHERE sheet_id = ? AND {column} >= ? AND {column} <= ?",
+                (sheet_id, start, start + count - 1)
+            )
+            return self.cursor.rowcount
+
+        physicals = order.visual_range_physicals(start, count)
+        self.cursor.executemany(
+            f"DELETE FROM cells WHERE sheet_id = ? AND {column} = ?",
+            [(sheet_id, physical) for physical in physicals]
+        )
+        return self.cursor.rowcount
+
+    def _shift_axis_order(self, sheet_id: int, axis: int, start: int, shift_amount: int) -> int:
+        """
+        shift_rows/shift_columns의 논리 순서 버전 - 셀은 건드리지 않고 순서 항목만 추가/삭제
+
+        양수: 화면 인덱스 start 위치에 빈 항목 삽입
+        음수: start 바로 앞의 |shift_amount|개 항목 제거 (그 위치에 남은 셀도 삭제 - 기존 동작과 동일)
+
+        Returns:
+            추가/삭제한 순서 항목 개수
+        """
+        order = self._ensure_axis_order(sheet_id, axis)
+
+        if shift_amount > 0:
+            entries, renormalized = order.insert(start, shift_amount)
+            if renormalized:
+                self._execute_axis("DELETE FROM axis_order WHERE sheet_id = ? AND axis = ?", (sheet_id, axis))
+                entries = order.entries()
+                logging.debug(f"시트 {sheet_id}: 논리 순서 간격 소진으로 재정렬 ({len(entries)}개 항목)")
+            self._save_axis_entries(sheet_id, axis, entries)
+            return len(entries)
+
+        remove_start = max(0, start + shift_amount)
+        removed = order.remove(remove_start, start - remove_start)
+        column = "row" if axis == AXIS_ROW else "col"
+        self.cursor.executemany(
+            f"DELETE FROM cells WHERE sheet_id = ? AND {column} = ?",
+            [(sheet_id, physical) for physical in removed]
+        )
+        self._execute_axis(
+            "DELETE FROM axis_order WHERE sheet_id = ? AND axis = ? AND physical = ?",
+            [(sheet_id, axis, physical) for physical in removed], many=True
+        )
+        return len(removed)
+
+    def _move_cells(self, sheet_id: int, axis: str, start: int, shift_amount: int) -> int:
+        """
+        start 이후 행/열의 셀을 shift_amount만큼 이동 (집합 연산 3회)
+
+        이동 대상을 임시 테이블로 복사 → 원본 삭제 → 이동된 좌표로 다시 삽입합니다.
+        PRIMARY KEY 충돌을 피하려고 행/열 번호별로 UPDATE를 반복하지 않습니다.
+        음수 좌표로 밀려나는 셀은 버립니다.
+
+        Args:
+            axis: 'row' 또는 'col'
+
+        Returns:
+            이동한 셀 개수
+        """
+        if axis not in ("row", "col"):
+            raise ValueError(f"잘못된 이동 축: {axis}")
+
+        self.cursor.execute(
+            "CREATE TEMP TABLE IF NOT EXISTS cell_moves (row INTEGER NOT NULL, col INTEGER NOT NULL, value TEXT)"
+        )
+        self.cursor.execute("DELETE FROM temp.cell_moves")
+
+        row_expr = "row + ?" if axis == "row" else "row"
+        col_expr = "col + ?" if axis == "col" else "col"
+        self.cursor.execute(
+            f"INSERT INTO temp.cell_moves (row, col, value) "
+            f"SELECT {row_expr}, {col_expr}, value FROM cells WHERE sheet_id = ? AND {axis} >= ?",
+            (shift_amount, sheet_id, start)
+        )
+        moved_count = self.cursor.rowcount
+
+        self.cursor.execute(f"DELETE FROM cells WHERE sheet_id = ? AND {axis} >= ?", (sheet_id, start))
+        self.cursor.execute(
+            f"INSERT OR REPLACE INTO cells (sheet_id, row, col, value) "
+            f"SELECT ?, row, col, value FROM temp.cell_moves WHERE {axis} >= 0 ORDER BY row, col",
+            (sheet_id,)
+        )
+        self.cursor.execute("DELETE FROM temp.cell_moves")
+        return moved_count
+
+    @traced("db.shift_rows", "db")
+    @writes
     def shift_rows(self, sheet_id: int, start_row: int, shift_amount: int) -> None:
         """
         지정된 행부터 모든 행을 위/아래로 이동 - 안전성 강화
@@ -731,56 +1524,23 @@ class DBHandlerV2:
             start_row: 이동 시작 행 번호
             shift_amount: 이동할 행 수 (양수: 아래로, 음수: 위로)
         """
+        if shift_amount == 0:
+            # 이동할 필요 없음
+            return
+
         try:
             # 트랜잭션 시작
             self.conn.execute("BEGIN TRANSACTION")
 
-            if shift_amount == 0:
-                # 이동할 필요 없음
-                self.conn.commit()
-                return
-
-            # 이동 전 영향받는 셀 수 확인
-            self.cursor.execute("""
-                SELECT COUNT(*) FROM cells
-                WHERE sheet_id = ? AND row >= ?
-            """, (sheet_id, start_row))
-            cells_to_move = self.cursor.fetchone()[0]
-
-            logging.debug(f"시트 {sheet_id}: 행 {start_row}부터 {shift_amount}만큼 이동 예정 ({cells_to_move}개 셀)")
-
-            if shift_amount > 0:
-                # 아래로 이동 (행 삽입 시): 간단한 방법 사용
-                # 큰 행 번호부터 역순으로 처리하여 충돌 방지
-                self.cursor.execute("""
-                    SELECT DISTINCT row FROM cells
-                    WHERE sheet_id = ? AND row >= ?
-                    ORDER BY row DESC
-                """, (sheet_id, start_row))
-
-                rows_to_move = [row[0] for row in self.cursor.fetchall()]
-
-                # 큰 행 번호부터 역순으로 이동
-                for row in rows_to_move:
-                    self.cursor.execute("""
-                        UPDATE cells
-                        SET row = row + ?
-                        WHERE sheet_id = ? AND row = ?
-                    """, (shift_amount, sheet_id, row))
-
-            elif shift_amount < 0:
-                # 위로 이동 (행 삭제 시): 직접 이동 (음수 이동이므로 충돌 없음)
-                self.cursor.execute("""
-                    UPDATE cells
-                    SET row = row + ?
-                    WHERE sheet_id = ? AND row >= ?
-                """, (shift_amount, sheet_id, start_row))
-
-            affected_count = self.cursor.rowcount
-            logging.debug(f"시트 {sheet_id}: 행 이동 완료 ({affected_count}개 셀 이동)")
+            if USE_AXIS_ORDER_INDIRECTION:
+                affected_count = self._shift_axis_order(sheet_id, AXIS_ROW, start_row, shift_amount)
+            else:
+                affected_count = self._move_cells(sheet_id, "row", start_row, shift_amount)
+            logging.debug(f"시트 {sheet_id}: 행 {start_row}부터 {shift_amount}만큼 이동 완료 ({affected_count}개 항목 갱신)")
 
             # 트랜잭션 커밋
             self.conn.commit()
+            self._notify_change(sheet_id)
 
         except sqlite3.Error as e:
             logging.error(f"행 이동 오류 (sheet_id={sheet_id}, start_row={start_row}, shift={shift_amount}): {e}")
@@ -791,6 +1551,8 @@ class DBHandlerV2:
             self.conn.rollback()
             raise
 
+    @traced("db.shift_columns", "db")
+    @writes
     def shift_columns(self, sheet_id: int, start_col: int, shift_amount: int) -> None:
         """
         지정된 열부터 모든 열을 좌/우로 이동 - 안전성 강화
@@ -800,56 +1562,23 @@ class DBHandlerV2:
             start_col: 이동 시작 열 번호
             shift_amount: 이동할 열 수 (양수: 오른쪽으로, 음수: 왼쪽으로)
         """
+        if shift_amount == 0:
+            # 이동할 필요 없음
+            return
+
         try:
             # 트랜잭션 시작
             self.conn.execute("BEGIN TRANSACTION")
 
-            if shift_amount == 0:
-                # 이동할 필요 없음
-                self.conn.commit()
-                return
-
-            # 이동 전 영향받는 셀 수 확인
-            self.cursor.execute("""
-                SELECT COUNT(*) FROM cells
-                WHERE sheet_id = ? AND col >= ?
-            """, (sheet_id, start_col))
-            cells_to_move = self.cursor.fetchone()[0]
-
-            logging.debug(f"시트 {sheet_id}: 열 {start_col}부터 {shift_amount}만큼 이동 예정 ({cells_to_move}개 셀)")
-
-            if shift_amount > 0:
-                # 오른쪽으로 이동 (열 삽입 시): 간단한 방법 사용
-                # 큰 열 번호부터 역순으로 처리하여 충돌 방지
-                self.cursor.execute("""
-                    SELECT DISTINCT col FROM cells
-                    WHERE sheet_id = ? AND col >= ?
-                    ORDER BY col DESC
-                """, (sheet_id, start_col))
-
-                cols_to_move = [col[0] for col in self.cursor.fetchall()]
-
-                # 큰 열 번호부터 역순으로 이동
-                for col in cols_to_move:
-                    self.cursor.execute("""
-                        UPDATE cells
-                        SET col = col + ?
-                        WHERE sheet_id = ? AND col = ?
-                    """, (shift_amount, sheet_id, col))
-
-            elif shift_amount < 0:
-                # 왼쪽으로 이동 (열 삭제 시): 직접 이동 (음수 이동이므로 충돌 없음)
-                self.cursor.execute("""
-                    UPDATE cells
-                    SET col = col + ?
-                    WHERE sheet_id = ? AND col >= ?
-                """, (shift_amount, sheet_id, start_col))
-
-            affected_count = self.cursor.rowcount
-            logging.debug(f"시트 {sheet_id}: 열 이동 완료 ({affected_count}개 셀 이동)")
+            if USE_AXIS_ORDER_INDIRECTION:
+                affected_count = self._shift_axis_order(sheet_id, AXIS_COL, start_col, shift_amount)
+            else:
+                affected_count = self._move_cells(sheet_id, "col", start_col, shift_amount)
+            logging.debug(f"시트 {sheet_id}: 열 {start_col}부터 {shift_amount}만큼 이동 완료 ({affected_count}개 항목 갱신)")
 
             # 트랜잭션 커밋
             self.conn.commit()
+            self._notify_change(sheet_id)
 
         except sqlite3.Error as e:
             logging.error(f"열 이동 오류 (sheet_id={sheet_id}, start_col={start_col}, shift={shift_amount}): {e}")
@@ -860,6 +1589,7 @@ class DBHandlerV2:
             self.conn.rollback()
             raise
 
+    @writes
     def update_sheet_order(self, sheet_id: int, new_order: int):
         """
         시트 순서 업데이트
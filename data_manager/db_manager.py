@@ -1,16 +1,78 @@
 import os
+import time
 import logging
-from typing import Dict, List, Optional, Any
+import threading
+from typing import Callable, Dict, List, Optional, Any
 from data_manager.db_handler_v2 import DBHandlerV2
+from data_manager.db_catalog import DBCatalog
+from data_manager.symbol_index import SymbolIndex
 
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import (
+        DB_LAZY_OPEN, DB_MAX_OPEN_CONNECTIONS, DB_IDLE_RELEASE_SEC, DB_CACHE_BUDGET_MB, DB_MMAP_BUDGET_MB,
+        USE_SYMBOL_INDEX
+    )
+except ImportError:
+    DB_LAZY_OPEN = True
+    DB_MAX_OPEN_CONNECTIONS = 4
+    DB_IDLE_RELEASE_SEC = 300
+    DB_CACHE_BUDGET_MB = 256
+    DB_MMAP_BUDGET_MB = 512
+    USE_SYMBOL_INDEX = True
 
-class DBManager:
-    """다중 데이터베이스 관리 클래스"""
+# 연결 예산 분배 시 연결 하나에 최소로 주는 페이지 캐시 (KiB)
+_MIN_CACHE_KIB = 2048
+
+# 방금 사용한 연결은 예산 초과여도 닫지 않음 (같은 작업 중 재연결 반복 방지)
+_RELEASE_GRACE_SEC = 2.0
+
+_SQLITE_HEADER = b"SQLite format 3\x00"
+
+# DB를 닫기(제거) 직전에 호출할 콜백 (DB 파일 경로를 인자로 받음, 다른 모듈이 연 전용 연결 정리용)
+_close_listeners: List[Callable[[str], None]] = []
+
+
+def add_close_listener(callback: Callable[[str], None]):
+    """DB 제거/전체 연결 해제 시 호출할 콜백 등록 (예: CSV 히스토리 기록기의 조회 연결 닫기)"""
+    if callback not in _close_listeners:
+        _close_listeners.append(callback)
 
-    def __init__(self):
+
+def _notify_closing(db_file: Optional[str]):
+    if not db_file:
+        return
+    for callback in list(_close_listeners):
+        try:
+            callback(db_file)
+        except Exception as e:
+            logging.warning(f"⚠ DB 닫기 콜백 오류 ({os.path.basename(db_file)}): {e}")
+
+
+class DBManager:
+    """
+    다중 데이터베이스 관리 클래스
+
+    - 지연 연결 (DB_LAZY_OPEN): DB를 추가할 때는 핸들러만 만들고, 첫 사용 시 조회 전용 연결로 엶
+      (셀 편집 등 변경 작업 시 쓰기 가능 연결로 자동 전환)
+    - 연결 예산: 열린 연결 수를 DB_MAX_OPEN_CONNECTIONS 이하로 유지 (오래 사용하지 않은 DB부터 닫음,
+      현재 DB 제외)하고, 페이지 캐시/메모리 맵 한도를 열린 연결끼리 나눠 씀 (현재 DB는 2배 몫)
+    - 시트 목록: 열리지 않은 DB는 카탈로그(DBCatalog)에서 가져옴 (파일이 바뀐 경우에만 DB를 엶)
+    - 심볼 색인 (USE_SYMBOL_INDEX): 관리 중인 DB 전체의 심볼 → 정의 위치 (SymbolIndex, 셀 변경 시 증분 갱신)
+    """
+
+    def __init__(self, lazy: bool = DB_LAZY_OPEN, max_open: int = DB_MAX_OPEN_CONNECTIONS,
+                 catalog: Optional[DBCatalog] = None, symbol_index: Optional[SymbolIndex] = None):
         """DBManager 초기화"""
         self.databases: Dict[str, DBHandlerV2] = {}  # {db_name: DBHandlerV2}
         self.current_db_name: Optional[str] = None
+        self.lazy = lazy
+        self.max_open = max(1, int(max_open))
+        self.catalog = catalog or DBCatalog()
+        # 색인 파일은 첫 조회/갱신 때 열림
+        self.symbol_index = symbol_index or (SymbolIndex() if USE_SYMBOL_INDEX else None)
+        # 연결 해제/예산 조정은 DBManager를 만든 스레드(GUI)에서만 수행 (다른 스레드가 쓰는 연결 보호)
+        self._owner_thread = threading.current_thread()
 
     def add_database(self, db_file_path: str, replace_existing: bool = False) -> str:
         """
@@ -41,10 +103,16 @@ class DBManager:
             counter += 1
 
         try:
-            # V2 DB 핸들러로 직접 연결
-            logging.info(f"V2 데이터베이스 연결: {db_file_path}")
-            db_handler = DBHandlerV2(db_file_path)
-            self.databases[db_name] = db_handler
+            if self.lazy:
+                # 지연 연결: 파일 형식만 확인하고 첫 사용 시 조회 전용으로 연결
+                self._check_sqlite_file(db_file_path)
+                logging.info(f"V2 데이터베이스 등록 (지연 연결): {db_file_path}")
+                db_handler = DBHandlerV2(db_file_path, lazy=True, read_only=True)
+            else:
+                # V2 DB 핸들러로 직접 연결
+                logging.info(f"V2 데이터베이스 연결: {db_file_path}")
+                db_handler = DBHandlerV2(db_file_path)
+            self._register(db_name, db_handler)
 
             # 첫 번째 DB이거나 대체 모드면 현재 DB로 설정
             if self.current_db_name is None or replace_existing:
@@ -89,10 +157,11 @@ class DBManager:
             counter += 1
 
         try:
-            # V2 DB 핸들러로 새 DB 생성 및 연결
+            # V2 DB 핸들러로 새 DB 생성 및 연결 (쓰기 가능 연결, 이후 유휴 시 해제 가능)
             logging.info(f"V2 새 데이터베이스 생성: {db_file_path}")
-            db_handler = DBHandlerV2(db_file_path)  # DBHandlerV2는 파일이 없으면 자동 생성
-            self.databases[db_name] = db_handler
+            db_handler = DBHandlerV2(db_file_path, lazy=self.lazy)  # DBHandlerV2는 파일이 없으면 자동 생성
+            self._register(db_name, db_handler)
+            db_handler.ensure_writable()
 
             # 첫 번째 DB이거나 대체 모드면 현재 DB로 설정
             if self.current_db_name is None or replace_existing:
@@ -174,6 +243,7 @@ class DBManager:
 
         self.current_db_name = db_name
         logging.info(f"Switched to database: {db_name}")
+        self._apply_connection_budget()
         return True
 
     def remove_database(self, db_name: str) -> bool:
@@ -193,7 +263,11 @@ class DBManager:
             # DB 연결 해제
             db_handler = self.databases[db_name]
             if db_handler:
+                _notify_closing(db_handler.db_file)
+                index_in_sync = self._symbol_index_in_sync(db_handler)
                 db_handler.disconnect()
+                if index_in_sync:
+                    self.symbol_index.mark_clean(db_handler.db_file)
                 logging.info(f"Database disconnected: {db_name}")
 
             # DB 목록에서 제거
@@ -255,37 +329,245 @@ class DBManager:
         """모든 데이터베이스 연결 해제"""
         for db_name, db_handler in self.databases.items():
             try:
+                # 열려 있던 DB는 닫은 뒤의 파일 서명으로 시트 목록 기록 (다음 실행 시 열지 않고 표시)
+                sheets = db_handler.get_sheets() if db_handler.is_open and db_handler.db_file else None
+                _notify_closing(db_handler.db_file)
+                index_in_sync = self._symbol_index_in_sync(db_handler)
                 db_handler.disconnect()
+                if sheets is not None:
+                    self.catalog.put(db_handler.db_file, sheets)
+                if index_in_sync:
+                    self.symbol_index.mark_clean(db_handler.db_file)
                 logging.info(f"Database disconnected: {db_name}")
             except Exception as e:
                 logging.error(f"Failed to disconnect database {db_name}: {e}")
 
         self.databases.clear()
         self.current_db_name = None
+        self.catalog.save()
         logging.info("All databases disconnected")
 
     def has_databases(self) -> bool:
         """데이터베이스가 하나 이상 열려있는지 확인"""
         return len(self.databases) > 0
 
+    def get_sheets_info(self, db_name: str) -> List[Dict[str, Any]]:
+        """
+        DB 하나의 시트 목록 (열린 DB는 직접 조회, 열리지 않은 DB는 카탈로그 - 파일이 바뀐 경우에만 엶)
+
+        Returns:
+            get_sheets 형식의 시트 목록 사본 (호출자가 수정해도 됨)
+        """
+        db_handler = self.databases.get(db_name)
+        if db_handler is None:
+            return []
+
+        try:
+            was_open = db_handler.is_open
+            if not was_open and db_handler.db_file:
+                cached = self.catalog.get(db_handler.db_file)
+                if cached is not None:
+                    return cached
+            sheets = db_handler.get_sheets()
+            if db_handler.db_file:
+                if not was_open and db_name != self.current_db_name:
+                    # 목록만 읽으려고 연 연결은 바로 닫음 (닫은 뒤 서명으로 카탈로그 기록)
+                    self._release(db_handler)
+                else:
+                    self.catalog.put(db_handler.db_file, sheets)
+                self.catalog.save()
+            return [dict(sheet) for sheet in sheets]
+        except Exception as e:
+            logging.error(f"Failed to get sheets from database {db_name}: {e}")
+            return []
+
     def get_all_sheets_info(self) -> Dict[str, List[Dict[str, Any]]]:
         """
-        모든 DB의 시트 정보 반환 (V2 방식)
+        모든 DB의 시트 정보 반환 (V2 방식, 열리지 않은 DB는 카탈로그 사용)
 
         Returns:
             {db_name: [sheet_info, ...], ...}
         """
-        all_sheets = {}
+        return {db_name: self.get_sheets_info(db_name) for db_name in list(self.databases)}
+
+    # ------------------------------------------------------------------
+    # 연결 예산 (지연 연결 핸들러)
+    # ------------------------------------------------------------------
+    @staticmethod
+    def _check_sqlite_file(db_file_path: str):
+        """연결하지 않고 SQLite 파일인지 확인 (빈 파일은 새 DB로 취급)"""
+        with open(db_file_path, 'rb') as f:
+            header = f.read(len(_SQLITE_HEADER))
+        if header and header != _SQLITE_HEADER:
+            raise ValueError(f"SQLite 데이터베이스 파일이 아닙니다: {db_file_path}")
+
+    def _register(self, db_name: str, db_handler: DBHandlerV2):
+        db_handler.open_listener = self._on_connection_opened
+        if self.symbol_index is not None:
+            db_handler.change_listener = self.symbol_index.record_change
+        self.databases[db_name] = db_handler
+        self._apply_connection_budget()
+
+    def _on_connection_opened(self, db_handler: DBHandlerV2):
+        self._apply_connection_budget(keep=db_handler)
+
+    def get_open_count(self) -> int:
+        """현재 연결이 열려 있는 DB 개수"""
+        return sum(1 for db_handler in self.databases.values() if db_handler.is_open)
+
+    def _apply_connection_budget(self, keep: Optional[DBHandlerV2] = None):
+        """
+        열린 연결 수 제한 + 페이지 캐시/메모리 맵 한도 분배
 
-        for db_name, db_handler in self.databases.items():
+        Args:
+            keep: 방금 연결된 핸들러 (닫기 대상에서 제외)
+        """
+        if threading.current_thread() is not self._owner_thread:
+            return
+
+        current = self.databases.get(self.current_db_name) if self.current_db_name else None
+        opened = [h for h in self.databases.values() if h.is_open]
+
+        if len(opened) > self.max_open:
+            now = time.monotonic()
+            candidates = sorted(
+                (h for h in opened if h is not current and h is not keep
+                 and now - h.last_used >= _RELEASE_GRACE_SEC and h.can_release()),
+                key=lambda h: h.last_used)
+            for db_handler in candidates[:len(opened) - self.max_open]:
+                if self._release(db_handler):
+                    opened.remove(db_handler)
+            self.catalog.save()
+
+        # 현재 DB는 2배 몫 (조회/편집이 집중되므로), 아직 열리지 않은 핸들러는 다음 연결 시 적용
+        weights = {id(h): 2 if h is current else 1 for h in opened}
+        total_weight = sum(weights.values()) or 1
+        cache_kib = DB_CACHE_BUDGET_MB * 1024
+        mmap_bytes = DB_MMAP_BUDGET_MB * 1024 * 1024
+        for db_handler in self.databases.values():
+            weight = weights.get(id(db_handler), 1)
+            db_handler.set_memory_limits(max(_MIN_CACHE_KIB, cache_kib * weight // total_weight),
+                                         mmap_bytes * weight // total_weight)
+
+    def _release(self, db_handler: DBHandlerV2) -> bool:
+        """연결 닫기 - 시트 목록은 카탈로그에 남겨 다시 열지 않고 표시"""
+        if not db_handler.can_release():
+            return False
+        sheets = None
+        if db_handler.db_file:
             try:
-                # V2 방식: 직접 모든 시트 조회
-                sheets_list = db_handler.get_sheets()
-                all_sheets[db_name] = sheets_list
-
+                sheets = db_handler.get_sheets()
             except Exception as e:
-                logging.error(f"Failed to get sheets from database {db_name}: {e}")
-                all_sheets[db_name] = []
+                logging.debug(f"카탈로그 기록용 시트 조회 실패 ({db_handler.db_file}): {e}")
+        index_in_sync = self._symbol_index_in_sync(db_handler)
+        if not db_handler.release():
+            return False
+        if sheets is not None:
+            # 닫을 때 WAL이 정리되어 파일 서명이 바뀌므로 닫은 뒤의 서명으로 기록
+            self.catalog.put(db_handler.db_file, sheets)
+        if index_in_sync:
+            self.symbol_index.mark_clean(db_handler.db_file)
+        return True
 
-        return all_sheets
+    def release_idle_connections(self, idle_sec: float = DB_IDLE_RELEASE_SEC) -> int:
+        """
+        idle_sec 이상 사용하지 않은 DB 연결 닫기 (현재 DB 제외, 다시 사용하면 자동 재연결)
 
+        Returns:
+            닫은 연결 수
+        """
+        if threading.current_thread() is not self._owner_thread:
+            return 0
+        current = self.databases.get(self.current_db_name) if self.current_db_name else None
+        now = time.monotonic()
+        released = 0
+        for db_handler in list(self.databases.values()):
+            if db_handler is current or not db_handler.is_open or now - db_handler.last_used < idle_sec:
+                continue
+            if self._release(db_handler):
+                released += 1
+        if released:
+            self.catalog.save()
+            self._apply_connection_budget()
+        return released
+
+    # ------------------------------------------------------------------
+    # 심볼 색인 (data_manager/symbol_index.py)
+    # ------------------------------------------------------------------
+    def _symbol_index_in_sync(self, db_handler: DBHandlerV2) -> bool:
+        """닫기 전 색인이 DB와 일치하는지 (일치하면 닫은 뒤의 파일 서명으로 갱신 - 다음 실행에서 재색인 방지)"""
+        index = self.symbol_index
+        if index is None or not db_handler.db_file or not index.is_verified(db_handler.db_file):
+            return False
+        try:
+            return index.is_current(db_handler.db_file)
+        except Exception as e:
+            logging.debug(f"심볼 색인 상태 확인 실패 ({db_handler.db_file}): {e}")
+            return False
+
+    def refresh_symbol_index(self) -> Optional[SymbolIndex]:
+        """
+        관리 중인 모든 DB의 심볼 색인을 최신 상태로 (기록된 변경/바뀐 파일만 읽음)
+
+        색인하려고 새로 연 연결은 바로 닫습니다 (현재 DB 제외).
+
+        Returns:
+            SymbolIndex (USE_SYMBOL_INDEX가 꺼져 있으면 None)
+        """
+        index = self.symbol_index
+        if index is None:
+            return None
+
+        released = False
+        for db_name, db_handler in list(self.databases.items()):
+            if not db_handler.db_file or not index.needs_refresh(db_handler.db_file):
+                continue
+            was_open = db_handler.is_open
+            try:
+                if index.refresh(db_handler):
+                    logging.info(f"심볼 색인 재구성: {db_name}")
+            except Exception as e:
+                logging.error(f"❌ 심볼 색인 갱신 실패 ({db_name}): {e}")
+            if not was_open and db_name != self.current_db_name:
+                released = self._release(db_handler) or released
+        if released:
+            self.catalog.save()
+        return index
+
+    def _symbol_db_files(self, db_names: Optional[List[str]] = None) -> List[str]:
+        names = self.databases if db_names is None else db_names
+        return [self.databases[name].db_file for name in names
+                if name in self.databases and self.databases[name].db_file]
+
+    def _with_db_names(self, entries: List[Dict[str, Any]]) -> List[Dict[str, Any]]:
+        """색인 항목에 db_name (DBManager 키) 추가"""
+        from data_manager.symbol_index import db_key
+        names = {db_key(db_handler.db_file): db_name for db_name, db_handler in self.databases.items()
+                 if db_handler.db_file}
+        for entry in entries:
+            entry['db_name'] = names.get(entry['db_key'], os.path.basename(entry['db_key']))
+        return entries
+
+    def find_symbol(self, name: str, db_names: Optional[List[str]] = None) -> List[Dict[str, Any]]:
+        """심볼 이름이 정확히 같은 정의 위치 목록 (관리 중인 DB 전체 또는 db_names)"""
+        index = self.refresh_symbol_index()
+        if index is None:
+            return []
+        return self._with_db_names(index.lookup(name, self._symbol_db_files(db_names)))
+
+    def search_symbols(self, text: str, limit: int = 500) -> List[Dict[str, Any]]:
+        """이름에 text가 포함된 심볼 정의 검색 (관리 중인 DB 전체)"""
+        index = self.refresh_symbol_index()
+        if index is None:
+            return []
+        return self._with_db_names(index.search(text, self._symbol_db_files(), limit))
+
+    def find_duplicate_symbols(self, db_names: Optional[List[str]] = None) -> Dict[str, List[Dict[str, Any]]]:
+        """충돌하는 중복 정의 {심볼 이름: 정의 위치 목록} (DB 간 중복 포함)"""
+        index = self.refresh_symbol_index()
+        if index is None:
+            return {}
+        duplicates = index.duplicates(self._symbol_db_files(db_names))
+        for entries in duplicates.values():
+            self._with_db_names(entries)
+        return duplicates
@@ -0,0 +1,504 @@
+"""
+DB 간 심볼 역색인 (심볼 이름 → DB/시트/행/OpCode/타입/프로젝트 정의)
+
+CalList 시트($ 시트, FileInfo 제외)에서 심볼을 정의하는 행($DEFINE, $TYPEDEF, $STR_DEF, $ENUM_MEM,
+$ARRAY, $VARIABLE)과 프로젝트 분기 행($PRJT_DEF)을 사용자 캐시 디렉토리의 SQLite 파일에 보관합니다.
+이름 인덱스로 조회하므로 코드 생성이나 generated_output 검색 없이 모든 DB에서 정의 위치를 찾고,
+중복 정의를 시트 전체 스캔 없이 확인할 수 있습니다.
+
+- 색인 규칙은 CalList(ChkCalListPos/readRow)와 같음: 머리글 행에서 OpCode/Keyword/Type/Name/Value/Description
+  열을 찾고, 이름은 Name 열($ENUM_MEM은 Name+1 열), 프로젝트 정의는 Name+PrjtDefCol / Name+PrjtNameCol 열
+- 셀 변경(DBHandlerV2.change_listener)은 메모리에 행 번호만 기록하고, 조회 직전에 바뀐 행만 다시 읽어 반영
+  (머리글/$PRJT_DEF 행이 바뀌었거나 행 삽입·삭제 등 구조 변경이면 해당 시트만 다시 색인)
+- DB 파일 서명(크기/수정 시각, -wal 포함)이 마지막 기록과 다르면 (외부 편집, Git 체크아웃) 그 DB 전체를 다시 색인
+
+사용 예:
+    index = SymbolIndex()
+    db_handler.change_listener = index.record_change
+    index.refresh(db_handler)
+    entries = index.lookup("CcCal_Kp")
+    conflicts = index.duplicates([db_handler.db_file])
+"""
+
+import os
+import json
+import sqlite3
+import logging
+from typing import Dict, List, Optional, Set
+
+from core.info import Info
+from core.sheet_view import SheetView
+from core.tracing import tracer, traced
+from data_manager.db_catalog import file_signature
+
+INDEX_FILE_NAME = "symbol_index.db"
+SCHEMA_VERSION = 1
+
+PRJT_OPCODE = "$PRJT_DEF"
+
+# 심볼을 정의하는 OpCode → Name 열 기준 이름 열 오프셋 (CalList.readRow와 같은 열)
+SYMBOL_OPCODES = {
+    "$DEFINE": 0,
+    "$TYPEDEF": 0,
+    "$STR_DEF": 0,
+    "$ENUM_MEM": 1,
+    "$ARRAY": 0,
+    "$VARIABLE": 0,
+}
+
+# CalList 머리글 항목 (CalList.dItem 키와 같음)
+ITEM_TITLES = ("OpCode", "Keyword", "Type", "Name", "Value", "Description")
+
+# 한 번에 이보다 많은 행이 바뀌면 행 단위 대신 시트 전체를 다시 색인 (SQLite 변수 개수 제한 이하)
+ROW_UPDATE_LIMIT = 500
+
+_SCHEMA = (
+    "CREATE TABLE IF NOT EXISTS files (db_key TEXT PRIMARY KEY, signature TEXT NOT NULL)",
+    """CREATE TABLE IF NOT EXISTS sheets (
+        db_key TEXT NOT NULL, sheet_id INTEGER NOT NULL, sheet_name TEXT NOT NULL, layout TEXT,
+        PRIMARY KEY (db_key, sheet_id)
+    ) WITHOUT ROWID""",
+    """CREATE TABLE IF NOT EXISTS symbols (
+        db_key TEXT NOT NULL, sheet_id INTEGER NOT NULL, row INTEGER NOT NULL,
+        opcode TEXT NOT NULL, keyword TEXT, type TEXT, name TEXT NOT NULL, value TEXT, prjt TEXT NOT NULL,
+        PRIMARY KEY (db_key, sheet_id, row)
+    ) WITHOUT ROWID""",
+    "CREATE INDEX IF NOT EXISTS idx_symbols_name ON symbols (name)",
+)
+
+_ENTRY_COLUMNS = "db_key, sheet_id, row, opcode, keyword, type, name, value, prjt"
+
+
+def default_index_path() -> str:
+    """색인 파일 경로 (시트 IR 캐시와 같은 사용자 캐시 디렉토리)"""
+    from code_generator.sheet_ir_cache import default_cache_dir
+    return os.path.join(default_cache_dir(), INDEX_FILE_NAME)
+
+
+def db_key(db_file: str) -> str:
+    return os.path.normcase(os.path.abspath(db_file))
+
+
+def is_cal_list_sheet(sheet_info: Dict) -> bool:
+    """코드 생성 대상 CalList 시트 여부 ($ 시트 중 FileInfo 제외)"""
+    name = sheet_info.get('name', '')
+    is_dollar = sheet_info.get('is_dollar_sheet') or name.startswith(Info.ReadingXlsRule)
+    return bool(is_dollar) and Info.FileInfoShtName not in name
+
+
+def find_layout(view: SheetView) -> Optional[Dict[str, int]]:
+    """
+    머리글 행과 항목 열 위치 (CalList.ChkCalListPos와 같은 탐색)
+
+    Returns:
+        {'header_row', 'OpCode', 'Keyword', 'Type', 'Name', 'Value', 'Description'} 또는 None (머리글 없음/불완전)
+    """
+    read = view.read
+    for row in range(1, view.row_count):
+        found = {}
+        for col in range(1, view.col_count):
+            cell = read(row, col)
+            if cell in ITEM_TITLES and cell not in found:
+                found[cell] = col
+                if len(found) == len(ITEM_TITLES):
+                    break
+        if found:
+            if len(found) < len(ITEM_TITLES):
+                return None
+            found['header_row'] = row
+            return found
+    return None
+
+
+def parse_row(read, row: int, layout: Dict[str, int]):
+    """
+    한 행을 색인 항목으로 변환
+
+    Returns:
+        (opcode, keyword, type, name, value) 또는 None (심볼/프로젝트 정의 행이 아님)
+    """
+    opcode = read(row, layout['OpCode'])
+    name_col = layout['Name']
+
+    if opcode == PRJT_OPCODE:
+        def_col = name_col + Info.PrjtDefCol
+        val_col = name_col + Info.PrjtNameCol
+        prjt_def, prjt_val = read(row, def_col), read(row, val_col)
+        if not prjt_def and not prjt_val:
+            prjt_def, prjt_val = read(row, def_col + 1), read(row, val_col + 1)
+        if not prjt_def:
+            return None
+        return opcode, "", "", prjt_def, prjt_val
+
+    offset = SYMBOL_OPCODES.get(opcode)
+    if offset is None:
+        return None
+    name = read(row, name_col + offset)
+    if not name:
+        return None
+    return opcode, read(row, layout['Keyword']), read(row, layout['Type']), name, read(row, layout['Value'])
+
+
+def _row_reader(row_cells: Dict[int, str]):
+    """get_row_data 결과를 SheetView.read와 같은 정규화로 읽는 함수"""
+    def read(_row, col):
+        value = row_cells.get(col)
+        return "" if value is None else str(value).strip()
+    return read
+
+
+class ProjectScope:
+    """$PRJT_DEF 행으로 열리고 닫히는 프로젝트 분기 (CalList.chkCalList의 prjtList 깊이 규칙)"""
+
+    def __init__(self):
+        self.stack: List[List[str]] = []  # [[define, 값], ...]
+
+    def apply(self, prjt_def: str, prjt_val: str):
+        for depth in range(len(self.stack) - 1, -1, -1):
+            if self.stack[depth][0] == prjt_def:
+                # 같은 define의 다른 분기 (#elif / DEFAULT) 또는 END로 닫기 - 안쪽 분기는 함께 닫힘
+                del self.stack[depth + 1:]
+                if prjt_val == Info.EndPrjtName:
+                    self.stack.pop()
+                else:
+                    self.stack[depth][1] = prjt_val
+                return
+        if prjt_val != Info.EndPrjtName:
+            self.stack.append([prjt_def, prjt_val])
+
+    def key(self) -> str:
+        """심볼이 속한 분기 문자열 (분기 밖이면 빈 문자열)"""
+        return " / ".join(f"{prjt_def}={prjt_val}" for prjt_def, prjt_val in self.stack)
+
+
+def conflicts(entries: List[Dict]) -> bool:
+    """
+    같은 이름의 정의 목록이 충돌하는지 (같은 분기에 둘 이상, 또는 분기 밖 정의가 다른 정의와 함께 있음)
+    서로 다른 분기(#if A / #elif B)에 하나씩 있는 것은 정상
+    """
+    scopes = [entry['prjt'] for entry in entries]
+    return len(set(scopes)) < len(scopes) or ("" in scopes and len(scopes) > 1)
+
+
+class SymbolIndex:
+    """심볼 역색인 (DBManager 소유 스레드에서만 사용)"""
+
+    def __init__(self, path: Optional[str] = None):
+        self.path = path or default_index_path()
+        self._conn: Optional[sqlite3.Connection] = None
+        # {db_key: [db_handler, {sheet_id: 바뀐 행 집합 또는 None(시트 전체)} 또는 None(DB 전체)]}
+        self._pending: Dict[str, list] = {}
+        # 이번 실행에서 색인이 파일과 일치함을 확인한 DB (이후 변경은 모두 record_change로 들어옴)
+        self._verified: Set[str] = set()
+
+    # ------------------------------------------------------------------
+    # 저장소
+    # ------------------------------------------------------------------
+
+    @property
+    def conn(self) -> sqlite3.Connection:
+        if self._conn is None:
+            self._conn = self._open()
+        return self._conn
+
+    def _open(self) -> sqlite3.Connection:
+        try:
+            os.makedirs(os.path.dirname(self.path), exist_ok=True)
+            conn = sqlite3.connect(self.path)
+            version = conn.execute("PRAGMA user_version").fetchone()[0]
+            if version != SCHEMA_VERSION:
+                for table in ("files", "sheets", "symbols"):
+                    conn.execute(f"DROP TABLE IF EXISTS {table}")
+                conn.execute(f"PRAGMA user_version = {SCHEMA_VERSION}")
+        except (OSError, sqlite3.Error) as e:
+            # 캐시 디렉토리를 쓸 수 없거나 파일이 손상된 경우: 이번 실행 동안만 메모리에 유지
+            logging.warning(f"⚠ 심볼 색인 파일 사용 불가, 메모리 색인 사용 ({self.path}): {e}")
+            conn = sqlite3.connect(":memory:")
+        conn.execute("PRAGMA journal_mode=WAL")
+        conn.execute("PRAGMA synchronous=NORMAL")
+        for statement in _SCHEMA:
+            conn.execute(statement)
+        conn.row_factory = sqlite3.Row
+        conn.commit()
+        self._prune(conn)
+        return conn
+
+    @staticmethod
+    def _prune(conn: sqlite3.Connection):
+        """더 이상 없는 DB 파일 항목 정리"""
+        missing = [row[0] for row in conn.execute("SELECT db_key FROM files") if not os.path.exists(row[0])]
+        for key in missing:
+            SymbolIndex._delete_db(conn, key)
+        if missing:
+            conn.commit()
+
+    @staticmethod
+    def _delete_db(conn: sqlite3.Connection, key: str):
+        conn.execute("DELETE FROM symbols WHERE db_key = ?", (key,))
+        conn.execute("DELETE FROM sheets WHERE db_key = ?", (key,))
+        conn.execute("DELETE FROM files WHERE db_key = ?", (key,))
+
+    def close(self):
+        if self._conn is not None:
+            self._conn.close()
+            self._conn = None
+
+    # ------------------------------------------------------------------
+    # 변경 기록 (DBHandlerV2.change_listener)
+    # ------------------------------------------------------------------
+
+    def record_change(self, db_handler, sheet_id: Optional[int], rows: Optional[Set[int]] = None):
+        """
+        커밋된 셀 변경 기록 (메모리만 갱신, 반영은 다음 조회 시)
+
+        Args:
+            sheet_id: 바뀐 시트 (None이면 DB 전체 - 여러 시트 삭제 등)
+            rows: 바뀐 화면 행 번호 (None이면 시트 전체 - 행/열 삽입·삭제, 시트 교체 등)
+        """
+        if not db_handler.db_file:
+            return
+        key = db_key(db_handler.db_file)
+        if key not in self._verified:
+            # 확인 전인 DB는 다음 조회 때 파일 서명이 달라 전체 재색인되므로 기록 불필요
+            return
+        entry = self._pending.get(key)
+        if entry is None:
+            entry = self._pending[key] = [db_handler, {}]
+        entry[0] = db_handler
+        sheets = entry[1]
+        if sheets is None:
+            return
+        if sheet_id is None:
+            entry[1] = None
+        elif rows is None or sheets.get(sheet_id, set()) is None:
+            sheets[sheet_id] = None
+        else:
+            changed = sheets.setdefault(sheet_id, set())
+            changed.update(rows)
+            if len(changed) > ROW_UPDATE_LIMIT:
+                sheets[sheet_id] = None
+
+    def has_pending(self, db_file: str) -> bool:
+        return db_key(db_file) in self._pending
+
+    def is_current(self, db_file: str) -> bool:
+        """반영할 변경이 없고 파일이 마지막 색인 이후 바뀌지 않았는지"""
+        key = db_key(db_file)
+        if key in self._pending:
+            return False
+        row = self.conn.execute("SELECT signature FROM files WHERE db_key = ?", (key,)).fetchone()
+        return row is not None and json.loads(row['signature']) == file_signature(db_file)
+
+    def mark_clean(self, db_file: str):
+        """DB를 닫은 뒤 서명만 갱신 (닫을 때 WAL 정리로 바뀐 서명 반영 - 닫기 전 is_current였던 경우에만 호출)"""
+        key = db_key(db_file)
+        if key in self._pending or key not in self._verified:
+            return
+        self.conn.execute("UPDATE files SET signature = ? WHERE db_key = ?",
+                          (json.dumps(file_signature(db_file)), key))
+        self.conn.commit()
+
+    def forget(self, db_file: str):
+        key = db_key(db_file)
+        self._pending.pop(key, None)
+        self._verified.discard(key)
+        self._delete_db(self.conn, key)
+        self.conn.commit()
+
+    # ------------------------------------------------------------------
+    # 동기화
+    # ------------------------------------------------------------------
+
+    def is_verified(self, db_file: str) -> bool:
+        """이번 실행에서 refresh로 확인한 DB인지 (이후 변경은 모두 기록됨)"""
+        return db_key(db_file) in self._verified
+
+    def needs_refresh(self, db_file: str) -> bool:
+        """refresh가 필요한지 (이번 실행에서 아직 확인하지 않은 DB 포함 - 확인해야 이후 변경이 기록됨)"""
+        return not self.is_verified(db_file) or not self.is_current(db_file)
+
+    @traced("symbol_index.refresh", "db")
+    def refresh(self, db_handler) -> bool:
+        """
+        DB 하나의 색인을 최신 상태로 (기록된 변경만 반영하거나, 파일이 외부에서 바뀌었으면 DB 전체 재색인)
+
+        Returns:
+            DB 전체를 다시 색인했는지 여부
+        """
+        key = db_key(db_handler.db_file)
+        entry = self._pending.pop(key, None)
+        stored = self.conn.execute("SELECT signature FROM files WHERE db_key = ?", (key,)).fetchone()
+        rebuilt = False
+
+        try:
+            if stored is None or (entry is not None and entry[1] is None):
+                self._rebuild_db(db_handler, key)
+                rebuilt = True
+            elif entry is not None:
+                # 확인된 상태 이후의 변경 기록만 반영 (자체 커밋으로 파일 서명은 이미 달라져 있음)
+                sheets_by_id = {sheet['id']: sheet for sheet in db_handler.get_sheets()}
+                for sheet_id, rows in entry[1].items():
+                    sheet = sheets_by_id.get(sheet_id)
+                    if rows is None or sheet is None or not self._update_rows(db_handler, key, sheet, rows):
+                        self._rebuild_sheet(db_handler, key, sheet_id, sheet)
+            elif json.loads(stored['signature']) != file_signature(db_handler.db_file):
+                self._rebuild_db(db_handler, key)
+                rebuilt = True
+            else:
+                self._verified.add(key)
+                return False
+
+            self.conn.execute("INSERT OR REPLACE INTO files (db_key, signature) VALUES (?, ?)",
+                              (key, json.dumps(file_signature(db_handler.db_file))))
+            self.conn.commit()
+            self._verified.add(key)
+        except Exception:
+            self.conn.rollback()
+            self._verified.discard(key)
+            # 실패한 DB는 다음 조회 때 다시 전체 색인
+            self.conn.execute("DELETE FROM files WHERE db_key = ?", (key,))
+            self.conn.commit()
+            raise
+        return rebuilt
+
+    def _rebuild_db(self, db_handler, key: str):
+        with tracer.span("symbol_index.rebuild_db", "db", db=os.path.basename(db_handler.db_file)):
+            self._delete_db(self.conn, key)
+            for sheet in db_handler.get_sheets():
+                self._rebuild_sheet(db_handler, key, sheet['id'], sheet)
+        logging.debug(f"심볼 색인 재구성: {os.path.basename(db_handler.db_file)}")
+
+    def _rebuild_sheet(self, db_handler, key: str, sheet_id: int, sheet: Optional[Dict]):
+        """시트 하나 다시 색인 (sheet가 None이면 삭제된 시트 - 항목만 제거)"""
+        self.conn.execute("DELETE FROM symbols WHERE db_key = ? AND sheet_id = ?", (key, sheet_id))
+        self.conn.execute("DELETE FROM sheets WHERE db_key = ? AND sheet_id = ?", (key, sheet_id))
+        if sheet is None:
+            return
+
+        layout = None
+        entries = []
+        if is_cal_list_sheet(sheet):
+            view = SheetView.of(db_handler.get_sheet_data_sparse(sheet_id))
+            layout = find_layout(view)
+            if layout is not None:
+                scope = ProjectScope()
+                for row in range(layout['header_row'] + 1, view.row_count):
+                    parsed = parse_row(view.read, row, layout)
+                    if parsed is None:
+                        continue
+                    if parsed[0] == PRJT_OPCODE:
+                        scope.apply(parsed[3], parsed[4])
+                    entries.append((key, sheet_id, row, *parsed, scope.key()))
+                tracer.count("symbol_index.sheet_rows", view.row_count)
+
+        self.conn.execute("INSERT INTO sheets (db_key, sheet_id, sheet_name, layout) VALUES (?, ?, ?, ?)",
+                          (key, sheet_id, sheet['name'], json.dumps(layout) if layout else None))
+        if entries:
+            self.conn.executemany(f"INSERT INTO symbols ({_ENTRY_COLUMNS}) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)",
+                                  entries)
+
+    def _update_rows(self, db_handler, key: str, sheet: Dict, rows: Set[int]) -> bool:
+        """
+        바뀐 행만 다시 읽어 반영
+
+        Returns:
+            False면 행 단위로 반영할 수 없음 (머리글/$PRJT_DEF 행 변경, 시트 이름 변경 등 - 시트 재색인 필요)
+        """
+        sheet_id = sheet['id']
+        stored = self.conn.execute("SELECT sheet_name, layout FROM sheets WHERE db_key = ? AND sheet_id = ?",
+                                   (key, sheet_id)).fetchone()
+        if stored is None or stored['sheet_name'] != sheet['name']:
+            return False
+        if stored['layout'] is None:
+            # CalList가 아니면 색인할 것이 없음, 머리글이 없던 CalList 시트는 새 머리글일 수 있으므로 재색인
+            return not is_cal_list_sheet(sheet)
+
+        layout = json.loads(stored['layout'])
+        if min(rows) <= layout['header_row']:
+            return False
+
+        old_rows = {row['row']: row['opcode'] for row in self.conn.execute(
+            f"SELECT row, opcode FROM symbols WHERE db_key = ? AND sheet_id = ? AND row IN ({','.join('?' * len(rows))})",
+            (key, sheet_id, *rows))}
+
+        updates = []
+        for row in sorted(rows):
+            parsed = parse_row(_row_reader(db_handler.get_row_data(sheet_id, row)), row, layout)
+            if old_rows.get(row) == PRJT_OPCODE or (parsed is not None and parsed[0] == PRJT_OPCODE):
+                # 분기 행이 바뀌면 뒤따르는 모든 심볼의 분기가 바뀜
+                return False
+            updates.append((row, parsed))
+
+        for row, parsed in updates:
+            if parsed is None:
+                self.conn.execute("DELETE FROM symbols WHERE db_key = ? AND sheet_id = ? AND row = ?",
+                                  (key, sheet_id, row))
+            else:
+                self.conn.execute(f"INSERT OR REPLACE INTO symbols ({_ENTRY_COLUMNS}) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)",
+                                  (key, sheet_id, row, *parsed, self._scope_at(key, sheet_id, row)))
+        tracer.count("symbol_index.row_updates", len(updates))
+        return True
+
+    def _scope_at(self, key: str, sheet_id: int, row: int) -> str:
+        """행 위치의 프로젝트 분기 (앞쪽 $PRJT_DEF 행만 다시 적용)"""
+        scope = ProjectScope()
+        for prjt in self.conn.execute(
+                "SELECT name, value FROM symbols WHERE db_key = ? AND sheet_id = ? AND opcode = ? AND row < ? ORDER BY row",
+                (key, sheet_id, PRJT_OPCODE, row)):
+            scope.apply(prjt['name'], prjt['value'])
+        return scope.key()
+
+    # ------------------------------------------------------------------
+    # 조회 (refresh 이후 호출)
+    # ------------------------------------------------------------------
+
+    def _query(self, where: str, params: tuple, db_files: Optional[List[str]],
+               order_by: str = "s.db_key, s.sheet_id, s.row", order_params: tuple = ()) -> List[Dict]:
+        sql = (f"SELECT s.db_key, s.sheet_id, s.row, s.opcode, s.keyword, s.type, s.name, s.value, s.prjt, "
+               f"h.sheet_name FROM symbols s JOIN sheets h ON h.db_key = s.db_key AND h.sheet_id = s.sheet_id "
+               f"WHERE s.opcode != ? AND {where}")
+        params = (PRJT_OPCODE, *params)
+        if db_files is not None:
+            keys = [db_key(db_file) for db_file in db_files]
+            if not keys:
+                return []
+            sql += f" AND s.db_key IN ({','.join('?' * len(keys))})"
+            params += tuple(keys)
+        return [dict(row) for row in self.conn.execute(f"{sql} ORDER BY {order_by}", params + order_params)]
+
+    def lookup(self, name: str, db_files: Optional[List[str]] = None) -> List[Dict]:
+        """이름이 정확히 같은 정의 목록 (이름 인덱스 조회)"""
+        return self._query("s.name = ?", (name,), db_files)
+
+    def search(self, text: str, db_files: Optional[List[str]] = None, limit: int = 500) -> List[Dict]:
+        """이름에 text가 포함된 정의 (앞부분 일치 우선, 대소문자 무시)"""
+        text = text.strip()
+        if not text:
+            return []
+        escaped = text.replace("\\", "\\\\").replace("%", "\\%").replace("_", "\\_")
+        return self._query("s.name LIKE ? ESCAPE '\\'", (f"%{escaped}%",), db_files,
+                           f"s.name NOT LIKE ? ESCAPE '\\', s.name, s.db_key, s.sheet_id, s.row LIMIT {int(limit)}",
+                           (f"{escaped}%",))
+
+    def duplicates(self, db_files: Optional[List[str]] = None) -> Dict[str, List[Dict]]:
+        """
+        충돌하는 중복 정의 {이름: 정의 목록} (conflicts 기준)
+
+        GROUP BY로 두 번 이상 정의된 이름만 고른 뒤 그 이름들만 조회합니다.
+        """
+        sql = "SELECT name FROM symbols WHERE opcode != ?"
+        params = [PRJT_OPCODE]
+        if db_files is not None:
+            keys = [db_key(db_file) for db_file in db_files]
+            if not keys:
+                return {}
+            sql += f" AND db_key IN ({','.join('?' * len(keys))})"
+            params += keys
+        names = [row[0] for row in self.conn.execute(sql + " GROUP BY name HAVING COUNT(*) > 1", params)]
+
+        result = {}
+        for name in names:
+            entries = self.lookup(name, db_files)
+            if conflicts(entries):
+                result[name] = entries
+        return result
@@ -0,0 +1,190 @@
+"""
+행/열 논리 순서(data_manager/axis_order, DBHandlerV2 축 매핑) 회귀 테스트
+
+- 처음/끝/범위 밖 위치의 삽입·삭제가 단순 리스트 모델과 같은 순서를 만드는지
+- ord 간격이 소진되면 재정렬되고, 재정렬 후에도 순서와 저장된 항목이 일치하는지
+- DBHandlerV2가 셀 목록을 한 번의 축 순서 조회로 물리 좌표에 매핑하는지
+
+실행: python -m unittest discover -t . -s data_manager/tests
+"""
+
+import os
+import shutil
+import logging
+import tempfile
+import unittest
+from unittest import mock
+
+from data_manager import db_handler_v2
+from data_manager.axis_order import AxisOrder, AXIS_ROW, AXIS_COL, _MIN_ORD_GAP
+
+
+class AxisOrderTest(unittest.TestCase):
+    def assertConsistent(self, order: AxisOrder, expected_physicals):
+        self.assertEqual(order.physicals, expected_physicals)
+        self.assertEqual(len(order.ords), len(order.physicals))
+        self.assertTrue(all(a < b for a, b in zip(order.ords, order.ords[1:])), order.ords)
+        for visual, physical in enumerate(expected_physicals):
+            self.assertEqual(order.to_physical(visual), physical)
+            self.assertEqual(order.to_visual(physical), visual)
+
+    def test_insert_at_start(self):
+        order = AxisOrder.identity(3)
+        entries, renormalized = order.insert(0, 2)
+        self.assertFalse(renormalized)
+        self.assertEqual([physical for physical, _ in entries], [3, 4])
+        self.assertConsistent(order, [3, 4, 0, 1, 2])
+        self.assertEqual(order.ords[2:], [0.0, 1.0, 2.0])  # 기존 항목은 그대로
+
+    def test_insert_at_end_and_past_end(self):
+        order = AxisOrder.identity(3)
+        order.insert(3, 1)
+        self.assertConsistent(order, [0, 1, 2, 3])
+
+        # 매핑 길이를 넘는 위치는 그 앞까지 먼저 확장
+        entries, _ = order.insert(6, 1)
+        self.assertEqual([physical for physical, _ in entries], [4, 5, 6])
+        self.assertConsistent(order, [0, 1, 2, 3, 4, 5, 6])
+        self.assertEqual(order.to_physical(9), 9)
+
+    def test_insert_into_empty(self):
+        order = AxisOrder([], [])
+        order.insert(0, 2)
+        self.assertConsistent(order, [0, 1])
+
+    def test_remove_at_edges(self):
+        order = AxisOrder.identity(5)
+        self.assertEqual(order.remove(0, 2), [0, 1])
+        self.assertEqual(order.remove(2, 5), [4])  # 끝을 넘는 범위는 있는 항목만 제거
+        self.assertConsistent(order, [2, 3])
+        # 물리 번호는 재사용하지 않음
+        self.assertEqual(order.to_physical(2), 5)
+
+    def test_renormalize_when_gap_runs_out(self):
+        order = AxisOrder.identity(3)
+        model = [0, 1, 2]
+        renormalized_at = None
+        for step in range(40):
+            entries, renormalized = order.insert(1, 1)
+            model.insert(1, order.physicals[1])
+            if renormalized:
+                renormalized_at = step
+                break
+            self.assertEqual(len(entries), 1)
+
+        self.assertIsNotNone(renormalized_at)
+        self.assertGreater(renormalized_at, 10)
+        self.assertEqual(order.ords, [float(i) for i in range(len(model))])
+        self.assertConsistent(order, model)
+
+        # 재정렬 후에는 다시 간격이 충분
+        _, renormalized = order.insert(1, 1)
+        self.assertFalse(renormalized)
+        self.assertGreater(order.ords[2] - order.ords[1], _MIN_ORD_GAP)
+
+
+class DBAxisOrderTest(unittest.TestCase):
+    """임시 DB에서 행/열 삽입·삭제 후 화면 좌표가 리스트 모델과 같은지 확인"""
+
+    ROWS, COLS = 4, 3
+
+    def setUp(self):
+        logging.disable(logging.CRITICAL)
+        patcher = mock.patch.object(db_handler_v2, "USE_AXIS_ORDER_INDIRECTION", True)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
+        self.temp_dir = tempfile.mkdtemp()
+        self.db_file = os.path.join(self.temp_dir, "axis.db")
+        self.db = db_handler_v2.DBHandlerV2(self.db_file)
+        self.sheet_id = self.db.create_sheet_v2("$Axis")
+        self.model = [[f"r{r}c{c}" for c in range(self.COLS)] for r in range(self.ROWS)]
+        self.db.update_cells(self.sheet_id, [(r, c, value) for r, row in enumerate(self.model)
+                                             for c, value in enumerate(row)])
+
+    def tearDown(self):
+        self.db.disconnect()
+        logging.disable(logging.NOTSET)
+        shutil.rmtree(self.temp_dir, ignore_errors=True)
+
+    def _width(self):
+        return max((len(row) for row in self.model), default=0)
+
+    def _insert_rows(self, start, count):
+        self.db.shift_rows(self.sheet_id, start, count)
+        self.model[start:start] = [[""] * self._width() for _ in range(count)]
+
+    def _remove_rows(self, start, count):
+        # shift_rows 음수: start 바로 앞의 count개 행 제거
+        self.db.shift_rows(self.sheet_id, start, -count)
+        del self.model[max(0, start - count):start]
+
+    def _insert_columns(self, start, count):
+        self.db.shift_columns(self.sheet_id, start, count)
+        for row in self.model:
+            row[start:start] = [""] * count
+
+    def _expected_cells(self):
+        return [(r, c, value) for r, row in enumerate(self.model) for c, value in enumerate(row) if value]
+
+    def assertMatchesModel(self, db=None):
+        db = db or self.db
+        self.assertEqual(db.visual_cells(self.sheet_id), self._expected_cells())
+        for r, row in enumerate(self.model):
+            self.assertEqual(db.get_row_data(self.sheet_id, r), {c: v for c, v in enumerate(row) if v})
+
+    def test_insert_and_remove_at_edges(self):
+        self._insert_rows(0, 2)
+        self.assertMatchesModel()
+        self._insert_rows(len(self.model), 1)
+        self._insert_columns(0, 1)
+        self._insert_columns(self._width(), 2)
+        self.assertMatchesModel()
+
+        self._remove_rows(2, 2)  # 맨 위 (삽입한 빈 행)
+        self._remove_rows(len(self.model), 1)  # 맨 아래
+        self._remove_rows(1, 3)  # 시작 위치 앞 행이 1개뿐이면 그만큼만 제거
+        self.assertMatchesModel()
+
+    def test_renormalized_order_is_persisted(self):
+        for _ in range(40):
+            self._insert_rows(1, 1)
+            self.db.update_cells(self.sheet_id, [(1, 0, f"n{len(self.model)}")])
+            self.model[1][0] = f"n{len(self.model)}"
+        self.assertMatchesModel()
+
+        # 다른 연결에서 저장된 순서로 다시 읽어도 같은 결과
+        reopened = db_handler_v2.DBHandlerV2(self.db_file, read_only=True)
+        try:
+            order = reopened.get_axis_order(self.sheet_id, AXIS_ROW)
+            self.assertTrue(all(a < b for a, b in zip(order.ords, order.ords[1:])))
+            self.assertMatchesModel(reopened)
+        finally:
+            reopened.disconnect()
+
+    def test_update_cells_maps_batch_with_single_axis_lookup(self):
+        self._insert_rows(0, 1)
+        self._insert_columns(1, 1)
+
+        far_row, far_col = len(self.model) + 3, self._width() + 2
+        updates = [(0, 0, "top"), (2, 1, "mid"), (far_row, far_col, "far"), (1, 0, "")]
+        with mock.patch.object(self.db, "_sync_axis_cache", wraps=self.db._sync_axis_cache) as sync:
+            self.db.update_cells(self.sheet_id, updates)
+        self.assertEqual(sync.call_count, 1)
+
+        for row, col, value in updates:
+            while len(self.model) <= row:
+                self.model.append([])
+            row_data = self.model[row]
+            row_data.extend([""] * (col + 1 - len(row_data)))
+            row_data[col] = value
+        self.assertEqual(self.db.visual_cells(self.sheet_id), self._expected_cells())
+        self.assertEqual(self.db.get_cell_value(self.sheet_id, far_row, far_col), "far")
+
+        # 매핑은 가장 큰 좌표까지 한 번에 확장
+        self.assertEqual(len(self.db.get_axis_order(self.sheet_id, AXIS_ROW)), far_row + 1)
+        self.assertEqual(len(self.db.get_axis_order(self.sheet_id, AXIS_COL)), far_col + 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,8 +1,18 @@
-import xlwings as xw
 import logging
 from data_manager.db_handler_v2 import DBHandlerV2
+from excel_processor.xlsx_stream_writer import export_db_to_xlsx, iter_sheet_rows, safe_sheet_names
 import os
 
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import EXCEL_EXPORT_ENGINE
+except ImportError:
+    EXCEL_EXPORT_ENGINE = "stream"
+
+# xlwings 경로에서 한 번에 쓰는 행 수 (시트 전체 2차원 배열 대신 행 블록 단위로 기록)
+_XLWINGS_BLOCK_ROWS = 2000
+
+
 class ExcelExporter:
     """Excel 파일 내보내기 클래스"""
 
@@ -15,68 +25,95 @@ class ExcelExporter:
         """
         self.db = db_handler
 
-    def export_excel(self, file_id: int, output_path: str) -> None:
+    def export_excel(self, file_id: int, output_path: str, engine: str = None) -> None:
         """
         DB 데이터를 Excel 파일로 내보내기
 
         Args:
-            file_id: 파일 ID
+            file_id: 파일 ID (V2에서는 DB 파일 자체가 하나의 파일이므로 사용하지 않음, V1 호환)
             output_path: 출력 파일 경로
+            engine: 'stream' / 'xlwings' (None이면 EXCEL_EXPORT_ENGINE 설정 사용)
         """
-        logging.info(f"Excel 파일 내보내기: ID {file_id}")
+        engine = engine or EXCEL_EXPORT_ENGINE
+        logging.info(f"Excel 파일 내보내기: {self.db.db_file} → {output_path} (engine={engine})")
 
         try:
-            # Excel 애플리케이션 시작
-            app = xw.App(visible=False)
-            wb = app.books.add()
-
-            # 기본 Sheet1 삭제
-            for sheet in wb.sheets:
-                sheet.delete()
-
-            # 파일 정보 가져오기
-            files = self.db.get_files()
-            file_name = next((f['name'] for f in files if f['id'] == file_id), None)
-
-            if not file_name:
-                raise ValueError(f"ID {file_id}에 해당하는 파일을 찾을 수 없습니다.")
-
-            # 시트 목록 가져오기
-            sheets = self.db.get_sheets(file_id)
-
-            for sheet_info in sheets:
-                sheet_id = sheet_info['id']
-                sheet_name = sheet_info['name']
+            if engine == "xlwings":
+                self.export_excel_xlwings(output_path)
+            else:
+                export_db_to_xlsx(self.db, output_path)
+        except Exception as e:
+            logging.error(f"Excel 파일 내보내기 오류: {e}")
+            raise
 
-                # 새 시트 추가
-                sheet = wb.sheets.add(sheet_name)
+    def export_excel_xlwings(self, output_path: str) -> None:
+        """
+        Excel을 실행하여(xlwings) 내보내기 - 저장 후 Excel 서식/매크로 처리가 필요한 경우용
 
-                # 시트 데이터 가져오기
-                sheet_data = self.db.get_sheet_data(sheet_id)
+        시트 전체 대신 행 블록 단위로 쓰며, 범위는 행/열 번호로 지정합니다 (Z 이후 열도 제한 없음).
+        """
+        # xlwings는 Excel 실행이 필요한 이 경로에서만 import (앱 시작 시 로드하지 않음)
+        try:
+            import xlwings as xw
+        except ImportError:
+            raise ImportError("xlwings가 설치되지 않아 Excel로 내보낼 수 없습니다 (기본 스트리밍 내보내기 사용)")
 
-                # 데이터가 있는 경우 Excel에 쓰기
-                if sheet_data:
-                    # 최대 행/열 수 계산
-                    max_row = len(sheet_data)
-                    max_col = max(len(row) for row in sheet_data) if max_row > 0 else 0
+        app = None
+        try:
+            # Excel 애플리케이션 시작
+            app = xw.App(visible=False, add_book=False)
+            app.display_alerts = False
+            wb = app.books.add()
 
-                    # 전체 범위 설정
-                    if max_row > 0 and max_col > 0:
-                        range_addr = f"A1:{chr(65 + max_col - 1)}{max_row}"
-                        sheet.range(range_addr).value = sheet_data
+            sheets = self.db.get_sheets()
+            names = safe_sheet_names([sheet['name'] for sheet in sheets])
+            default_sheets = list(wb.sheets)
+
+            for sheet_info, sheet_name in zip(sheets, names):
+                sheet = wb.sheets.add(sheet_name, after=wb.sheets[-1])
+                row_count, col_count, rows = iter_sheet_rows(self.db, sheet_info['id'])
+                if row_count <= 0 or col_count <= 0:
+                    continue
+
+                block_start = 0
+                block = []
+                for row, cells in rows:
+                    while row >= block_start + _XLWINGS_BLOCK_ROWS:
+                        self._write_block(sheet, block_start, block, col_count)
+                        block_start += _XLWINGS_BLOCK_ROWS
+                        block = []
+                    while len(block) < row - block_start:
+                        block.append([None] * col_count)
+                    values = [None] * col_count
+                    for col, value in cells:
+                        values[col] = value
+                    block.append(values)
+                self._write_block(sheet, block_start, block, col_count)
+
+            # 기본 Sheet1 삭제 (시트가 하나 이상 추가된 경우에만 - 빈 통합 문서는 저장 불가)
+            if sheets:
+                for sheet in default_sheets:
+                    sheet.delete()
 
             # 파일 저장
             wb.save(output_path)
             wb.close()
-            app.quit()
-
             logging.info(f"Excel 파일 내보내기 완료: {output_path}")
-
-        except Exception as e:
-            logging.error(f"Excel 파일 내보내기 오류: {e}")
-            if 'app' in locals():
+        finally:
+            if app is not None:
                 try:
                     app.quit()
-                except:
+                except Exception:
                     pass
-            raise
\ No newline at end of file
+
+    @staticmethod
+    def _write_block(sheet, block_start: int, block, col_count: int):
+        if not block:
+            return
+        # 문자 주소 대신 행/열 번호로 범위 지정 (열 수 제한 없음)
+        sheet.range((block_start + 1, 1), (block_start + len(block), col_count)).value = block
+
+
+def default_export_path(db_file: str, output_dir: str) -> str:
+    """DB 파일명 기준 xlsx 경로 (예: database/A.db → output_dir/A.xlsx)"""
+    return os.path.join(output_dir, os.path.splitext(os.path.basename(db_file))[0] + ".xlsx")
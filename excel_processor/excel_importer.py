@@ -1,18 +1,68 @@
-import xlwings as xw
 import logging
 from data_manager.db_handler_v2 import DBHandlerV2
+from excel_processor.xlsx_stream_reader import XlsxStreamReader, is_streamable
 import os
 
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import EXCEL_IMPORT_ENGINE, EXCEL_BATCH_SIZE
+except ImportError:
+    EXCEL_IMPORT_ENGINE = "xlwings"
+    EXCEL_BATCH_SIZE = 1000
+
+
+def format_cell_value(cell_value) -> str:
+    """셀 값 하나를 DB 저장 문자열로 (Cython process_cell_value_fast와 같은 규칙 - bool은 "True"/"False")"""
+    if type(cell_value) is str:
+        return cell_value
+    if type(cell_value) is float:
+        # 정수로 표현 가능한 값은 정수 문자열 (inf/nan은 그대로)
+        if cell_value.is_integer():
+            return str(int(cell_value))
+        return str(cell_value)
+    return str(cell_value)
+
+
+def bulk_cell_params_python(values) -> list:
+    """
+    used_range.value 블록 전체를 (row, col, value) 목록으로 변환 (Cython bulk_cell_params의 Python 폴백)
+
+    빈 값(None, 공백 문자열)은 제외하므로 결과를 batch_insert_cells(..., prepared=True)에 그대로 넘깁니다.
+    """
+    if values is None:
+        return []
+    if not isinstance(values, (list, tuple)):
+        # 단일 셀
+        value = format_cell_value(values)
+        return [(0, 0, value)] if value.strip() else []
+
+    params = []
+    append = params.append
+    for i, row in enumerate(values):
+        if isinstance(row, (list, tuple)):
+            for j, cell_value in enumerate(row):
+                if cell_value is not None:
+                    value = format_cell_value(cell_value)
+                    if value.strip():
+                        append((i, j, value))
+        elif row is not None:
+            # 1차원 데이터 (한 행 또는 한 열 범위)
+            value = format_cell_value(row)
+            if value.strip():
+                append((0, i, value))
+    return params
+
+
 # Cython 최적화 모듈 import (성능 향상)
 try:
     from cython_extensions.excel_processor_v2 import (
-        fast_process_excel_data,
         process_cell_value_fast,
-        fast_batch_cell_processing
+        bulk_cell_params
     )
     USE_CYTHON_EXCEL = True
     logging.info("✓ Cython Excel 최적화 모듈 로드 성공")
 except ImportError as e:
+    bulk_cell_params = bulk_cell_params_python
     USE_CYTHON_EXCEL = False
     logging.warning(f"⚠ Cython Excel 모듈 로드 실패, Python 폴백 사용: {e}")
 
@@ -28,10 +78,38 @@ class ExcelImporter:
         """
         self.db = db_handler
 
-    def import_excel(self, excel_path: str, db_file_path: str = None) -> int:
+    @staticmethod
+    def get_source_file_name(excel_path: str, db_file_path: str = None) -> str:
+        """V2 source_file 이름 (사용자 지정 DB 파일명, 기본은 엑셀 파일명 + .db)"""
+        if db_file_path:
+            return os.path.basename(db_file_path)
+        excel_name_without_ext = os.path.splitext(os.path.basename(excel_path))[0]
+        return f"{excel_name_without_ext}.db"
+
+    def import_excel(self, excel_path: str, db_file_path: str = None, engine: str = None) -> int:
         """
         Excel 파일을 DB로 가져오기 (안정성 강화)
 
+        Args:
+            excel_path: Excel 파일 경로
+            db_file_path: 사용자 지정 DB 파일 경로 (지정된 경우)
+            engine: 'stream' / 'xlwings' (None이면 EXCEL_IMPORT_ENGINE 설정 사용)
+
+        Returns:
+            생성된 파일 ID
+        """
+        engine = engine or EXCEL_IMPORT_ENGINE
+
+        # 대량 가져오기 모드: 보조 인덱스는 모든 시트 삽입 후 한 번만 생성
+        with self.db.bulk_ingest():
+            if engine == "stream" and is_streamable(excel_path):
+                return self.import_excel_stream(excel_path, db_file_path)
+            return self.import_excel_xlwings(excel_path, db_file_path)
+
+    def import_excel_xlwings(self, excel_path: str, db_file_path: str = None) -> int:
+        """
+        Excel을 실행하여(xlwings) 파일을 DB로 가져오기 - xls/xlsb 등 스트리밍 불가 형식용
+
         Args:
             excel_path: Excel 파일 경로
             db_file_path: 사용자 지정 DB 파일 경로 (지정된 경우)
@@ -39,6 +117,12 @@ class ExcelImporter:
         Returns:
             생성된 파일 ID
         """
+        # xlwings는 Excel 실행이 필요한 이 경로에서만 import (앱 시작 시 로드하지 않음)
+        try:
+            import xlwings as xw
+        except ImportError:
+            raise ImportError("xlwings가 설치되지 않아 Excel 파일을 열 수 없습니다 (xlsx/xlsm만 직접 가져오기 가능)")
+
         logging.info(f"Excel 파일 가져오기 시작: {excel_path}")
 
         app = None
@@ -55,13 +139,7 @@ class ExcelImporter:
             logging.info(f"Excel 파일 열기 완료: {excel_path}")
 
             # 파일명 추출 (V2에서는 source_file로 사용)
-            if db_file_path:
-                # 사용자가 지정한 DB 파일명 사용
-                source_file_name = os.path.basename(db_file_path)
-            else:
-                # 기본: 확장자를 제거한 엑셀 파일명에 .db 추가
-                excel_name_without_ext = os.path.splitext(os.path.basename(excel_path))[0]
-                source_file_name = f"{excel_name_without_ext}.db"
+            source_file_name = self.get_source_file_name(excel_path, db_file_path)
 
             # V2 방식: source_file 이름만 저장 (실제 파일 ID는 사용하지 않음)
             source_file = source_file_name
@@ -117,36 +195,14 @@ class ExcelImporter:
                                     logging.warning(f"시트 '{sheet_name}' 데이터가 None입니다.")
                                     continue
 
-                                # 데이터 처리 - Cython 최적화 적용
-                                if USE_CYTHON_EXCEL:
-                                    # Cython 최적화 버전 사용 (C 수준 성능)
-                                    cells_data = fast_process_excel_data(data)
-                                    logging.info(f"시트 '{sheet_name}' Cython 최적화 데이터 처리: {len(cells_data)}개 셀")
-                                else:
-                                    # 기존 Python 버전 (폴백)
-                                    cells_data = []
-                                    if isinstance(data, list):
-                                        logging.info(f"시트 '{sheet_name}' 리스트 데이터 처리: {len(data)}행")
-                                        for i, row_data in enumerate(data):
-                                            if isinstance(row_data, list):
-                                                for j, cell_value in enumerate(row_data):
-                                                    if cell_value is not None:
-                                                        value = self.process_cell_value(cell_value)
-                                                        cells_data.append((i, j, value))
-                                            elif row_data is not None:  # 단일 행인 경우
-                                                value = str(row_data) if not isinstance(row_data, str) else row_data
-                                                cells_data.append((0, i, value))
-                                    else:  # 단일 셀인 경우
-                                        logging.info(f"시트 '{sheet_name}' 단일 셀 데이터: {data}")
-                                        cells_data = [(0, 0, str(data) if data is not None else "")]
-
-                                # 배치 처리 최적화
-                                if USE_CYTHON_EXCEL and cells_data:
-                                    cells_data = fast_batch_cell_processing(cells_data)
-
-                                # DB에 셀 데이터 일괄 저장
+                                # 블록 전체를 한 번에 변환 (숫자 서식 + 빈 값 제외, Cython 사용 시 C 수준 루프)
+                                cells_data = bulk_cell_params(data)
+                                logging.info(f"시트 '{sheet_name}' 데이터 변환: {len(cells_data)}개 셀"
+                                             f"{' (Cython)' if USE_CYTHON_EXCEL else ''}")
+
+                                # DB에 셀 데이터 일괄 저장 (변환 결과를 executemany에 그대로 전달)
                                 if cells_data:
-                                    self.db.batch_insert_cells(sheet_id, cells_data)
+                                    self.db.batch_insert_cells(sheet_id, cells_data, prepared=True)
                                     logging.info(f"시트 '{sheet_name}' 데이터 저장 완료: {len(cells_data)}개 셀")
                                 else:
                                     logging.warning(f"시트 '{sheet_name}' 저장할 데이터가 없습니다.")
@@ -205,23 +261,68 @@ class ExcelImporter:
 
             raise
 
+    def import_excel_stream(self, excel_path: str, db_file_path: str = None) -> int:
+        """
+        xlsx/xlsm 파일을 Excel 실행 없이 DB로 가져오기
+
+        워크시트 XML을 한 번 스트리밍하면서 셀 배치를 바로 DB에 삽입합니다.
+        수식 셀은 파일에 저장된 마지막 계산 결과를 사용합니다 (xlwings 경로의 Calculate() 없음).
+
+        Args:
+            excel_path: Excel 파일 경로
+            db_file_path: 사용자 지정 DB 파일 경로 (지정된 경우)
+
+        Returns:
+            성공 표시 (xlwings 경로와 동일하게 1)
+        """
+        logging.info(f"Excel 파일 스트리밍 가져오기 시작: {excel_path}")
+        source_file_name = self.get_source_file_name(excel_path, db_file_path)
+
+        # 기존 동일한 source_file의 시트들 정리 (중복 방지)
+        try:
+            deleted_count = self.db.delete_sheets_by_source_file(source_file_name)
+            if deleted_count > 0:
+                logging.info(f"기존 '{source_file_name}' 시트 {deleted_count}개 정리 완료")
+        except Exception as cleanup_error:
+            logging.warning(f"기존 시트 정리 중 오류 (계속 진행): {cleanup_error}")
+
+        with XlsxStreamReader(excel_path) as reader:
+            worksheets = reader.worksheets()
+            dollar_sheets_count = 0
+            total_cells = 0
+
+            for sheet_idx, sheet_name, part in worksheets:
+                # "$" 포함 시트만 처리
+                if "$" not in sheet_name:
+                    logging.debug(f"시트 '{sheet_name}' $ 없음, 건너뛰기")
+                    continue
+
+                dollar_sheets_count += 1
+                try:
+                    sheet_id = self.db.create_sheet_v2(
+                        sheet_name,
+                        is_dollar_sheet=True,
+                        sheet_order=sheet_idx,
+                        source_file=source_file_name,
+                        replace_if_exists=True
+                    )
+                    cell_count = self.db.stream_insert_cells(sheet_id, reader.iter_cell_batches(part, EXCEL_BATCH_SIZE))
+                    total_cells += cell_count
+                    logging.info(f"시트 '{sheet_name}' 데이터 저장 완료: {cell_count}개 셀")
+                except Exception as sheet_error:
+                    logging.error(f"시트 '{sheet_name}' 처리 중 오류: {sheet_error}")
+                    continue
+
+        logging.info(f"✓ Excel 스트리밍 가져오기 완료: 총 {len(worksheets)}개 시트 중 "
+                     f"{dollar_sheets_count}개 $ 시트, {total_cells}개 셀 ({source_file_name})")
+        return 1
+
     # 기존 코드 위치에 새 메서드 추가
     def process_cell_value(self, cell_value):
         """셀 값을 처리하여 적절한 형태로 변환 (Cython 최적화 지원)"""
         if USE_CYTHON_EXCEL:
             # Cython 최적화 버전 사용 (C 수준 성능)
             return process_cell_value_fast(cell_value)
-        else:
-            # 기존 Python 버전 (폴백)
-            if cell_value is None:
-                return ""
-
-            # 숫자인 경우 정수 확인 및 처리
-            if isinstance(cell_value, (int, float)):
-                # 정수로 표현 가능한 값인지 확인
-                if cell_value == int(cell_value):
-                    return str(int(cell_value))  # 정수로 변환 후 문자열화
-                return str(cell_value)           # 그대로 문자열화
-
-            # 문자열이면 그대로 반환, 아니면 문자열로 변환
-            return cell_value if isinstance(cell_value, str) else str(cell_value)
\ No newline at end of file
+        if cell_value is None:
+            return ""
+        return format_cell_value(cell_value)
\ No newline at end of file
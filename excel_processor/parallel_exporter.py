@@ -0,0 +1,150 @@
+"""
+다중 DB 병렬 xlsx 내보내기
+
+DB 파일 하나당 워커 프로세스 하나를 할당하여 xlsx 스트리밍 내보내기(export_db_to_xlsx)를
+실행합니다. 워커는 DB 파일을 각자 연결로 읽고 서로 다른 xlsx 파일에 쓰므로 공유 상태가 없습니다.
+(ParallelExcelImporter와 같은 구조)
+"""
+
+import os
+import time
+import logging
+import multiprocessing
+from concurrent.futures import ProcessPoolExecutor, wait, FIRST_COMPLETED
+from typing import Callable, Dict, List, Optional, Tuple
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import EXCEL_EXPORT_MAX_WORKERS
+except ImportError:
+    EXCEL_EXPORT_MAX_WORKERS = 0
+
+
+def export_db_worker(db_file_path: str, xlsx_path: str) -> Dict:
+    """
+    워커 프로세스 진입점: DB 파일 하나를 xlsx 파일로 내보내기
+
+    Returns:
+        결과 딕셔너리 (프로세스 간 전달을 위해 dict 사용)
+    """
+    from data_manager.db_handler_v2 import DBHandlerV2
+    from excel_processor.xlsx_stream_writer import export_db_to_xlsx
+
+    db_handler = None
+    try:
+        db_handler = DBHandlerV2(db_file_path, read_only=True)
+        summary = export_db_to_xlsx(db_handler, xlsx_path)
+        summary.update({
+            'db_file': os.path.basename(db_file_path),
+            'excel_file': os.path.basename(xlsx_path),
+            'excel_path': xlsx_path
+        })
+        return summary
+    finally:
+        if db_handler:
+            db_handler.disconnect()
+
+
+class ParallelExcelExporter:
+    """다중 DB → xlsx 변환을 프로세스 풀로 분산 실행하는 스케줄러"""
+
+    def __init__(self, max_workers: Optional[int] = None, poll_interval: float = 0.1):
+        if not max_workers:
+            max_workers = EXCEL_EXPORT_MAX_WORKERS or os.cpu_count() or 1
+        self.max_workers = max(1, int(max_workers))
+        self.poll_interval = poll_interval
+
+    def run(self, jobs: List[Tuple[str, str]],
+            progress_handler: Optional[Callable[[str, int], None]] = None,
+            cancel_checker: Optional[Callable[[], bool]] = None) -> Tuple[List[Dict], List[Dict]]:
+        """
+        (DB 파일 경로, xlsx 파일 경로) 목록을 병렬로 내보내기
+
+        Args:
+            jobs: [(db_file_path, xlsx_path), ...] - xlsx 경로는 서로 달라야 함
+            progress_handler: (완료된 DB 파일명, 완료 개수) 콜백 - 대기 중에도 주기적으로 호출
+            cancel_checker: True 반환 시 아직 시작하지 않은 작업 취소
+
+        Returns:
+            (성공 목록, 실패 목록) - 실패 항목은 {'db_file', 'error'}
+        """
+        successful, failed = [], []
+        if not jobs:
+            return successful, failed
+
+        worker_count = min(self.max_workers, len(jobs))
+        logging.info(f"🚀 병렬 xlsx 내보내기 시작: {len(jobs)}개 DB, 워커 {worker_count}개")
+        start_time = time.time()
+
+        if worker_count == 1:
+            # 워커 하나면 프로세스 생성 비용 없이 현재 프로세스에서 실행
+            for completed, (db_file_path, xlsx_path) in enumerate(jobs, 1):
+                db_basename = os.path.basename(db_file_path)
+                if cancel_checker and cancel_checker():
+                    failed.append({'db_file': db_basename, 'error': '사용자 취소'})
+                    continue
+                try:
+                    self._record(export_db_worker(db_file_path, xlsx_path), successful)
+                except Exception as e:
+                    logging.error(f"❌ xlsx 내보내기 실패 [{db_basename}]: {e}")
+                    failed.append({'db_file': db_basename, 'error': str(e)})
+                if progress_handler:
+                    progress_handler(db_basename, completed)
+        else:
+            # Windows/PyInstaller 호환을 위해 spawn 컨텍스트 사용
+            ctx = multiprocessing.get_context('spawn')
+            with ProcessPoolExecutor(max_workers=worker_count, mp_context=ctx) as pool:
+                futures = {pool.submit(export_db_worker, db_file_path, xlsx_path): db_file_path
+                           for db_file_path, xlsx_path in jobs}
+                pending = set(futures)
+                completed = 0
+                cancelled = False
+
+                while pending:
+                    done, pending = wait(pending, timeout=self.poll_interval, return_when=FIRST_COMPLETED)
+
+                    for future in done:
+                        completed += 1
+                        db_basename = os.path.basename(futures[future])
+                        self._collect(future, db_basename, successful, failed)
+                        if progress_handler:
+                            progress_handler(db_basename, completed)
+
+                    if not done and progress_handler:
+                        progress_handler("", completed)
+
+                    if not cancelled and cancel_checker and cancel_checker():
+                        logging.info("사용자가 병렬 xlsx 내보내기를 취소했습니다.")
+                        cancelled = True
+                        for future in pending:
+                            future.cancel()
+
+        logging.info(f"병렬 xlsx 내보내기 완료: 성공 {len(successful)}개, 실패 {len(failed)}개 "
+                     f"(총 소요시간: {time.time() - start_time:.1f}초)")
+        return successful, failed
+
+    @classmethod
+    def _collect(cls, future, db_basename: str, successful: List[Dict], failed: List[Dict]):
+        """완료된 future 결과를 성공/실패 목록에 분류"""
+        if future.cancelled():
+            failed.append({'db_file': db_basename, 'error': '사용자 취소'})
+            return
+
+        try:
+            result = future.result()
+        except Exception as e:
+            logging.error(f"❌ xlsx 내보내기 실패 [{db_basename}]: {e}")
+            failed.append({'db_file': db_basename, 'error': str(e)})
+            return
+        cls._record(result, successful)
+
+    @staticmethod
+    def _record(result: Dict, successful: List[Dict]):
+        successful.append({
+            'db_file': result['db_file'],
+            'excel_file': result['excel_file'],
+            'excel_path': result['excel_path'],
+            'sheets': result['sheets'],
+            'cells': result['cells']
+        })
+        logging.info(f"✅ xlsx 내보내기 성공: {result['db_file']} → {result['excel_file']} ({result['elapsed']:.1f}초)")
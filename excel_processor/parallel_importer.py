@@ -0,0 +1,139 @@
+"""
+다중 Excel 파일 병렬 가져오기
+
+Excel 파일 하나당 워커 프로세스 하나를 할당하여 xlsx 스트리밍 가져오기
+(ExcelImporter.import_excel, engine='stream')를 실행합니다. 파일마다 독립된 DB 파일에 쓰므로
+워커 간 공유 상태가 없으며, 완료된 DB는 메인 프로세스에서 DBManager에 추가합니다.
+"""
+
+import os
+import time
+import logging
+import multiprocessing
+from concurrent.futures import ProcessPoolExecutor, wait, FIRST_COMPLETED
+from typing import Callable, Dict, List, Optional, Tuple
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import EXCEL_IMPORT_MAX_WORKERS
+except ImportError:
+    EXCEL_IMPORT_MAX_WORKERS = 0
+
+
+def import_excel_worker(excel_path: str, db_file_path: str) -> Dict:
+    """
+    워커 프로세스 진입점: Excel 파일 하나를 새 DB 파일로 가져오기
+
+    Returns:
+        결과 딕셔너리 (프로세스 간 전달을 위해 dict 사용)
+    """
+    from data_manager.db_handler_v2 import DBHandlerV2
+    from excel_processor.excel_importer import ExcelImporter
+
+    start_time = time.time()
+    db_handler = None
+    try:
+        db_handler = DBHandlerV2(db_file_path)
+        file_id = ExcelImporter(db_handler).import_excel(excel_path, db_file_path, engine="stream")
+        return {
+            'excel_file': os.path.basename(excel_path),
+            'db_file': os.path.basename(db_file_path),
+            'db_path': db_file_path,
+            'file_id': file_id,
+            'elapsed': time.time() - start_time
+        }
+    finally:
+        if db_handler:
+            db_handler.disconnect()
+
+
+class ParallelExcelImporter:
+    """다중 Excel → DB 변환을 프로세스 풀로 분산 실행하는 스케줄러"""
+
+    def __init__(self, max_workers: Optional[int] = None, poll_interval: float = 0.1):
+        if not max_workers:
+            max_workers = EXCEL_IMPORT_MAX_WORKERS or os.cpu_count() or 1
+        self.max_workers = max(1, int(max_workers))
+        self.poll_interval = poll_interval
+
+    def run(self, jobs: List[Tuple[str, str]],
+            progress_handler: Optional[Callable[[str, int], None]] = None,
+            cancel_checker: Optional[Callable[[], bool]] = None) -> Tuple[List[Dict], List[Dict]]:
+        """
+        (Excel 파일 경로, DB 파일 경로) 목록을 병렬로 가져오기
+
+        Args:
+            jobs: [(excel_path, db_file_path), ...] - DB 파일 경로는 서로 달라야 함
+            progress_handler: (완료된 Excel 파일명, 완료 개수) 콜백 - 대기 중에도 주기적으로 호출
+            cancel_checker: True 반환 시 아직 시작하지 않은 작업 취소
+
+        Returns:
+            (성공 목록, 실패 목록) - process_multiple_excel_files 형식
+        """
+        successful, failed = [], []
+        if not jobs:
+            return successful, failed
+
+        worker_count = min(self.max_workers, len(jobs))
+        logging.info(f"🚀 병렬 Excel 가져오기 시작: {len(jobs)}개 파일, 워커 {worker_count}개")
+        start_time = time.time()
+
+        # Windows/PyInstaller 호환을 위해 spawn 컨텍스트 사용
+        ctx = multiprocessing.get_context('spawn')
+        with ProcessPoolExecutor(max_workers=worker_count, mp_context=ctx) as pool:
+            futures = {pool.submit(import_excel_worker, excel_path, db_file_path): (excel_path, db_file_path)
+                       for excel_path, db_file_path in jobs}
+            pending = set(futures)
+            completed = 0
+            cancelled = False
+
+            while pending:
+                done, pending = wait(pending, timeout=self.poll_interval, return_when=FIRST_COMPLETED)
+
+                for future in done:
+                    completed += 1
+                    excel_path, db_file_path = futures[future]
+                    excel_basename = os.path.basename(excel_path)
+                    self._collect(future, excel_basename, db_file_path, successful, failed)
+                    if progress_handler:
+                        progress_handler(excel_basename, completed)
+
+                if not done and progress_handler:
+                    progress_handler("", completed)
+
+                if not cancelled and cancel_checker and cancel_checker():
+                    logging.info("사용자가 병렬 Excel 가져오기를 취소했습니다.")
+                    cancelled = True
+                    for future in pending:
+                        future.cancel()
+
+        logging.info(f"병렬 Excel 가져오기 완료: 성공 {len(successful)}개, 실패 {len(failed)}개 "
+                     f"(총 소요시간: {time.time() - start_time:.1f}초)")
+        return successful, failed
+
+    @staticmethod
+    def _collect(future, excel_basename: str, db_file_path: str, successful: List[Dict], failed: List[Dict]):
+        """완료된 future 결과를 성공/실패 목록에 분류"""
+        if future.cancelled():
+            failed.append({'excel_file': excel_basename, 'error': '사용자 취소'})
+            return
+
+        try:
+            result = future.result()
+        except Exception as e:
+            logging.error(f"❌ Excel 가져오기 실패 [{excel_basename}]: {e}")
+            failed.append({'excel_file': excel_basename, 'error': str(e)})
+            # 반쯤 만들어진 DB 파일은 남기지 않음
+            for suffix in ("", "-wal", "-shm"):
+                try:
+                    os.remove(db_file_path + suffix)
+                except OSError:
+                    pass
+            return
+
+        successful.append({
+            'excel_file': result['excel_file'],
+            'db_file': result['db_file'],
+            'db_path': result['db_path']
+        })
+        logging.info(f"✅ Excel 가져오기 성공: {excel_basename} → {result['db_file']} ({result['elapsed']:.1f}초)")
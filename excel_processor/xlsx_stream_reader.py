@@ -0,0 +1,304 @@
+"""
+xlsx 스트리밍 리더 (Excel/xlwings 없이 zip/XML 직접 파싱)
+
+워크시트 XML을 iterparse로 한 번 읽으면서 (row, col, value) 셀 배치를 내보냅니다.
+- 수식 셀은 파일에 저장된 계산 결과(<v>)를 사용합니다 (Excel 재계산 없음).
+- 좌표는 xlwings used_range.value와 동일하게 사용 영역(<dimension>) 좌상단 기준 0부터 시작합니다.
+- 값 변환은 ExcelImporter.process_cell_value와 동일합니다 (정수형 실수 → "123", 날짜 → str(datetime)).
+"""
+
+import re
+import zipfile
+import logging
+import posixpath
+from datetime import datetime, timedelta
+from typing import Dict, Iterator, List, Optional, Tuple
+from xml.etree.ElementTree import iterparse
+
+# 한 번에 DB로 넘길 셀 개수
+DEFAULT_BATCH_SIZE = 5000
+
+_NS_MAIN = "{http://schemas.openxmlformats.org/spreadsheetml/2006/main}"
+_NS_REL = "{http://schemas.openxmlformats.org/officeDocument/2006/relationships}"
+_NS_PKG_REL = "{http://schemas.openxmlformats.org/package/2006/relationships}"
+
+_TAG_ROW = _NS_MAIN + "row"
+_TAG_C = _NS_MAIN + "c"
+_TAG_V = _NS_MAIN + "v"
+_TAG_IS = _NS_MAIN + "is"
+_TAG_T = _NS_MAIN + "t"
+_TAG_SI = _NS_MAIN + "si"
+_TAG_DIMENSION = _NS_MAIN + "dimension"
+_TAG_SHEET_DATA = _NS_MAIN + "sheetData"
+
+# 날짜/시간 내장 표시 형식 ID (ECMA-376 18.8.30)
+_BUILTIN_DATE_FORMATS = set(range(14, 23)) | {45, 46, 47}
+
+# 사용자 정의 형식에서 날짜 토큰 판별 (따옴표 문자열, 이스케이프, [색상] 등 제거 후)
+_FORMAT_STRIP_RE = re.compile(r'"[^"]*"|\\.|\[[^\]]*\]')
+_DATE_TOKEN_RE = re.compile(r'[dmyhs]', re.IGNORECASE)
+
+_CELL_REF_RE = re.compile(r'([A-Z]+)(\d+)')
+
+# OOXML 문자 이스케이프 (_x000D_ 등, 줄바꿈 CR이 이렇게 저장됨)
+_ESCAPE_RE = re.compile(r'_x([0-9A-Fa-f]{4})_')
+
+
+def column_index(letters: str) -> int:
+    """열 문자('A', 'AB')를 0부터 시작하는 열 번호로 변환"""
+    index = 0
+    for ch in letters:
+        index = index * 26 + (ord(ch) - 64)
+    return index - 1
+
+
+def parse_cell_ref(ref: str) -> Optional[Tuple[int, int]]:
+    """'B3' → (2, 1) (0부터 시작하는 행, 열)"""
+    match = _CELL_REF_RE.match(ref.replace('$', '').upper())
+    if not match:
+        return None
+    return int(match.group(2)) - 1, column_index(match.group(1))
+
+
+def convert_number(text: str, is_date: bool = False, date1904: bool = False):
+    """
+    <v> 숫자 문자열을 ExcelImporter.process_cell_value 결과와 같은 문자열로 변환
+
+    xlwings는 숫자를 float, 날짜 형식 셀을 datetime으로 돌려주므로 같은 규칙을 적용합니다.
+    """
+    number = float(text)
+    if is_date:
+        base = datetime(1904, 1, 1) if date1904 else datetime(1899, 12, 30)
+        try:
+            # xlwings(pywintypes)와 동일하게 초 단위 미만은 반올림
+            return str(base + timedelta(seconds=round(number * 86400)))
+        except OverflowError:
+            pass
+    if number == int(number):
+        return str(int(number))
+    return str(number)
+
+
+class XlsxStreamReader:
+    """
+    xlsx/xlsm 워크북 스트리밍 리더
+
+    사용 예:
+        with XlsxStreamReader(path) as reader:
+            for sheet_index, sheet_name, part in reader.worksheets():
+                for batch in reader.iter_cell_batches(part):
+                    ...
+    """
+
+    def __init__(self, file_path: str):
+        self.file_path = file_path
+        self.zip = zipfile.ZipFile(file_path)
+        self.date1904 = False
+        self._sheets: List[Tuple[str, str]] = []
+        self._shared_strings: Optional[List[str]] = None
+        self._date_styles: Optional[List[bool]] = None
+        self._read_workbook()
+
+    def close(self):
+        if self.zip:
+            self.zip.close()
+            self.zip = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc, tb):
+        self.close()
+
+    # ------------------------------------------------------------------
+    # 워크북 구조
+    # ------------------------------------------------------------------
+    def _read_workbook(self):
+        """workbook.xml + rels에서 워크시트 목록(순서 유지)과 1904 날짜 체계 여부 확인"""
+        targets = {}
+        rels_path = "xl/_rels/workbook.xml.rels"
+        if rels_path in self.zip.namelist():
+            with self.zip.open(rels_path) as f:
+                for _, elem in iterparse(f):
+                    if elem.tag == _NS_PKG_REL + "Relationship":
+                        # 차트 시트 등은 xlwings wb.sheets에도 포함되지 않으므로 워크시트만 사용
+                        if elem.get("Type", "").endswith("/worksheet"):
+                            target = elem.get("Target", "")
+                            if target.startswith("/"):
+                                part = target.lstrip("/")
+                            else:
+                                part = posixpath.normpath(posixpath.join("xl", target))
+                            targets[elem.get("Id")] = part
+
+        with self.zip.open("xl/workbook.xml") as f:
+            for _, elem in iterparse(f):
+                if elem.tag == _NS_MAIN + "workbookPr":
+                    self.date1904 = elem.get("date1904", "0") in ("1", "true")
+                elif elem.tag == _NS_MAIN + "sheet":
+                    part = targets.get(elem.get(_NS_REL + "id"))
+                    if part:
+                        self._sheets.append((elem.get("name", ""), part))
+
+    def worksheets(self) -> List[Tuple[int, str, str]]:
+        """[(시트 순서, 시트명, 내부 XML 경로), ...] - 순서는 xlwings wb.sheets와 동일"""
+        return [(index, name, part) for index, (name, part) in enumerate(self._sheets)]
+
+    @property
+    def shared_strings(self) -> List[str]:
+        """공유 문자열 테이블 (최초 사용 시 한 번만 파싱)"""
+        if self._shared_strings is None:
+            strings = []
+            path = "xl/sharedStrings.xml"
+            if path in self.zip.namelist():
+                with self.zip.open(path) as f:
+                    for _, elem in iterparse(f):
+                        if elem.tag == _TAG_SI:
+                            strings.append(self._rich_text(elem))
+                            elem.clear()
+            self._shared_strings = strings
+        return self._shared_strings
+
+    @property
+    def date_styles(self) -> List[bool]:
+        """셀 스타일(cellXfs) 인덱스별 날짜 형식 여부"""
+        if self._date_styles is None:
+            flags = []
+            path = "xl/styles.xml"
+            if path in self.zip.namelist():
+                custom_formats: Dict[int, str] = {}
+                in_cell_xfs = False
+                with self.zip.open(path) as f:
+                    for event, elem in iterparse(f, events=("start", "end")):
+                        if event == "start":
+                            if elem.tag == _NS_MAIN + "cellXfs":
+                                in_cell_xfs = True
+                            continue
+                        if elem.tag == _NS_MAIN + "numFmt":
+                            custom_formats[int(elem.get("numFmtId", "0"))] = elem.get("formatCode", "")
+                        elif elem.tag == _NS_MAIN + "xf" and in_cell_xfs:
+                            fmt_id = int(elem.get("numFmtId", "0"))
+                            flags.append(self._is_date_format(fmt_id, custom_formats.get(fmt_id)))
+                        elif elem.tag == _NS_MAIN + "cellXfs":
+                            in_cell_xfs = False
+            self._date_styles = flags
+        return self._date_styles
+
+    @staticmethod
+    def _is_date_format(fmt_id: int, format_code: Optional[str]) -> bool:
+        if fmt_id in _BUILTIN_DATE_FORMATS:
+            return True
+        if not format_code:
+            return False
+        stripped = _FORMAT_STRIP_RE.sub("", format_code.split(";")[0])
+        return bool(_DATE_TOKEN_RE.search(stripped))
+
+    @staticmethod
+    def _rich_text(elem) -> str:
+        """<si>/<is> 요소의 텍스트 (서식 run 연결, 윗주(rPh) 제외)"""
+        parts = []
+        for child in elem:
+            if child.tag == _TAG_T:
+                parts.append(child.text or "")
+            elif child.tag == _NS_MAIN + "r":
+                for t in child.iter(_TAG_T):
+                    parts.append(t.text or "")
+        text = "".join(parts)
+        if "_x" in text:
+            text = _ESCAPE_RE.sub(lambda m: chr(int(m.group(1), 16)), text)
+        return text
+
+    # ------------------------------------------------------------------
+    # 셀 스트리밍
+    # ------------------------------------------------------------------
+    def iter_cell_batches(self, part: str, batch_size: int = DEFAULT_BATCH_SIZE) -> Iterator[List[Tuple[int, int, str]]]:
+        """
+        워크시트 셀을 (row, col, value) 배치로 스트리밍
+
+        값이 없는 셀(빈 문자열/오류 값)은 제외하며, 좌표는 사용 영역 좌상단 기준입니다.
+        <dimension>이 없는 파일(일부 외부 도구 생성)은 전체 셀을 읽은 뒤 최소 좌표를 기준으로 합니다.
+        """
+        shared = None
+        date_styles = None
+        origin: Optional[Tuple[int, int]] = None
+        pending: List[Tuple[int, int, str]] = []
+        batch: List[Tuple[int, int, str]] = []
+        row_index = -1
+
+        with self.zip.open(part) as f:
+            context = iterparse(f, events=("start", "end"))
+            for event, elem in context:
+                tag = elem.tag
+                if event == "start":
+                    if tag == _TAG_ROW:
+                        r = elem.get("r")
+                        row_index = int(r) - 1 if r else row_index + 1
+                        col_index = -1
+                    elif tag == _TAG_DIMENSION:
+                        ref = elem.get("ref", "")
+                        origin = parse_cell_ref(ref.split(":")[0]) if ref else None
+                    continue
+
+                if tag == _TAG_C:
+                    ref = elem.get("r")
+                    if ref:
+                        position = parse_cell_ref(ref)
+                        col_index = position[1]
+                    else:
+                        col_index += 1
+                        position = (row_index, col_index)
+
+                    cell_type = elem.get("t", "n")
+                    value = None
+                    if cell_type == "inlineStr":
+                        inline = elem.find(_TAG_IS)
+                        if inline is not None:
+                            value = self._rich_text(inline)
+                    else:
+                        v = elem.find(_TAG_V)
+                        text = v.text if v is not None else None
+                        if text is not None:
+                            if cell_type == "s":
+                                if shared is None:
+                                    shared = self.shared_strings
+                                value = shared[int(text)]
+                            elif cell_type == "n":
+                                if date_styles is None:
+                                    date_styles = self.date_styles
+                                style = int(elem.get("s", "0"))
+                                is_date = style < len(date_styles) and date_styles[style]
+                                value = convert_number(text, is_date, self.date1904)
+                            elif cell_type == "b":
+                                # xlwings는 bool 반환 → process_cell_value_fast 결과는 "True"/"False"
+                                value = "True" if text == "1" else "False"
+                            elif cell_type in ("str", "d"):
+                                value = text
+                            # 오류 값(t="e")은 xlwings에서 None이므로 제외
+
+                    if value and value.strip():
+                        if origin is None:
+                            pending.append((position[0], position[1], value))
+                        else:
+                            batch.append((position[0] - origin[0], position[1] - origin[1], value))
+                            if len(batch) >= batch_size:
+                                yield batch
+                                batch = []
+                    elem.clear()
+
+                elif tag == _TAG_ROW:
+                    elem.clear()
+                elif tag == _TAG_SHEET_DATA:
+                    break
+
+        if pending:
+            min_row = min(cell[0] for cell in pending)
+            min_col = min(cell[1] for cell in pending)
+            pending = [(r - min_row, c - min_col, value) for r, c, value in pending]
+            for start in range(0, len(pending), batch_size):
+                yield pending[start:start + batch_size]
+        if batch:
+            yield batch
+
+
+def is_streamable(file_path: str) -> bool:
+    """스트리밍 리더로 읽을 수 있는 파일인지 (xlsx/xlsm, 바이너리 xls/xlsb 제외)"""
+    return file_path.lower().endswith((".xlsx", ".xlsm")) and zipfile.is_zipfile(file_path)
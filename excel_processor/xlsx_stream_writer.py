@@ -0,0 +1,377 @@
+"""
+xlsx 스트리밍 라이터 (Excel/xlwings 없이 zip/XML 직접 작성)
+
+DB 시트를 (row, col) 정렬 커서에서 행 단위로 읽어 워크시트 XML을 zip 항목에 바로 씁니다.
+- 시트 전체 2차원 배열을 만들지 않음 (메모리는 행 하나 + 공유 문자열 테이블)
+- 열 주소는 A..Z, AA..XFD 전 범위 지원 (범위 제한 없음)
+- 문자열은 공유 문자열 테이블(sharedStrings.xml)에 한 번만 저장
+- 숫자는 XlsxStreamReader로 다시 읽었을 때 같은 문자열이 되는 경우에만 숫자 셀로 저장
+  ("007", "1e3", "1.50" 등은 문자열 셀) → 가져오기/내보내기 왕복 시 값이 바뀌지 않음
+- 좌표는 A1 기준 (XlsxStreamReader/xlwings used_range와 같은 원점)
+"""
+
+import os
+import re
+import math
+import time
+import zipfile
+import logging
+from typing import Dict, Iterator, List, Tuple
+from xml.sax.saxutils import escape, quoteattr
+
+from excel_processor.xlsx_stream_reader import convert_number
+
+# 계측 (비활성화 시 no-op)
+from core.tracing import tracer, traced
+
+# 커서에서 한 번에 가져오는 셀 수
+_FETCH_CELLS = 10000
+
+# zip 항목에 한 번에 쓰는 XML 크기 (문자 수)
+_WRITE_CHUNK = 256 * 1024
+
+# Excel 시트 크기 제한
+MAX_ROWS = 1048576
+MAX_COLS = 16384
+
+# 시트명 제한 (31자, 금지 문자 []:*?/\)
+_SHEET_NAME_MAX = 31
+_SHEET_NAME_INVALID_RE = re.compile(r'[\[\]:*?/\\]')
+
+# XML 1.0에서 쓸 수 없거나 파싱 시 바뀌는 제어 문자(탭/줄바꿈 제외, CR 포함) → OOXML _xHHHH_ 이스케이프
+_CONTROL_RE = re.compile('[\x00-\x08\x0b-\x1f\ufffe\uffff]')
+# 원래 문자열에 있는 _xHHHH_ 형태는 _x005F_ 접두로 보호 (읽을 때 제어 문자로 바뀌지 않도록)
+_LITERAL_ESCAPE_RE = re.compile(r'_(x[0-9A-Fa-f]{4}_)')
+
+_NS_MAIN = "http://schemas.openxmlformats.org/spreadsheetml/2006/main"
+_NS_REL = "http://schemas.openxmlformats.org/officeDocument/2006/relationships"
+_NS_PKG_REL = "http://schemas.openxmlformats.org/package/2006/relationships"
+_XML_HEADER = '<?xml version="1.0" encoding="UTF-8" standalone="yes"?>\n'
+
+
+def column_letter(col: int) -> str:
+    """0부터 시작하는 열 번호를 열 문자로 변환 (0 → 'A', 26 → 'AA', 16383 → 'XFD')"""
+    letters = ""
+    col += 1
+    while col > 0:
+        col, remainder = divmod(col - 1, 26)
+        letters = chr(65 + remainder) + letters
+    return letters
+
+
+def range_address(row_count: int, col_count: int) -> str:
+    """A1 기준 사용 영역 주소 (예: 3행 30열 → 'A1:AD3')"""
+    if row_count <= 0 or col_count <= 0:
+        return "A1"
+    return f"A1:{column_letter(col_count - 1)}{row_count}"
+
+
+def xml_text(value: str) -> str:
+    """셀 문자열을 XML 텍스트로 이스케이프 (OOXML _xHHHH_ 규칙 포함)"""
+    if "_x" in value:
+        value = _LITERAL_ESCAPE_RE.sub(r'_x005F_\1', value)
+    if _CONTROL_RE.search(value):
+        value = _CONTROL_RE.sub(lambda m: f"_x{ord(m.group(0)):04X}_", value)
+    return escape(value)
+
+
+def is_number_literal(value: str) -> bool:
+    """숫자 셀로 저장해도 다시 읽을 때 같은 문자열이 되는지 (XlsxStreamReader.convert_number 기준)"""
+    if not value or value[0] not in "-0123456789" or "_" in value:
+        return False
+    try:
+        number = float(value)
+    except ValueError:
+        return False
+    return math.isfinite(number) and convert_number(value) == value
+
+
+def safe_sheet_names(names: List[str]) -> List[str]:
+    """Excel 규칙에 맞는 시트명 목록 (금지 문자 치환, 31자 제한, 대소문자 무시 중복 제거)"""
+    result = []
+    used = set()
+    for index, name in enumerate(names):
+        safe = _SHEET_NAME_INVALID_RE.sub("_", name).strip("'")[:_SHEET_NAME_MAX] or f"Sheet{index + 1}"
+        candidate = safe
+        suffix = 2
+        while candidate.lower() in used:
+            tail = f"({suffix})"
+            candidate = safe[:_SHEET_NAME_MAX - len(tail)] + tail
+            suffix += 1
+        if candidate != name:
+            logging.warning(f"⚠ Excel 시트명 규칙에 맞게 변경: '{name}' → '{candidate}'")
+        used.add(candidate.lower())
+        result.append(candidate)
+    return result
+
+
+def iter_sheet_rows(db_handler, sheet_id: int) -> Tuple[int, int, Iterator[Tuple[int, List[Tuple[int, str]]]]]:
+    """
+    시트의 크기와 행 단위 셀 스트림
+
+    Returns:
+        (행 수, 열 수, [(행, [(열, 값), ...]), ...] 반복자) - 값이 있는 행만, 행/열 오름차순
+        논리 순서(axis_order)가 있는 시트는 화면 좌표로 변환 (DB는 변경하지 않음)
+    """
+    visual_cells = db_handler.visual_cells(sheet_id)
+    if visual_cells is not None:
+        row_count = max((cell[0] for cell in visual_cells), default=-1) + 1
+        col_count = max((cell[1] for cell in visual_cells), default=-1) + 1
+        cells = iter(visual_cells)
+    else:
+        cursor = db_handler.conn.cursor()
+        cursor.row_factory = None
+        max_row, max_col = cursor.execute(
+            "SELECT MAX(row), MAX(col) FROM cells WHERE sheet_id = ? AND value IS NOT NULL AND value != ''",
+            (sheet_id,)
+        ).fetchone()
+        row_count = max_row + 1 if max_row is not None else 0
+        col_count = max_col + 1 if max_col is not None else 0
+        cells = _iter_cursor(db_handler, sheet_id)
+
+    def rows():
+        current_row = -1
+        current: List[Tuple[int, str]] = []
+        for row, col, value in cells:
+            if row != current_row:
+                if current:
+                    yield current_row, current
+                current = []
+                current_row = row
+            current.append((col, value))
+        if current:
+            yield current_row, current
+
+    return row_count, col_count, rows()
+
+
+def _iter_cursor(db_handler, sheet_id: int):
+    cursor = db_handler.conn.cursor()
+    cursor.row_factory = None
+    cursor.execute("""
+        SELECT row, col, value FROM cells
+        WHERE sheet_id = ? AND value IS NOT NULL AND value != ''
+        ORDER BY row, col
+    """, (sheet_id,))
+    while True:
+        batch = cursor.fetchmany(_FETCH_CELLS)
+        if not batch:
+            break
+        yield from batch
+
+
+class XlsxStreamWriter:
+    """
+    xlsx 파일 스트리밍 작성기
+
+    사용 예:
+        with XlsxStreamWriter("out.xlsx") as writer:
+            writer.write_sheet("Sheet1", row_count, col_count, rows)
+
+    시트 XML은 write_sheet 호출 즉시 zip에 기록되고, 공유 문자열/통합 문서 정보는 close 시 기록합니다.
+    임시 파일에 쓴 뒤 os.replace로 교체하므로 실패해도 기존 파일은 유지됩니다.
+    """
+
+    def __init__(self, file_path: str):
+        self.file_path = file_path
+        self.temp_path = file_path + ".tmp"
+        self.zip = zipfile.ZipFile(self.temp_path, "w", compression=zipfile.ZIP_DEFLATED, compresslevel=1)
+        self.sheet_names: List[str] = []
+        self.strings: Dict[str, int] = {}
+        self.string_refs = 0
+        self.cell_count = 0
+        self._columns: List[str] = []
+        self._closed = False
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc, tb):
+        if exc_type is None:
+            self.close()
+        else:
+            self.abort()
+
+    def _column(self, col: int) -> str:
+        columns = self._columns
+        while len(columns) <= col:
+            columns.append(column_letter(len(columns)))
+        return columns[col]
+
+    def write_sheet(self, name: str, row_count: int, col_count: int,
+                    rows: Iterator[Tuple[int, List[Tuple[int, str]]]]) -> int:
+        """
+        워크시트 하나 작성 - 작성한 셀 수 반환
+
+        Args:
+            name: 시트명 (safe_sheet_names로 정리된 이름)
+            row_count, col_count: 사용 영역 크기 (<dimension>)
+            rows: [(행, [(열, 값), ...]), ...] - 행/열 오름차순 (0부터 시작)
+        """
+        if row_count > MAX_ROWS or col_count > MAX_COLS:
+            raise ValueError(f"시트 '{name}' 크기({row_count}x{col_count})가 Excel 제한"
+                             f"({MAX_ROWS}x{MAX_COLS})을 넘습니다.")
+
+        self.sheet_names.append(name)
+        part = f"xl/worksheets/sheet{len(self.sheet_names)}.xml"
+        strings = self.strings
+        column = self._column
+        written = 0
+
+        with self.zip.open(part, "w", force_zip64=True) as f:
+            f.write((_XML_HEADER + f'<worksheet xmlns="{_NS_MAIN}" xmlns:r="{_NS_REL}">'
+                     f'<dimension ref="{range_address(row_count, col_count)}"/>'
+                     '<sheetData>').encode("utf-8"))
+            chunk: List[str] = []
+            chunk_size = 0
+            for row, cells in rows:
+                r = str(row + 1)
+                parts = [f'<row r="{r}">']
+                for col, value in cells:
+                    if is_number_literal(value):
+                        parts.append(f'<c r="{column(col)}{r}"><v>{value}</v></c>')
+                    else:
+                        index = strings.get(value)
+                        if index is None:
+                            index = strings[value] = len(strings)
+                        parts.append(f'<c r="{column(col)}{r}" t="s"><v>{index}</v></c>')
+                        self.string_refs += 1
+                parts.append('</row>')
+                written += len(cells)
+                line = "".join(parts)
+                chunk.append(line)
+                chunk_size += len(line)
+                if chunk_size >= _WRITE_CHUNK:
+                    f.write("".join(chunk).encode("utf-8"))
+                    chunk = []
+                    chunk_size = 0
+            if chunk:
+                f.write("".join(chunk).encode("utf-8"))
+            f.write(b'</sheetData></worksheet>')
+
+        self.cell_count += written
+        return written
+
+    def _write_shared_strings(self):
+        with self.zip.open("xl/sharedStrings.xml", "w", force_zip64=True) as f:
+            f.write((_XML_HEADER + f'<sst xmlns="{_NS_MAIN}" count="{self.string_refs}" '
+                     f'uniqueCount="{len(self.strings)}">').encode("utf-8"))
+            chunk: List[str] = []
+            chunk_size = 0
+            # dict는 삽입 순서 유지 → 인덱스 순서와 같음
+            for value in self.strings:
+                text = xml_text(value)
+                space = ' xml:space="preserve"' if value[:1].isspace() or value[-1:].isspace() else ''
+                item = f'<si><t{space}>{text}</t></si>'
+                chunk.append(item)
+                chunk_size += len(item)
+                if chunk_size >= _WRITE_CHUNK:
+                    f.write("".join(chunk).encode("utf-8"))
+                    chunk = []
+                    chunk_size = 0
+            if chunk:
+                f.write("".join(chunk).encode("utf-8"))
+            f.write(b'</sst>')
+
+    def _write_package_parts(self):
+        sheet_count = len(self.sheet_names)
+        overrides = "".join(
+            f'<Override PartName="/xl/worksheets/sheet{i}.xml" '
+            'ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml"/>'
+            for i in range(1, sheet_count + 1))
+        self.zip.writestr("[Content_Types].xml", _XML_HEADER + (
+            '<Types xmlns="http://schemas.openxmlformats.org/package/2006/content-types">'
+            '<Default Extension="rels" ContentType="application/vnd.openxmlformats-package.relationships+xml"/>'
+            '<Default Extension="xml" ContentType="application/xml"/>'
+            '<Override PartName="/xl/workbook.xml" '
+            'ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.sheet.main+xml"/>'
+            '<Override PartName="/xl/styles.xml" '
+            'ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.styles+xml"/>'
+            '<Override PartName="/xl/sharedStrings.xml" '
+            'ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.sharedStrings+xml"/>'
+            f'{overrides}</Types>'))
+        self.zip.writestr("_rels/.rels", _XML_HEADER + (
+            f'<Relationships xmlns="{_NS_PKG_REL}">'
+            f'<Relationship Id="rId1" Type="{_NS_REL}/officeDocument" Target="xl/workbook.xml"/>'
+            '</Relationships>'))
+
+        sheets = "".join(f'<sheet name={quoteattr(name)} sheetId="{i}" r:id="rId{i}"/>'
+                         for i, name in enumerate(self.sheet_names, 1))
+        self.zip.writestr("xl/workbook.xml", _XML_HEADER + (
+            f'<workbook xmlns="{_NS_MAIN}" xmlns:r="{_NS_REL}"><sheets>{sheets}</sheets></workbook>'))
+
+        rels = "".join(f'<Relationship Id="rId{i}" Type="{_NS_REL}/worksheet" Target="worksheets/sheet{i}.xml"/>'
+                       for i in range(1, sheet_count + 1))
+        self.zip.writestr("xl/_rels/workbook.xml.rels", _XML_HEADER + (
+            f'<Relationships xmlns="{_NS_PKG_REL}">{rels}'
+            f'<Relationship Id="rId{sheet_count + 1}" Type="{_NS_REL}/styles" Target="styles.xml"/>'
+            f'<Relationship Id="rId{sheet_count + 2}" Type="{_NS_REL}/sharedStrings" Target="sharedStrings.xml"/>'
+            '</Relationships>'))
+
+        # 최소 스타일 (일반 서식 하나) - 날짜 서식 없음 → 숫자 셀은 그대로 숫자로 읽힘
+        self.zip.writestr("xl/styles.xml", _XML_HEADER + (
+            f'<styleSheet xmlns="{_NS_MAIN}">'
+            '<fonts count="1"><font><sz val="11"/><name val="Calibri"/></font></fonts>'
+            '<fills count="2"><fill><patternFill patternType="none"/></fill>'
+            '<fill><patternFill patternType="gray125"/></fill></fills>'
+            '<borders count="1"><border><left/><right/><top/><bottom/><diagonal/></border></borders>'
+            '<cellStyleXfs count="1"><xf numFmtId="0" fontId="0" fillId="0" borderId="0"/></cellStyleXfs>'
+            '<cellXfs count="1"><xf numFmtId="0" fontId="0" fillId="0" borderId="0" xfId="0"/></cellXfs>'
+            '<cellStyles count="1"><cellStyle name="Normal" xfId="0" builtinId="0"/></cellStyles>'
+            '</styleSheet>'))
+
+    def close(self):
+        """공유 문자열/통합 문서 정보 기록 후 대상 경로로 교체"""
+        if self._closed:
+            return
+        try:
+            if not self.sheet_names:
+                # Excel은 시트 없는 통합 문서를 열지 못함
+                self.write_sheet("Sheet1", 0, 0, iter(()))
+            self._write_shared_strings()
+            self._write_package_parts()
+            self.zip.close()
+            os.replace(self.temp_path, self.file_path)
+        except BaseException:
+            self.abort()
+            raise
+        self._closed = True
+
+    def abort(self):
+        """작성 중단 - 임시 파일 삭제 (기존 대상 파일 유지)"""
+        if self._closed:
+            return
+        self._closed = True
+        try:
+            self.zip.close()
+        except Exception:
+            pass
+        try:
+            os.remove(self.temp_path)
+        except OSError:
+            pass
+
+
+@traced("xlsx.export_db", "excel")
+def export_db_to_xlsx(db_handler, output_path: str) -> Dict:
+    """
+    DB 하나의 모든 시트를 xlsx 파일로 스트리밍 내보내기
+
+    Returns:
+        {'sheets': 시트 수, 'cells': 셀 수, 'strings': 공유 문자열 수, 'elapsed': 소요 시간}
+    """
+    start_time = time.time()
+    sheets = db_handler.get_sheets()
+    names = safe_sheet_names([sheet['name'] for sheet in sheets])
+
+    with XlsxStreamWriter(output_path) as writer:
+        for sheet, name in zip(sheets, names):
+            with tracer.span("xlsx.write_sheet", "excel", sheet=sheet['name']):
+                row_count, col_count, rows = iter_sheet_rows(db_handler, sheet['id'])
+                writer.write_sheet(name, row_count, col_count, rows)
+        summary = {'sheets': len(sheets), 'cells': writer.cell_count, 'strings': len(writer.strings)}
+
+    summary['elapsed'] = time.time() - start_time
+    logging.info(f"✓ xlsx 내보내기 완료: {output_path} (시트 {summary['sheets']}개, 셀 {summary['cells']}개, "
+                 f"{summary['elapsed']:.2f}초)")
+    return summary
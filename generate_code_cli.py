@@ -0,0 +1,118 @@
+"""
+명령행 코드 생성 도구 (GUI 없이 실행)
+
+야간 빌드 등에서 database/*.db 전체를 재생성할 때 사용합니다.
+
+사용 예:
+    python generate_code_cli.py                              # database/*.db → generated_output/
+    python generate_code_cli.py --jobs 8                     # DB별 워커 프로세스 8개로 병렬 생성
+    python generate_code_cli.py -o out "database/04_*.db"    # 특정 DB만 생성
+"""
+
+import os
+import sys
+import glob
+import time
+import logging
+import argparse
+
+from code_generator.headless_generator import GenerationObserver, generate_database
+
+
+class ConsoleObserver(GenerationObserver):
+    """진행률을 콘솔에 출력하는 관찰자 (10% 단위)"""
+
+    def __init__(self, db_name: str):
+        self.db_name = db_name
+        self._last_step = -1
+
+    def on_progress(self, progress: int, message: str):
+        step = progress // 10
+        if step != self._last_step:
+            self._last_step = step
+            print(f"  [{self.db_name}] {progress:3d}% {message}", flush=True)
+
+
+def collect_db_files(patterns, db_dir):
+    """입력 패턴/디렉토리에서 DB 파일 목록 수집 (정렬, 중복 제거)"""
+    if not patterns:
+        patterns = [os.path.join(db_dir, "*.db")]
+
+    db_files = []
+    for pattern in patterns:
+        matches = glob.glob(pattern) if any(ch in pattern for ch in "*?[") else [pattern]
+        for path in matches:
+            if path.endswith('.db') and os.path.isfile(path) and path not in db_files:
+                db_files.append(path)
+    return sorted(db_files)
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description="DB 파일에서 C 소스/헤더 코드 생성 (GUI 없음)")
+    parser.add_argument("db_files", nargs="*", help="DB 파일 경로 또는 glob 패턴 (기본: <db-dir>/*.db)")
+    parser.add_argument("--db-dir", default="database", help="DB 파일 디렉토리 (기본: database)")
+    parser.add_argument("-o", "--output", default="generated_output", help="출력 루트 디렉토리 (DB명 하위 폴더에 저장)")
+    parser.add_argument("-j", "--jobs", type=int, default=1, help="병렬 워커 프로세스 수 (0: CPU 코어 수)")
+    parser.add_argument("--full", action="store_true", help="증분 생성/시트 IR 캐시를 무시하고 전체 재생성")
+    parser.add_argument("-v", "--verbose", action="store_true", help="상세 로그 출력")
+    args = parser.parse_args(argv)
+
+    logging.basicConfig(level=logging.INFO if args.verbose else logging.ERROR,
+                        format="%(asctime)s - %(levelname)s - %(message)s")
+
+    try:
+        from core.performance_settings import USE_INCREMENTAL_CODE_GEN
+    except ImportError:
+        USE_INCREMENTAL_CODE_GEN = False
+    incremental = USE_INCREMENTAL_CODE_GEN and not args.full
+    use_sheet_ir = False if args.full else None  # None: USE_SHEET_IR_CACHE 설정 사용
+
+    db_files = collect_db_files(args.db_files, args.db_dir)
+    if not db_files:
+        print(f"❌ 코드 생성할 DB 파일이 없습니다: {args.db_files or args.db_dir}")
+        return 2
+
+    print(f"🚀 코드 생성 시작: {len(db_files)}개 DB → {args.output}")
+    start_time = time.time()
+    failed = []
+
+    if args.jobs != 1 and len(db_files) > 1:
+        from code_generator.parallel_generator import ParallelCodeGenerator
+
+        scheduler = ParallelCodeGenerator(max_workers=args.jobs or None, incremental=incremental,
+                                          use_sheet_ir=use_sheet_ir)
+        successful, failed_results = scheduler.run(db_files, args.output)
+        for item in successful:
+            print(f"✓ {item['db_name']}: {item['file_count']}개 파일")
+        for item in failed_results:
+            print(f"❌ {item['db_name']}: {item['error']}")
+            if not item['error'].startswith('코드 생성할 $ 시트가 없음'):
+                failed.append(item['db_name'])
+    else:
+        for db_file in db_files:
+            db_name = os.path.basename(db_file)
+            db_output_dir = os.path.join(args.output, os.path.splitext(db_name)[0])
+            result = generate_database(db_file, db_output_dir, ConsoleObserver(db_name), incremental, use_sheet_ir)
+
+            if result.status == 'success':
+                reused = sum(1 for group in result.groups if group.reused)
+                reused_text = f", 변경 없는 그룹 {reused}개 재사용" if reused else ""
+                print(f"✓ {db_name}: {len(result.written_files)}개 파일 ({result.elapsed:.2f}초{reused_text})")
+            elif result.status == 'skipped':
+                print(f"⚠ {db_name}: {result.error}")
+            else:
+                print(f"❌ {db_name}: {result.error}")
+                failed.append(db_name)
+
+            for err in result.errors:
+                print(f"    {err}")
+
+    print(f"코드 생성 완료: 실패 {len(failed)}개 (총 소요시간: {time.time() - start_time:.1f}초)")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    # 병렬 워커 프로세스 지원 (PyInstaller 빌드 포함)
+    import multiprocessing
+    multiprocessing.freeze_support()
+    sys.exit(main())
@@ -9,11 +9,14 @@ os.environ['QT_LOGGING_RULES'] = 'qt.qpa.fonts=false'
 
 # 애플리케이션 정보는 core/info.py에서 중앙 관리
 
+# 시작 단계 시간 기록 (기준 시각이 프로세스 시작에 가깝도록 가장 먼저 import)
+from core.startup_profiler import startup_profiler
+
 from PySide6.QtWidgets import (
     QApplication, QMainWindow, QWidget, QVBoxLayout, QHBoxLayout,
     QPushButton, QMessageBox, QFileDialog, QLabel, QSplitter,
     QStatusBar, QToolBar, QInputDialog, QLineEdit, QDialog,
-    QTextEdit, QListWidget, QComboBox
+    QTextEdit, QListWidget, QComboBox, QAbstractItemView
 )
 # 수정 후
 from PySide6.QtCore import Qt, QSize, Signal, Slot, QUrl, QSettings, QTimer
@@ -22,18 +25,25 @@ from PySide6.QtGui import QAction, QIcon, QDesktopServices, QFont, QKeySequence
 from data_manager.db_handler_v2 import DBHandlerV2
 from data_manager.db_manager import DBManager
 from excel_processor.excel_importer import ExcelImporter
+from excel_processor.xlsx_stream_reader import is_streamable
 from excel_processor.excel_exporter import ExcelExporter
 from ui.ui_components import TreeView, ExcelGridView # VirtualizedGridModel 사용하는 버전
 from core.data_parser import DataParser
-from utils.git_manager import GitManager, DBHistoryManager
-from ui.git_status_dialog import GitStatusDialog
+from core.tracing import tracer
+# Git 관리자, Git/성능 대화상자, 히스토리 작업, 코드 생성기는 사용 시점에 import
+# (창 표시 후 StartupWarmupWorker가 백그라운드에서 미리 로드)
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import USE_STAGED_STARTUP, STARTUP_WARMUP_DELAY_MS
+except ImportError:
+    USE_STAGED_STARTUP = True
+    STARTUP_WARMUP_DELAY_MS = 0
 # from commit_dialog import CommitFileDialog  # 더 이상 사용하지 않음
 
 # 기존 코드 가져오기 (안전한 import)
 try:
     from core.info import Info, SShtInfo, EMkFile
-    from code_generator.make_code import MakeCode
-    from code_generator.cal_list import CalList
     logging.info("✓ 필수 모듈 로드 성공")
 except ImportError as e:
     logging.error(f"기존 코드 모듈 import 실패: {e}. 경로를 확인하세요.")
@@ -164,7 +174,8 @@ def detailed_logged_subprocess_run(*args, **kwargs):
             kwargs['encoding'] = 'utf-8'
             kwargs['errors'] = 'replace'  # 디코딩 오류 시 대체 문자 사용
 
-        result = original_run(*args, **kwargs)
+        with tracer.span("subprocess", "git", cmd=cmd_str[:120]):
+            result = original_run(*args, **kwargs)
 
         # 실행 시간 계산
         execution_time = time.time() - start_time
@@ -237,7 +248,7 @@ class OriginalFileSurrogate:
             if is_dollar_sheet:
                 try:
                     # 시트 데이터 가져오기 (2D 리스트 형태)
-                    sheet_data = self.db.get_sheet_data(sheet_id)
+                    sheet_data = self.db.get_sheet_data_for_code_gen(sheet_id)
 
                     # SShtInfo 객체 생성 (DataParser 사용)
                     sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, sheet_data)
@@ -305,29 +316,117 @@ class DBExcelEditor(QMainWindow):
         # 기존 코드 연동을 위한 객체 (필요 시점에 생성)
         self.original_surrogate: Optional[OriginalFileSurrogate] = None
 
-        # UI 초기화 (Git 설정 전에 먼저 UI 생성)
-        self.init_ui()
-
-        # Git 설정 확인 및 강제 설정 다이얼로그
+        # Git 관리자 (단계적 시작에서는 창 표시 후 백그라운드에서 생성)
         self.git_manager = None
         self.history_manager = None
+        self.history_export_worker: Optional['HistoryExportWorker'] = None
+        self.history_export_progress = None
         self.git_config_needed = True
+        self.startup_worker = None
+        self.symbol_search_dialog = None
+
+        # UI 초기화 (Git 설정 전에 먼저 UI 생성)
+        with startup_profiler.phase("ui"):
+            self.init_ui()
+
+        # Git 상태 자동 업데이트 타이머 (3초마다, 단계적 시작에서는 Git 준비 후 시작)
+        self.git_status_timer = QTimer()
+        self.git_status_timer.timeout.connect(self.update_git_status_display)
+
+        if USE_STAGED_STARTUP:
+            # 이벤트 루프 시작(창 표시) 직후 마지막 DB 로드 → 백그라운드 Git/모듈 준비
+            self.update_git_status("Git 준비 중...", "info")
+            QTimer.singleShot(0, self.run_staged_startup)
+        else:
+            self.run_blocking_startup()
+            self.git_status_timer.start(3000)  # 3초마다 업데이트
+
+        # 오래 사용하지 않은 DB 연결 해제 타이머 (다시 사용하면 자동 재연결)
+        self.db_idle_timer = QTimer()
+        self.db_idle_timer.timeout.connect(self.release_idle_db_connections)
+        self.db_idle_timer.start(60000)  # 1분마다 확인
+
+        # 애플리케이션 종료 시 DB 연결 해제 보장
+        QApplication.instance().aboutToQuit.connect(self.cleanup)
+
+    def run_blocking_startup(self):
+        """기존 시작 순서 (USE_STAGED_STARTUP = False): 브랜치 표시 → DB 로드 → Git 설정을 창 표시 전에 모두 실행"""
+        self.update_branch_display()
+        self.update_git_status("Git 준비 완료", "success")
+
+        with startup_profiler.phase("last_db"):
+            self.load_initial_databases()
 
         # Git 설정 초기화 및 검증
-        if not self.initialize_git_config():
+        with startup_profiler.phase("git_manager"):
+            git_ready = self.initialize_git_config()
+        if not git_ready:
             # Git 설정 실패 시 프로그램 종료
             logging.critical("Git 설정이 완료되지 않아 프로그램을 종료합니다.")
             QMessageBox.critical(self, "설정 필요",
                                "Git 설정이 필요합니다. 프로그램을 다시 시작해주세요.")
             sys.exit(1)
 
-        # Git 상태 자동 업데이트 타이머 (3초마다)
-        self.git_status_timer = QTimer()
-        self.git_status_timer.timeout.connect(self.update_git_status_display)
+        startup_profiler.log_summary()
+
+    def run_staged_startup(self):
+        """
+        단계적 시작: 창이 표시된 뒤 마지막 DB/시트를 먼저 로드하고,
+        Git 관리자·브랜치 목록·무거운 모듈 import는 작업 스레드에서 준비
+        """
+        startup_profiler.mark("window_shown")
+
+        with startup_profiler.phase("last_db"):
+            self.load_initial_databases()
+        startup_profiler.mark("usable")
+
+        QTimer.singleShot(STARTUP_WARMUP_DELAY_MS, self.start_background_warmup)
+
+    def start_background_warmup(self):
+        """백그라운드 준비 작업 시작 (결과는 GUI 스레드의 슬롯에서 반영)"""
+        from ui.startup_worker import StartupWarmupWorker
+
+        worker = StartupWarmupWorker(self)
+        worker.git_ready.connect(self.on_startup_git_ready)
+        worker.finished.connect(self.on_startup_warmup_finished)
+        self.startup_worker = worker
+        worker.start()
+
+    def on_startup_git_ready(self, result: dict):
+        """백그라운드에서 생성한 Git 관리자 적용 (사용자 작업으로 먼저 생성된 경우 기존 것 유지)"""
+        if self.git_manager is None:
+            if result.get('error') or result.get('git_manager') is None:
+                logging.error(f"Git 설정 초기화 실패: {result.get('error')}")
+                self.update_git_status("Git 초기화 실패", "error")
+                QMessageBox.critical(self, "Git 설정 오류",
+                                   f"Git 설정 초기화 중 오류가 발생했습니다:\n{result.get('error')}\n\n"
+                                   "Git 기능을 사용하려면 프로그램을 다시 시작해주세요.")
+                return
+            self.git_manager = result['git_manager']
+            self.history_manager = result['history_manager']
+            logging.info("Git 관리자 초기화 완료 (로컬 Git 전용, 백그라운드)")
+
+        # 브랜치 목록/상태는 작업 스레드에서 채운 캐시를 사용 (refs가 그대로면 git 실행 없음)
+        with startup_profiler.phase("git_display"):
+            if hasattr(self, 'branch_combo'):
+                self.refresh_branches()
+            self.update_git_status_display()
         self.git_status_timer.start(3000)  # 3초마다 업데이트
 
-        # 애플리케이션 종료 시 DB 연결 해제 보장
-        QApplication.instance().aboutToQuit.connect(self.cleanup)
+    def on_startup_warmup_finished(self):
+        startup_profiler.mark("warmup_done")
+        startup_profiler.log_summary()
+
+    def ensure_git_manager(self) -> bool:
+        """
+        Git 관리자가 필요한 작업 전에 호출 - 백그라운드 준비가 끝나기 전이면 바로 생성
+
+        Returns:
+            bool: Git 관리자 사용 가능 여부
+        """
+        if self.git_manager:
+            return True
+        return self.initialize_git_config()
 
     def initialize_git_config(self) -> bool:
         """
@@ -340,6 +439,7 @@ class DBExcelEditor(QMainWindow):
         """
         try:
             # Git 관리자 초기화 (로컬 Git만 사용)
+            from utils.git_manager import GitManager, DBHistoryManager
             self.git_manager = GitManager()
             self.history_manager = DBHistoryManager(self.git_manager)
 
@@ -623,15 +723,6 @@ class DBExcelEditor(QMainWindow):
         # 툴바 생성 제거 (중복 기능이므로 메뉴만 사용)
         # self.create_tool_bar()
 
-        # 초기 브랜치 정보 업데이트
-        self.update_branch_display()
-
-        # 초기 Git 상태 설정
-        self.update_git_status("Git 준비 완료", "success")
-
-        # 초기 DB 로드 시도
-        self.load_initial_databases()
-
     def on_db_selection_changed(self, index: int):
         """DB 선택 드롭다운에서 DB가 변경되었을 때 처리"""
         try:
@@ -676,6 +767,10 @@ class DBExcelEditor(QMainWindow):
     def close_current_db(self):
         """현재 선택된 DB 닫기"""
         try:
+            # 대기 중인 편집 반영 (연결 해제 전)
+            if not self.flush_grid_edits("DB 닫기"):
+                return
+
             if not self.db_manager or not self.db_manager.current_db_name:
                 QMessageBox.information(self, "알림", "닫을 데이터베이스가 없습니다.")
                 return
@@ -718,6 +813,14 @@ class DBExcelEditor(QMainWindow):
             logging.error(f"DB 닫기 중 오류: {e}")
             QMessageBox.critical(self, "오류", f"DB 닫기 중 오류가 발생했습니다:\n{str(e)}")
 
+    def release_idle_db_connections(self):
+        """현재 DB가 아닌 유휴 DB 연결 닫기 (DB_IDLE_RELEASE_SEC 기준)"""
+        try:
+            if self.db_manager:
+                self.db_manager.release_idle_connections()
+        except Exception as e:
+            logging.warning(f"⚠ 유휴 DB 연결 해제 실패: {e}")
+
     def update_db_combo(self):
         """DB 선택 드롭다운 업데이트"""
         try:
@@ -926,6 +1029,12 @@ class DBExcelEditor(QMainWindow):
         csv_history_action.triggered.connect(self.generate_csv_history)
         file_menu.addAction(csv_history_action)
 
+        # 셀 저장 형식 변환 (V2 → V3, 사용자가 선택할 때만 실행)
+        migrate_action = QAction("DB 저장 형식 변환(&U)...", self)
+        migrate_action.setStatusTip("열린 DB 중 이전 형식(V2) DB를 새 셀 저장 형식(V3)으로 변환합니다")
+        migrate_action.triggered.connect(self.migrate_open_dbs_to_v3)
+        file_menu.addAction(migrate_action)
+
         file_menu.addSeparator()
 
         save_action = QAction("현재 시트 저장(&S)", self)
@@ -1029,6 +1138,18 @@ class DBExcelEditor(QMainWindow):
         generate_action.triggered.connect(self.generate_code)
         code_menu.addAction(generate_action)
 
+        symbol_search_action = QAction("심볼 검색(&F)...", self)
+        symbol_search_action.setShortcut(QKeySequence("Ctrl+Shift+F"))
+        symbol_search_action.setStatusTip("열린 모든 DB에서 심볼 정의를 검색하고 중복 정의를 확인합니다.")
+        symbol_search_action.triggered.connect(self.show_symbol_search)
+        code_menu.addAction(symbol_search_action)
+
+        code_menu.addSeparator()
+        perf_report_action = QAction("성능 보고서(&P)...", self)
+        perf_report_action.setStatusTip("마지막 코드 생성의 시트별 소요 시간, 캐시 적중률을 표시하고 Chrome trace로 저장합니다.")
+        perf_report_action.triggered.connect(self.show_performance_report)
+        code_menu.addAction(perf_report_action)
+
 
 
         # --- 도움말 메뉴 ---
@@ -1065,6 +1186,7 @@ class DBExcelEditor(QMainWindow):
             <tr><td>열 삽입</td><td>Ctrl+Shift+I</td></tr>
             <tr><td>실행 취소</td><td>Ctrl+Z</td></tr>
             <tr><td>다시 실행</td><td>Ctrl+Y</td></tr>
+            <tr><td>심볼 검색</td><td>Ctrl+Shift+F</td></tr>
         </table>
             """
             QMessageBox.information(self, "단축키 도움말", shortcut_text)
@@ -1190,14 +1312,10 @@ class DBExcelEditor(QMainWindow):
                 all_sheets = []
                 logging.info("열린 DB가 없습니다. 시트 목록을 비웁니다.")
             else:
-                # 모든 경우에 다중 DB 처리 방식 사용 (일관성 보장)
-                all_sheets_info = self.db_manager.get_all_sheets_info()
-                logging.info(f"🔄 다중 DB 시트 정보: {list(all_sheets_info.keys())}")
-
-                # 현재 활성 DB의 시트만 표시 (UI 혼란 방지)
+                # 현재 활성 DB의 시트만 표시 (UI 혼란 방지) - 다른 DB는 열지 않음
                 current_db_name = self.db_manager.current_db_name
-                if current_db_name and current_db_name in all_sheets_info:
-                    all_sheets = all_sheets_info[current_db_name]
+                if current_db_name and current_db_name in self.db_manager.databases:
+                    all_sheets = self.db_manager.get_sheets_info(current_db_name)
                     logging.info(f"🔄 현재 활성 DB '{current_db_name}'에서 {len(all_sheets)}개 시트 로드")
 
                     # 각 시트에 DB 정보 추가
@@ -2362,6 +2480,16 @@ class DBExcelEditor(QMainWindow):
             self.last_directory = save_directory
             self.settings.setValue(Info.LAST_DIRECTORY_KEY, self.last_directory)
 
+            # xlsx 스트리밍 가져오기가 가능하면 파일별 워커 프로세스로 병렬 변환
+            try:
+                from core.performance_settings import EXCEL_IMPORT_ENGINE
+            except ImportError:
+                EXCEL_IMPORT_ENGINE = "xlwings"
+
+            if EXCEL_IMPORT_ENGINE == "stream" and len(file_paths) > 1 and all(is_streamable(p) for p in file_paths):
+                self.process_multiple_excel_files_parallel(file_paths, save_directory)
+                return
+
             # 진행률 대화상자 생성
             from PySide6.QtWidgets import QProgressDialog
             progress = QProgressDialog("Excel 파일을 DB로 변환 중...", "취소", 0, len(file_paths), self)
@@ -2424,33 +2552,140 @@ class DBExcelEditor(QMainWindow):
             progress.setValue(len(file_paths))
             progress.close()
 
-            # 성공한 DB들을 모두 DBManager에 추가
-            if successful_imports:
-                self.add_multiple_dbs_to_manager(successful_imports)
+            self.finish_multiple_excel_import(file_paths, successful_imports, failed_imports, save_directory)
 
-            # 파일 목록 새로고침
-            self.load_files()
+        except Exception as e:
+            error_msg = f"다중 Excel 파일 처리 중 오류 발생: {str(e)}"
+            logging.error(f"{error_msg}\n{traceback.format_exc()}")
+            QMessageBox.critical(self, "다중 처리 오류", error_msg)
+            self.statusBar.showMessage("다중 Excel 파일 처리 실패")
 
-            # DB 드롭다운 업데이트 (중요: UI 동기화)
-            self.update_db_combo()
+    def process_multiple_excel_files_parallel(self, file_paths, save_directory):
+        """다중 xlsx 파일 병렬 변환 (파일별 워커 프로세스, Excel 실행 없음)"""
+        from PySide6.QtWidgets import QProgressDialog
+        from excel_processor.parallel_importer import ParallelExcelImporter
 
-            # 간단한 결과 메시지
-            if failed_imports:
-                self.statusBar.showMessage(f"다중 Excel → DB 변환 완료: 성공 {len(successful_imports)}개, 실패 {len(failed_imports)}개")
-                QMessageBox.information(self, "다중 Excel → DB 변환 완료",
-                                      f"총 {len(file_paths)}개 파일 중 {len(successful_imports)}개 성공, {len(failed_imports)}개 실패\n"
-                                      f"저장 위치: {save_directory}")
-            else:
-                self.statusBar.showMessage(f"다중 Excel → DB 변환 완료: 모든 {len(successful_imports)}개 파일 성공")
-                QMessageBox.information(self, "다중 Excel → DB 변환 완료",
-                                      f"모든 {len(successful_imports)}개 Excel 파일을 성공적으로 DB로 변환했습니다.\n"
-                                      f"저장 위치: {save_directory}")
+        progress = None
+        try:
+            from core.performance_settings import USE_JOB_SCHEDULER
+        except ImportError:
+            USE_JOB_SCHEDULER = False
+
+        try:
+            # 파일별 DB 경로 미리 결정 (기존 파일 및 같은 배치 내 중복 이름 회피)
+            jobs = []
+            reserved_paths = set()
+            for file_path in file_paths:
+                excel_filename_only = os.path.splitext(os.path.basename(file_path))[0]
+                db_file_path = os.path.join(save_directory, f"{excel_filename_only}.db")
+                counter = 1
+                original_db_path = db_file_path
+                while os.path.exists(db_file_path) or db_file_path in reserved_paths:
+                    name_without_ext = os.path.splitext(original_db_path)[0]
+                    db_file_path = f"{name_without_ext}_{counter}.db"
+                    counter += 1
+                reserved_paths.add(db_file_path)
+                jobs.append((file_path, db_file_path))
+                logging.info(f"병렬 가져오기 예약: {file_path} -> {db_file_path}")
+
+            if USE_JOB_SCHEDULER:
+                self.process_multiple_excel_files_job(file_paths, jobs, save_directory)
+                return
+
+            progress = QProgressDialog("Excel 파일을 DB로 변환 중...", "취소", 0, len(jobs), self)
+            progress.setWindowTitle(Info.EXCEL_TO_DB_MULTI_PROGRESS_TITLE)
+            progress.setWindowModality(Qt.WindowModal)
+            progress.setMinimumDuration(0)
+            progress.show()
+            QApplication.processEvents()
+
+            def on_progress(excel_basename, completed):
+                progress.setValue(min(completed, len(jobs) - 1))
+                if excel_basename:
+                    progress.setLabelText(f"병렬 변환 중 ({completed}/{len(jobs)} 완료)\n{excel_basename} 완료")
+                QApplication.processEvents()
+
+            def is_cancelled():
+                QApplication.processEvents()
+                return progress.wasCanceled()
+
+            successful_imports, failed_imports = ParallelExcelImporter().run(
+                jobs, progress_handler=on_progress, cancel_checker=is_cancelled)
+
+            progress.setValue(len(jobs))
+            progress.close()
+
+            self.finish_multiple_excel_import(file_paths, successful_imports, failed_imports, save_directory)
 
         except Exception as e:
-            error_msg = f"다중 Excel 파일 처리 중 오류 발생: {str(e)}"
+            error_msg = f"다중 Excel 파일 병렬 처리 중 오류 발생: {str(e)}"
             logging.error(f"{error_msg}\n{traceback.format_exc()}")
             QMessageBox.critical(self, "다중 처리 오류", error_msg)
             self.statusBar.showMessage("다중 Excel 파일 처리 실패")
+        finally:
+            if progress is not None and progress.isVisible():
+                progress.close()
+
+    def process_multiple_excel_files_job(self, file_paths, jobs, save_directory):
+        """다중 xlsx 병렬 변환을 공용 작업 스케줄러에서 실행 (변환 중에도 다른 DB 편집/코드 생성 가능)"""
+        from core.job_scheduler import get_job_scheduler
+        from ui.job_bridge import JobProgressDialog, get_job_bridge
+
+        def run(ctx):
+            from excel_processor.parallel_importer import ParallelExcelImporter
+
+            def on_progress(excel_basename, completed):
+                ctx.report(completed * 100 / len(jobs),
+                           f"병렬 변환 중 ({completed}/{len(jobs)} 완료)" + (f"\n{excel_basename} 완료" if excel_basename else ""))
+
+            return ParallelExcelImporter().run(jobs, progress_handler=on_progress, cancel_checker=ctx.cancelled)
+
+        job = get_job_scheduler().submit(run, name=f"Excel → DB 변환 ({len(jobs)}개)", resource="excel_import")
+        dialog = JobProgressDialog(job, "Excel 파일을 DB로 변환 중...", self)
+        dialog.setWindowTitle(Info.EXCEL_TO_DB_MULTI_PROGRESS_TITLE)
+        dialog.show()
+        get_job_bridge().watch(job, on_finished=lambda job: self.on_multiple_excel_import_job_finished(
+            job, file_paths, save_directory))
+        self.statusBar.showMessage(f"다중 Excel → DB 변환 중: {len(jobs)}개 파일 (백그라운드)")
+
+    def on_multiple_excel_import_job_finished(self, job, file_paths, save_directory):
+        """다중 xlsx 병렬 변환 작업 완료 (작업 스레드 → GUI 스레드)"""
+        from core.job_scheduler import DONE
+
+        if job.state != DONE:
+            if job.error is not None and not isinstance(job.error, InterruptedError):
+                QMessageBox.critical(self, "다중 처리 오류", f"다중 Excel 파일 병렬 처리 중 오류 발생: {job.error}")
+                self.statusBar.showMessage("다중 Excel 파일 처리 실패")
+            else:
+                self.statusBar.showMessage("다중 Excel → DB 변환 취소됨")
+            return
+
+        successful_imports, failed_imports = job.result()
+        self.finish_multiple_excel_import(file_paths, successful_imports, failed_imports, save_directory)
+
+    def finish_multiple_excel_import(self, file_paths, successful_imports, failed_imports, save_directory):
+        """다중 Excel 가져오기 후처리 (DBManager 추가, UI 갱신, 결과 메시지)"""
+        # 성공한 DB들을 모두 DBManager에 추가
+        if successful_imports:
+            self.add_multiple_dbs_to_manager(successful_imports)
+
+        # 파일 목록 새로고침
+        self.load_files()
+
+        # DB 드롭다운 업데이트 (중요: UI 동기화)
+        self.update_db_combo()
+
+        # 간단한 결과 메시지
+        if failed_imports:
+            self.statusBar.showMessage(f"다중 Excel → DB 변환 완료: 성공 {len(successful_imports)}개, 실패 {len(failed_imports)}개")
+            QMessageBox.information(self, "다중 Excel → DB 변환 완료",
+                                  f"총 {len(file_paths)}개 파일 중 {len(successful_imports)}개 성공, {len(failed_imports)}개 실패\n"
+                                  f"저장 위치: {save_directory}")
+        else:
+            self.statusBar.showMessage(f"다중 Excel → DB 변환 완료: 모든 {len(successful_imports)}개 파일 성공")
+            QMessageBox.information(self, "다중 Excel → DB 변환 완료",
+                                  f"모든 {len(successful_imports)}개 Excel 파일을 성공적으로 DB로 변환했습니다.\n"
+                                  f"저장 위치: {save_directory}")
 
     def add_multiple_dbs_to_manager(self, successful_imports):
         """성공적으로 가져온 DB들을 DBManager에 추가"""
@@ -2587,25 +2822,32 @@ class DBExcelEditor(QMainWindow):
 
     def export_to_excel(self):
         """
-        현재 선택된 파일을 Excel로 내보내기
+        현재 DB를 Excel(xlsx)로 내보내기 (Excel 실행 없이 스트리밍 작성)
 
-        주의: 이 기능은 현재 임시로 비활성화되어 있습니다.
-        메뉴에서 접근할 수 없지만 코드는 향후 재활성화를 위해 보존됩니다.
+        여러 DB가 열려 있으면 모든 DB를 폴더에 한 번에 내보낼지 선택할 수 있습니다 (DB별 병렬 처리).
         """
-        if self.current_file_id is None:
-            QMessageBox.warning(self, "내보내기 경고", "내보낼 파일을 먼저 선택해주세요.")
+        if self.db is None or self.exporter is None:
+            QMessageBox.warning(self, "내보내기 경고", "내보낼 DB를 먼저 열어주세요.")
             return
 
-        # 현재 파일 이름 가져오기 (저장 대화상자 기본값으로 사용)
-        current_file_name = "exported_excel" # 기본값
-        try:
-            files = self.db.get_files()
-            current_file_name = next((f['name'] for f in files if f['id'] == self.current_file_id), current_file_name)
-            # 확장자 제거
-            current_file_name = os.path.splitext(current_file_name)[0]
-        except Exception as e:
-             logging.warning(f"현재 파일 이름 조회 중 오류 (내보내기용): {e}")
+        # 편집 중인 내용을 DB에 반영한 뒤 내보내기
+        if not self.flush_grid_edits("Excel 내보내기"):
+            return
+
+        if self.db_manager.get_database_count() > 1:
+            reply = QMessageBox.question(
+                self, "Excel 내보내기",
+                f"열려 있는 {self.db_manager.get_database_count()}개 DB를 모두 내보내시겠습니까?\n"
+                "(아니오: 현재 DB만 내보내기)",
+                QMessageBox.Yes | QMessageBox.No | QMessageBox.Cancel, QMessageBox.No)
+            if reply == QMessageBox.Cancel:
+                return
+            if reply == QMessageBox.Yes:
+                self.export_all_dbs_to_excel()
+                return
 
+        # DB 파일 이름을 저장 대화상자 기본값으로 사용
+        current_file_name = os.path.splitext(os.path.basename(self.db.db_file))[0] if self.db.db_file else "exported_excel"
 
         try:
             # 파일 저장 대화상자
@@ -2617,11 +2859,11 @@ class DBExcelEditor(QMainWindow):
             if not file_path:
                 return # 사용자가 취소
 
-            # 확장자 확인 및 추가 (.xlsx만 지원 가정)
+            # 확장자 확인 및 추가 (.xlsx만 지원)
             if not file_path.lower().endswith('.xlsx'):
                 file_path += '.xlsx'
 
-            logging.info(f"Attempting to export File ID {self.current_file_id} to: {file_path}")
+            logging.info(f"Excel 내보내기: {self.db.db_file} -> {file_path}")
             self.statusBar.showMessage("Excel 파일로 내보내는 중...")
             QApplication.processEvents()
 
@@ -2637,6 +2879,87 @@ class DBExcelEditor(QMainWindow):
             QMessageBox.critical(self, "내보내기 오류", error_msg)
             self.statusBar.showMessage("Excel 파일 내보내기 실패")
 
+    def export_all_dbs_to_excel(self):
+        """열려 있는 모든 DB를 선택한 폴더에 xlsx로 병렬 내보내기 (DB별 워커 프로세스)"""
+        from PySide6.QtWidgets import QProgressDialog
+        from excel_processor.excel_exporter import default_export_path
+        from excel_processor.parallel_exporter import ParallelExcelExporter
+
+        output_dir = QFileDialog.getExistingDirectory(self, "Excel 파일 저장 폴더 선택", "")
+        if not output_dir:
+            return
+
+        jobs = []
+        for db_name in self.db_manager.get_database_names():
+            db_handler = self.db_manager.get_database(db_name)
+            if db_handler and db_handler.db_file:
+                jobs.append((db_handler.db_file, default_export_path(db_handler.db_file, output_dir)))
+        if not jobs:
+            return
+
+        progress = None
+        try:
+            progress = QProgressDialog("DB를 Excel 파일로 내보내는 중...", "취소", 0, len(jobs), self)
+            progress.setWindowTitle("Excel 내보내기")
+            progress.setWindowModality(Qt.WindowModal)
+            progress.setMinimumDuration(0)
+            progress.show()
+            QApplication.processEvents()
+
+            def on_progress(db_basename, completed):
+                progress.setValue(min(completed, len(jobs) - 1))
+                if db_basename:
+                    progress.setLabelText(f"내보내는 중 ({completed}/{len(jobs)} 완료)\n{db_basename} 완료")
+                QApplication.processEvents()
+
+            def is_cancelled():
+                QApplication.processEvents()
+                return progress.wasCanceled()
+
+            successful, failed = ParallelExcelExporter().run(
+                jobs, progress_handler=on_progress, cancel_checker=is_cancelled)
+
+            progress.setValue(len(jobs))
+            progress.close()
+
+            message = f"{len(successful)}개 DB를 Excel 파일로 저장했습니다.\n저장 위치: {output_dir}"
+            if failed:
+                message += f"\n\n실패 {len(failed)}개:\n" + "\n".join(f"{item['db_file']}: {item['error']}" for item in failed)
+            self.statusBar.showMessage(f"Excel 내보내기 완료: 성공 {len(successful)}개, 실패 {len(failed)}개")
+            QMessageBox.information(self, "내보내기 완료", message)
+
+        except Exception as e:
+            error_msg = f"다중 DB Excel 내보내기 중 오류 발생: {str(e)}"
+            logging.error(f"{error_msg}\n{traceback.format_exc()}")
+            QMessageBox.critical(self, "내보내기 오류", error_msg)
+            self.statusBar.showMessage("Excel 파일 내보내기 실패")
+        finally:
+            if progress is not None and progress.isVisible():
+                progress.close()
+
+    def flush_grid_edits(self, action: Optional[str] = None) -> bool:
+        """
+        그리드 편집 저널의 대기 중인 편집을 DB에 반영 (DB를 직접 읽는 작업 전에 호출)
+
+        Args:
+            action: 반영 실패 시 경고 대화상자에 표시할 작업 이름 (None이면 로그만 기록)
+
+        Returns:
+            반영 성공 여부 - False면 호출자는 작업을 중단 (반영하지 못한 편집은 저널에 남아 재시도 가능)
+        """
+        grid_view = getattr(self, 'grid_view', None)
+        if grid_view and grid_view.model:
+            try:
+                grid_view.model.flush_edits()
+            except Exception as e:
+                logging.error(f"대기 중인 편집 반영 실패: {e}\n{traceback.format_exc()}")
+                if action:
+                    QMessageBox.warning(self, "편집 반영 실패",
+                                        f"대기 중인 셀 편집을 DB에 반영하지 못해 {action} 작업을 중단합니다.\n\n{str(e)}\n\n"
+                                        "편집 내용은 그리드에 남아 있으니 저장을 다시 시도한 뒤 진행하세요.")
+                return False
+        return True
+
     def save_current_sheet(self):
         """현재 그리드뷰의 변경 사항을 DB에 저장"""
         if self.current_sheet_id is None:
@@ -2669,6 +2992,10 @@ class DBExcelEditor(QMainWindow):
     def generate_code(self):
         """코드 생성 메서드 (다중 DB 지원 - 개선된 워크플로우)"""
         try:
+            # 0. 그리드의 대기 중인 편집을 DB에 먼저 반영
+            if not self.flush_grid_edits("코드 생성"):
+                return
+
             # 1. DB 선택 먼저 (다중 선택 지원)
             selected_dbs = self.select_databases_for_code_generation()
             if not selected_dbs:
@@ -2688,7 +3015,13 @@ class DBExcelEditor(QMainWindow):
             self.last_directory = output_dir
             self.settings.setValue(Info.LAST_DIRECTORY_KEY, output_dir)
 
-            # 3. 코드 생성 실행
+            # 심볼 색인으로 DB 간 중복 정의 확인 (경고만 - 생성 결과/오류 목록은 기존 검사 그대로)
+            self.warn_duplicate_symbols(selected_dbs)
+
+            # 3. 코드 생성 실행 (계측 사용 시 이전 실행 기록 비움)
+            if tracer.enabled:
+                from datetime import datetime
+                tracer.begin_run(f"코드 생성 {datetime.now().strftime('%H:%M:%S')} ({len(selected_dbs)}개 DB)")
             if len(selected_dbs) == 1:
                 # 단일 DB 처리
                 self.generate_code_for_single_db(selected_dbs[0], output_dir)
@@ -2696,12 +3029,36 @@ class DBExcelEditor(QMainWindow):
                 # 다중 DB 처리 (개선된 배치 처리)
                 self.generate_code_for_multiple_dbs_improved(selected_dbs, output_dir)
 
+            # 4. Cython 커널 사용 현황 기록 (Cython/폴백 호출 수)
+            try:
+                from core.performance_settings import log_performance_status
+                log_performance_status()
+            except ImportError:
+                pass
+
         except Exception as e:
             error_msg = f"코드 생성 중 오류 발생: {str(e)}"
             logging.error(f"{error_msg}\n{traceback.format_exc()}")
             QMessageBox.critical(self, "코드 생성 오류", error_msg)
             self.statusBar.showMessage("코드 생성 중 심각한 오류 발생")
 
+    def warn_duplicate_symbols(self, selected_dbs: List['DBHandlerV2']):
+        """선택한 DB들에서 충돌하는 중복 정의를 로그와 상태바로 알림 (시트를 읽지 않고 심볼 색인 조회)"""
+        try:
+            db_names = [db_name for db_name, db_handler in self.db_manager.databases.items()
+                        if db_handler in selected_dbs]
+            duplicates = self.db_manager.find_duplicate_symbols(db_names)
+        except Exception as e:
+            logging.warning(f"⚠ 중복 정의 확인 실패: {e}")
+            return
+        if not duplicates:
+            return
+
+        for name, entries in sorted(duplicates.items()):
+            locations = ", ".join(f"{entry['db_name']}/{entry['sheet_name']}:{entry['row'] + 1}" for entry in entries)
+            logging.warning(f"⚠ 중복 정의: {name} ({locations})")
+        self.statusBar.showMessage(f"⚠ 중복 정의된 심볼 {len(duplicates)}개 - 코드 > 심볼 검색에서 확인할 수 있습니다")
+
     def select_databases_for_code_generation(self) -> List['DBHandlerV2']:
         """코드 생성을 위한 데이터베이스들 선택"""
         db_count = self.db_manager.get_database_count()
@@ -2730,6 +3087,16 @@ class DBExcelEditor(QMainWindow):
                     self.update_current_db_references()
                     break
 
+        # 공용 작업 스케줄러 사용 시 작업 스레드에서 생성 (GUI는 계속 사용 가능)
+        try:
+            from core.performance_settings import USE_JOB_SCHEDULER
+        except ImportError:
+            USE_JOB_SCHEDULER = False
+
+        if USE_JOB_SCHEDULER:
+            self.generate_code_for_single_db_job(selected_db, output_dir)
+            return
+
         try:
             # 진행률 대화상자 생성 - 개선된 사용자 경험
             from PySide6.QtWidgets import QProgressDialog
@@ -2867,13 +3234,13 @@ class DBExcelEditor(QMainWindow):
                     # FileInfo 시트인지 CalList 시트인지 구분
                     if sht_def_name == "FileInfo":
                         # FileInfo 시트 데이터 로드
-                        fileinfo_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        fileinfo_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         fileinfo_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, fileinfo_sheet_data)
                         d_xls[sht_naming]['FileInfoSht'] = fileinfo_sht_info
                         logging.info(f"  → FileInfo 시트 등록: 그룹 '{sht_naming}'")
                     else:
                         # CalList 시트 데이터 로드
-                        callist_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        callist_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         callist_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, callist_sheet_data)
                         d_xls[sht_naming]['CalListSht'].append(callist_sht_info)
                         logging.info(f"  → CalList 시트 등록: 그룹 '{sht_naming}' 타입 '{sht_def_name}'")
@@ -2893,19 +3260,19 @@ class DBExcelEditor(QMainWindow):
 
                     if sheet_type == "FileInfo":
                         # FileInfo 시트 데이터 로드
-                        fileinfo_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        fileinfo_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         fileinfo_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, fileinfo_sheet_data)
                         d_xls[group_name]['FileInfoSht'] = fileinfo_sht_info
                         logging.info(f"  → FileInfo 시트 등록: 그룹 '{group_name}' (C# 호환 모드)")
                     elif sheet_type in ["CalData", "CalList", "Caldata"] or sheet_type.startswith("_") or "UNDEFINED" in sheet_type:
                         # CalData, CalList, Caldata, _로 시작하는 프로젝트 시트, UNDEFINED 시트 모두 CalList로 처리
-                        callist_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        callist_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         callist_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, callist_sheet_data)
                         d_xls[group_name]['CalListSht'].append(callist_sht_info)
                         logging.info(f"  → CalList 시트 등록: 그룹 '{group_name}' 타입 '{sheet_type}' (C# 호환)")
                     else:
                         # 알 수 없는 타입도 CalList로 처리 (C# 레거시 호환성)
-                        callist_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        callist_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         callist_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, callist_sheet_data)
                         d_xls[group_name]['CalListSht'].append(callist_sht_info)
                         logging.info(f"  → 알 수 없는 타입을 CalList로 등록: 그룹 '{group_name}' 타입 '{sheet_type}' (C# 호환 모드)")
@@ -2981,6 +3348,7 @@ class DBExcelEditor(QMainWindow):
                     lb_hdr.clear()
 
                     # MakeCode 객체 생성
+                    from code_generator.make_code import MakeCode
                     make_code = MakeCode(current_sheet_surrogate, lb_src, lb_hdr)
 
                     # 진행률 콜백 함수 정의 (더 상세한 피드백)
@@ -3128,10 +3496,120 @@ class DBExcelEditor(QMainWindow):
             if 'progress' in locals() and progress.isVisible():
                 progress.close()
 
+    def generate_code_for_single_db_job(self, selected_db: 'DBHandlerV2', output_dir: str):
+        """단일 DB 코드 생성을 공용 작업 스케줄러에서 실행 (headless_generator - 다중 DB 생성과 같은 코어)"""
+        try:
+            # 1. 현재 편집 중인 시트 저장
+            if self.current_sheet_id is not None:
+                reply = QMessageBox.question(self, "저장 확인",
+                                             "코드 생성 전에 현재 시트의 변경 사항을 저장하시겠습니까?",
+                                             QMessageBox.Save | QMessageBox.Discard | QMessageBox.Cancel,
+                                             QMessageBox.Save)
+                if reply == QMessageBox.Save:
+                    self.save_current_sheet()
+                elif reply == QMessageBox.Cancel:
+                    return  # 생성 취소
+            if not self.flush_grid_edits("코드 생성"):
+                return
+
+            # 2. 코드 저장 위치 (이미 전달받은 경우 건너뛰기)
+            if not output_dir:
+                output_dir = QFileDialog.getExistingDirectory(self, "코드 저장 폴더 선택", "")
+                if not output_dir:
+                    return  # 사용자가 취소
+
+            # 다중 DB와 동일하게 DB명 폴더에 저장
+            db_name = os.path.basename(selected_db.db_file)
+            db_output_dir = os.path.join(output_dir, os.path.splitext(db_name)[0])
+            os.makedirs(db_output_dir, exist_ok=True)
+            logging.info(f"단일 DB 출력 디렉토리 생성: {db_output_dir}")
+
+            try:
+                from core.performance_settings import USE_INCREMENTAL_CODE_GEN
+            except ImportError:
+                USE_INCREMENTAL_CODE_GEN = False
+
+            from core.job_scheduler import get_job_scheduler, PRIORITY_HIGH
+            from ui.job_bridge import JobProgressDialog, get_job_bridge
+            from code_generator.headless_generator import generate_database
+
+            # Info 전역 상태를 쓰므로 같은 프로세스의 코드 생성은 'codegen' 자원으로 하나씩 실행
+            job = get_job_scheduler().submit(
+                lambda ctx: generate_database(selected_db.db_file, db_output_dir, ctx.generation_observer(),
+                                              USE_INCREMENTAL_CODE_GEN),
+                name=f"코드 생성: {db_name}", priority=PRIORITY_HIGH, resource="codegen")
+
+            JobProgressDialog(job, f"코드 생성 중: {db_name}", self).show()
+            get_job_bridge().watch(job, on_finished=lambda job: self.on_single_db_code_job_finished(job, db_output_dir))
+            self.statusBar.showMessage(f"코드 생성 중: {db_name} (백그라운드)")
+
+        except Exception as e:
+            error_msg = f"코드 생성 시작 중 오류 발생: {str(e)}"
+            logging.error(f"{error_msg}\n{traceback.format_exc()}")
+            QMessageBox.critical(self, "코드 생성 오류", error_msg)
+            self.statusBar.showMessage("코드 생성 중 심각한 오류 발생")
+
+    def on_single_db_code_job_finished(self, job, output_dir: str):
+        """단일 DB 코드 생성 작업 완료 (작업 스레드 → GUI 스레드)"""
+        from core.job_scheduler import DONE
+
+        if job.state != DONE:
+            if job.error is not None and not isinstance(job.error, InterruptedError):
+                QMessageBox.critical(self, "코드 생성 오류", f"코드 생성 과정 중 예기치 않은 오류 발생: {job.error}")
+                self.statusBar.showMessage("코드 생성 중 심각한 오류 발생")
+            else:
+                QMessageBox.information(self, "코드 생성 취소", "코드 생성이 취소되었습니다.")
+            return
+
+        result = job.result()
+        if result.status == 'cancelled':
+            logging.info(f"사용자가 코드 생성을 취소했습니다: {result.error}")
+            QMessageBox.information(self, "코드 생성 취소", "코드 생성이 취소되었습니다.")
+            return
+        if result.status == 'skipped':
+            QMessageBox.warning(self, "코드 생성 불가", "코드 생성에 필요한 $ 시트(FileInfo/CalList)를 찾을 수 없습니다.")
+            self.statusBar.showMessage("코드 생성 실패: $ 시트 없음")
+            return
+        if not result.groups:
+            QMessageBox.critical(self, "코드 생성 오류", f"코드 생성 과정 중 오류 발생: {result.error}")
+            self.statusBar.showMessage("코드 생성 중 심각한 오류 발생")
+            return
+
+        result_message = "코드 생성 결과:\n\n"
+        generated_files_info = []
+        for group_idx, group in enumerate(result.groups):
+            result_message += f"\n--- 그룹 {group_idx + 1}: {group.group_name} ---\n{group.message}"
+            if group.success:
+                generated_files_info.append({
+                    "sheet_name": group.group_name,
+                    "src_file": group.src_file_name,
+                    "hdr_file": group.hdr_file_name
+                })
+
+        if result.errors or len(generated_files_info) < len(result.groups):
+            final_msg = f"코드 생성 완료 (일부 오류 발생): {len(result.groups)}개 그룹 중 일부에서 오류"
+            logging.warning("Code generation completed with errors.")
+        else:
+            final_msg = f"코드 생성 완료: 모든 {len(result.groups)}개 그룹 성공"
+            logging.info(f"Code generation completed successfully ({result.elapsed:.1f}초).")
+
+        self.statusBar.showMessage(final_msg)
+        self.show_code_generation_result(result_message, output_dir, generated_files_info)
+
     def generate_code_for_multiple_dbs_improved(self, selected_dbs: List['DBHandlerV2'], output_dir: str):
         """개선된 다중 DB 코드 생성 (배치 처리) - 응답성 개선"""
         import time
 
+        # 병렬 코드 생성 사용 가능 시 워커 프로세스 방식으로 처리
+        try:
+            from core.performance_settings import USE_PARALLEL_CODE_GEN
+        except ImportError:
+            USE_PARALLEL_CODE_GEN = False
+
+        if USE_PARALLEL_CODE_GEN and len(selected_dbs) > 1:
+            self.generate_code_for_multiple_dbs_parallel(selected_dbs, output_dir)
+            return
+
         try:
             logging.info(f"=== 개선된 다중 DB 코드 생성 시작: {len(selected_dbs)}개 DB ===")
             start_time = time.time()
@@ -3317,6 +3795,110 @@ class DBExcelEditor(QMainWindow):
             if 'progress' in locals() and progress.isVisible():
                 progress.close()
 
+    def generate_code_for_multiple_dbs_parallel(self, selected_dbs: List['DBHandlerV2'], output_dir: str):
+        """다중 DB 병렬 코드 생성 (DB별 워커 프로세스) - 진행률/취소는 GUI 스레드에서 폴링"""
+        import time
+        from PySide6.QtWidgets import QProgressDialog
+        from code_generator.parallel_generator import ParallelCodeGenerator
+
+        db_count = len(selected_dbs)
+        progress = None
+
+        try:
+            from core.performance_settings import USE_JOB_SCHEDULER
+        except ImportError:
+            USE_JOB_SCHEDULER = False
+
+        if USE_JOB_SCHEDULER:
+            self.generate_code_for_multiple_dbs_job([db.db_file for db in selected_dbs], output_dir)
+            return
+
+        try:
+            logging.info(f"=== 병렬 다중 DB 코드 생성 시작: {db_count}개 DB ===")
+            start_time = time.time()
+
+            # DB별 0~100 진행률을 합산하여 전체 진행률로 표시
+            progress = QProgressDialog(f"다중 DB 코드 생성 중... (0/{db_count})", "취소", 0, db_count * 100, self)
+            progress.setWindowModality(Qt.WindowModal)
+            progress.setMinimumDuration(0)
+            progress.show()
+            QApplication.processEvents()
+
+            db_progress = {os.path.basename(db.db_file): 0 for db in selected_dbs}
+
+            def on_progress(db_name, progress_val, message, completed):
+                db_progress[db_name] = max(db_progress.get(db_name, 0), progress_val)
+                progress.setValue(min(sum(db_progress.values()), db_count * 100 - 1))
+                progress.setLabelText(f"병렬 코드 생성 중 ({completed}/{db_count} 완료)\n{db_name}: {message}")
+                QApplication.processEvents()
+
+            def is_cancelled():
+                QApplication.processEvents()
+                return progress.wasCanceled()
+
+            scheduler = ParallelCodeGenerator()
+            successful_generations, failed_generations = scheduler.run(
+                [db.db_file for db in selected_dbs], output_dir,
+                progress_handler=on_progress, cancel_checker=is_cancelled)
+
+            progress.setValue(db_count * 100)
+            progress.close()
+
+            total_time = time.time() - start_time
+            logging.info(f"병렬 다중 DB 코드 생성 완료 (총 소요시간: {total_time:.1f}초)")
+            self.show_multiple_code_generation_result_improved(successful_generations, failed_generations, output_dir)
+
+        except Exception as e:
+            error_msg = f"병렬 다중 DB 코드 생성 중 오류: {str(e)}"
+            logging.error(f"{error_msg}\n{traceback.format_exc()}")
+            if progress is not None:
+                progress.close()
+            QMessageBox.critical(self, "다중 코드 생성 오류", error_msg)
+        finally:
+            if progress is not None and progress.isVisible():
+                progress.close()
+
+    def generate_code_for_multiple_dbs_job(self, db_files: List[str], output_dir: str):
+        """다중 DB 병렬 코드 생성을 공용 작업 스케줄러에서 실행 (작업 스레드가 워커 프로세스 풀을 구동)"""
+        from core.job_scheduler import get_job_scheduler
+        from ui.job_bridge import JobProgressDialog, get_job_bridge
+
+        def run(ctx):
+            from code_generator.parallel_generator import ParallelCodeGenerator
+
+            # DB별 0~100 진행률을 합산하여 전체 진행률로 보고
+            db_progress = {os.path.basename(db_file): 0 for db_file in db_files}
+
+            def on_progress(db_name, progress_val, message, completed):
+                db_progress[db_name] = max(db_progress.get(db_name, 0), progress_val)
+                ctx.report(sum(db_progress.values()) / len(db_files),
+                           f"병렬 코드 생성 중 ({completed}/{len(db_files)} 완료)\n{db_name}: {message}")
+
+            return ParallelCodeGenerator().run(db_files, output_dir, progress_handler=on_progress,
+                                               cancel_checker=ctx.cancelled)
+
+        # 워커 프로세스가 CPU 코어를 모두 쓰므로 병렬 코드 생성은 한 번에 하나만 실행
+        job = get_job_scheduler().submit(run, name=f"다중 DB 코드 생성 ({len(db_files)}개)",
+                                         resource="parallel_codegen")
+        JobProgressDialog(job, f"다중 DB 코드 생성 중... ({len(db_files)}개 DB)", self).show()
+        get_job_bridge().watch(job, on_finished=lambda job: self.on_multiple_dbs_code_job_finished(job, output_dir))
+        self.statusBar.showMessage(f"다중 DB 코드 생성 중: {len(db_files)}개 DB (백그라운드)")
+
+    def on_multiple_dbs_code_job_finished(self, job, output_dir: str):
+        """다중 DB 코드 생성 작업 완료 (작업 스레드 → GUI 스레드)"""
+        from core.job_scheduler import DONE
+
+        if job.state != DONE:
+            if job.error is not None and not isinstance(job.error, InterruptedError):
+                QMessageBox.critical(self, "다중 코드 생성 오류", f"병렬 다중 DB 코드 생성 중 오류: {job.error}")
+            else:
+                QMessageBox.information(self, "다중 코드 생성 취소", "다중 DB 코드 생성이 취소되었습니다.")
+            return
+
+        successful_generations, failed_generations = job.result()
+        logging.info(f"병렬 다중 DB 코드 생성 완료 (총 소요시간: {job.elapsed:.1f}초)")
+        self.show_multiple_code_generation_result_improved(successful_generations, failed_generations, output_dir)
+
     def generate_code_for_single_db_v2(self, db_handler: 'DBHandlerV2', output_dir: str) -> str:
         """V2 구조에 맞는 단일 DB 코드 생성 (디버깅 정보 추가)"""
         try:
@@ -3693,16 +4275,17 @@ class DBExcelEditor(QMainWindow):
                     group_surrogate = OriginalFileSurrogate(db_handler)
                     # 그룹별 시트만 할당 (전체 DB 로드하지 않음)
                     if fileinfo_sheet:
-                        fileinfo_sheet_data = db_handler.get_sheet_data(fileinfo_sheet['id'])
+                        fileinfo_sheet_data = db_handler.get_sheet_data_for_code_gen(fileinfo_sheet['id'])
                         group_surrogate.FileInfoSht = DataParser.prepare_sheet_for_existing_code(fileinfo_sheet['name'], fileinfo_sheet_data)
 
                     group_surrogate.CalListSht = []
                     for cal_sheet in callist_sheets:
-                        cal_sheet_data = db_handler.get_sheet_data(cal_sheet['id'])
+                        cal_sheet_data = db_handler.get_sheet_data_for_code_gen(cal_sheet['id'])
                         cal_sht_info = DataParser.prepare_sheet_for_existing_code(cal_sheet['name'], cal_sheet_data)
                         group_surrogate.CalListSht.append(cal_sht_info)
 
                     # MakeCode 객체 생성 (그룹별 독립적인 surrogate 사용)
+                    from code_generator.make_code import MakeCode
                     make_code = MakeCode(group_surrogate, lb_src, lb_hdr)
 
                     # 시트 정보 검증 (단일 DB와 동일)
@@ -3912,16 +4495,17 @@ class DBExcelEditor(QMainWindow):
                     # 그룹별 시트만 할당
                     group_surrogate = OriginalFileSurrogate(db_handler)
                     if fileinfo_sheet:
-                        fileinfo_sheet_data = db_handler.get_sheet_data(fileinfo_sheet['id'])
+                        fileinfo_sheet_data = db_handler.get_sheet_data_for_code_gen(fileinfo_sheet['id'])
                         group_surrogate.FileInfoSht = DataParser.prepare_sheet_for_existing_code(fileinfo_sheet['name'], fileinfo_sheet_data)
 
                     group_surrogate.CalListSht = []
                     for cal_sheet in callist_sheets:
-                        cal_sheet_data = db_handler.get_sheet_data(cal_sheet['id'])
+                        cal_sheet_data = db_handler.get_sheet_data_for_code_gen(cal_sheet['id'])
                         cal_sht_info = DataParser.prepare_sheet_for_existing_code(cal_sheet['name'], cal_sheet_data)
                         group_surrogate.CalListSht.append(cal_sht_info)
 
                     # MakeCode 객체 생성
+                    from code_generator.make_code import MakeCode
                     make_code = MakeCode(group_surrogate, lb_src, lb_hdr)
 
                     # 시트 정보 검증
@@ -4146,12 +4730,12 @@ class DBExcelEditor(QMainWindow):
                     # FileInfo 시트인지 CalList 시트인지 구분
                     if sht_def_name == "FileInfo":
                         # FileInfo 시트 데이터 로드
-                        fileinfo_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        fileinfo_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         fileinfo_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, fileinfo_sheet_data)
                         d_xls[sht_naming]['FileInfoSht'] = fileinfo_sht_info
                     else:
                         # CalList 시트 데이터 로드
-                        callist_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        callist_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         callist_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, callist_sheet_data)
                         d_xls[sht_naming]['CalListSht'].append(callist_sht_info)
 
@@ -4168,17 +4752,17 @@ class DBExcelEditor(QMainWindow):
 
                     if sheet_type == "FileInfo":
                         # FileInfo 시트 데이터 로드
-                        fileinfo_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        fileinfo_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         fileinfo_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, fileinfo_sheet_data)
                         d_xls[group_name]['FileInfoSht'] = fileinfo_sht_info
                     elif sheet_type in ["CalData", "CalList", "Caldata"] or sheet_type.startswith("_") or "UNDEFINED" in sheet_type:
                         # CalData, CalList, Caldata, _로 시작하는 프로젝트 시트, UNDEFINED 시트 모두 CalList로 처리
-                        callist_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        callist_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         callist_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, callist_sheet_data)
                         d_xls[group_name]['CalListSht'].append(callist_sht_info)
                     else:
                         # 알 수 없는 타입도 CalList로 처리 (C# 레거시 호환성)
-                        callist_sheet_data = self.db.get_sheet_data(sheet_info['id'])
+                        callist_sheet_data = self.db.get_sheet_data_for_code_gen(sheet_info['id'])
                         callist_sht_info = DataParser.prepare_sheet_for_existing_code(sheet_name, callist_sheet_data)
                         d_xls[group_name]['CalListSht'].append(callist_sht_info)
 
@@ -4216,6 +4800,7 @@ class DBExcelEditor(QMainWindow):
                     lb_hdr.clear()
 
                     # MakeCode 객체 생성
+                    from code_generator.make_code import MakeCode
                     make_code = MakeCode(current_sheet_surrogate, lb_src, lb_hdr)
 
                     # 시트 정보 검증 (C# 버전과 동일한 순서)
@@ -4619,6 +5204,33 @@ class DBExcelEditor(QMainWindow):
         #         event.ignore() # 종료 취소
         #         return
 
+        # 대기 중인 편집 반영 - 실패하면 편집을 잃고 종료할지 확인
+        if not self.flush_grid_edits():
+            reply = QMessageBox.warning(self, "편집 반영 실패",
+                                        "대기 중인 셀 편집을 DB에 반영하지 못했습니다.\n\n"
+                                        "종료하면 반영하지 못한 편집은 사라집니다. 그래도 종료하시겠습니까?",
+                                        QMessageBox.Yes | QMessageBox.No, QMessageBox.No)
+            if reply != QMessageBox.Yes:
+                event.ignore()
+                return
+
+        # 진행 중인 백그라운드 작업 확인 (종료 시 취소됨)
+        try:
+            from core.job_scheduler import get_job_scheduler
+            startup_job = getattr(self.startup_worker, 'job', None)  # 시작 준비 작업은 확인 없이 취소
+            active_jobs = [job for job in get_job_scheduler().active_jobs() if job is not startup_job]
+        except ImportError:
+            active_jobs = []
+        if active_jobs:
+            job_list = '\n'.join(f"• {job.name}" for job in active_jobs[:10])
+            reply = QMessageBox.question(self, "종료 확인",
+                                         f"진행 중인 작업이 {len(active_jobs)}개 있습니다.\n\n{job_list}\n\n"
+                                         "작업을 취소하고 종료하시겠습니까?",
+                                         QMessageBox.Yes | QMessageBox.No, QMessageBox.No)
+            if reply != QMessageBox.Yes:
+                event.ignore()
+                return
+
         # cleanup 메서드가 aboutToQuit 시그널에 연결되어 DB 연결 해제 등을 처리하므로
         # 여기서는 특별한 작업 없이 종료 허용
         event.accept()
@@ -4628,6 +5240,16 @@ class DBExcelEditor(QMainWindow):
         """애플리케이션 종료 시 정리 작업 (다중 DB 상태 저장 및 DB 연결 해제)"""
         logging.info("=== 애플리케이션 정리 작업 시작 ===")
 
+        # 0. 그리드의 대기 중인 편집 반영 (DB 연결 해제 전, 실패는 closeEvent에서 이미 확인)
+        self.flush_grid_edits()
+
+        # 백그라운드 작업 취소 및 작업 스레드 종료 대기 (작업 전용 DB 연결이 먼저 닫히도록)
+        try:
+            from core.job_scheduler import shutdown_job_scheduler
+            shutdown_job_scheduler(wait=True, timeout=5.0)
+        except Exception as e:
+            logging.error(f"작업 스케줄러 종료 오류: {e}")
+
         try:
             # 1. 개별 DB 핸들러 연결 해제 (안전 조치)
             if hasattr(self, 'db') and self.db:
@@ -4853,6 +5475,8 @@ class DBExcelEditor(QMainWindow):
         """앱 시작 시 Git pull 및 백업 루틴"""
         try:
             logging.info("앱 시작 루틴 시작...")
+            if not self.ensure_git_manager():
+                return
 
             # Git 상태 표시 업데이트
             self.update_git_status("🔄 Git pull 실행 중...", "info")
@@ -5010,6 +5634,20 @@ class DBExcelEditor(QMainWindow):
         # 기본값 (PATH에서 찾기)
         return "git"
 
+    def _branch_status_text(self, current_branch: str, cached_only: bool = False) -> str:
+        """브랜치 표시 문자열 (upstream 대비 ahead/behind가 있으면 ↑/↓ 표시, 상태 캐시 사용)"""
+        text = f"브랜치: {current_branch}"
+        if self.git_manager:
+            try:
+                ahead_behind = self.git_manager.get_ahead_behind(cached_only)
+                if ahead_behind['ahead']:
+                    text += f" ↑{ahead_behind['ahead']}"
+                if ahead_behind['behind']:
+                    text += f" ↓{ahead_behind['behind']}"
+            except Exception as e:
+                logging.debug(f"ahead/behind 확인 실패: {e}")
+        return text
+
     def update_branch_display(self):
         """브랜치 표시 업데이트 (Git 상태 레이블에 반영)"""
         try:
@@ -5023,7 +5661,7 @@ class DBExcelEditor(QMainWindow):
                 else:
                     status_type = "info"
 
-                self.update_git_status(f"브랜치: {current_branch}", status_type)
+                self.update_git_status(self._branch_status_text(current_branch), status_type)
 
             logging.debug(f"브랜치 표시 업데이트: {current_branch}")
         except Exception as e:
@@ -5044,6 +5682,10 @@ class DBExcelEditor(QMainWindow):
             self.statusBar.showMessage("Git 상태 새로고침 중...")
             QApplication.processEvents()
 
+            # 수동 새로고침은 캐시된 Git 상태를 버리고 다시 조회
+            if self.git_manager:
+                self.git_manager.status_service.invalidate()
+
             # 브랜치 정보 업데이트
             self.update_branch_display()
 
@@ -5055,7 +5697,7 @@ class DBExcelEditor(QMainWindow):
                 try:
                     if self.git_manager:
                         current_branch = self.get_current_branch()
-                        self.update_git_status(f"브랜치: {current_branch}", "success")
+                        self.update_git_status(self._branch_status_text(current_branch), "success")
                     else:
                         self.update_git_status("Git 관리자 없음", "warning")
                 except Exception as git_error:
@@ -5080,6 +5722,9 @@ class DBExcelEditor(QMainWindow):
     def reset_to_remote(self):
         """원격 기준으로 로컬 초기화"""
         try:
+            if not self.ensure_git_manager():
+                return
+
             # 사용자 확인
             reply = QMessageBox.question(
                 self, "원격 기준 초기화 확인",
@@ -5129,6 +5774,13 @@ class DBExcelEditor(QMainWindow):
     def generate_csv_history(self):
         """CSV 히스토리 생성 (파일 메뉴에서 호출)"""
         try:
+            if self.history_export_worker is not None and self.history_export_worker.is_running():
+                QMessageBox.information(self, "CSV 히스토리 생성", "CSV 히스토리 생성이 이미 진행 중입니다.")
+                return
+
+            if not self.ensure_git_manager():
+                return
+
             # 기능 설명 및 확인 대화상자
             info_message = (
                 "CSV 히스토리 생성 기능\n\n"
@@ -5138,7 +5790,7 @@ class DBExcelEditor(QMainWindow):
                 "• 현재 열린 모든 데이터베이스의 시트를 개별 CSV 파일로 변환\n"
                 "• 각 데이터베이스별로 별도의 history 디렉토리 생성\n"
                 "• 시트명을 파일명으로 하는 CSV 파일 생성\n"
-                "• 기존 CSV 파일이 있는 경우 덮어쓰기\n\n"
+                "• 마지막 내보내기 이후 내용이 바뀐 시트만 다시 쓰기\n\n"
                 "주의사항:\n"
                 "일반적으로 파일 편집 시 CSV 히스토리가 자동으로 생성되므로, "
                 "초기 세팅, 특별한 목적 등이 없다면 사용하실 필요가 없습니다.\n\n"
@@ -5202,56 +5854,205 @@ class DBExcelEditor(QMainWindow):
             if final_confirm != QMessageBox.Yes:
                 return
 
-            # 진행률 다이얼로그 표시
+            # 대기 중인 편집 반영 후 작업 스레드에서 내보내기 (작업 스레드는 DB별 전용 연결 사용)
+            if not self.flush_grid_edits("CSV 히스토리 내보내기"):
+                return
+            db_files = [getattr(db, 'db_file_path', None) or db.db_file for db in db_handlers]
+
             from PySide6.QtWidgets import QProgressDialog
-            progress = QProgressDialog("CSV 히스토리 생성 중...", "취소", 0, 100, self)
+            progress = QProgressDialog("CSV 히스토리 생성 준비 중...", "취소", 0, max(1, total_sheets), self)
             progress.setWindowModality(Qt.WindowModal)
             progress.setMinimumDuration(0)
+            progress.setAutoClose(False)
+            progress.setAutoReset(False)
+            self.history_export_progress = progress
+
+            from ui.history_export_worker import HistoryExportWorker
+            worker = HistoryExportWorker(self.git_manager.history_dir, db_files, self)
+            worker.progress.connect(self.on_csv_history_progress)
+            worker.finished.connect(self.on_csv_history_finished)
+            progress.canceled.connect(worker.cancel)
+            self.history_export_worker = worker
+
             progress.show()
-            progress.setValue(10)
-            QApplication.processEvents()
+            worker.start()
+            self.statusBar.showMessage("CSV 히스토리 생성 중...")
 
-            # CSV 생성 실행
-            progress.setLabelText("모든 DB의 시트를 CSV로 내보내는 중...")
-            progress.setValue(50)
-            QApplication.processEvents()
+        except Exception as e:
+            logging.error(f"CSV 히스토리 생성 중 오류: {e}")
+            QMessageBox.critical(self, "CSV 생성 오류",
+                               f"CSV 히스토리 생성 중 오류가 발생했습니다:\n{str(e)}")
 
-            if self.git_manager.export_all_db_history(db_handlers):
-                progress.setValue(100)
-                progress.setLabelText("CSV 생성 완료")
-                QApplication.processEvents()
 
-                # 성공 메시지
-                self.statusBar.showMessage("CSV 히스토리 생성 완료")
 
-                QMessageBox.information(self, "CSV 생성 완료",
-                                      f"모든 DB의 시트가 CSV로 성공적으로 내보내졌습니다.\n\n"
-                                      f"각 DB별 history 디렉토리를 확인해주세요.")
-            else:
-                progress.close()
-                QMessageBox.critical(self, "CSV 생성 실패",
-                                   "CSV 파일 생성 중 오류가 발생했습니다.\n"
-                                   "로그를 확인해주세요.")
+    def migrate_open_dbs_to_v3(self):
+        """열린 V2 DB를 V3 셀 스키마로 변환 (파일 전체를 다시 쓰므로 사용자 확인 후에만 실행)"""
+        try:
+            targets = []
+            for db_name, db_handler in self.db_manager.databases.items():
+                try:
+                    if db_handler.needs_cells_migration():
+                        targets.append((db_name, db_handler))
+                except Exception as e:
+                    logging.warning(f"⚠ 셀 스키마 확인 실패 ({db_name}): {e}")
 
-            progress.close()
+            if not targets:
+                QMessageBox.information(self, "DB 저장 형식 변환", "변환할 이전 형식(V2) DB가 없습니다.")
+                return
+
+            db_list = '\n'.join(f"• {db_name}" for db_name, _ in targets)
+            reply = QMessageBox.question(
+                self, "DB 저장 형식 변환",
+                f"다음 {len(targets)}개 DB를 새 셀 저장 형식(V3)으로 변환합니다.\n\n{db_list}\n\n"
+                "변환 후 파일 크기가 줄고 조회가 빨라지지만 DB 파일 전체가 다시 쓰이므로 "
+                "Git에서는 모든 대상 DB가 변경된 것으로 표시됩니다.\n\n계속하시겠습니까?",
+                QMessageBox.Yes | QMessageBox.No, QMessageBox.No)
+            if reply != QMessageBox.Yes:
+                return
+
+            if not self.flush_grid_edits("DB 저장 형식 변환"):
+                return
+            converted, failed = [], []
+            for db_name, db_handler in targets:
+                self.statusBar.showMessage(f"DB 저장 형식 변환 중: {db_name}")
+                QApplication.processEvents()
+                try:
+                    db_handler.migrate_cells_to_v3()
+                    converted.append(db_name)
+                except Exception as e:
+                    logging.error(f"❌ DB 저장 형식 변환 실패 ({db_name}): {e}")
+                    failed.append(f"{db_name}: {e}")
 
+            self.statusBar.showMessage(f"DB 저장 형식 변환 완료: {len(converted)}개 성공, {len(failed)}개 실패")
+            if failed:
+                QMessageBox.warning(self, "DB 저장 형식 변환", "일부 DB 변환에 실패했습니다.\n\n" + '\n'.join(failed))
+            else:
+                QMessageBox.information(self, "DB 저장 형식 변환", f"{len(converted)}개 DB를 변환했습니다.")
         except Exception as e:
-            logging.error(f"CSV 히스토리 생성 중 오류: {e}")
+            logging.error(f"DB 저장 형식 변환 중 오류: {e}")
+            QMessageBox.critical(self, "DB 저장 형식 변환 오류", f"DB 저장 형식 변환 중 오류가 발생했습니다:\n{str(e)}")
+
+    def on_csv_history_progress(self, done: int, total: int, label: str):
+        """CSV 히스토리 내보내기 진행률 (작업 스레드 → GUI 스레드)"""
+        progress = self.history_export_progress
+        if progress is None:
+            return
+        progress.setMaximum(max(1, total))
+        progress.setValue(done)
+        if label:
+            progress.setLabelText(f"CSV로 내보내는 중 ({done + 1}/{total})\n{label}")
+
+    def on_csv_history_finished(self, summary: dict):
+        """CSV 히스토리 내보내기 완료 (작업 스레드 → GUI 스레드)"""
+        if self.history_export_progress is not None:
+            self.history_export_progress.close()
+            self.history_export_progress = None
+        self.history_export_worker = None
+
+        if summary.get('error'):
             QMessageBox.critical(self, "CSV 생성 오류",
-                               f"CSV 히스토리 생성 중 오류가 발생했습니다:\n{str(e)}")
+                                 f"CSV 히스토리 생성 중 오류가 발생했습니다:\n{summary['error']}")
+            return
 
+        result_text = (f"새로 쓴 시트: {summary['written']}개\n"
+                       f"변경 없어 생략한 시트: {summary['skipped']}개")
+        if summary['failed']:
+            failed_list = '\n'.join(f"• {label}" for label in summary['failed'][:20])
+            QMessageBox.critical(self, "CSV 생성 실패",
+                                 f"일부 시트의 CSV 파일 생성 중 오류가 발생했습니다.\n\n{result_text}\n\n"
+                                 f"실패한 시트:\n{failed_list}\n\n로그를 확인해주세요.")
+        elif summary['cancelled']:
+            self.statusBar.showMessage("CSV 히스토리 생성 취소됨")
+            QMessageBox.information(self, "CSV 생성 취소", f"CSV 히스토리 생성이 취소되었습니다.\n\n{result_text}")
+        else:
+            self.statusBar.showMessage("CSV 히스토리 생성 완료")
+            QMessageBox.information(self, "CSV 생성 완료",
+                                    f"모든 DB의 시트가 CSV로 성공적으로 내보내졌습니다.\n\n{result_text}\n\n"
+                                    f"각 DB별 history 디렉토리를 확인해주세요.")
 
+    def show_performance_report(self):
+        """성능 보고서 다이얼로그 표시 (계측 요약, 캐시 적중률, Chrome trace 저장)"""
+        try:
+            model = getattr(self.grid_view, 'model', None)
+            grid_cache = getattr(model, 'cache', None)
+            from ui.performance_report_dialog import PerformanceReportDialog
+            dialog = PerformanceReportDialog(self, grid_cache=grid_cache, default_dir=self.last_directory)
+            dialog.exec()
+        except Exception as e:
+            logging.error(f"성능 보고서 표시 오류: {e}\n{traceback.format_exc()}")
+            QMessageBox.critical(self, "성능 보고서 오류", f"성능 보고서 표시 중 오류 발생: {str(e)}")
+
+    def show_symbol_search(self):
+        """심볼 검색 다이얼로그 표시 (모달리스 - 결과 더블클릭 시 해당 위치로 이동)"""
+        try:
+            if not self.db_manager or self.db_manager.symbol_index is None:
+                QMessageBox.information(self, "심볼 검색", "심볼 색인이 비활성화되어 있습니다 (USE_SYMBOL_INDEX).")
+                return
+
+            # 대기 중인 편집 반영 (색인은 DB에 커밋된 변경 기준)
+            if not self.flush_grid_edits("심볼 검색"):
+                return
+
+            if self.symbol_search_dialog is None:
+                from ui.symbol_search_dialog import SymbolSearchDialog
+                self.symbol_search_dialog = SymbolSearchDialog(self.db_manager, self)
+                self.symbol_search_dialog.navigate.connect(self.navigate_to_symbol)
+            self.symbol_search_dialog.db_manager = self.db_manager  # DB 관리자가 다시 만들어진 경우 대비
+            self.symbol_search_dialog.show()
+            self.symbol_search_dialog.raise_()
+            self.symbol_search_dialog.activateWindow()
+            self.symbol_search_dialog.refresh()
+        except Exception as e:
+            logging.error(f"심볼 검색 표시 오류: {e}\n{traceback.format_exc()}")
+            QMessageBox.critical(self, "심볼 검색 오류", f"심볼 검색 표시 중 오류 발생: {str(e)}")
+
+    def navigate_to_symbol(self, db_name: str, sheet_id: int, row: int):
+        """심볼 정의 위치로 이동 (DB 전환 → 트리에서 시트 선택 → 그리드 행 표시)"""
+        if db_name not in self.db_manager.databases:
+            self.statusBar.showMessage(f"'{db_name}' DB가 열려 있지 않습니다")
+            return
+
+        if self.db_manager.current_db_name != db_name:
+            combo_index = self.db_combo.findData(db_name)
+            if combo_index >= 0:
+                self.db_combo.setCurrentIndex(combo_index)  # on_db_selection_changed에서 전환/목록 갱신
+            if self.db_manager.current_db_name != db_name:
+                return
+
+        tree_model = self.tree_view.model
+        for file_row in range(tree_model.rowCount()):
+            file_item = tree_model.item(file_row, 0)
+            for sheet_row in range(file_item.rowCount() if file_item else 0):
+                sheet_item = file_item.child(sheet_row, 0)
+                if sheet_item.data(Qt.UserRole + 1) == "sheet" and sheet_item.data(Qt.UserRole) == sheet_id:
+                    self.tree_view.setCurrentIndex(sheet_item.index())  # sheet_selected → 그리드 로드
+                    break
+            else:
+                continue
+            break
+
+        if self.current_sheet_id != sheet_id:
+            self.statusBar.showMessage(f"시트를 찾을 수 없습니다 (ID: {sheet_id})")
+            return
+        grid_index = self.grid_view.model.index(row, 0)
+        self.grid_view.setCurrentIndex(grid_index)
+        self.grid_view.scrollTo(grid_index, QAbstractItemView.PositionAtCenter)
 
     def show_git_status(self):
         """Git 변경사항 확인 다이얼로그 표시 (DB 닫기 없이 바로 표시)"""
         try:
-            if not self.git_manager:
+            if not self.ensure_git_manager():
                 QMessageBox.warning(self, "Git 관리자 없음",
                                   "Git 관리자가 초기화되지 않았습니다.")
                 return
 
+            # 대기 중인 편집 반영 (DB/CSV 히스토리가 최신 상태여야 함)
+            if not self.flush_grid_edits("Git 상태 확인"):
+                return
+
             # Git 상태 다이얼로그 생성 및 표시 (DB 닫기 없이 바로)
             # DB 관리자 정보를 다이얼로그에 전달하여 커밋 시 DB 닫기 처리
+            from ui.git_status_dialog import GitStatusDialog
             dialog = GitStatusDialog(self.git_manager, self, db_manager=self.db_manager)
 
             # 다이얼로그 실행
@@ -5468,6 +6269,8 @@ class DBExcelEditor(QMainWindow):
         """완전한 시스템 새로고침: Git pull 먼저, 모든 파일 최신화 후 재로드"""
         try:
             logging.info("=== 완전한 시스템 새로고침 시작 ===")
+            if not self.ensure_git_manager():
+                return
 
             # 1단계: 모든 리소스 완전 해제
             self.update_git_status("🧹 모든 리소스 정리 중...", "info")
@@ -5657,11 +6460,11 @@ class DBExcelEditor(QMainWindow):
                 self.update_git_status("Git 관리자 없음", "error")
                 return
 
-            # 현재 브랜치 정보만 표시
+            # 현재 브랜치 정보만 표시 (.git/HEAD 직접 읽기, ahead/behind는 캐시된 값 - git 실행 없음)
             try:
                 current_branch = self.get_current_branch()
                 if current_branch:
-                    self.update_git_status(f"브랜치: {current_branch}", "success")
+                    self.update_git_status(self._branch_status_text(current_branch, cached_only=True), "success")
                 else:
                     self.update_git_status("Git 저장소 없음", "warning")
             except Exception as branch_error:
@@ -5712,6 +6515,8 @@ def main():
     # QApplication.setAttribute(Qt.AA_EnableHighDpiScaling)
     # QApplication.setAttribute(Qt.AA_UseHighDpiPixmaps)
 
+    startup_profiler.mark("imports_done")
+
     app = QApplication(sys.argv)
     app.setStyle('Fusion')  # 일관된 UI 스타일 적용
 
@@ -5736,4 +6541,7 @@ except ImportError:
 # ---------------------------------
 
 if __name__ == "__main__":
+    # 병렬 코드 생성 워커 프로세스 지원 (PyInstaller 빌드 포함)
+    import multiprocessing
+    multiprocessing.freeze_support()
     main()
\ No newline at end of file
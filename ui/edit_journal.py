@@ -0,0 +1,249 @@
+"""
+셀 편집 지연 저장(write-behind) 저널과 증분 CSV 히스토리 기록기
+
+- EditJournal: 셀 편집을 메모리에서 병합(같은 셀은 마지막 값)한 뒤
+  유휴 타이머 만료/저장/구조 변경 직전에 update_cells 한 번(한 트랜잭션)으로 DB에 반영
+- CsvHistoryWriter: history/<DB명>/<시트명>.csv 를 백그라운드 스레드에서 갱신
+  시트별로 렌더링된 CSV 행 문자열을 보관하여 변경된 행만 DB에서 다시 읽고 렌더링
+  (열 개수가 바뀌었거나 캐시가 없으면 전체 렌더링)
+"""
+
+import io
+import os
+import csv
+import logging
+import threading
+from pathlib import Path
+from typing import Dict, Iterable, Optional, Set, Tuple
+
+from PySide6.QtCore import QObject, QTimer, Signal
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import EDIT_JOURNAL_IDLE_MS, EDIT_JOURNAL_MAX_PENDING
+except ImportError:
+    EDIT_JOURNAL_IDLE_MS = 500
+    EDIT_JOURNAL_MAX_PENDING = 5000
+
+# 전체 렌더링 시 한 번에 읽는 행 수
+_CSV_RENDER_CHUNK_ROWS = 1024
+
+
+def _render_csv_line(row_data: Dict[int, str], width: int) -> str:
+    """한 행을 csv.writer와 같은 형식의 문자열로 변환 (줄바꿈 포함)"""
+    buffer = io.StringIO()
+    csv.writer(buffer).writerow([str(row_data.get(col, "") or "") for col in range(width)])
+    return buffer.getvalue()
+
+
+class CsvHistoryWriter(QObject):
+    """
+    시트 CSV 히스토리 증분 기록기 (프로세스 전체에서 하나, instance()로 사용)
+
+    요청은 (DB 파일, 시트) 단위로 병합되며 작업 스레드 하나가 순서대로 처리합니다.
+    작업 스레드는 DB 파일별 전용 조회 연결(DBHandlerV2, read_only)로 읽습니다 (GUI 연결과 분리).
+    조회 연결은 한 번의 기록 작업(대기 요청 묶음)이 끝나면 닫고, DBManager가 DB를 제거하거나
+    모두 닫을 때(Git 커밋 전 포함)도 close_handlers()로 닫습니다.
+    """
+
+    written = Signal(str)  # 기록 완료된 CSV 파일 경로 (GUI 스레드로 전달됨)
+
+    _instance: Optional['CsvHistoryWriter'] = None
+
+    @classmethod
+    def instance(cls) -> 'CsvHistoryWriter':
+        if cls._instance is None:
+            cls._instance = cls()
+        return cls._instance
+
+    def __init__(self):
+        super().__init__()
+        self._lock = threading.Lock()
+        self._wakeup = threading.Event()
+        self._pending: Dict[Tuple[str, int], Optional[Set[int]]] = {}  # None이면 전체 렌더링
+        self._rendered: Dict[Tuple[str, int], Dict] = {}  # {'width': 열 개수, 'lines': [CSV 행 문자열]}
+        self._handlers = {}
+        # 작업 스레드의 기록 묶음 전체 동안 잡음 (close_handlers가 사용 중인 연결을 닫지 않도록)
+        self._handler_lock = threading.RLock()
+        self._thread: Optional[threading.Thread] = None
+
+        from data_manager.db_manager import add_close_listener
+        add_close_listener(self.close_handlers)
+
+    def schedule(self, db_file: str, sheet_id: int, rows: Optional[Iterable[int]] = None):
+        """CSV 갱신 요청 (rows=None이면 시트 전체) - 즉시 반환"""
+        key = (db_file, sheet_id)
+        with self._lock:
+            if rows is None or (key in self._pending and self._pending[key] is None):
+                self._pending[key] = None
+            else:
+                self._pending.setdefault(key, set()).update(rows)
+        self._wakeup.set()
+        if self._thread is None or not self._thread.is_alive():
+            self._thread = threading.Thread(target=self._worker, name="CsvHistoryWriter", daemon=True)
+            self._thread.start()
+
+    def invalidate(self, db_file: str, sheet_id: int):
+        """행 번호가 바뀌는 변경(행/열 삽입·삭제, 시트 다시 로드) 후 렌더링 캐시 폐기"""
+        with self._lock:
+            self._rendered.pop((db_file, sheet_id), None)
+
+    def _worker(self):
+        while True:
+            self._wakeup.wait()
+            with self._lock:
+                self._wakeup.clear()
+                pending, self._pending = self._pending, {}
+            if not pending:
+                continue
+            with self._handler_lock:
+                try:
+                    for (db_file, sheet_id), rows in pending.items():
+                        try:
+                            csv_file = self._write(db_file, sheet_id, rows)
+                            if csv_file:
+                                self.written.emit(str(csv_file))
+                        except Exception as e:
+                            logging.error(f"CSV 히스토리 갱신 실패 ({Path(db_file).name}, 시트 {sheet_id}): {e}")
+                finally:
+                    self._close_handlers_locked()
+
+    def close_handlers(self, db_file: Optional[str] = None):
+        """
+        작업 스레드의 조회 연결 닫기 (db_file=None이면 전체)
+
+        기록 중이면 현재 묶음이 끝날 때까지 기다립니다 (묶음이 끝나면 어차피 닫히므로 짧게 대기).
+        """
+        with self._handler_lock:
+            self._close_handlers_locked(db_file)
+
+    def _close_handlers_locked(self, db_file: Optional[str] = None):
+        targets = list(self._handlers) if db_file is None else [
+            f for f in self._handlers if os.path.normcase(os.path.abspath(f)) == os.path.normcase(os.path.abspath(db_file))
+        ]
+        for f in targets:
+            handler = self._handlers.pop(f)
+            try:
+                handler.disconnect()
+            except Exception as e:
+                logging.warning(f"⚠ CSV 히스토리 조회 연결 닫기 실패 ({Path(f).name}): {e}")
+
+    def _handler(self, db_file: str):
+        handler = self._handlers.get(db_file)
+        if handler is None:
+            from data_manager.db_handler_v2 import DBHandlerV2
+            handler = self._handlers[db_file] = DBHandlerV2(db_file, read_only=True)
+        return handler
+
+    def _write(self, db_file: str, sheet_id: int, rows: Optional[Set[int]]) -> Optional[Path]:
+        db = self._handler(db_file)
+        sheet = next((s for s in db.get_sheets() if s['id'] == sheet_id), None)
+        if sheet is None:
+            logging.debug(f"시트 ID {sheet_id}를 찾을 수 없음 - CSV 갱신 생략")
+            return None
+
+        metadata = db.get_sheet_metadata(sheet_id)
+        height = metadata.get("max_row", 0) + 1
+        width = metadata.get("max_col", 0) + 1
+
+        key = (db_file, sheet_id)
+        with self._lock:
+            rendered = self._rendered.get(key)
+
+        if rendered is None or rendered['width'] != width or rows is None:
+            # 전체 렌더링 (범위 쿼리 단위)
+            lines = []
+            for start in range(0, height, _CSV_RENDER_CHUNK_ROWS):
+                count = min(_CSV_RENDER_CHUNK_ROWS, height - start)
+                chunk = db.get_rows_data(sheet_id, start, count)
+                lines.extend(_render_csv_line(chunk.get(r, {}), width) for r in range(start, start + count))
+            mode = "전체"
+        else:
+            # 변경된 행 + 새로 늘어난 행만 렌더링
+            lines = rendered['lines'][:height]
+            touched = {r for r in rows if r < height} | set(range(len(lines), height))
+            lines.extend([""] * (height - len(lines)))
+            for r in sorted(touched):
+                lines[r] = _render_csv_line(db.get_row_data(sheet_id, r), width)
+            mode = f"{len(touched)}개 행"
+
+        csv_dir = Path("history") / Path(db_file).stem
+        csv_dir.mkdir(parents=True, exist_ok=True)
+        # $ 기호 제거하여 파일명 안전하게 만들기
+        csv_file = csv_dir / f"{sheet['name'].replace('$', '')}.csv"
+        with open(csv_file, 'w', newline='', encoding='utf-8') as f:
+            f.write("".join(lines))
+
+        with self._lock:
+            self._rendered[key] = {'width': width, 'lines': lines}
+        logging.info(f"✅ CSV 히스토리 갱신 ({mode}): {csv_file}")
+        return csv_file
+
+
+class EditJournal(QObject):
+    """
+    셀 편집 지연 저장 저널 (VirtualizedGridModel 전용, GUI 스레드에서 사용)
+
+    record()는 메모리에만 기록하고 유휴 타이머를 다시 시작합니다.
+    flush()는 대기 중인 편집을 시트별 update_cells 한 번으로 반영한 뒤 CSV 히스토리 갱신을 요청합니다.
+    """
+
+    flushed = Signal(int)  # DB에 반영된 셀 개수
+
+    def __init__(self, db_handler, idle_ms: int = EDIT_JOURNAL_IDLE_MS, parent=None):
+        super().__init__(parent)
+        self.db = db_handler
+        self._pending: Dict[int, Dict[Tuple[int, int], str]] = {}  # {sheet_id: {(row, col): value}}
+        self._pending_count = 0
+        self._timer = QTimer(self)
+        self._timer.setSingleShot(True)
+        self._timer.setInterval(max(0, int(idle_ms)))
+        self._timer.timeout.connect(self.flush)
+
+    def __bool__(self) -> bool:
+        return self._pending_count > 0
+
+    def record(self, sheet_id: int, cells: Iterable[Tuple[int, int, str]]):
+        """편집 기록 (같은 셀은 마지막 값만 유지)"""
+        sheet_pending = self._pending.setdefault(sheet_id, {})
+        for row, col, value in cells:
+            sheet_pending[(row, col)] = value
+        self._pending_count = sum(len(p) for p in self._pending.values())
+
+        if self._pending_count >= EDIT_JOURNAL_MAX_PENDING:
+            self.flush()
+        else:
+            self._timer.start()
+
+    def flush(self) -> int:
+        """대기 중인 편집을 DB에 반영 (시트별 한 트랜잭션) - 반영한 셀 개수 반환"""
+        self._timer.stop()
+        if not self._pending:
+            return 0
+
+        pending, self._pending = self._pending, {}
+        self._pending_count = 0
+        total = 0
+        db_file = getattr(self.db, 'db_file_path', None) or getattr(self.db, 'db_file', None)
+
+        items = list(pending.items())
+        for index, (sheet_id, cells) in enumerate(items):
+            cells_data = [(row, col, value) for (row, col), value in cells.items()]
+            try:
+                self.db.update_cells(sheet_id, cells_data)
+            except Exception:
+                # 반영하지 못한 시트의 편집은 다시 대기열에 두고 상위로 전파 (저장 시 오류 표시)
+                for other_sheet, other_cells in items[index:]:
+                    restored = self._pending.setdefault(other_sheet, {})
+                    for key, value in other_cells.items():
+                        restored.setdefault(key, value)
+                self._pending_count = sum(len(p) for p in self._pending.values())
+                raise
+            total += len(cells_data)
+            logging.debug(f"편집 저널 반영: 시트 {sheet_id}, 셀 {len(cells_data)}개")
+
+            if db_file:
+                CsvHistoryWriter.instance().schedule(db_file, sheet_id, {row for row, _ in cells})
+
+        self.flushed.emit(total)
+        return total
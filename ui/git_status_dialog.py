@@ -353,7 +353,7 @@ class GitStatusDialog(QDialog):
         try:
             self.status_label.setText("상태 로딩 중...")
 
-            # GitManager를 통해 변경된 파일 목록 가져오기
+            # GitManager를 통해 변경된 파일 목록 가져오기 (상태 캐시 - git 메타데이터/history가 그대로면 재실행 없음)
             self.changed_files = self.git_manager.get_changed_files(use_enhanced_encoding=True)
 
             # 현재 브랜치 정보 (GitManager 활용)
@@ -665,6 +665,15 @@ class GitStatusDialog(QDialog):
             self.left_diff_viewer.setText("diff 로딩 중...")
             self.right_diff_viewer.setText("diff 로딩 중...")
 
+            # DB 파일은 셀 단위 비교 (실패 시 기존 텍스트 diff)
+            if filename.endswith('.db'):
+                try:
+                    db_diff = self.git_manager.get_db_diff(filename)
+                    self.display_db_diff(db_diff)
+                    return
+                except Exception as db_diff_error:
+                    logging.warning(f"DB 셀 비교 실패, 텍스트 diff 사용 ({filename}): {db_diff_error}")
+
             # GitManager를 통해 diff 가져오기
             diff_content = self.git_manager.get_file_diff(filename)
 
@@ -686,6 +695,76 @@ class GitStatusDialog(QDialog):
 
 
 
+    # 시트당 표시하는 최대 변경 항목 수 (나머지는 개수만 표시)
+    DB_DIFF_MAX_ITEMS_PER_SHEET = 1000
+
+    def display_db_diff(self, db_diff):
+        """DB 셀 단위 비교 결과를 좌우 분할로 표시 (시트별 바뀐 셀, 삽입/삭제된 행, 영향받는 심볼)"""
+        from data_manager.db_diff import cell_address
+
+        self.left_diff_viewer.clear()
+        self.right_diff_viewer.clear()
+
+        changed_sheets = db_diff.changed_sheets
+        if not changed_sheets:
+            no_diff_msg = f"셀 변경사항이 없습니다. (시트 {len(db_diff.sheets)}개 비교)"
+            self.left_diff_viewer.setText(no_diff_msg)
+            self.right_diff_viewer.setText(no_diff_msg)
+            return
+
+        summary = (f"DB 셀 비교: 변경 시트 {len(changed_sheets)}개 / 전체 {len(db_diff.sheets)}개, "
+                   f"{db_diff.elapsed * 1000:.0f}ms")
+        left_lines = [('chunk_header', summary)]
+        right_lines = [('chunk_header', summary)]
+        symbols = sorted(db_diff.symbols)
+        if symbols:
+            symbol_text = ", ".join(symbols[:50]) + (f" 외 {len(symbols) - 50}개" if len(symbols) > 50 else "")
+            left_lines.append(('chunk_header', f"영향받는 심볼 ({len(symbols)}개): {symbol_text}"))
+            right_lines.append(('chunk_header', f"영향받는 심볼 ({len(symbols)}개): {symbol_text}"))
+
+        status_names = {'added': "추가됨", 'removed': "삭제됨", 'modified': "수정됨"}
+        for sheet in changed_sheets:
+            if sheet.status in ('added', 'removed'):
+                header = f"시트: {sheet.name} ({status_names[sheet.status]}, 셀 {sheet.cell_count}개)"
+                left_lines.append(('header', header))
+                right_lines.append(('header', header))
+                continue
+
+            header = (f"시트: {sheet.name} (셀 변경 {len(sheet.changed_cells)}개, "
+                      f"행 삽입 {len(sheet.inserted_rows)}개, 행 삭제 {len(sheet.removed_rows)}개)")
+            left_lines.append(('header', header))
+            right_lines.append(('header', header))
+
+            shown = 0
+            for change in sheet.changed_cells:
+                if shown >= self.DB_DIFF_MAX_ITEMS_PER_SHEET:
+                    break
+                left_lines.append(('removed', f"{cell_address(change.old_row, change.col)}: {change.old or '(빈 셀)'}"))
+                right_lines.append(('added', f"{cell_address(change.new_row, change.col)}: {change.new or '(빈 셀)'}"))
+                shown += 1
+            for row, values in sheet.removed_rows:
+                if shown >= self.DB_DIFF_MAX_ITEMS_PER_SHEET:
+                    break
+                left_lines.append(('removed', f"행 {row + 1} 삭제: " + " | ".join(v for v in values if v)))
+                right_lines.append(('empty', ''))
+                shown += 1
+            for row, values in sheet.inserted_rows:
+                if shown >= self.DB_DIFF_MAX_ITEMS_PER_SHEET:
+                    break
+                left_lines.append(('empty', ''))
+                right_lines.append(('added', f"행 {row + 1} 삽입: " + " | ".join(v for v in values if v)))
+                shown += 1
+
+            total = len(sheet.changed_cells) + len(sheet.removed_rows) + len(sheet.inserted_rows)
+            if total > shown:
+                left_lines.append(('chunk_header', f"... {total - shown}개 항목 생략"))
+                right_lines.append(('chunk_header', f"... {total - shown}개 항목 생략"))
+
+        self.populate_diff_viewer(self.left_diff_viewer, left_lines, "left")
+        self.populate_diff_viewer(self.right_diff_viewer, right_lines, "right")
+        self.sync_scroll_bars()
+        logging.info(f"DB 셀 비교 표시 완료: {summary}")
+
     def display_split_diff(self, diff_content):
         """diff 내용을 좌우 분할로 표시 (이전/현재 버전)"""
         self.left_diff_viewer.clear()
@@ -1190,8 +1269,9 @@ class GitStatusDialog(QDialog):
             self.commit_push_button.setText("새 파일 확인 중...")
             QApplication.processEvents()
 
-            # 새로운 Git 상태 가져오기
-            self.files_after_db_close = self.git_manager.get_changed_files(use_enhanced_encoding=True)
+            # 새로운 Git 상태 가져오기 (DB 닫기로 파일이 바뀌었으므로 캐시 무시)
+            self.files_after_db_close = self.git_manager.get_changed_files(use_enhanced_encoding=True,
+                                                                           force_refresh=True)
 
             # 새로 생긴 파일들 찾기
             files_after_names = [f['filename'] for f in self.files_after_db_close]
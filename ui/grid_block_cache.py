@@ -0,0 +1,284 @@
+"""
+그리드 블록 캐시 (VirtualizedGridModel 전용, Qt 비의존)
+
+- 행을 block_rows개 단위 블록으로 묶어 DBHandlerV2.get_rows_data 범위 쿼리 한 번으로 로드
+- 블록은 OrderedDict LRU 순서로 관리 (접근 시 끝으로 이동, 가장 오래된 블록부터 제거)
+- 블록마다 행별 dirty 플래그(bytearray)를 두어 편집된 행이 있는 블록은 제거하지 않음
+- 스크롤 방향으로 다음 블록을 백그라운드 스레드에서 미리 로드
+  (스레드 전용 DBHandlerV2 연결 사용, 결과는 다음 조회 시 GUI 스레드에서 병합)
+- 캐시가 바뀌는 작업(편집/행 삽입 등)마다 세대 번호를 올려 진행 중이던 선읽기 결과를 폐기
+"""
+
+import queue
+import logging
+import threading
+from collections import OrderedDict
+from typing import Callable, Dict, Optional
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import (
+        GRID_BLOCK_ROWS, GRID_CACHE_BLOCKS, GRID_PREFETCH_BLOCKS, USE_GRID_PREFETCH
+    )
+except ImportError:
+    GRID_BLOCK_ROWS = 256
+    GRID_CACHE_BLOCKS = 64
+    GRID_PREFETCH_BLOCKS = 2
+    USE_GRID_PREFETCH = True
+
+# 닫을 때 선읽기 스레드 종료를 기다리는 최대 시간 (블록 하나 읽는 시간보다 충분히 길게)
+_CLOSE_JOIN_TIMEOUT_SEC = 2.0
+
+
+class _Block:
+    """block_rows개 행의 캐시 데이터와 행별 dirty 플래그"""
+    __slots__ = ('rows', 'dirty', 'dirty_count')
+
+    def __init__(self, rows: Dict[int, Dict[int, str]], block_rows: int):
+        self.rows = rows  # {행 번호: {열 번호: 값}} - 셀이 없는 행은 생략
+        self.dirty = bytearray(block_rows)
+        self.dirty_count = 0
+
+
+class GridBlockCache:
+    """
+    행 블록 단위 LRU 캐시
+
+    사용 예:
+        cache = GridBlockCache(lambda start, count: db.get_rows_data(sheet_id, start, count))
+        value = cache.get_cell(row, col)
+    """
+
+    def __init__(self, loader: Callable[[int, int], Dict[int, Dict[int, str]]],
+                 block_rows: int = GRID_BLOCK_ROWS, max_blocks: int = GRID_CACHE_BLOCKS,
+                 prefetch_loader_factory: Optional[Callable[[], Callable[[int, int], Dict]]] = None,
+                 prefetch_blocks: int = GRID_PREFETCH_BLOCKS):
+        """
+        Args:
+            loader: (시작 행, 행 개수) → {행: {열: 값}} - GUI 스레드에서 호출
+            prefetch_loader_factory: 선읽기 스레드 안에서 호출되어 그 스레드 전용 loader를 만드는 함수
+                                     (None이면 선읽기 사용 안 함)
+        """
+        self.loader = loader
+        self.block_rows = max(1, int(block_rows))
+        self.max_blocks = max(2, int(max_blocks))
+        self.prefetch_blocks = max(0, int(prefetch_blocks))
+        self.blocks: "OrderedDict[int, _Block]" = OrderedDict()
+        self.generation = 0
+        self._last_block = None
+
+        # 적중 통계 (성능 보고서용)
+        self.hits = 0
+        self.misses = 0
+        self.prefetch_hits = 0
+
+        # 선읽기 스레드 상태
+        self._prefetch_loader_factory = prefetch_loader_factory if USE_GRID_PREFETCH else None
+        self._requests: "queue.Queue" = queue.Queue()
+        self._results = []  # [(세대, 블록 번호, rows)] - _lock 보호
+        self._lock = threading.Lock()
+        self._pending = set()  # 선읽기 요청 중인 블록 번호 (GUI 스레드 전용)
+        self._thread: Optional[threading.Thread] = None
+
+    # ------------------------------------------------------------------
+    # 조회
+    # ------------------------------------------------------------------
+    def get_cell(self, row: int, col: int) -> Optional[str]:
+        """셀 값 (없으면 None) - 블록이 없으면 로드"""
+        row_data = self.get_row(row).get(row)
+        return row_data.get(col) if row_data is not None else None
+
+    def get_row(self, row: int) -> Dict[int, Dict[int, str]]:
+        """row가 속한 블록의 {행: {열: 값}} (LRU 갱신 + 스크롤 방향 선읽기)"""
+        index = row // self.block_rows
+        block = self.blocks.get(index)
+        if block is None:
+            self._merge_prefetched()
+            block = self.blocks.get(index)
+            if block is not None:
+                self.prefetch_hits += 1
+        else:
+            self.hits += 1
+        if block is None:
+            self.misses += 1
+            block = self._store(index, self.loader(index * self.block_rows, self.block_rows))
+        else:
+            self.blocks.move_to_end(index)
+
+        if index != self._last_block:
+            self._schedule_prefetch(index)
+            self._last_block = index
+        return block.rows
+
+    def peek_cell(self, row: int, col: int) -> Optional[str]:
+        """이미 캐시된 경우에만 값 반환 (DB 조회/LRU 갱신 없음)"""
+        block = self.blocks.get(row // self.block_rows)
+        if block is None:
+            return None
+        row_data = block.rows.get(row)
+        return row_data.get(col) if row_data is not None else None
+
+    def __contains__(self, row: int) -> bool:
+        return row // self.block_rows in self.blocks
+
+    def stats(self) -> Dict[str, float]:
+        """블록 조회 통계 - 선읽기로 채워진 블록 조회도 적중으로 계산"""
+        lookups = self.hits + self.prefetch_hits + self.misses
+        return {
+            'hits': self.hits,
+            'prefetch_hits': self.prefetch_hits,
+            'misses': self.misses,
+            'hit_rate': (self.hits + self.prefetch_hits) / lookups if lookups else 0.0,
+            'cached_blocks': len(self.blocks),
+            'max_blocks': self.max_blocks,
+        }
+
+    # ------------------------------------------------------------------
+    # 수정
+    # ------------------------------------------------------------------
+    def set_cell(self, row: int, col: int, value, mark_dirty: bool = True):
+        """셀 값을 캐시에 반영하고 행 dirty 플래그 설정 (블록이 없으면 먼저 로드)"""
+        self.generation += 1  # 진행 중인 선읽기 결과는 이 값을 모르므로 폐기
+        index = row // self.block_rows
+        if index not in self.blocks:
+            self.get_row(row)
+        block = self.blocks[index]
+        row_data = block.rows.get(row)
+        if row_data is None:
+            row_data = block.rows[row] = {}
+        if value:
+            row_data[col] = value
+        else:
+            row_data.pop(col, None)
+
+        if mark_dirty:
+            offset = row - index * self.block_rows
+            if not block.dirty[offset]:
+                block.dirty[offset] = 1
+                block.dirty_count += 1
+
+    def is_row_dirty(self, row: int) -> bool:
+        block = self.blocks.get(row // self.block_rows)
+        return bool(block and block.dirty[row % self.block_rows])
+
+    def clear_dirty(self):
+        """저장 완료 후 모든 dirty 플래그 해제"""
+        for block in self.blocks.values():
+            if block.dirty_count:
+                block.dirty = bytearray(self.block_rows)
+                block.dirty_count = 0
+
+    def invalidate(self, from_row: int = 0):
+        """from_row가 속한 블록부터 끝까지 제거 (행 삽입/삭제 등 행 번호가 바뀌는 경우)"""
+        self.generation += 1
+        first = from_row // self.block_rows
+        if first <= 0:
+            self.blocks.clear()
+        else:
+            for index in [i for i in self.blocks if i >= first]:
+                del self.blocks[index]
+        self._last_block = None
+
+    def shift_columns(self, at: int, count: int):
+        """열 삽입 후 캐시된 셀의 열 번호 이동 (at 이상 열을 count만큼 오른쪽으로)"""
+        self.generation += 1
+        for block in self.blocks.values():
+            for row, row_data in block.rows.items():
+                if any(col >= at for col in row_data):
+                    block.rows[row] = {(col + count if col >= at else col): value
+                                       for col, value in row_data.items()}
+
+    def clear(self):
+        self.invalidate(0)
+
+    # ------------------------------------------------------------------
+    # 내부: 저장/제거
+    # ------------------------------------------------------------------
+    def _store(self, index: int, rows: Dict[int, Dict[int, str]]) -> _Block:
+        block = _Block(rows, self.block_rows)
+        self.blocks[index] = block
+        self._evict(keep=index)
+        return block
+
+    def _evict(self, keep: int):
+        """LRU 앞쪽부터 제거 - dirty 행이 있는 블록과 방금 넣은 블록은 끝으로 보내고 건너뜀 (한 바퀴까지만)"""
+        attempts = len(self.blocks)
+        while len(self.blocks) > self.max_blocks and attempts > 0:
+            attempts -= 1
+            index, block = next(iter(self.blocks.items()))
+            if block.dirty_count or index == keep:
+                self.blocks.move_to_end(index)
+                continue
+            del self.blocks[index]
+
+    # ------------------------------------------------------------------
+    # 내부: 선읽기
+    # ------------------------------------------------------------------
+    def _schedule_prefetch(self, index: int):
+        if self._prefetch_loader_factory is None or not self.prefetch_blocks:
+            return
+        direction = -1 if self._last_block is not None and index < self._last_block else 1
+        for step in range(1, self.prefetch_blocks + 1):
+            target = index + direction * step
+            if target < 0 or target in self.blocks or target in self._pending:
+                continue
+            self._pending.add(target)
+            self._requests.put((self.generation, target))
+        self._ensure_thread()
+
+    def _ensure_thread(self):
+        if self._thread is None or not self._thread.is_alive():
+            self._thread = threading.Thread(target=self._prefetch_worker, name="GridPrefetch", daemon=True)
+            self._thread.start()
+
+    def _prefetch_worker(self):
+        """선읽기 스레드: 요청 블록을 전용 연결로 읽어 결과 목록에 추가"""
+        try:
+            loader = self._prefetch_loader_factory()
+        except Exception as e:
+            logging.warning(f"⚠ 그리드 선읽기 연결 생성 실패, 선읽기 중지: {e}")
+            self._prefetch_loader_factory = None
+            return
+
+        while True:
+            request = self._requests.get()
+            if request is None:
+                break
+            generation, index = request
+            try:
+                rows = loader(index * self.block_rows, self.block_rows)
+            except Exception as e:
+                logging.debug(f"그리드 블록 {index} 선읽기 실패: {e}")
+                rows = None
+            with self._lock:
+                self._results.append((generation, index, rows))
+
+        closer = getattr(loader, 'close', None)
+        if closer:
+            closer()
+
+    def _merge_prefetched(self):
+        """완료된 선읽기 결과 중 현재 세대의 것만 캐시에 추가 (GUI 스레드)"""
+        with self._lock:
+            results, self._results = self._results, []
+        for generation, index, rows in results:
+            self._pending.discard(index)
+            if rows is None or generation != self.generation or index in self.blocks:
+                continue
+            self._store(index, rows)
+
+    def close(self):
+        """선읽기 스레드 종료 (남은 요청은 버리고, 읽던 블록이 끝나 전용 연결을 닫을 때까지 기다림)"""
+        thread, self._thread = self._thread, None
+        if thread is None or not thread.is_alive():
+            return
+        try:
+            while True:
+                self._requests.get_nowait()
+        except queue.Empty:
+            pass
+        self._pending.clear()
+        self._requests.put(None)
+        thread.join(_CLOSE_JOIN_TIMEOUT_SEC)
+        if thread.is_alive():
+            logging.warning(f"⚠ 그리드 선읽기 스레드가 {_CLOSE_JOIN_TIMEOUT_SEC:.0f}초 안에 끝나지 않음 (백그라운드에서 종료)")
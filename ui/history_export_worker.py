@@ -0,0 +1,89 @@
+"""
+CSV 히스토리 내보내기 백그라운드 작업
+
+GUI 스레드를 막지 않도록 작업 스레드에서 CsvHistoryExporter를 실행하고
+시트 단위 진행률/완료를 Qt 시그널로 전달합니다 (수신 슬롯은 GUI 스레드에서 실행).
+작업 스레드는 DB 파일별 전용 DBHandlerV2 연결로 읽습니다 (GUI 연결과 분리).
+공용 작업 스케줄러를 사용하면 'git' 자원 작업으로 실행되어 다른 Git 작업과 겹치지 않습니다.
+"""
+
+import logging
+import threading
+from pathlib import Path
+from typing import List, Optional
+
+from PySide6.QtCore import QObject, Signal
+
+from core.job_scheduler import CancellationToken, PRIORITY_LOW
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import USE_JOB_SCHEDULER
+except ImportError:
+    USE_JOB_SCHEDULER = False
+
+
+class HistoryExportWorker(QObject):
+    """
+    사용 예:
+        worker = HistoryExportWorker(git_manager.history_dir, db_files)
+        worker.progress.connect(on_progress)
+        worker.finished.connect(on_finished)
+        worker.start()
+    """
+
+    progress = Signal(int, int, str)  # 완료 시트 수, 전체 시트 수, 현재 시트 라벨
+    finished = Signal(object)  # CsvHistoryExporter.export 요약 dict (예외 시 'error' 키 포함)
+
+    def __init__(self, history_dir: Path, db_files: List[str], parent=None):
+        super().__init__(parent)
+        self.history_dir = Path(history_dir)
+        self.db_files = list(db_files)
+        self.cancel_event = CancellationToken()  # threading.Event와 같은 is_set() 제공
+        self._thread: Optional[threading.Thread] = None
+        self._job = None
+
+    def start(self):
+        if USE_JOB_SCHEDULER:
+            from core.job_scheduler import get_job_scheduler
+            self._job = get_job_scheduler().submit(lambda ctx: self._run(), name="CSV 히스토리 내보내기",
+                                                   priority=PRIORITY_LOW, resource="git", token=self.cancel_event)
+            # 실행 전에 취소되면 _run이 호출되지 않으므로 완료 시그널을 여기서 보냄
+            self._job.add_done_callback(self._on_job_done)
+            return
+        self._thread = threading.Thread(target=self._run, name="HistoryExport", daemon=True)
+        self._thread.start()
+
+    def cancel(self):
+        """다음 시트부터 중단 (진행 중인 시트는 완료 또는 기존 파일 유지)"""
+        self.cancel_event.cancel()
+
+    def is_running(self) -> bool:
+        if self._job is not None:
+            return not self._job.done()
+        return self._thread is not None and self._thread.is_alive()
+
+    def _on_job_done(self, job):
+        if job.future.cancelled():
+            self.finished.emit({'written': 0, 'skipped': 0, 'failed': [], 'cancelled': True, 'total': 0})
+
+    def _run(self):
+        from data_manager.db_handler_v2 import DBHandlerV2
+        from utils.csv_history_exporter import CsvHistoryExporter
+
+        handlers = []
+        try:
+            for db_file in self.db_files:
+                handlers.append(DBHandlerV2(db_file, read_only=True))
+            summary = CsvHistoryExporter(self.history_dir).export(
+                handlers, lambda done, total, label: self.progress.emit(done, total, label), self.cancel_event)
+        except Exception as e:
+            logging.error(f"CSV 히스토리 내보내기 작업 오류: {e}")
+            summary = {'written': 0, 'skipped': 0, 'failed': [], 'cancelled': False, 'total': 0, 'error': str(e)}
+        finally:
+            for handler in handlers:
+                try:
+                    handler.disconnect()
+                except Exception:
+                    pass
+        self.finished.emit(summary)
@@ -0,0 +1,131 @@
+"""
+작업 스케줄러(core/job_scheduler.py) ↔ Qt 연결
+
+스케줄러 이벤트는 작업 스레드에서 발생하므로 GUI 스레드에 생성된 JobSignalBridge가
+Qt 시그널로 다시 내보냅니다 (수신 슬롯은 GUI 스레드에서 실행, HistoryExportWorker와 같은 방식).
+JobProgressDialog는 작업 하나를 따라가는 모달리스 진행률 대화상자로, 열려 있는 동안에도
+다른 가져오기/코드 생성/내보내기를 시작할 수 있습니다.
+
+사용 예:
+    job = get_job_scheduler().submit(run_import, jobs, name="Excel 가져오기", resource="excel_import")
+    JobProgressDialog(job, "Excel 파일을 DB로 변환 중...", self).show()
+    get_job_bridge().watch(job, on_finished=self.on_import_finished)
+"""
+
+import logging
+from typing import Callable, Dict, List, Optional
+
+from PySide6.QtCore import QObject, Qt, Signal
+from PySide6.QtWidgets import QProgressDialog
+
+from core.job_scheduler import Job, JobListener, get_job_scheduler, PENDING
+
+
+class JobSignalBridge(QObject, JobListener):
+    """스케줄러 리스너 → Qt 시그널 (반드시 GUI 스레드에서 생성)"""
+
+    job_submitted = Signal(object)  # Job
+    job_started = Signal(object)
+    job_progress = Signal(object)
+    job_finished = Signal(object)
+    active_count_changed = Signal(int)  # 대기/실행 중 작업 수
+
+    def __init__(self, scheduler=None, parent=None):
+        super().__init__(parent)
+        self.scheduler = scheduler or get_job_scheduler()
+        self._progress_slots: Dict[int, List[Callable[[Job], None]]] = {}
+        self._finished_slots: Dict[int, List[Callable[[Job], None]]] = {}
+        self.job_progress.connect(self._dispatch_progress)
+        self.job_finished.connect(self._dispatch_finished)
+        self.scheduler.add_listener(self)
+
+    def watch(self, job: Job, on_finished: Optional[Callable[[Job], None]] = None,
+              on_progress: Optional[Callable[[Job], None]] = None):
+        """
+        작업 하나의 진행률/완료 슬롯 등록 (GUI 스레드에서 호출)
+
+        완료 알림은 큐 연결로 전달되므로 submit() 직후 같은 호출 안에서 등록하면 놓치지 않습니다.
+        """
+        if on_progress is not None:
+            self._progress_slots.setdefault(job.id, []).append(on_progress)
+        if on_finished is not None:
+            self._finished_slots.setdefault(job.id, []).append(on_finished)
+
+    # JobListener (작업 스레드에서 호출)
+    def on_job_submitted(self, job: Job):
+        self.job_submitted.emit(job)
+        self.active_count_changed.emit(len(self.scheduler.active_jobs()))
+
+    def on_job_started(self, job: Job):
+        self.job_started.emit(job)
+
+    def on_job_progress(self, job: Job):
+        self.job_progress.emit(job)
+
+    def on_job_finished(self, job: Job):
+        self.job_finished.emit(job)
+        self.active_count_changed.emit(len(self.scheduler.active_jobs()))
+
+    # GUI 스레드
+    def _dispatch_progress(self, job: Job):
+        for slot in self._progress_slots.get(job.id, []):
+            try:
+                slot(job)
+            except Exception as e:
+                logging.error(f"작업 진행률 처리 오류 [{job.name}]: {e}")
+
+    def _dispatch_finished(self, job: Job):
+        self._progress_slots.pop(job.id, None)
+        for slot in self._finished_slots.pop(job.id, []):
+            try:
+                slot(job)
+            except Exception as e:
+                logging.error(f"작업 완료 처리 오류 [{job.name}]: {e}")
+
+
+_bridge: Optional[JobSignalBridge] = None
+
+
+def get_job_bridge() -> JobSignalBridge:
+    """공용 브리지 (첫 호출은 GUI 스레드에서)"""
+    global _bridge
+    if _bridge is None:
+        _bridge = JobSignalBridge()
+    return _bridge
+
+
+class JobProgressDialog(QProgressDialog):
+    """작업 하나의 진행률 표시 + 취소 (모달리스, 작업이 끝나면 자동으로 닫힘)"""
+
+    def __init__(self, job: Job, title: str, parent=None, bridge: Optional[JobSignalBridge] = None):
+        super().__init__(title, "취소", 0, 100, parent)
+        self.job = job
+        self.title = title
+        self.setWindowTitle(job.name)
+        self.setWindowModality(Qt.NonModal)
+        self.setMinimumDuration(0)
+        self.setAutoClose(False)
+        self.setAutoReset(False)
+        self.setValue(0)
+        if job.state == PENDING:
+            self.setLabelText(f"{title}\n(다른 작업이 끝나기를 기다리는 중...)")
+        self.canceled.connect(self._on_canceled)
+
+        bridge = bridge or get_job_bridge()
+        bridge.watch(job, on_finished=self._on_finished, on_progress=self._on_progress)
+
+    def _on_progress(self, job: Job):
+        if self.job.token.cancelled:
+            return
+        self.setValue(min(99, int(job.progress)))
+        if job.message:
+            self.setLabelText(f"{self.title}\n{job.message}")
+
+    def _on_canceled(self):
+        logging.info(f"사용자가 작업을 취소했습니다: {self.job.name}")
+        self.job.cancel()
+
+    def _on_finished(self, _job: Job):
+        self.setValue(100)
+        self.close()
+        self.deleteLater()
@@ -0,0 +1,175 @@
+"""
+성능 보고서 다이얼로그
+- 마지막 실행의 시트별 소요 시간 / 초당 행 수
+- span 집계 (DB 조회, CalList 단계, CSV 내보내기, git 호출)
+- 캐시 적중률 (그리드 블록 캐시 등 .hits/.misses 카운터) 및 Cython 커널 호출 수
+- Chrome trace JSON 저장 (chrome://tracing, Perfetto에서 열기)
+"""
+
+import logging
+from datetime import datetime
+from typing import Dict, List
+
+from PySide6.QtWidgets import (
+    QDialog, QVBoxLayout, QHBoxLayout, QTabWidget, QTableWidget, QTableWidgetItem,
+    QPushButton, QLabel, QCheckBox, QFileDialog, QMessageBox, QHeaderView
+)
+from PySide6.QtCore import Qt
+
+from core.tracing import tracer
+
+
+class PerformanceReportDialog(QDialog):
+    """계측 결과 요약 다이얼로그"""
+
+    def __init__(self, parent=None, grid_cache=None, default_dir: str = ""):
+        super().__init__(parent)
+        self.grid_cache = grid_cache  # GridBlockCache (없으면 None)
+        self.default_dir = default_dir
+
+        self.setWindowTitle("성능 보고서")
+        self.setMinimumSize(800, 500)
+        self.resize(1000, 650)
+
+        self.setup_ui()
+        self.refresh()
+
+    def setup_ui(self):
+        """UI 구성"""
+        layout = QVBoxLayout(self)
+        layout.setContentsMargins(6, 6, 6, 6)
+
+        self.header_label = QLabel()
+        layout.addWidget(self.header_label)
+
+        self.tabs = QTabWidget()
+        self.sheet_table = self._create_table(["시트", "단계", "소요(ms)", "행 수", "행/초"])
+        self.span_table = self._create_table(["구간", "호출 수", "합계(ms)", "평균(ms)", "최대(ms)"])
+        self.cache_table = self._create_table(["캐시", "적중", "미스", "적중률"])
+        self.kernel_table = self._create_table(["커널", "모듈", "Cython", "Cython 호출", "폴백 호출", "오류"])
+        self.tabs.addTab(self.sheet_table, "시트별")
+        self.tabs.addTab(self.span_table, "구간별")
+        self.tabs.addTab(self.cache_table, "캐시")
+        self.tabs.addTab(self.kernel_table, "커널")
+        layout.addWidget(self.tabs, 1)
+
+        # 하단 버튼
+        button_layout = QHBoxLayout()
+        self.enable_check = QCheckBox("계측 사용")
+        self.enable_check.setChecked(tracer.enabled)
+        self.enable_check.setToolTip("다음 코드 생성부터 구간/카운터를 기록합니다 (비활성화 시 오버헤드 없음)")
+        self.enable_check.toggled.connect(self.on_toggle_tracing)
+        button_layout.addWidget(self.enable_check)
+        button_layout.addStretch()
+
+        refresh_button = QPushButton("새로고침")
+        refresh_button.clicked.connect(self.refresh)
+        button_layout.addWidget(refresh_button)
+
+        self.export_button = QPushButton("Chrome trace 저장...")
+        self.export_button.clicked.connect(self.export_trace)
+        button_layout.addWidget(self.export_button)
+
+        close_button = QPushButton("닫기")
+        close_button.clicked.connect(self.accept)
+        button_layout.addWidget(close_button)
+        layout.addLayout(button_layout)
+
+    def _create_table(self, headers: List[str]) -> QTableWidget:
+        table = QTableWidget(0, len(headers))
+        table.setHorizontalHeaderLabels(headers)
+        table.setEditTriggers(QTableWidget.NoEditTriggers)
+        table.setSortingEnabled(True)
+        table.verticalHeader().setVisible(False)
+        table.horizontalHeader().setSectionResizeMode(0, QHeaderView.Stretch)
+        return table
+
+    @staticmethod
+    def _fill_table(table: QTableWidget, rows: List[List]):
+        """행 목록으로 표 채우기 (숫자는 정렬 가능하도록 EditRole에 값 지정)"""
+        table.setSortingEnabled(False)
+        table.setRowCount(len(rows))
+        for r, values in enumerate(rows):
+            for c, value in enumerate(values):
+                item = QTableWidgetItem()
+                if isinstance(value, float):
+                    item.setData(Qt.EditRole, round(value, 2))
+                elif isinstance(value, int) and not isinstance(value, bool):
+                    item.setData(Qt.EditRole, value)
+                else:
+                    item.setText(str(value))
+                table.setItem(r, c, item)
+        table.setSortingEnabled(True)
+
+    # ------------------------------------------------------------------
+    # 표시
+    # ------------------------------------------------------------------
+    def refresh(self):
+        """계측 요약 / 캐시 / 커널 통계 다시 읽기"""
+        summary = tracer.summary()
+
+        status = "사용 중" if tracer.enabled else "꺼짐"
+        run = summary['run'] or "-"
+        self.header_label.setText(f"계측 {status} | 마지막 실행: {run} | 기록된 구간 {len(tracer.events)}개")
+        self.export_button.setEnabled(bool(tracer.events))
+
+        self._fill_table(self.sheet_table, [
+            [s['sheet'], s['span'], s['ms'], int(s['rows']), s['rows_per_sec']] for s in summary['sheets']
+        ])
+
+        self._fill_table(self.span_table, [
+            [name, e['count'], e['total_ms'], e['total_ms'] / e['count'], e['max_ms']]
+            for name, e in sorted(summary['spans'].items(), key=lambda kv: -kv[1]['total_ms'])
+        ])
+
+        self._fill_table(self.cache_table, self._cache_rows(summary))
+        self._fill_table(self.kernel_table, self._kernel_rows())
+
+    def _cache_rows(self, summary: Dict) -> List[List]:
+        counters = summary['counters']
+        rows = []
+        for name, rate in sorted(summary['hit_rates'].items()):
+            rows.append([name, int(counters.get(name + '.hits', 0)), int(counters.get(name + '.misses', 0)),
+                         f"{rate * 100:.1f}%"])
+
+        if self.grid_cache is not None:
+            stats = self.grid_cache.stats()
+            rows.append(["grid_block_cache", stats['hits'] + stats['prefetch_hits'], stats['misses'],
+                         f"{stats['hit_rate'] * 100:.1f}% (선읽기 {stats['prefetch_hits']}, "
+                         f"블록 {stats['cached_blocks']}/{stats['max_blocks']})"])
+        return rows
+
+    @staticmethod
+    def _kernel_rows() -> List[List]:
+        try:
+            from core.kernels import kernel_stats
+        except ImportError:
+            return []
+        return [[name, s['module'], "✓" if s['native'] else "-", s['hits'], s['fallbacks'], s['errors']]
+                for name, s in sorted(kernel_stats().items())]
+
+    # ------------------------------------------------------------------
+    # 동작
+    # ------------------------------------------------------------------
+    def on_toggle_tracing(self, checked: bool):
+        tracer.set_enabled(checked)
+        logging.info(f"계측 {'활성화' if checked else '비활성화'}")
+        self.refresh()
+
+    def export_trace(self):
+        """Chrome trace JSON 저장"""
+        default_name = f"trace_{datetime.now().strftime('%Y%m%d_%H%M%S')}.json"
+        file_path, _ = QFileDialog.getSaveFileName(
+            self, "Chrome trace 저장", f"{self.default_dir}/{default_name}" if self.default_dir else default_name,
+            "Trace JSON (*.json)")
+        if not file_path:
+            return
+        try:
+            count = tracer.export_chrome_trace(file_path)
+            logging.info(f"✓ Chrome trace 저장: {file_path} ({count}개 이벤트)")
+            QMessageBox.information(self, "저장 완료",
+                                    f"{count}개 이벤트를 저장했습니다.\n\n{file_path}\n\n"
+                                    "chrome://tracing 또는 https://ui.perfetto.dev 에서 열 수 있습니다.")
+        except OSError as e:
+            logging.error(f"❌ Chrome trace 저장 실패: {e}")
+            QMessageBox.critical(self, "저장 실패", f"Chrome trace 저장 실패:\n{e}")
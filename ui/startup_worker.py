@@ -0,0 +1,105 @@
+"""
+앱 시작 후 백그라운드 준비 작업
+
+창과 마지막 DB가 표시된 뒤 작업 스레드에서 GitManager 생성, 브랜치 목록/상태 캐시 조회,
+무거운 모듈(코드 생성기, Git 대화상자, 병렬 가져오기/내보내기 등) import를 미리 실행합니다.
+결과는 Qt 시그널로 전달되며 수신 슬롯(콤보박스 갱신 등)은 GUI 스레드에서 실행됩니다.
+(HistoryExportWorker와 같은 구조, 공용 작업 스케줄러 사용 시 'git' 자원 작업으로 실행)
+"""
+
+import logging
+import importlib
+import threading
+from typing import Optional
+
+from PySide6.QtCore import QObject, Signal
+
+from core.startup_profiler import startup_profiler
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import USE_JOB_SCHEDULER
+except ImportError:
+    USE_JOB_SCHEDULER = False
+
+# 첫 사용 시 지연을 줄이기 위해 미리 import하는 모듈
+WARMUP_MODULES = (
+    "code_generator.make_code",
+    "ui.git_status_dialog",
+    "ui.performance_report_dialog",
+    "ui.history_export_worker",
+    "ui.job_bridge",
+    "code_generator.parallel_generator",
+    "excel_processor.parallel_importer",
+    "excel_processor.parallel_exporter",
+)
+# xlwings는 import 시 해당 스레드에서 COM을 초기화하므로 미리 로드하지 않음 (Excel 실행 경로에서 지연 import)
+
+
+class StartupWarmupWorker(QObject):
+    """
+    사용 예:
+        worker = StartupWarmupWorker(self)
+        worker.git_ready.connect(on_git_ready)
+        worker.finished.connect(on_finished)
+        worker.start()
+    """
+
+    git_ready = Signal(object)  # {'git_manager', 'history_manager', 'branches'} (실패 시 'error' 키 포함)
+    finished = Signal()
+
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self._thread: Optional[threading.Thread] = None
+        self.job = None
+
+    def start(self):
+        if USE_JOB_SCHEDULER:
+            from core.job_scheduler import get_job_scheduler, PRIORITY_HIGH
+            self.job = get_job_scheduler().submit(lambda ctx: self._run(), name="시작 준비 (Git/모듈)",
+                                                   priority=PRIORITY_HIGH, resource="git")
+            return
+        self._thread = threading.Thread(target=self._run, name="StartupWarmup", daemon=True)
+        self._thread.start()
+
+    def is_running(self) -> bool:
+        if self.job is not None:
+            return not self.job.done()
+        return self._thread is not None and self._thread.is_alive()
+
+    def _run(self):
+        try:
+            self.git_ready.emit(self._prepare_git())
+            self._warm_up_modules()
+        finally:
+            self.finished.emit()
+
+    @staticmethod
+    def _prepare_git() -> dict:
+        """GitManager 생성 + 브랜치 목록/상태 캐시 채우기 (git 실행은 이 스레드에서만)"""
+        result = {'git_manager': None, 'history_manager': None, 'branches': None}
+        try:
+            with startup_profiler.phase("git_manager"):
+                from utils.git_manager import GitManager, DBHistoryManager
+                git_manager = GitManager()
+                result['git_manager'] = git_manager
+                result['history_manager'] = DBHistoryManager(git_manager)
+
+            with startup_profiler.phase("git_branches"):
+                if git_manager.status_service.available:
+                    result['branches'] = git_manager.get_all_branches()
+                    # ahead/behind 표시용 상태 캐시 (이후 타이머는 cached_only로 git 실행 없음)
+                    git_manager.get_ahead_behind()
+        except Exception as e:
+            logging.error(f"백그라운드 Git 준비 실패: {e}")
+            result['error'] = str(e)
+        return result
+
+    @staticmethod
+    def _warm_up_modules():
+        with startup_profiler.phase("module_warmup"):
+            for module_name in WARMUP_MODULES:
+                try:
+                    importlib.import_module(module_name)
+                except Exception as e:
+                    logging.warning(f"⚠ warm-up 모듈 로드 실패 ({module_name}): {e}")
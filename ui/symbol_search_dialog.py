@@ -0,0 +1,135 @@
+"""
+심볼 검색 다이얼로그
+- 열린 모든 DB에서 심볼 이름 검색 (입력 중 짧은 지연 후 자동 검색)
+- 충돌하는 중복 정의만 보기 (같은 프로젝트 조건에서 두 번 이상 정의된 심볼)
+- 결과 더블클릭 시 해당 DB/시트/행으로 이동
+검색은 DBManager의 심볼 색인(data_manager/symbol_index.py)을 사용하므로 시트를 읽지 않습니다.
+"""
+
+import logging
+from typing import Dict, List
+
+from PySide6.QtWidgets import (
+    QDialog, QVBoxLayout, QHBoxLayout, QTableWidget, QTableWidgetItem,
+    QPushButton, QLabel, QLineEdit, QCheckBox, QHeaderView
+)
+from PySide6.QtCore import Qt, QTimer, Signal
+
+SEARCH_DELAY_MS = 200
+SEARCH_LIMIT = 500
+
+
+class SymbolSearchDialog(QDialog):
+    """DB 간 심볼 검색 / 중복 정의 확인 다이얼로그 (모달리스)"""
+
+    navigate = Signal(str, int, int)  # db_name, sheet_id, row
+
+    COLUMNS = ["심볼", "OpCode", "타입", "값", "프로젝트 정의", "DB", "시트", "행"]
+
+    def __init__(self, db_manager, parent=None):
+        super().__init__(parent)
+        self.db_manager = db_manager
+        self.entries: List[Dict] = []
+
+        self.setWindowTitle("심볼 검색")
+        self.setMinimumSize(800, 450)
+        self.resize(1000, 600)
+
+        self.search_timer = QTimer(self)
+        self.search_timer.setSingleShot(True)
+        self.search_timer.setInterval(SEARCH_DELAY_MS)
+        self.search_timer.timeout.connect(self.refresh)
+
+        self.setup_ui()
+
+    def setup_ui(self):
+        """UI 구성"""
+        layout = QVBoxLayout(self)
+        layout.setContentsMargins(6, 6, 6, 6)
+
+        search_layout = QHBoxLayout()
+        self.search_edit = QLineEdit()
+        self.search_edit.setPlaceholderText("심볼 이름 (일부만 입력 가능)")
+        self.search_edit.textChanged.connect(lambda _text: self.search_timer.start())
+        self.search_edit.returnPressed.connect(self.refresh)
+        search_layout.addWidget(self.search_edit, 1)
+
+        self.duplicates_check = QCheckBox("중복 정의만 보기")
+        self.duplicates_check.setToolTip("같은 프로젝트 조건에서 두 번 이상 정의된 심볼 (DB 간 중복 포함)")
+        self.duplicates_check.toggled.connect(self.refresh)
+        search_layout.addWidget(self.duplicates_check)
+        layout.addLayout(search_layout)
+
+        self.table = QTableWidget(0, len(self.COLUMNS))
+        self.table.setHorizontalHeaderLabels(self.COLUMNS)
+        self.table.setEditTriggers(QTableWidget.NoEditTriggers)
+        self.table.setSelectionBehavior(QTableWidget.SelectRows)
+        self.table.setSortingEnabled(True)
+        self.table.verticalHeader().setVisible(False)
+        self.table.horizontalHeader().setSectionResizeMode(0, QHeaderView.Stretch)
+        self.table.cellDoubleClicked.connect(self.on_cell_double_clicked)
+        layout.addWidget(self.table, 1)
+
+        # 하단 상태/버튼
+        button_layout = QHBoxLayout()
+        self.status_label = QLabel()
+        button_layout.addWidget(self.status_label)
+        button_layout.addStretch()
+
+        close_button = QPushButton("닫기")
+        close_button.clicked.connect(self.close)
+        button_layout.addWidget(close_button)
+        layout.addLayout(button_layout)
+
+    # ------------------------------------------------------------------
+    # 검색
+    # ------------------------------------------------------------------
+    def refresh(self):
+        """현재 검색어/필터로 결과 다시 조회 (색인은 필요한 DB만 갱신됨)"""
+        self.search_timer.stop()
+        text = self.search_edit.text().strip()
+        try:
+            if self.duplicates_check.isChecked():
+                duplicates = self.db_manager.find_duplicate_symbols()
+                entries = [entry for name, group in sorted(duplicates.items())
+                           if not text or text.lower() in name.lower() for entry in group]
+                status = f"충돌하는 중복 정의 {len({entry['name'] for entry in entries})}개 심볼"
+            elif text:
+                entries = self.db_manager.search_symbols(text, SEARCH_LIMIT)
+                status = f"검색 결과 {len(entries)}개"
+                if len(entries) >= SEARCH_LIMIT:
+                    status += f" (상위 {SEARCH_LIMIT}개만 표시)"
+            else:
+                entries = []
+                status = "검색어를 입력하세요"
+        except Exception as e:
+            logging.error(f"심볼 검색 오류: {e}")
+            entries, status = [], f"검색 오류: {e}"
+
+        self.entries = entries
+        self._fill_table(entries)
+        self.status_label.setText(status)
+
+    def _fill_table(self, entries: List[Dict]):
+        self.table.setSortingEnabled(False)
+        self.table.setRowCount(len(entries))
+        for r, entry in enumerate(entries):
+            values = [entry['name'], entry['opcode'], entry['type'], entry['value'], entry['prjt'],
+                      entry['db_name'], entry['sheet_name'], entry['row']]
+            for c, value in enumerate(values):
+                item = QTableWidgetItem()
+                if isinstance(value, int):
+                    item.setData(Qt.EditRole, value)
+                else:
+                    item.setText(str(value))
+                if c == 0:
+                    item.setData(Qt.UserRole, r)  # 정렬 후에도 원래 항목을 찾기 위한 인덱스
+                self.table.setItem(r, c, item)
+        self.table.setSortingEnabled(True)
+
+    def on_cell_double_clicked(self, row: int, _column: int):
+        item = self.table.item(row, 0)
+        if item is None:
+            return
+        entry = self.entries[item.data(Qt.UserRole)]
+        self.navigate.emit(entry['db_name'], entry['sheet_id'], entry['row'])
@@ -0,0 +1,114 @@
+"""
+셀 편집 지연 저장 저널(ui/edit_journal.EditJournal) 회귀 테스트
+
+- 같은 셀 편집은 마지막 값만 남기고 시트별 update_cells 한 번으로 반영하는지
+- 반영에 실패한 편집이 저널에 남아 다시 반영할 수 있는지
+- 그리드 모델을 닫을 때(release) 대기 중인 편집이 DB 연결 해제 전에 반영되는지
+
+PySide6가 없으면 건너뜁니다. 실행: python -m unittest discover -t . -s ui/tests
+"""
+
+import os
+import shutil
+import logging
+import tempfile
+import unittest
+from unittest import mock
+
+try:
+    import PySide6  # noqa: F401
+    PYSIDE6_AVAILABLE = True
+except ImportError:
+    PYSIDE6_AVAILABLE = False
+
+
+def setUpModule():
+    if PYSIDE6_AVAILABLE:
+        os.environ.setdefault("QT_QPA_PLATFORM", "offscreen")
+        from PySide6.QtWidgets import QApplication
+        if QApplication.instance() is None:
+            globals()["_app"] = QApplication([])
+
+
+@unittest.skipUnless(PYSIDE6_AVAILABLE, "PySide6 없음")
+class EditJournalTest(unittest.TestCase):
+    def setUp(self):
+        logging.disable(logging.CRITICAL)
+        from data_manager.db_handler_v2 import DBHandlerV2
+        from ui import edit_journal
+
+        # CSV 히스토리는 기록하지 않고 요청만 확인
+        self.csv_writer = mock.Mock()
+        patcher = mock.patch.object(edit_journal.CsvHistoryWriter, "instance", return_value=self.csv_writer)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
+        self.temp_dir = tempfile.mkdtemp()
+        self.db_file = os.path.join(self.temp_dir, "journal.db")
+        self.db = DBHandlerV2(self.db_file)
+        self.sheet_a = self.db.create_sheet_v2("$A")
+        self.sheet_b = self.db.create_sheet_v2("$B")
+        self.journal = edit_journal.EditJournal(self.db, idle_ms=60000)
+
+    def tearDown(self):
+        self.db.disconnect()
+        logging.disable(logging.NOTSET)
+        shutil.rmtree(self.temp_dir, ignore_errors=True)
+
+    def test_flush_coalesces_edits_per_sheet(self):
+        self.journal.record(self.sheet_a, [(0, 0, "a"), (1, 2, "b")])
+        self.journal.record(self.sheet_a, [(0, 0, "a2")])
+        self.journal.record(self.sheet_b, [(3, 1, "c")])
+        self.assertTrue(self.journal)
+
+        with mock.patch.object(self.db, "update_cells", wraps=self.db.update_cells) as update_cells:
+            self.assertEqual(self.journal.flush(), 3)
+        self.assertEqual(update_cells.call_count, 2)
+        self.assertFalse(self.journal)
+
+        self.assertEqual(self.db.get_cell_value(self.sheet_a, 0, 0), "a2")
+        self.assertEqual(self.db.get_cell_value(self.sheet_a, 1, 2), "b")
+        self.assertEqual(self.db.get_cell_value(self.sheet_b, 3, 1), "c")
+        self.csv_writer.schedule.assert_any_call(self.db_file, self.sheet_a, {0, 1})
+        self.assertEqual(self.journal.flush(), 0)
+
+    def test_failed_flush_keeps_pending_edits(self):
+        self.journal.record(self.sheet_a, [(0, 0, "a")])
+        self.journal.record(self.sheet_b, [(0, 0, "b")])
+
+        original = self.db.update_cells
+        with mock.patch.object(self.db, "update_cells", side_effect=[None, RuntimeError("disk I/O error")]):
+            with self.assertRaises(RuntimeError):
+                self.journal.flush()
+        self.assertTrue(self.journal)
+
+        # 실패 이후의 새 편집이 우선
+        self.journal.record(self.sheet_b, [(0, 0, "b2")])
+        with mock.patch.object(self.db, "update_cells", wraps=original) as update_cells:
+            self.assertEqual(self.journal.flush(), 1)
+        self.assertEqual(update_cells.call_args[0][0], self.sheet_b)
+        self.assertEqual(self.db.get_cell_value(self.sheet_b, 0, 0), "b2")
+        self.assertFalse(self.journal)
+
+    def test_model_release_flushes_before_close(self):
+        from ui.ui_components import VirtualizedGridModel
+
+        model = VirtualizedGridModel(self.db)
+        model.sheet_id = self.sheet_a
+        model.apply_edits([(2, 3, "pending")])
+        self.assertEqual(self.db.get_cell_value(self.sheet_a, 2, 3), "")
+
+        model.release()
+        self.assertFalse(model.journal)
+        self.db.disconnect()
+
+        from data_manager.db_handler_v2 import DBHandlerV2
+        reopened = DBHandlerV2(self.db_file, read_only=True)
+        try:
+            self.assertEqual(reopened.get_cell_value(self.sheet_a, 2, 3), "pending")
+        finally:
+            reopened.disconnect()
+
+
+if __name__ == '__main__':
+    unittest.main()
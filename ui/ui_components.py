@@ -16,6 +16,9 @@ from PySide6.QtWidgets import (
     QStyle, QApplication
 )
 
+from ui.grid_block_cache import GridBlockCache
+from ui.edit_journal import EditJournal, CsvHistoryWriter
+
 class FastItemDelegate(QStyledItemDelegate):
     """빠른 렌더링을 위한 아이템 델리게이트"""
 
@@ -108,13 +111,17 @@ class VirtualizedGridModel(QAbstractTableModel):
         self.row_count = 0
         self.col_count = 0
 
-        # 데이터 캐싱 (행 단위로 캐싱)
-        self.cache = {}  # {row: {col: value}}
-        self.cache_size = 1000  # 최대 캐시 크기
+        # 데이터 캐싱 (행 블록 단위 LRU 캐시, 시트 로드 시 생성)
+        self.cache: Optional[GridBlockCache] = None
         self.modified_cells = set()  # 수정된 셀 추적 (row, col)
         # 실행 취소 스택 추가
         self.undo_stack = QUndoStack(self)
 
+        # 편집 지연 저장 저널 (유휴 시/저장 시 한 트랜잭션으로 DB 반영, CSV 히스토리는 백그라운드 증분 갱신)
+        self.journal = EditJournal(self.db, parent=self)
+        self.journal.flushed.connect(self._on_journal_flushed)
+        CsvHistoryWriter.instance().written.connect(self._on_csv_history_written)
+
     # 셀 변경 명령 클래스 추가
     class CellEditCommand(QUndoCommand):
         def __init__(self, model, index, old_value, new_value):
@@ -125,44 +132,147 @@ class VirtualizedGridModel(QAbstractTableModel):
             self.new_value = new_value
 
         def redo(self):
-            # 셀 값 설정 - modified_cells에 추가하고 dataChanged 발생
+            # 셀 값 설정 - 캐시/저널에 기록하고 dataChanged 발생 (DB 반영은 저널이 일괄 처리)
             row, col = self.index.row(), self.index.column()
-            if row not in self.model.cache:
-                self.model.cache[row] = {}
-            self.model.cache[row][col] = self.new_value
-            self.model.modified_cells.add((row, col))
-
-            # 즉시 DB에 저장 (실시간 저장)
-            try:
-                self.model.db.update_cells(self.model.sheet_id, [(row, col, self.new_value)])
-                logging.debug(f"셀 즉시 저장: ({row}, {col}) = '{self.new_value}'")
-            except Exception as save_error:
-                logging.error(f"셀 즉시 저장 실패: {save_error}")
-
+            self.model.apply_edits([(row, col, self.new_value)])
             self.model.dataChanged.emit(self.index, self.index, [Qt.EditRole])
 
-            # 실시간 CSV 업데이트
-            self.model.update_csv_immediately()
-
         def undo(self):
             # 이전 값으로 복원
             row, col = self.index.row(), self.index.column()
-            if row not in self.model.cache:
-                self.model.cache[row] = {}
-            self.model.cache[row][col] = self.old_value
-            self.model.modified_cells.add((row, col))
+            self.model.apply_edits([(row, col, self.old_value)])
+            self.model.dataChanged.emit(self.index, self.index, [Qt.EditRole])
 
-            # 즉시 DB에 저장 (실시간 저장)
-            try:
-                self.model.db.update_cells(self.model.sheet_id, [(row, col, self.old_value)])
-                logging.debug(f"셀 실행 취소 저장: ({row}, {col}) = '{self.old_value}'")
-            except Exception as save_error:
-                logging.error(f"셀 실행 취소 저장 실패: {save_error}")
+    class BatchCellEditCommand(QUndoCommand):
+        """여러 셀 편집을 하나의 실행 취소 단위로 처리 (붙여넣기/지우기) - 저널 기록과 dataChanged는 1회"""
+
+        def __init__(self, model, changes, description):
+            """
+            Args:
+                model: VirtualizedGridModel
+                changes: [(row, col, old_value, new_value), ...]
+                description: 실행 취소 목록에 표시할 이름
+            """
+            super().__init__(f"{description} ({len(changes)}개 셀)")
+            self.model = model
+            self.changes = changes
 
-            self.model.dataChanged.emit(self.index, self.index, [Qt.EditRole])
+        def _apply(self, values):
+            self.model.apply_edits(values)
 
-            # 실시간 CSV 업데이트
-            self.model.update_csv_immediately()
+            rows = [row for row, _, _ in values]
+            cols = [col for _, col, _ in values]
+            self.model.dataChanged.emit(self.model.index(min(rows), min(cols)),
+                                        self.model.index(max(rows), max(cols)), [Qt.EditRole])
+
+        def redo(self):
+            self._apply([(row, col, new_value) for row, col, _, new_value in self.changes])
+
+        def undo(self):
+            self._apply([(row, col, old_value) for row, col, old_value, _ in self.changes])
+
+    def apply_edits(self, values):
+        """
+        편집 값을 캐시(행 dirty 플래그)와 편집 저널에 기록 - DB 반영은 저널 flush 시 일괄 처리
+
+        Args:
+            values: [(row, col, value), ...]
+        """
+        for row, col, value in values:
+            if self.cache is not None:
+                self.cache.set_cell(row, col, value)
+            self.modified_cells.add((row, col))
+        if self.sheet_id is not None:
+            self.journal.record(self.sheet_id, values)
+
+    def flush_edits(self) -> int:
+        """대기 중인 편집을 DB에 반영 (시트 전환/행·열 구조 변경/코드 생성 전 호출)"""
+        return self.journal.flush()
+
+    def release(self):
+        """모델 교체 전 정리 - 편집 반영, 선읽기 스레드 종료, CSV 기록기 연결 해제"""
+        self.flush_edits()
+        if self.cache is not None:
+            self.cache.close()
+            self.cache = None
+        try:
+            CsvHistoryWriter.instance().written.disconnect(self._on_csv_history_written)
+        except (RuntimeError, TypeError):
+            pass
+
+    def _on_journal_flushed(self, count):
+        # DB에 반영되었으므로 dirty 행 블록 고정 해제
+        if self.cache is not None:
+            self.cache.clear_dirty()
+
+    def _invalidate_csv_history(self):
+        """행/열 번호가 바뀐 뒤 현재 시트의 증분 CSV 렌더링 캐시 폐기"""
+        db_file = getattr(self.db, 'db_file_path', None) or getattr(self.db, 'db_file', None)
+        if db_file and self.sheet_id is not None:
+            CsvHistoryWriter.instance().invalidate(db_file, self.sheet_id)
+
+    def _on_csv_history_written(self, csv_file):
+        """CSV 히스토리 기록 완료 (GUI 스레드) - Git 상태 표시 갱신"""
+        app = QApplication.instance()
+        if not app:
+            return
+        for widget in app.topLevelWidgets():
+            if hasattr(widget, 'git_manager') and hasattr(widget, 'update_git_status_display'):
+                widget.update_git_status_display()
+                break
+
+    def _reset_cache(self):
+        """현재 시트용 블록 캐시 새로 생성 (이전 캐시의 선읽기 스레드 종료)"""
+        if self.cache is not None:
+            self.cache.close()
+        self.cache = None
+        if self.sheet_id is None or self.db is None:
+            return
+
+        sheet_id = self.sheet_id
+        db = self.db
+        if hasattr(db, 'get_rows_data'):
+            loader = lambda start, count: db.get_rows_data(sheet_id, start, count)
+        else:
+            # 범위 조회가 없는 핸들러: 행 단위 조회로 블록 구성
+            loader = lambda start, count: {r: d for r in range(start, start + count)
+                                           for d in (db.get_row_data(sheet_id, r),) if d}
+
+        prefetch_loader_factory = None
+        db_file = getattr(db, 'db_file', None)
+        if db_file and hasattr(db, 'get_rows_data'):
+            def prefetch_loader_factory():
+                # 선읽기 스레드 전용 조회 연결 (WAL 모드이므로 GUI 연결의 쓰기와 동시에 읽기 가능)
+                prefetch_db = type(db)(db_file, lazy=True, read_only=True)
+                prefetch_loader = lambda start, count: prefetch_db.get_rows_data(sheet_id, start, count)
+                prefetch_loader.close = prefetch_db.disconnect
+                return prefetch_loader
+
+        self.cache = GridBlockCache(loader, prefetch_loader_factory=prefetch_loader_factory)
+
+    def set_cells_batch(self, cells, description="셀 일괄 편집"):
+        """
+        여러 셀 값을 한 번에 설정 (값이 같은 셀은 제외)
+
+        Args:
+            cells: [(row, col, value), ...]
+            description: 실행 취소 이름
+
+        Returns:
+            실제로 변경된 셀 개수
+        """
+        if self.sheet_id is None:
+            return 0
+
+        changes = []
+        for row, col, value in cells:
+            current_value = self.data(self.index(row, col), Qt.EditRole)
+            if str(value) != str(current_value or ""):
+                changes.append((row, col, current_value, value))
+
+        if changes:
+            self.undo_stack.push(self.BatchCellEditCommand(self, changes, description))
+        return len(changes)
 
     def load_sheet(self, sheet_id):
         """
@@ -175,6 +285,9 @@ class VirtualizedGridModel(QAbstractTableModel):
             logging.debug(f"Sheet {sheet_id} already loaded")
             return
 
+        # 이전 시트의 대기 중인 편집 반영
+        self.flush_edits()
+
         try:
             # 모델 변경 시작
             self.beginResetModel()
@@ -190,7 +303,8 @@ class VirtualizedGridModel(QAbstractTableModel):
             self.col_count = metadata["max_col"] + 1
 
             # 캐시 완전 초기화 (이전 데이터와 동기화 문제 방지)
-            self.cache = {}
+            self._reset_cache()
+            self._invalidate_csv_history()
             self.modified_cells.clear()
 
             # 실행 취소 스택도 초기화
@@ -204,7 +318,7 @@ class VirtualizedGridModel(QAbstractTableModel):
             self.sheet_id = sheet_id
             self.row_count = 100  # 기본값
             self.col_count = 50   # 기본값
-            self.cache = {}
+            self._reset_cache()
             self.modified_cells.clear()
             self.undo_stack.clear()
             raise  # 오류 재발생 (상위 호출자에게 알림)
@@ -237,14 +351,10 @@ class VirtualizedGridModel(QAbstractTableModel):
         row, col = index.row(), index.column()
 
         if role == Qt.DisplayRole or role == Qt.EditRole:
-            # 1. 수정된 데이터인지 확인 (캐시에 우선 반영됨)
-            cached_value = self.get_from_cache(row, col)
-            if cached_value is not None:
-                return cached_value
-
-            # 2. 캐시에 없으면 해당 행 전체를 DB에서 로드 (행 단위 캐싱)
-            self.load_row_data(row)
-            return self.get_from_cache(row, col) or "" # DB에도 없으면 빈 문자열
+            # 캐시(수정 내용 우선 반영)에서 조회 - 블록이 없으면 해당 행 블록을 범위 쿼리 한 번으로 로드
+            if self.cache is None:
+                return ""
+            return self.cache.get_cell(row, col) or ""  # DB에도 없으면 빈 문자열
 
         return None
 
@@ -257,47 +367,22 @@ class VirtualizedGridModel(QAbstractTableModel):
             col: 열 번호
 
         Returns:
-            캐시된 값 또는 None
+            캐시된 값 또는 None (DB 조회 없음)
         """
-        row_data = self.cache.get(row)
-        if row_data is not None:
-            return row_data.get(col)
-        return None
+        if self.cache is None:
+            return None
+        return self.cache.peek_cell(row, col)
 
     def load_row_data(self, row):
         """
-        행 단위로 데이터 로드 (DB 쿼리 최소화)
+        행이 속한 블록을 캐시에 로드 (블록 단위 범위 쿼리, LRU 제거는 GridBlockCache가 처리)
 
         Args:
             row: 로드할 행 번호
         """
-        # 이미 캐시에 있거나 유효하지 않은 sheet_id면 로드하지 않음
-        if row in self.cache or self.sheet_id is None:
+        if self.cache is None or self.sheet_id is None:
             return
-
-        # 캐시 크기 관리 (오래된 행 제거 - 수정되지 않은 행만)
-        if len(self.cache) >= self.cache_size:
-            rows_to_remove = []
-            # 현재 행에서 멀리 떨어진, 수정되지 않은 행 찾기
-            sorted_rows = sorted(self.cache.keys(), key=lambda r: abs(r - row))
-            removed_count = 0
-            for r in reversed(sorted_rows): # 가장 먼 행부터 확인
-                is_modified = any((r, c) in self.modified_cells for c in self.cache[r])
-                if not is_modified:
-                    rows_to_remove.append(r)
-                    removed_count += 1
-                    if removed_count >= 100: # 최대 100개 제거
-                        break
-
-            for r in rows_to_remove:
-                del self.cache[r]
-            if rows_to_remove:
-                logging.debug(f"Removed {len(rows_to_remove)} rows from cache.")
-
-        # DB에서 행 데이터 로드
-        logging.debug(f"Loading row {row} from DB for sheet {self.sheet_id}")
-        row_data = self.db.get_row_data(self.sheet_id, row)
-        self.cache[row] = row_data
+        self.cache.get_row(row)
 
     def setData(self, index, value, role=Qt.EditRole):
         if not index.isValid() or role != Qt.EditRole or self.sheet_id is None:
@@ -320,123 +405,24 @@ class VirtualizedGridModel(QAbstractTableModel):
         return Qt.ItemIsEnabled | Qt.ItemIsSelectable | Qt.ItemIsEditable
 
     def save_changes(self):
-        """수정된 셀만 DB에 저장 (배치 처리)"""
-        if not self.modified_cells or self.sheet_id is None:
+        """대기 중인 편집을 DB에 반영 (편집 저널 flush - 한 트랜잭션)"""
+        if (not self.journal and not self.modified_cells) or self.sheet_id is None:
             logging.info("No changes to save.")
             return
 
-        logging.info(f"Saving {len(self.modified_cells)} modified cells for sheet {self.sheet_id}")
-        cells_data = []
-        for row, col in self.modified_cells:
-            # 캐시에서 최신 값 가져오기
-            value = self.get_from_cache(row, col)
-            cells_data.append((row, col, value))
-
         try:
-            # 수정된 셀만 DB에 업데이트
-            self.db.update_cells(self.sheet_id, cells_data)
+            saved_count = self.journal.flush()
+            logging.info(f"Saving {saved_count} pending cells for sheet {self.sheet_id} "
+                         f"({len(self.modified_cells)} modified since last save)")
             self.modified_cells.clear()
+            if self.cache is not None:
+                self.cache.clear_dirty()
             logging.info("Changes saved successfully.")
         except Exception as e:
             logging.error(f"Error saving changes: {e}")
-            # 오류 발생 시 modified_cells를 유지하여 재시도 가능하게 할 수 있음
+            # 반영하지 못한 편집은 저널에 남아 있으므로 재시도 가능
             raise # 오류를 상위로 전파
 
-    def update_csv_immediately(self):
-        """셀 수정 시 즉시 CSV 업데이트 (간단하고 확실한 방법)"""
-        try:
-            # 현재 시트 정보 확인
-            if not self.sheet_id or not self.db:
-                logging.debug("시트 ID 또는 DB가 없어서 CSV 업데이트 스킵")
-                return
-
-            # 메인 윈도우 찾기
-            from PySide6.QtWidgets import QApplication
-            app = QApplication.instance()
-            if not app:
-                return
-
-            main_window = None
-            for widget in app.topLevelWidgets():
-                if hasattr(widget, 'git_manager'):
-                    main_window = widget
-                    break
-
-            if not main_window:
-                logging.debug("메인 윈도우를 찾을 수 없음")
-                return
-
-            # 현재 시트 정보 가져오기
-            try:
-                sheets = self.db.get_sheets()
-                current_sheet = None
-                for sheet in sheets:
-                    if sheet['id'] == self.sheet_id:
-                        current_sheet = sheet
-                        break
-
-                if not current_sheet:
-                    logging.debug(f"시트 ID {self.sheet_id}를 찾을 수 없음")
-                    return
-
-                # DB와 시트 이름
-                db_file_path = getattr(self.db, 'db_file_path', None) or getattr(self.db, 'db_file', None)
-                if not db_file_path:
-                    logging.debug("DB 파일 경로를 찾을 수 없음")
-                    return
-
-                db_name = Path(db_file_path).stem
-                sheet_name = current_sheet['name']
-
-                # CSV 파일 경로 (프로젝트 루트, .gitignore로 제외)
-                csv_dir = Path("history") / db_name
-                csv_dir.mkdir(parents=True, exist_ok=True)
-                # $ 기호 제거하여 파일명 안전하게 만들기
-                safe_sheet_name = sheet_name.replace('$', '')
-                csv_file = csv_dir / f"{safe_sheet_name}.csv"
-
-                # 시트 전체 데이터를 CSV로 저장
-                import csv
-                with open(csv_file, 'w', newline='', encoding='utf-8') as f:
-                    writer = csv.writer(f)
-
-                    # 시트 메타데이터
-                    metadata = self.db.get_sheet_metadata(self.sheet_id)
-                    max_row = metadata.get("max_row", 0)
-                    max_col = metadata.get("max_col", 0)
-
-                    # 모든 데이터 쓰기
-                    for row in range(max_row + 1):
-                        row_data = self.db.get_row_data(self.sheet_id, row)
-                        csv_row = []
-                        for col in range(max_col + 1):
-                            value = row_data.get(col, "")
-                            csv_row.append(str(value) if value is not None else "")
-                        writer.writerow(csv_row)
-
-                logging.info(f"✅ 실시간 CSV 업데이트: {csv_file}")
-
-                # DB 파일도 저장 (변경사항 반영) - 모델의 save_changes 호출
-                try:
-                    if hasattr(self, 'save_changes') and callable(self.save_changes):
-                        self.save_changes()
-                        logging.debug("DB 변경사항 저장 완료")
-                    else:
-                        logging.debug("save_changes 메서드가 없거나 호출 불가")
-                except Exception as save_error:
-                    logging.error(f"DB 저장 중 오류: {save_error}")
-
-                # Git 상태 즉시 업데이트
-                if hasattr(main_window, 'update_git_status_display'):
-                    main_window.update_git_status_display()
-
-            except Exception as sheet_error:
-                logging.error(f"시트 데이터 처리 중 오류: {sheet_error}")
-
-        except Exception as e:
-            logging.error(f"실시간 CSV 업데이트 실패: {e}")
-            # 오류가 발생해도 셀 편집은 계속 진행
-
     def headerData(self, section: int, orientation: Qt.Orientation, role: int = Qt.DisplayRole) -> Any:
         """행/열 헤더 데이터 반환"""
         if role != Qt.DisplayRole:
@@ -466,6 +452,9 @@ class VirtualizedGridModel(QAbstractTableModel):
             return False
 
         logging.debug(f"Model inserting {count} rows at {row}")
+        # 저널의 편집은 현재 좌표 기준이므로 행/열 이동 전에 반영
+        self.flush_edits()
+        self._invalidate_csv_history()
 
         try:
             # 뷰에 알림 시작 (삽입될 위치와 개수)
@@ -496,6 +485,9 @@ class VirtualizedGridModel(QAbstractTableModel):
             return False
 
         logging.debug(f"Model removing {count} rows at {row}")
+        # 저널의 편집은 현재 좌표 기준이므로 행/열 이동 전에 반영
+        self.flush_edits()
+        self._invalidate_csv_history()
         # 뷰에 알림 시작 (삭제될 위치와 개수)
         self.beginRemoveRows(parent, row, row + count - 1)
         try:
@@ -507,8 +499,8 @@ class VirtualizedGridModel(QAbstractTableModel):
             # 모델 내부 상태 업데이트
             self.row_count -= count
 
-            # 캐시 및 수정된 셀 업데이트 (전체 초기화)
-            self.cache = {}
+            # 캐시 및 수정된 셀 업데이트 (삭제 위치 블록부터 무효화)
+            self.cache.invalidate(row)
             self.modified_cells = set()
             logging.debug(f"Cache and modified cells cleared after row removal.")
 
@@ -529,6 +521,9 @@ class VirtualizedGridModel(QAbstractTableModel):
             return False
 
         logging.debug(f"Model inserting {count} columns at {column}")
+        # 저널의 편집은 현재 좌표 기준이므로 행/열 이동 전에 반영
+        self.flush_edits()
+        self._invalidate_csv_history()
 
         try:
             # 뷰에 알림 시작
@@ -560,6 +555,9 @@ class VirtualizedGridModel(QAbstractTableModel):
             return False
 
         logging.debug(f"Model removing {count} columns at {column}")
+        # 저널의 편집은 현재 좌표 기준이므로 행/열 이동 전에 반영
+        self.flush_edits()
+        self._invalidate_csv_history()
         # 뷰에 알림 시작
         self.beginRemoveColumns(parent, column, column + count - 1)
         try:
@@ -572,7 +570,7 @@ class VirtualizedGridModel(QAbstractTableModel):
             self.col_count -= count
 
             # 캐시 및 수정된 셀 업데이트 (전체 초기화)
-            self.cache = {}
+            self.cache.clear()
             self.modified_cells = set()
             logging.debug(f"Cache and modified cells cleared after column removal.")
 
@@ -590,17 +588,8 @@ class VirtualizedGridModel(QAbstractTableModel):
     def _update_cache_after_row_insertion(self, insert_row: int, count: int):
         """행 삽입 후 캐시 업데이트 - 데이터 손실 방지"""
         try:
-            # 삽입 위치 이후의 행들을 아래로 이동
-            new_cache = {}
-            for cached_row, row_data in self.cache.items():
-                if cached_row >= insert_row:
-                    # 삽입 위치 이후의 행들은 count만큼 아래로 이동
-                    new_cache[cached_row + count] = row_data
-                else:
-                    # 삽입 위치 이전의 행들은 그대로 유지
-                    new_cache[cached_row] = row_data
-
-            self.cache = new_cache
+            # 삽입 위치 블록부터 무효화 (행 번호가 바뀐 블록은 DB에서 다시 로드, 이전 블록은 유지)
+            self.cache.invalidate(insert_row)
 
             # 수정된 셀 정보도 업데이트
             new_modified_cells = set()
@@ -616,23 +605,14 @@ class VirtualizedGridModel(QAbstractTableModel):
         except Exception as e:
             logging.error(f"캐시 업데이트 중 오류: {e}")
             # 오류 발생 시에만 전체 초기화
-            self.cache = {}
+            self.cache.clear()
             self.modified_cells = set()
 
     def _update_cache_after_column_insertion(self, insert_col: int, count: int):
         """열 삽입 후 캐시 업데이트 - 데이터 손실 방지"""
         try:
-            # 각 행의 열 데이터를 업데이트
-            for row, row_data in self.cache.items():
-                new_row_data = {}
-                for col, value in row_data.items():
-                    if col >= insert_col:
-                        # 삽입 위치 이후의 열들은 count만큼 오른쪽으로 이동
-                        new_row_data[col + count] = value
-                    else:
-                        # 삽입 위치 이전의 열들은 그대로 유지
-                        new_row_data[col] = value
-                self.cache[row] = new_row_data
+            # 캐시된 각 행의 삽입 위치 이후 열들을 count만큼 오른쪽으로 이동
+            self.cache.shift_columns(insert_col, count)
 
             # 수정된 셀 정보도 업데이트
             new_modified_cells = set()
@@ -648,7 +628,7 @@ class VirtualizedGridModel(QAbstractTableModel):
         except Exception as e:
             logging.error(f"캐시 업데이트 중 오류: {e}")
             # 오류 발생 시에만 전체 초기화
-            self.cache = {}
+            self.cache.clear()
             self.modified_cells = set()
 class ExcelGridView(QTableView):
     """가상화된 Excel 스타일 그리드 뷰"""
@@ -880,6 +860,12 @@ class ExcelGridView(QTableView):
         Args:
             db_handler: DB 핸들러 객체
         """
+        if self.model:
+            # 이전 모델의 대기 중인 편집 반영 후 정리
+            try:
+                self.model.release()
+            except Exception as e:
+                logging.error(f"이전 모델 정리 중 오류: {e}")
         self.db = db_handler
         self.model = VirtualizedGridModel(self.db)
         self.setModel(self.model)
@@ -1530,38 +1516,24 @@ class ExcelGridView(QTableView):
 
         logging.info(f"Pasting {rows_to_paste}x{cols_to_paste} cells starting at ({start_row}, {start_col})")
 
-        changed_indexes = []
-
         try:
+            cells = []
             for r_offset in range(rows_to_paste):
                 target_row = start_row + r_offset
                 # 모델의 행 범위를 벗어나면 중단
                 if target_row >= self.model.rowCount():
                     break
 
-                for c_offset in range(cols_to_paste):
+                for c_offset in range(min(cols_to_paste, len(copied_data[r_offset]))):
                     target_col = start_col + c_offset
                     # 모델의 열 범위를 벗어나면 다음 행으로
                     if target_col >= self.model.columnCount():
                         break
+                    cells.append((target_row, target_col, copied_data[r_offset][c_offset]))
 
-                    value_to_paste = copied_data[r_offset][c_offset]
-                    target_index = self.model.index(target_row, target_col)
-                    if target_index.isValid():
-                        # setData 호출 (내부적으로 dataChanged 시그널 발생)
-                        if self.model.setData(target_index, value_to_paste):
-                            changed_indexes.append(target_index)
-
-            # 변경된 영역에 대한 dataChanged 시그널을 명시적으로 보내는 것이 더 좋음
-            if changed_indexes:
-                min_row = min(idx.row() for idx in changed_indexes)
-                max_row = max(idx.row() for idx in changed_indexes)
-                min_col = min(idx.column() for idx in changed_indexes)
-                max_col = max(idx.column() for idx in changed_indexes)
-                top_left = self.model.index(min_row, min_col)
-                bottom_right = self.model.index(max_row, max_col)
-                self.model.dataChanged.emit(top_left, bottom_right, [Qt.EditRole])
-                logging.info(f"Paste completed. Emitted dataChanged for range ({min_row},{min_col}) to ({max_row},{max_col})")
+            # 한 번의 실행 취소 명령으로 적용 (DB 일괄 반영 + dataChanged 1회)
+            changed_count = self.model.set_cells_batch(cells, "붙여넣기")
+            logging.info(f"Paste completed. {changed_count} cells changed")
 
         except Exception as e:
             logging.error(f"Error during paste operation: {e}")
@@ -1575,22 +1547,10 @@ class ExcelGridView(QTableView):
 
         logging.info(f"Clearing contents of {len(selected_indexes)} selected cells.")
 
-        changed_indexes = []
         try:
-            for index in selected_indexes:
-                if self.model.setData(index, ""): # 빈 문자열로 설정
-                     changed_indexes.append(index)
-
-            # 변경된 영역에 대한 dataChanged 시그널
-            if changed_indexes:
-                 min_row = min(idx.row() for idx in changed_indexes)
-                 max_row = max(idx.row() for idx in changed_indexes)
-                 min_col = min(idx.column() for idx in changed_indexes)
-                 max_col = max(idx.column() for idx in changed_indexes)
-                 top_left = self.model.index(min_row, min_col)
-                 bottom_right = self.model.index(max_row, max_col)
-                 self.model.dataChanged.emit(top_left, bottom_right, [Qt.EditRole])
-                 logging.info(f"Clear contents completed. Emitted dataChanged.")
+            cells = [(index.row(), index.column(), "") for index in selected_indexes]
+            changed_count = self.model.set_cells_batch(cells, "내용 지우기")
+            logging.info(f"Clear contents completed. {changed_count} cells cleared")
 
         except Exception as e:
             logging.error(f"Error clearing cell contents: {e}")
@@ -1602,7 +1562,7 @@ class ExcelGridView(QTableView):
             self.model.sheet_id = None
             self.model.row_count = 0
             self.model.col_count = 0
-            self.model.cache = {}
+            self.model._reset_cache()  # sheet_id가 None이므로 캐시 해제 + 선읽기 스레드 종료
             self.model.modified_cells = set()
             self.model.endResetModel()
             logging.info("Grid view cleared.")
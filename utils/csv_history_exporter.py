@@ -0,0 +1,241 @@
+"""
+증분 스트리밍 CSV 히스토리 내보내기 (Git 추적용)
+
+history/<DB명>/<시트명>.csv 를 시트 전체 2차원 배열 없이 (row, col) 정렬 커서에서 바로 파일로 씁니다.
+
+- 1차 스캔: 내용 해시 + 크기(마지막 행/열) 계산 → 이전 내보내기와 해시가 같고 파일이 그대로면 생략
+- 2차 스캔: 행 단위로 CSV 작성 (빈 행은 미리 렌더링한 문자열 재사용)
+- 임시 파일에 쓴 뒤 os.replace로 교체 (중간에 실패/취소해도 기존 CSV 유지)
+- 출력 형식은 기존 get_sheet_data + csv.writer.writerows와 동일 (빈 셀 패딩 포함)
+- 내보내기 상태(시트 해시, 파일 크기/수정 시각)는 history 밖 사용자 캐시 디렉토리에 보관 (Git 커밋 대상 아님)
+"""
+
+import io
+import os
+import csv
+import json
+import hashlib
+import logging
+import threading
+from pathlib import Path
+from typing import Callable, Dict, List, Optional, Tuple
+
+# 계측 (비활성화 시 no-op)
+from core.tracing import tracer
+
+MANIFEST_FILE_NAME = "csv_history_manifest.json"
+
+# 커서에서 한 번에 가져오는 셀 수
+_FETCH_CELLS = 10000
+
+
+def default_manifest_path() -> str:
+    """내보내기 상태 파일 경로 (시트 IR 캐시와 같은 사용자 캐시 디렉토리)"""
+    from code_generator.sheet_ir_cache import default_cache_dir
+    return os.path.join(default_cache_dir(), MANIFEST_FILE_NAME)
+
+
+def safe_sheet_file_name(sheet_name: str) -> str:
+    """$ 기호 제거 (파일명에 사용하기 위해)"""
+    return sheet_name.replace('$', '')
+
+
+def _render_csv_line(cells: List[str]) -> str:
+    buffer = io.StringIO()
+    csv.writer(buffer).writerow(cells)
+    return buffer.getvalue()
+
+
+def _iter_sheet_cells(db_handler, sheet_id: int):
+    """(row, col, value) 정렬 스트림 - 논리 순서가 있는 시트는 화면 좌표로 변환한 목록"""
+    visual_cells = db_handler.visual_cells(sheet_id)
+    if visual_cells is not None:
+        yield from visual_cells
+        return
+
+    cursor = db_handler.conn.cursor()
+    cursor.row_factory = None
+    cursor.execute("""
+        SELECT row, col, value FROM cells
+        WHERE sheet_id = ? AND value IS NOT NULL AND value != ''
+        ORDER BY row, col
+    """, (sheet_id,))
+    while True:
+        batch = cursor.fetchmany(_FETCH_CELLS)
+        if not batch:
+            break
+        yield from batch
+
+
+def scan_sheet(db_handler, sheet_id: int) -> Tuple[str, int, int]:
+    """
+    시트 내용 해시와 크기 계산 (get_sheet_content_hash와 같은 해시)
+
+    Returns:
+        (해시, 행 수, 열 수) - 크기는 get_sheet_data의 2차원 배열 크기와 같음
+    """
+    hasher = hashlib.sha1()
+    max_row = max_col = -1
+    batch = []
+    for cell in _iter_sheet_cells(db_handler, sheet_id):
+        batch.append(cell)
+        if cell[0] > max_row:
+            max_row = cell[0]
+        if cell[1] > max_col:
+            max_col = cell[1]
+        if len(batch) >= _FETCH_CELLS:
+            hasher.update("".join(f"{c[0]}\x1f{c[1]}\x1f{c[2]}\x1e" for c in batch).encode('utf-8'))
+            batch = []
+    if batch:
+        hasher.update("".join(f"{c[0]}\x1f{c[1]}\x1f{c[2]}\x1e" for c in batch).encode('utf-8'))
+    return hasher.hexdigest(), max_row + 1, max_col + 1
+
+
+def write_sheet_csv(db_handler, sheet_id: int, csv_file: Path, row_count: int, col_count: int) -> int:
+    """
+    시트를 CSV로 스트리밍 저장 (임시 파일 작성 후 원자적 교체) - 작성한 행 수 반환
+    """
+    temp_file = csv_file.with_name(csv_file.name + ".tmp")
+    try:
+        with open(temp_file, 'w', newline='', encoding='utf-8') as f:
+            if row_count and col_count:
+                writer = csv.writer(f)
+                empty_line = _render_csv_line([""] * col_count)
+                current_row = -1
+                cells: List[str] = []
+                for row, col, value in _iter_sheet_cells(db_handler, sheet_id):
+                    if row != current_row:
+                        if current_row >= 0:
+                            writer.writerow(cells)
+                        if row - current_row > 1:
+                            f.write(empty_line * (row - current_row - 1))
+                        cells = [""] * col_count
+                        current_row = row
+                    cells[col] = value
+                if current_row >= 0:
+                    writer.writerow(cells)
+        os.replace(temp_file, csv_file)
+    except BaseException:
+        try:
+            os.remove(temp_file)
+        except OSError:
+            pass
+        raise
+    return row_count
+
+
+class CsvHistoryExporter:
+    """
+    열린 DB들의 시트를 history 디렉토리에 CSV로 내보내기 (변경된 시트만)
+
+    사용 예:
+        exporter = CsvHistoryExporter(Path("history"))
+        summary = exporter.export(db_handlers, progress_callback=on_progress, cancel_event=event)
+    """
+
+    def __init__(self, history_root: Path, manifest_path: Optional[str] = None):
+        self.history_root = Path(history_root)
+        self.manifest_path = manifest_path or default_manifest_path()
+        self.manifest: Dict[str, Dict] = self._load_manifest()
+
+    def _load_manifest(self) -> Dict[str, Dict]:
+        try:
+            with open(self.manifest_path, 'r', encoding='utf-8') as f:
+                manifest = json.load(f)
+            return manifest if isinstance(manifest, dict) else {}
+        except (OSError, ValueError):
+            return {}
+
+    def _save_manifest(self):
+        try:
+            os.makedirs(os.path.dirname(self.manifest_path), exist_ok=True)
+            temp_file = self.manifest_path + ".tmp"
+            with open(temp_file, 'w', encoding='utf-8') as f:
+                json.dump(self.manifest, f, ensure_ascii=False)
+            os.replace(temp_file, self.manifest_path)
+        except OSError as e:
+            logging.warning(f"⚠ CSV 내보내기 상태 저장 실패 ({self.manifest_path}): {e}")
+
+    def _is_unchanged(self, csv_file: Path, sheet_hash: str) -> bool:
+        """이전 내보내기와 해시가 같고 CSV 파일이 그 뒤로 바뀌지 않았는지"""
+        entry = self.manifest.get(str(csv_file.resolve()))
+        if not entry or entry.get('hash') != sheet_hash:
+            return False
+        try:
+            stat = csv_file.stat()
+        except OSError:
+            return False
+        return entry.get('size') == stat.st_size and entry.get('mtime_ns') == stat.st_mtime_ns
+
+    def _remember(self, csv_file: Path, sheet_hash: str):
+        stat = csv_file.stat()
+        self.manifest[str(csv_file.resolve())] = {'hash': sheet_hash, 'size': stat.st_size, 'mtime_ns': stat.st_mtime_ns}
+
+    def export_sheet(self, db_handler, sheet: Dict, history_dir: Path, force: bool = False) -> bool:
+        """
+        시트 하나 내보내기 - 파일을 다시 썼으면 True, 변경 없어 생략했으면 False
+        """
+        csv_file = history_dir / f"{safe_sheet_file_name(sheet['name'])}.csv"
+        sheet_hash, row_count, col_count = scan_sheet(db_handler, sheet['id'])
+        if not force and self._is_unchanged(csv_file, sheet_hash):
+            logging.debug(f"CSV 변경 없음 - 생략: {csv_file}")
+            return False
+
+        with tracer.span("csv.write_sheet", "csv", sheet=sheet['name'], rows=row_count):
+            write_sheet_csv(db_handler, sheet['id'], csv_file, row_count, col_count)
+        self._remember(csv_file, sheet_hash)
+        logging.info(f"CSV 내보내기 완료: {csv_file} ({row_count}x{col_count})")
+        return True
+
+    def export(self, db_handlers: List, progress_callback: Optional[Callable[[int, int, str], None]] = None,
+               cancel_event: Optional[threading.Event] = None, force: bool = False) -> Dict:
+        """
+        모든 DB의 시트 내보내기
+
+        Args:
+            db_handlers: DBHandlerV2 목록 (호출 스레드에서 사용 가능한 연결)
+            progress_callback: (완료 시트 수, 전체 시트 수, 현재 시트 라벨) - 시트마다 호출
+            cancel_event: 설정되면 다음 시트부터 중단
+            force: 해시가 같아도 다시 쓰기
+
+        Returns:
+            {'written', 'skipped', 'failed': [라벨], 'cancelled', 'total'}
+        """
+        targets = []
+        for db_handler in db_handlers:
+            if not db_handler or not getattr(db_handler, 'db_file', None):
+                continue
+            db_name = Path(db_handler.db_file).stem
+            for sheet in db_handler.get_sheets():
+                targets.append((db_handler, db_name, sheet))
+
+        summary = {'written': 0, 'skipped': 0, 'failed': [], 'cancelled': False, 'total': len(targets)}
+        try:
+            for index, (db_handler, db_name, sheet) in enumerate(targets):
+                if cancel_event is not None and cancel_event.is_set():
+                    summary['cancelled'] = True
+                    logging.info(f"CSV 히스토리 내보내기 취소 ({index}/{len(targets)})")
+                    break
+
+                label = f"{db_name} / {sheet['name']}"
+                if progress_callback:
+                    progress_callback(index, len(targets), label)
+
+                history_dir = self.history_root / db_name
+                try:
+                    history_dir.mkdir(parents=True, exist_ok=True)
+                    if self.export_sheet(db_handler, sheet, history_dir, force):
+                        summary['written'] += 1
+                    else:
+                        summary['skipped'] += 1
+                except Exception as e:
+                    logging.error(f"CSV 내보내기 실패 ({label}): {e}")
+                    summary['failed'].append(label)
+        finally:
+            self._save_manifest()
+
+        if progress_callback and not summary['cancelled']:
+            progress_callback(len(targets), len(targets), "")
+        logging.info(f"총 {summary['written']}개 시트 CSV 내보내기 완료 "
+                     f"(변경 없음 {summary['skipped']}개, 실패 {len(summary['failed'])}개)")
+        return summary
@@ -6,15 +6,18 @@ Git 연동 및 DB 히스토리 관리 시스템
 """
 
 import os
-import csv
 import logging
 import subprocess
 import shutil
 import re
 from datetime import datetime
-from typing import Dict, List
+from typing import Dict, List, Optional
 from pathlib import Path
 
+# 계측 (비활성화 시 no-op)
+from core.tracing import tracer, traced
+from utils.git_status_service import GitStatusService
+
 
 class GitManager:
     """Git 연동 관리 클래스"""
@@ -30,6 +33,10 @@ class GitManager:
         # Git 실행 파일 경로 찾기
         self.git_executable = self._find_git_executable()
 
+        # 브랜치/상태 캐시 (CSV 히스토리 디렉토리 변경도 상태 재조회 조건)
+        self.status_service = GitStatusService(self.git_executable, self.project_root, watch_paths=[self.history_dir])
+        self._encoding_cleaned = False
+
         # history 디렉토리만 미리 생성 (CSV 히스토리용)
         # backup 디렉토리는 실제 백업 시에만 생성
         self.history_dir.mkdir(exist_ok=True)
@@ -130,69 +137,12 @@ class GitManager:
             return 'main'
 
     def get_all_branches(self) -> Dict[str, List[str]]:
-        """모든 브랜치 목록 가져오기 (로컬 + 원격)"""
+        """모든 브랜치 목록 가져오기 (로컬 + 원격, refs가 바뀌지 않았으면 캐시 사용)"""
         try:
-            branches = {
-                'local': [],
-                'remote': [],
-                'current': ''
-            }
-
-            # 현재 브랜치 확인
-            try:
-                result = subprocess.run([self.git_executable, 'branch', '--show-current'],
-                                      cwd=self.project_root,
-                                      capture_output=True, text=True, check=True)
-                branches['current'] = result.stdout.strip()
-            except:
-                branches['current'] = 'main'
-
-            # 로컬 브랜치 목록
-            try:
-                result = subprocess.run([self.git_executable, 'branch'],
-                                      cwd=self.project_root,
-                                      capture_output=True, text=True, check=True)
-                for line in result.stdout.strip().split('\n'):
-                    branch = line.strip().replace('*', '').strip()
-                    if branch and branch not in branches['local']:
-                        branches['local'].append(branch)
-            except:
-                pass
-
-            # 원격 브랜치 목록
-            try:
-                result = subprocess.run([self.git_executable, 'branch', '-r'],
-                                      cwd=self.project_root,
-                                      capture_output=True, text=True, check=True)
-                for line in result.stdout.strip().split('\n'):
-                    branch = line.strip()
-                    if not branch:
-                        continue
-
-                    # HEAD -> 같은 특별한 참조 제거
-                    if 'HEAD ->' in branch:
-                        continue
-
-                    # 원격 저장소 이름과 브랜치 이름 분리
-                    if '/' in branch:
-                        parts = branch.split('/', 1)
-                        if len(parts) == 2:
-                            remote_name = parts[0]
-                            remote_branch = parts[1]
-
-                            # 빈 문자열이나 특별한 참조 제거
-                            if remote_branch and remote_branch not in branches['remote']:
-                                # 원격 저장소 이름과 함께 표시
-                                display_name = f"{remote_branch} ({remote_name})"
-                                branches['remote'].append({
-                                    'name': remote_branch,
-                                    'remote': remote_name,
-                                    'display': display_name,
-                                    'full_name': branch
-                                })
-            except:
-                pass
-
+            if not self.status_service.available:
+                raise RuntimeError("Git 저장소 없음")
+            branches = self.status_service.branches()
+            branches['current'] = branches['current'] or 'main'
             return branches
 
         except Exception as e:
@@ -496,25 +446,19 @@ class GitManager:
 
     def export_sheet_to_csv(self, db_handler, sheet_id: int, sheet_name: str,
                            history_dir: Path) -> bool:
-        """시트 데이터를 CSV로 내보내기"""
+        """시트 데이터를 CSV로 내보내기 (정렬 커서에서 스트리밍, 원자적 교체)"""
         try:
+            from utils.csv_history_exporter import scan_sheet, write_sheet_csv
+
             # CSV 파일 경로
             csv_file = history_dir / f"{sheet_name}.csv"
 
-            # 시트 데이터 가져오기
-            sheet_data = db_handler.get_sheet_data(sheet_id)
-
-            if not sheet_data:
+            _, row_count, col_count = scan_sheet(db_handler, sheet_id)
+            if not row_count:
                 logging.warning(f"시트 {sheet_name} 데이터가 비어있음")
-                # 빈 CSV 파일 생성
-                with open(csv_file, 'w', newline='', encoding='utf-8') as f:
-                    pass
-                return True
 
-            # CSV 파일로 저장
-            with open(csv_file, 'w', newline='', encoding='utf-8') as f:
-                writer = csv.writer(f)
-                writer.writerows(sheet_data)
+            with tracer.span("csv.write_sheet", "csv", sheet=sheet_name, rows=row_count):
+                write_sheet_csv(db_handler, sheet_id, csv_file, row_count, col_count)
 
             logging.info(f"CSV 내보내기 완료: {csv_file}")
             return True
@@ -523,36 +467,21 @@ class GitManager:
             logging.error(f"CSV 내보내기 실패 ({sheet_name}): {e}")
             return False
 
-    def export_all_db_history(self, db_handlers: List):
-        """모든 DB의 히스토리를 CSV로 내보내기"""
-        try:
-            export_count = 0
-
-            for db_handler in db_handlers:
-                if not db_handler or not hasattr(db_handler, 'db_file'):
-                    continue
-
-                # DB 파일명에서 히스토리 디렉토리명 생성 (상위 디렉토리에)
-                db_name = Path(db_handler.db_file).stem
-                history_dir = self.history_dir / db_name
-                history_dir.mkdir(exist_ok=True)
-
-                # 모든 시트 내보내기 (V2 방식)
-                sheets = db_handler.get_sheets()  # V2에서는 파일 ID 없이 모든 시트 조회
-                for sheet in sheets:
-                    sheet_id = sheet['id']
-                    sheet_name = sheet['name']
-
-                    # $ 기호 제거 (파일명에 사용하기 위해)
-                    safe_sheet_name = sheet_name.replace('$', '')
+    @traced("csv.export_all_db_history", "csv")
+    def export_all_db_history(self, db_handlers: List, progress_callback=None, cancel_event=None) -> bool:
+        """
+        모든 DB의 히스토리를 CSV로 내보내기 (이전 내보내기 이후 내용이 바뀐 시트만)
 
-                    if self.export_sheet_to_csv(db_handler, sheet_id, safe_sheet_name, history_dir):
-                        export_count += 1
+        Args:
+            db_handlers: DBHandlerV2 목록 (호출 스레드에서 사용할 연결)
+            progress_callback: (완료 시트 수, 전체 시트 수, 현재 시트 라벨)
+            cancel_event: threading.Event - 설정되면 다음 시트부터 중단
+        """
+        try:
+            from utils.csv_history_exporter import CsvHistoryExporter
 
-                logging.info(f"DB {db_name} 히스토리 내보내기 완료")
-
-            logging.info(f"총 {export_count}개 시트 CSV 내보내기 완료")
-            return True
+            summary = CsvHistoryExporter(self.history_dir).export(db_handlers, progress_callback, cancel_event)
+            return not summary['failed'] and not summary['cancelled']
 
         except Exception as e:
             logging.error(f"DB 히스토리 내보내기 중 오류: {e}")
@@ -597,6 +526,9 @@ class GitManager:
 
     def get_git_root(self) -> str:
         """Git 저장소 루트 디렉토리 찾기"""
+        if self.status_service.available:
+            return str(self.status_service.root).replace('\\', '/')
+
         try:
             # 현재 디렉토리에서 시작해서 Git 루트 찾기
             current_dir = os.getcwd()
@@ -629,7 +561,10 @@ class GitManager:
             return current_dir
 
     def get_current_branch(self) -> str:
-        """현재 브랜치 가져오기"""
+        """현재 브랜치 가져오기 (.git/HEAD 직접 읽기, 저장소를 찾지 못한 경우에만 git 실행)"""
+        if self.status_service.available:
+            return self.status_service.current_branch() or "detached HEAD"
+
         try:
             git_root = self.get_git_root()
 
@@ -676,169 +611,57 @@ class GitManager:
             logging.warning(f"Git 상태 확인 실패: {e}")
             return "Git 상태 확인 실패"
 
-    def get_changed_files(self, use_enhanced_encoding: bool = True) -> List[Dict[str, str]]:
-        """변경된 파일 목록 가져오기 (인코딩 문제 해결 포함)"""
-        try:
-            # Git 저장소 루트 디렉토리 사용
-            git_root = self.get_git_root()
-
-            # Git 저장소 정리 시도 (인코딩 문제 해결)
-            self._cleanup_git_encoding_issues(git_root)
-
-            # 인코딩 문제 해결을 위한 환경변수 설정 (Windows 호환)
-            env = os.environ.copy()
-            if use_enhanced_encoding:
-                env['PYTHONIOENCODING'] = 'utf-8'
-                # Windows에서 LC_ALL 설정 문제 해결
-                if os.name == 'nt':  # Windows
-                    env['LANG'] = 'en_US.UTF-8'
-                else:
-                    env['LC_ALL'] = 'C.UTF-8'
-
-            # Git 설정으로 인코딩 문제 해결 시도
-            try:
-                # 핵심 Git 인코딩 설정
-                git_configs = [
-                    [self.git_executable, 'config', 'core.quotepath', 'false'],  # 경로 인용 비활성화
-                    [self.git_executable, 'config', 'core.precomposeunicode', 'true'],  # 유니코드 정규화
-                    [self.git_executable, 'config', 'i18n.filesEncoding', 'utf-8'],  # 파일 인코딩
-                    [self.git_executable, 'config', 'i18n.logOutputEncoding', 'utf-8'],  # 로그 출력 인코딩
-                ]
-
-                for config_cmd in git_configs:
-                    try:
-                        result = subprocess.run(config_cmd, cwd=git_root,
-                                              capture_output=True, timeout=5)
-                        if result.returncode == 0:
-                            logging.debug(f"Git 설정 성공: {' '.join(config_cmd[2:])}")
-                    except:
-                        continue
-
-            except:
-                pass  # 설정 실패해도 계속 진행
-
-            # Git status 명령어 실행 (인코딩 안전 모드)
-            try:
-                # 첫 번째 시도: UTF-8 인코딩
-                result = subprocess.run(
-                    [self.git_executable, 'status', '--porcelain', '--untracked-files=all'],
-                    cwd=git_root,
-                    capture_output=True,
-                    text=True,
-                    encoding='utf-8',
-                    errors='replace',
-                    env=env,
-                    timeout=30
-                )
-
-                if result.returncode != 0:
-                    raise subprocess.CalledProcessError(result.returncode, ['git', 'status'])
-
-            except (subprocess.CalledProcessError, UnicodeDecodeError) as e:
-                logging.warning(f"UTF-8 모드 Git status 실패: {e}")
-
-                # 두 번째 시도: 바이너리 모드로 실행 후 안전 디코딩
-                try:
-                    result_binary = subprocess.run(
-                        [self.git_executable, 'status', '--porcelain', '--untracked-files=all'],
-                        cwd=git_root,
-                        capture_output=True,
-                        env=env,
-                        timeout=30
-                    )
-
-                    if result_binary.returncode != 0:
-                        raise subprocess.CalledProcessError(result_binary.returncode, ['git', 'status'])
-
-                    # 안전한 디코딩
-                    try:
-                        stdout_text = result_binary.stdout.decode('utf-8', errors='replace')
-                    except:
-                        try:
-                            stdout_text = result_binary.stdout.decode('cp949', errors='replace')
-                        except:
-                            stdout_text = result_binary.stdout.decode('latin1', errors='replace')
+    def get_ahead_behind(self, cached_only: bool = False) -> Dict[str, int]:
+        """
+        upstream 대비 ahead/behind 커밋 수 (상태 캐시 사용)
 
-                    # 결과 객체 생성
-                    class SafeResult:
-                        def __init__(self, stdout, returncode):
-                            self.stdout = stdout
-                            self.returncode = returncode
+        cached_only: 캐시된 결과만 사용 (주기적 표시 갱신용, git 실행 없음 - 캐시가 없으면 0)
+        """
+        snapshot = self.status_service.cached_status() if cached_only else self.status_service.status()
+        if snapshot is None:
+            return {'ahead': 0, 'behind': 0, 'upstream': ''}
+        return {'ahead': snapshot.ahead, 'behind': snapshot.behind, 'upstream': snapshot.upstream}
 
-                    result = SafeResult(stdout_text, result_binary.returncode)
+    def get_changed_files(self, use_enhanced_encoding: bool = True, force_refresh: bool = False) -> List[Dict[str, str]]:
+        """
+        변경된 파일 목록 가져오기 (인코딩 문제 해결 포함)
 
-                except Exception as binary_error:
-                    logging.error(f"바이너리 모드도 실패: {binary_error}")
-                    # 빈 결과 반환
-                    class EmptyResult:
-                        def __init__(self):
-                            self.stdout = ""
-                            self.returncode = 0
+        git status --porcelain=v2 -z 결과를 GitStatusService에서 캐시하여 사용합니다.
+        force_refresh: 캐시 서명과 무관하게 다시 조회 (DB 닫기 직후 등)
+        """
+        try:
+            # Git 저장소 루트 디렉토리 사용
+            git_root = self.get_git_root()
 
-                    result = EmptyResult()
+            # Git 저장소 정리 (인코딩 설정) - 세션당 한 번
+            if use_enhanced_encoding and not self._encoding_cleaned:
+                self._cleanup_git_encoding_issues(git_root)
+                self._encoding_cleaned = True
+                force_refresh = True
 
-            # 디버깅을 위한 원본 출력 로그
-            stdout_preview = result.stdout[:200] if result.stdout else "(빈 출력)"
-            logging.info(f"Git status 원본 출력 (처음 200자): {repr(stdout_preview)}")
+            snapshot = self.status_service.status(force=force_refresh)
+            if not snapshot.ok:
+                logging.warning(f"Git status 조회 실패: {snapshot.error}")
+                return []
 
             changed_files = []
-            if not result.stdout.strip():
+            if not snapshot.entries:
                 logging.info("Git status 출력이 비어있음 - 변경된 파일 없음")
                 return []
 
-            lines = result.stdout.strip().split('\n')
-            logging.info(f"Git status 파싱: {len(lines)}개 라인")
-
-            for line_num, line in enumerate(lines, 1):
-                if not line.strip():
-                    continue
-
-                # Git status 형식: XY filename
-                # 더 견고한 파싱을 위해 다양한 경우 처리
-                if len(line) < 3:
-                    logging.warning(f"라인 {line_num}: 너무 짧은 Git status 라인: '{line}'")
-                    continue
-
-                status = line[:2]
-
-                # 파일명 추출 - 정규표현식 사용으로 더 견고하게
-                filename = None
+            logging.info(f"Git status 파싱: {len(snapshot.entries)}개 항목")
 
-                # Git status 형식: XY filename (X, Y는 상태 문자, 그 다음 공백 또는 탭, 그 다음 파일명)
-                # 정규표현식 패턴: 처음 2문자(상태) + 공백/탭 + 나머지(파일명)
-                match = re.match(r'^(.{2})[\s\t](.+)$', line)
-                if match:
-                    status = match.group(1)
-                    filename = match.group(2)
-                else:
-                    # 정규표현식이 실패한 경우 기존 방법 사용
-                    # 방법 1: 정상적인 경우 (상태 코드 + 공백 + 파일명)
-                    if len(line) > 2 and line[2] == ' ':
-                        filename = line[3:]
-                    # 방법 2: 공백이 없는 경우 (상태 코드 + 파일명)
-                    elif len(line) > 2:
-                        filename = line[2:]
-                    # 방법 3: 탭으로 구분된 경우
-                    elif '\t' in line:
-                        parts = line.split('\t', 1)
-                        if len(parts) >= 2:
-                            status = parts[0][:2] if len(parts[0]) >= 2 else parts[0]
-                            filename = parts[1]
-
-                # 파일명이 추출되지 않은 경우
-                if not filename:
-                    logging.warning(f"라인 {line_num}: 파일명 추출 실패: '{line}'")
-                    continue
+            for line_num, entry in enumerate(snapshot.entries, 1):
+                status = entry['status']
+                filename = entry['filename']
 
                 # 빈 파일명 체크
                 if not filename.strip():
-                    logging.warning(f"라인 {line_num}: 빈 파일명: '{line}'")
+                    logging.warning(f"항목 {line_num}: 빈 파일명 (상태 '{status}')")
                     continue
 
-                # 손상된 파일명 검사 제거 - 모든 파일명 허용
-
                 # 디버깅을 위한 상세 로그
-                logging.debug(f"라인 {line_num}: 원본='{line}', 상태='{status}', 파일명='{filename}'")
+                logging.debug(f"항목 {line_num}: 상태='{status}', 파일명='{filename}'")
 
                 # 인코딩 문제가 있는 파일명 감지
                 if '/3' in filename and len(filename) > 50:
@@ -1389,6 +1212,35 @@ class GitManager:
             logging.error(f"파일 diff 가져오기 실패 ({filename}): {e}")
             return f"diff 가져오기 실패: {str(e)}"
 
+    def get_head_blob(self, path_in_repo: str) -> Optional[bytes]:
+        """HEAD 커밋의 파일 내용 (HEAD에 없는 파일이면 None)"""
+        result = subprocess.run([self.git_executable, 'cat-file', 'blob', f"HEAD:{path_in_repo}"],
+                                cwd=self.get_git_root(), capture_output=True, timeout=60)
+        if result.returncode != 0:
+            logging.debug(f"HEAD에 없는 파일: {path_in_repo}")
+            return None
+        return result.stdout
+
+    def get_db_diff(self, filename: str):
+        """
+        .db 파일의 셀 단위 비교 (HEAD vs 작업 사본) - data_manager.db_diff.DbDiff 반환
+
+        Args:
+            filename: get_changed_files()의 파일명 (저장소 루트 기준 경로)
+        """
+        from data_manager.db_diff import diff_db_file
+
+        path_in_repo = filename.replace('\\', '/').strip('"\'')
+        working_file = Path(self.get_git_root()) / path_in_repo
+        if not working_file.exists():
+            candidate = Path.cwd() / self._normalize_git_path(path_in_repo, Path.cwd())
+            if candidate.exists():
+                working_file = candidate
+
+        with tracer.span("git.db_diff", "git", file=path_in_repo):
+            head_blob = self.get_head_blob(path_in_repo)
+            return diff_db_file(head_blob, str(working_file) if working_file.exists() else None)
+
     def commit_selected_files(self, selected_files: List[str], commit_message: str, target_branch: str = None) -> bool:
         """선택된 파일들만 커밋 및 푸시 (개선된 버전)"""
         try:
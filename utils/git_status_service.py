@@ -0,0 +1,313 @@
+"""
+Git 상태 캐시 서비스 (브랜치 / porcelain 상태 / ahead·behind / 브랜치 목록)
+
+UI 갱신마다 git 프로세스를 여러 번 띄우지 않도록 결과를 캐시합니다.
+
+- 현재 브랜치: .git/HEAD 를 직접 읽음 (프로세스 실행 없음)
+- 상태: `git status --porcelain=v2 -z --branch --untracked-files=all` 한 번으로
+  브랜치, upstream, ahead/behind, 변경 파일 목록을 함께 가져옴 (-z 출력이라 경로 인용/이스케이프 없음)
+- 브랜치 목록: `git for-each-ref` 한 번
+- 무효화: git 메타데이터(HEAD, index, refs, packed-refs)와 감시 경로(history 등)의 파일 시각/크기 서명이
+  바뀌었거나, invalidate() 호출, 또는 GIT_STATUS_CACHE_TTL_SEC 경과 (외부 편집 대비)
+
+Windows에서는 git 실행 한 번에 수십~수백 ms가 걸리므로 서명 비교(stat)만으로 캐시 적중 여부를 판단합니다.
+"""
+
+import os
+import time
+import logging
+import subprocess
+import threading
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+# 계측 (비활성화 시 no-op)
+from core.tracing import tracer
+
+# 성능 설정 안전 import
+try:
+    from core.performance_settings import GIT_STATUS_CACHE_TTL_SEC
+except ImportError:
+    GIT_STATUS_CACHE_TTL_SEC = 10
+
+
+def find_git_dir(start: Path) -> Tuple[Optional[Path], Optional[Path]]:
+    """
+    start부터 상위로 올라가며 작업 트리 루트와 .git 디렉토리 찾기
+
+    Returns:
+        (작업 트리 루트, git 디렉토리) - 없으면 (None, None)
+        .git 이 파일(worktree/submodule의 "gitdir: ...")이면 가리키는 디렉토리 사용
+    """
+    current = Path(start).resolve()
+    for directory in [current] + list(current.parents):
+        dot_git = directory / ".git"
+        if dot_git.is_dir():
+            return directory, dot_git
+        if dot_git.is_file():
+            try:
+                content = dot_git.read_text(encoding='utf-8').strip()
+            except OSError:
+                return None, None
+            if content.startswith("gitdir:"):
+                git_dir = Path(content[len("gitdir:"):].strip())
+                if not git_dir.is_absolute():
+                    git_dir = (directory / git_dir).resolve()
+                return directory, git_dir
+    return None, None
+
+
+def _tree_signature(path: Path) -> Tuple:
+    """디렉토리 아래 파일들의 (경로, 크기, 수정 시각) 서명 (없으면 빈 튜플)"""
+    entries = []
+    stack = [str(path)]
+    while stack:
+        current = stack.pop()
+        try:
+            with os.scandir(current) as it:
+                for entry in it:
+                    try:
+                        if entry.is_dir(follow_symlinks=False):
+                            stack.append(entry.path)
+                        else:
+                            stat = entry.stat(follow_symlinks=False)
+                            entries.append((entry.path, stat.st_size, stat.st_mtime_ns))
+                    except OSError:
+                        continue
+        except OSError:
+            continue
+    entries.sort()
+    return tuple(entries)
+
+
+def _file_signature(path: Path) -> Tuple:
+    try:
+        stat = path.stat()
+        return (stat.st_size, stat.st_mtime_ns)
+    except OSError:
+        return ()
+
+
+class GitStatusSnapshot:
+    """git status --porcelain=v2 결과"""
+
+    def __init__(self):
+        self.ok = False
+        self.oid = ""  # HEAD 커밋 (초기 상태면 빈 문자열)
+        self.branch = ""  # 현재 브랜치 (detached면 빈 문자열)
+        self.upstream = ""
+        self.ahead = 0
+        self.behind = 0
+        self.entries: List[Dict[str, str]] = []  # [{'status': v1 형식 XY, 'filename', 'orig_filename'}]
+        self.error = ""
+        self.taken_at = 0.0
+
+
+def parse_porcelain_v2(output: bytes) -> GitStatusSnapshot:
+    """`git status --porcelain=v2 -z --branch` 출력 파싱"""
+    snapshot = GitStatusSnapshot()
+    tokens = output.decode('utf-8', errors='replace').split('\0')
+    index = 0
+    while index < len(tokens):
+        record = tokens[index]
+        index += 1
+        if not record:
+            continue
+
+        if record.startswith('# '):
+            key, _, value = record[2:].partition(' ')
+            if key == 'branch.oid':
+                snapshot.oid = "" if value == '(initial)' else value
+            elif key == 'branch.head':
+                snapshot.branch = "" if value == '(detached)' else value
+            elif key == 'branch.upstream':
+                snapshot.upstream = value
+            elif key == 'branch.ab':
+                for part in value.split():
+                    if part.startswith('+'):
+                        snapshot.ahead = int(part[1:] or 0)
+                    elif part.startswith('-'):
+                        snapshot.behind = int(part[1:] or 0)
+            continue
+
+        kind = record[0]
+        if kind == '?':
+            snapshot.entries.append({'status': '??', 'filename': record[2:], 'orig_filename': ''})
+        elif kind == '1':
+            fields = record.split(' ', 8)
+            snapshot.entries.append({'status': fields[1].replace('.', ' '), 'filename': fields[8], 'orig_filename': ''})
+        elif kind == '2':
+            # 이름변경/복사: 원래 경로는 다음 NUL 토큰
+            fields = record.split(' ', 9)
+            orig = tokens[index] if index < len(tokens) else ''
+            index += 1
+            snapshot.entries.append({'status': fields[1].replace('.', ' '), 'filename': fields[9], 'orig_filename': orig})
+        elif kind == 'u':
+            fields = record.split(' ', 10)
+            snapshot.entries.append({'status': fields[1].replace('.', ' '), 'filename': fields[10], 'orig_filename': ''})
+        # '!' (무시된 파일)은 요청하지 않으므로 나오지 않음
+
+    snapshot.ok = True
+    return snapshot
+
+
+class GitStatusService:
+    """
+    저장소 하나의 Git 상태 캐시 (GitManager.status_service)
+
+    사용 예:
+        service = GitStatusService(git_executable, project_root, watch_paths=[history_dir])
+        branch = service.current_branch()
+        snapshot = service.status()
+    """
+
+    def __init__(self, git_executable: str, start_dir: Path, watch_paths: Optional[List[Path]] = None,
+                 ttl_sec: float = GIT_STATUS_CACHE_TTL_SEC):
+        self.git_executable = git_executable
+        self.root, self.git_dir = find_git_dir(start_dir)
+        self.watch_paths = [Path(p) for p in (watch_paths or [])]
+        self.ttl_sec = ttl_sec
+        self._lock = threading.Lock()
+        self._status: Optional[GitStatusSnapshot] = None
+        self._status_signature = None
+        self._branches: Optional[Dict] = None
+        self._refs_signature = None
+        self.spawn_count = 0
+
+        if self.root is None:
+            logging.warning(f"⚠ Git 저장소를 찾을 수 없음: {start_dir}")
+
+    @property
+    def available(self) -> bool:
+        return self.root is not None
+
+    def invalidate(self):
+        """다음 조회에서 git 상태를 다시 읽도록 캐시 폐기 (파일 변경 알림, 커밋/체크아웃 후 호출)"""
+        with self._lock:
+            self._status = None
+            self._branches = None
+
+    # ------------------------------------------------------------------
+    # 서명 (캐시 유효성)
+    # ------------------------------------------------------------------
+    def _refs_signature_now(self) -> Tuple:
+        git_dir = self.git_dir
+        return (_file_signature(git_dir / "HEAD"), _file_signature(git_dir / "packed-refs"),
+                _tree_signature(git_dir / "refs" / "heads"), _tree_signature(git_dir / "refs" / "remotes"))
+
+    def _status_signature_now(self) -> Tuple:
+        return (self._refs_signature_now(), _file_signature(self.git_dir / "index"),
+                tuple(_tree_signature(p) if p.is_dir() else _file_signature(p) for p in self.watch_paths))
+
+    def _run_git(self, args: List[str], timeout: int = 30) -> subprocess.CompletedProcess:
+        self.spawn_count += 1
+        command = next((arg for arg in args if not arg.startswith('-') and '=' not in arg), "git")
+        with tracer.span("git." + command, "git"):
+            return subprocess.run([self.git_executable] + args, cwd=str(self.root), capture_output=True, timeout=timeout)
+
+    # ------------------------------------------------------------------
+    # 조회
+    # ------------------------------------------------------------------
+    def current_branch(self) -> str:
+        """현재 브랜치 이름 (.git/HEAD 직접 읽기, detached면 빈 문자열)"""
+        if self.git_dir is None:
+            return ""
+        try:
+            head = (self.git_dir / "HEAD").read_text(encoding='utf-8').strip()
+        except OSError:
+            return self.status().branch
+        if head.startswith("ref:"):
+            ref = head[len("ref:"):].strip()
+            return ref[len("refs/heads/"):] if ref.startswith("refs/heads/") else ref
+        return ""
+
+    def status(self, force: bool = False) -> GitStatusSnapshot:
+        """브랜치/upstream/ahead·behind/변경 파일 (캐시 유효하면 git 실행 없음)"""
+        if self.root is None:
+            snapshot = GitStatusSnapshot()
+            snapshot.error = "Git 저장소 없음"
+            return snapshot
+
+        signature = self._status_signature_now()
+        with self._lock:
+            cached = self._status
+            if (not force and cached is not None and signature == self._status_signature
+                    and time.time() - cached.taken_at < self.ttl_sec):
+                tracer.count("git_status_cache.hits")
+                return cached
+        tracer.count("git_status_cache.misses")
+
+        try:
+            result = self._run_git(['-c', 'core.quotepath=false', 'status', '--porcelain=v2', '-z', '--branch',
+                                    '--untracked-files=all'])
+            if result.returncode != 0:
+                snapshot = GitStatusSnapshot()
+                snapshot.error = result.stderr.decode('utf-8', errors='replace').strip()
+                logging.warning(f"⚠ git status 실패: {snapshot.error}")
+            else:
+                snapshot = parse_porcelain_v2(result.stdout)
+        except (OSError, subprocess.SubprocessError) as e:
+            snapshot = GitStatusSnapshot()
+            snapshot.error = str(e)
+            logging.warning(f"⚠ git status 실행 실패: {e}")
+
+        snapshot.taken_at = time.time()
+        with self._lock:
+            self._status = snapshot
+            # git status가 index를 갱신할 수 있으므로 실행 후 서명 기준으로 저장
+            self._status_signature = self._status_signature_now()
+        return snapshot
+
+    def cached_status(self) -> Optional[GitStatusSnapshot]:
+        """마지막 조회 결과 (git 실행 없음, 아직 조회하지 않았거나 폐기되었으면 None)"""
+        with self._lock:
+            return self._status
+
+    def branches(self, force: bool = False) -> Dict:
+        """
+        로컬/원격 브랜치 목록 (GitManager.get_all_branches 형식)
+
+        Returns:
+            {'local': [이름], 'remote': [{'name', 'remote', 'display', 'full_name'}], 'current': 이름}
+        """
+        current = self.current_branch()
+        if self.root is None:
+            return {'local': [], 'remote': [], 'current': current}
+
+        signature = self._refs_signature_now()
+        with self._lock:
+            if not force and self._branches is not None and signature == self._refs_signature:
+                tracer.count("git_refs_cache.hits")
+                return dict(self._branches, current=current)
+        tracer.count("git_refs_cache.misses")
+
+        branches = {'local': [], 'remote': [], 'current': current}
+        try:
+            result = self._run_git(['for-each-ref', '--format=%(refname)', 'refs/heads', 'refs/remotes'])
+            if result.returncode == 0:
+                for refname in result.stdout.decode('utf-8', errors='replace').splitlines():
+                    if refname.startswith('refs/heads/'):
+                        name = refname[len('refs/heads/'):]
+                        if name not in branches['local']:
+                            branches['local'].append(name)
+                    elif refname.startswith('refs/remotes/'):
+                        full_name = refname[len('refs/remotes/'):]
+                        remote_name, _, remote_branch = full_name.partition('/')
+                        # HEAD 같은 특별한 참조 제거
+                        if not remote_branch or remote_branch == 'HEAD':
+                            continue
+                        branches['remote'].append({
+                            'name': remote_branch,
+                            'remote': remote_name,
+                            'display': f"{remote_branch} ({remote_name})",
+                            'full_name': full_name
+                        })
+            else:
+                logging.warning(f"⚠ git for-each-ref 실패: {result.stderr.decode('utf-8', errors='replace').strip()}")
+        except (OSError, subprocess.SubprocessError) as e:
+            logging.warning(f"⚠ git for-each-ref 실행 실패: {e}")
+
+        with self._lock:
+            self._branches = branches
+            self._refs_signature = signature
+        return dict(branches)